@@ -27,7 +27,7 @@ SOFTWARE.
 #include <kegwebhandler.hpp>
 #include <main.hpp>
 #include <ota.hpp>
-#include <perf.hpp>
+#include <perfstats.hpp>
 #include <scale.hpp>
 #include <serialws.hpp>
 #include <temp_mgr.hpp>
@@ -121,14 +121,6 @@ void loop() {
     loopMillis = millis();
     loopCounter++;
 
-    // Try to reconnect to scales if they are missing (6 seconds)
-    if (!(loopCounter % 3)) {
-      if (!myScale.isConnected(UnitIndex::U1) ||
-          !myScale.isConnected(UnitIndex::U2)) {
-        myScale.setup();  // Try to reconnect to scale
-      }
-    }
-
     // The temp sensor should not be read too often. Reading every 4 seconds.
     if (!(loopCounter % 1)) {
       myTemp.read();
@@ -0,0 +1,83 @@
+# Decoder for raw capture files recorded with /api/capture/start and downloaded
+# from http://<device>/capture. Writes the same csv columns as export.py.
+#
+# python capture.py capture.bin [capture.csv] [--raw]
+
+import struct
+import sys
+
+HEADER = "<4sB3xiiffI"
+
+
+def read_varint(data, pos):
+    result = 0
+    shift = 0
+    while True:
+        b = data[pos]
+        pos += 1
+        result |= (b & 0x7F) << shift
+        if not (b & 0x80):
+            return result, pos
+        shift += 7
+
+
+def zigzag_decode(v):
+    return (v >> 1) ^ -(v & 1)
+
+
+def decode(data):
+    magic, version, offset1, offset2, factor1, factor2, duration = struct.unpack_from(HEADER, data, 0)
+
+    if magic != b"KCAP" or version != 1:
+        raise ValueError("Not a capture file or unsupported version")
+
+    pos = struct.calcsize(HEADER)
+    offsets = (offset1, offset2)
+    factors = (factor1, factor2)
+    last = [0, 0, 0]
+    time = 0
+
+    while pos < len(data):
+        tag, pos = read_varint(data, pos)
+        delta, pos = read_varint(data, pos)
+        channel = tag & 0x03
+        time += tag >> 2
+        last[channel] += zigzag_decode(delta)
+        yield time, channel, last[channel], offsets, factors
+
+
+if __name__ == "__main__":
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    raw = "--raw" in sys.argv
+
+    if len(args) < 1:
+        print("Usage: capture.py capture.bin [capture.csv] [--raw]")
+        sys.exit(1)
+
+    inName = args[0]
+    csvOutName = args[1] if len(args) > 1 else "capture.csv"
+
+    with open(inName, "rb") as f:
+        data = f.read()
+
+    values = ["", ""]
+    temp = ""
+    rows = 0
+
+    with open(csvOutName, "w") as csvOut:
+        csvOut.write("time,level-raw1,level-raw2,tempC\n")
+
+        for time, channel, value, offsets, factors in decode(data):
+            if channel == 2:
+                temp = str(value / 100)
+                continue
+
+            if raw:
+                values[channel] = str(value)
+            elif factors[channel] != 0:
+                values[channel] = str(round((value - offsets[channel]) / factors[channel], 6))
+
+            csvOut.write(str(time / 1000) + "," + values[0] + "," + values[1] + "," + temp + "\n")
+            rows += 1
+
+    print("Wrote " + str(rows) + " rows to " + csvOutName)
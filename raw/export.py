@@ -1,8 +1,10 @@
 # Install influx client library for python
 # pip install influxdb-client
+#
+# python export.py                  - Export data from influxdb
+# python export.py --csv data.csv   - Convert a csv (export.py or capture.py)
 
-import influxdb_client
-from influxdb_client.client.write_api import SYNCHRONOUS
+import sys
 
 bucket = ""
 org = ""
@@ -11,18 +13,87 @@ url=""
 cppOutName = "simulated.hpp"
 csvOutName = "simulated.csv"
 interval = 0 # Will skip this amount of values, needed if the data is too much for the arduino
+channels = 2 # Number of scale columns to include in the trace (1 or 2)
+weightScale = 1000 # Fixed point resolution, units per kg (1 g)
+tempScale = 100 # Fixed point resolution, units per C (0.01 C)
 
-if __name__ == "__main__":
-    print("Influx data export converter")
+def varint(v):
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+    return out
+
+def zigzag(v):
+    return (v << 1) ^ (v >> 31)
+
+def encode(records):
+    # Records are (scale1, scale2, temp), see raw/trace.hpp for the format
+    data = bytearray()
+    last = [0, 0, 0]
+
+    for r in records:
+        v = [round(r[0] * weightScale), round(r[1] * weightScale), round(r[2] * tempScale)]
+        d1 = zigzag(v[0] - last[0])
+        d2 = zigzag(v[1] - last[1])
+        tempChanged = 1 if v[2] != last[2] else 0
+
+        if channels > 1 and d1 < 8 and d2 < 8:
+            data.append((d1 << 4) | (d2 << 1) | tempChanged)
+        elif channels == 1 and d1 < 64:
+            data.append((d1 << 1) | tempChanged)
+        else:
+            data.append(0x80 | tempChanged)
+            data += varint(d1)
+            if channels > 1:
+                data += varint(d2)
+
+        if tempChanged:
+            data += varint(zigzag(v[2] - last[2]))
+        last = v
+
+    return data
+
+def writeCpp(name, records):
+    data = encode(records)
+
+    cppOut = open(name, "w")
+    cppOut.write("// Generated by data converter, " + str(len(records)) + " records in " + str(len(data)) + " bytes.\n")
+    cppOut.write("// Decode with SimulatedTrace (raw/trace.hpp).\n")
+    cppOut.write("constexpr auto SIMULATED_COUNT = " + str(len(records)) + ";\n")
+    cppOut.write("constexpr auto SIMULATED_CHANNELS = " + str(channels) + ";\n")
+    cppOut.write("constexpr auto SIMULATED_WEIGHT_SCALE = " + str(weightScale) + ";\n")
+    cppOut.write("constexpr auto SIMULATED_TEMP_SCALE = " + str(tempScale) + ";\n\n")
+    cppOut.write("const uint8_t simulatedData[] PROGMEM = {\n")
+
+    for i in range(0, len(data), 16):
+        cppOut.write(",".join("0x%02x" % b for b in data[i:i+16]) + ",\n")
+
+    cppOut.write("};\n\n")
+    cppOut.write("// EOF\n")
+    cppOut.close()
+
+    print("Wrote " + str(len(records)) + " records, " + str(len(data)) + " bytes (" + str(round(len(data) / len(records), 2)) + " bytes/record)")
+
+def readCsv(name):
+    import csv
+
+    records = []
+    with open(name) as f:
+        for row in csv.DictReader(f):
+            if row["tempC"] == "" or row["level-raw1"] == "": # Ignore incomplete rows
+                continue
+            s2 = row["level-raw2"] if row["level-raw2"] != "" else "0"
+            records.append((float(row["level-raw1"]), float(s2), float(row["tempC"])))
+    return records
+
+def readInflux():
+    import influxdb_client
 
     client = influxdb_client.InfluxDBClient(url=url,token=token,org=org)
     query_api = client.query_api()
 
-    cppOut = open( cppOutName, "w")
-    cppOut.write("// Generated by data converter.\n")
-    cppOut.write("struct ScaleRecord { float scale1; float scale2; float temp; };\n\n");
-    cppOut.write("const ScaleRecord simulatedData [] PROGMEM = {\n")
-
     csvOut = open( csvOutName, "w")
     csvOut.write("time,level-raw1,level-raw2,tempC\n")
 
@@ -34,6 +105,7 @@ if __name__ == "__main__":
         |> filter(fn: (r) => r["_field"] == "level-raw2" or r["_field"] == "level-raw1" or r["_field"] == "tempC")\
         |> pivot(rowKey: ["_time"], columnKey: ["_field"], valueColumn: "_value")'
 
+    records = []
     cnt = 0
     line = 0
     result = query_api.query(org=org, query=query)
@@ -44,7 +116,7 @@ if __name__ == "__main__":
 
             if record.values.get("tempC") != None: # Ignore values without temp data
                 if cnt >= interval:
-                    cppOut.write("{ " + str(record.values.get("level-raw1")) + ", " + str(record.values.get("level-raw2")) + ", " + str(record.values.get("tempC")) + " },\n")
+                    records.append((record.values.get("level-raw1"), record.values.get("level-raw2"), record.values.get("tempC")))
                     csvOut.write(record.get_time().isoformat() + "," + str(record.values.get("level-raw1")) + "," + str(record.values.get("level-raw2")) + "," + str(record.values.get("tempC")) + "\n")
                     cnt = 0
                     print(".", end="\r")
@@ -54,8 +126,15 @@ if __name__ == "__main__":
                 print("Missing temperature data")
 
     print("")
-    cppOut.write( "{ -1.0, -1.0, -1.0 } };\n\n") # Mark end of data structure
-    cppOut.write( "// EOF\n")
-    cppOut.close()
-
     csvOut.close()
+    return records
+
+if __name__ == "__main__":
+    print("Influx data export converter")
+
+    if len(sys.argv) > 2 and sys.argv[1] == "--csv":
+        records = readCsv(sys.argv[2])
+    else:
+        records = readInflux()
+
+    writeCpp(cppOutName, records)
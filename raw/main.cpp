@@ -24,13 +24,16 @@ SOFTWARE.
 #include <display.hpp>
 #include <kegconfig.hpp>
 #include <kegpush.hpp>
+#include <lineprotocol.hpp>
 #include <main.hpp>
 #include <ota.hpp>
 #include <scale.hpp>
+#include <scale_replay.hpp>
 #include <temp_mgr.hpp>
 #include <utils.hpp>
 #include <wificonnection.hpp>
 #include "simulated.hpp"
+#include "trace.hpp"
 
 SerialDebug mySerial(115200L);
 KegConfig myConfig(CFG_MDNSNAME, CFG_FILENAME);
@@ -40,6 +43,12 @@ KegPushHandler myPush(&myConfig);
 Display myDisplay;
 TempSensorManager myTemp;
 LevelDetection myLevelDetection;
+Scale myScale;
+
+// Column 1 = scale2 in the recorded data
+SimulatedTrace simulatedTrace(simulatedData, sizeof(simulatedData),
+                              SIMULATED_COUNT, SIMULATED_CHANNELS,
+                              SIMULATED_WEIGHT_SCALE, SIMULATED_TEMP_SCALE, 1);
 
 void setup() {
   Log.notice(F("Level detection simulator" CR));
@@ -63,6 +72,13 @@ void setup() {
   myConfig.setScaleTempCompensationFormula(UnitIndex::U1, formula);
   myConfig.setScaleTempCompensationFormula(UnitIndex::U2, formula);
 
+  // Feed the recorded trace through the scale so the complete acquisition path
+  // is used. The trace is already in kg so factor/offset are just placeholders.
+  myConfig.setScaleSensorType(UnitIndex::U1, ScaleSensorType::ScaleReplay);
+  myConfig.setScaleFactor(UnitIndex::U1, 1);
+  myConfig.setScaleOffset(UnitIndex::U1, 1);
+  myScale.setDriver(UnitIndex::U1, new ScaleDriverReplay(&simulatedTrace));
+
   if (!myWifi.hasConfig() || myWifi.isDoubleResetDetected()) {
     Log.notice(
         F("Main: Missing wifi config or double reset detected, entering wifi "
@@ -91,6 +107,11 @@ void setup() {
 }
 
 int simulatedIndex = 0;
+uint32_t simulatedReadTime = 0;    // Time spent decoding + scale read (us)
+uint32_t simulatedUpdateTime = 0;  // Time spent in level detection (us)
+bool simulatedReported = false;
+uint32_t simulatedPours = 0;
+uint32_t simulatedStables = 0;
 // int simulatedDelay = 1000;
 // int simulatedDelay = 500;
 // int simulatedDelay = 200;
@@ -101,13 +122,32 @@ void loop() {
   if (!myWifi.isConnected()) myWifi.connect();
 
   myWifi.loop();
+  myPush.loop();
 
-  if (simulatedData[simulatedIndex].scale1 > 0.0) {
-    float t = simulatedData[simulatedIndex].temp; 
-    // float v = simulatedData[simulatedIndex].scale1; 
-    float v = simulatedData[simulatedIndex].scale2; 
+  if (!simulatedTrace.isDone()) {
+    uint32_t start = micros();
+    float v = myScale.read(UnitIndex::U1);
+    float t = simulatedTrace.getTemp();
+    simulatedReadTime += micros() - start;
 
+    start = micros();
     myLevelDetection.update(UnitIndex::U1, v, t);
+    simulatedUpdateTime += micros() - start;
+
+    if (myLevelDetection.getPourCount(UnitIndex::U1) != simulatedPours) {
+      simulatedPours = myLevelDetection.getPourCount(UnitIndex::U1);
+      myLevelDetection.pushPourUpdate(
+          UnitIndex::U1, myLevelDetection.getBeerStableVolume(UnitIndex::U1),
+          myLevelDetection.getPourVolume(UnitIndex::U1));
+    }
+
+    if (myLevelDetection.getStableCount(UnitIndex::U1) != simulatedStables) {
+      simulatedStables = myLevelDetection.getStableCount(UnitIndex::U1);
+      myLevelDetection.pushKegUpdate(
+          UnitIndex::U1, myLevelDetection.getBeerStableVolume(UnitIndex::U1),
+          myLevelDetection.getPourVolume(UnitIndex::U1),
+          myLevelDetection.getNoStableGlasses(UnitIndex::U1));
+    }
 
     Log.verbose(
         F("LOOP: Input: %F, output: raw1=%F,stable1=%F"
@@ -119,75 +159,38 @@ void loop() {
 
 #if defined(ENABLE_INFLUX_DEBUG)
     // This part is used to send data to an influxdb in order to get data on
-    // scale stability/drift over time.
-    char buf[250];
-
-    float raw1 = myLevelDetection.getRawDetection(UnitIndex::U1)->getRawValue();
-
-    String s;
-    snprintf(&buf[0], sizeof(buf),
-             "simulate,host=%s,device=%s "
-             "level-raw1=%f,temp=%f",
-             myConfig.getMDNS(), myConfig.getID(), isnan(raw1) ? 0 : raw1, t);
-    s = &buf[0];
-
-    float ave1 =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getAverageValue();
-
-    if (!isnan(ave1)) {
-      snprintf(&buf[0], sizeof(buf), ",level-average1=%f",
-              isnan(ave1) ? 0 : ave1);
-      s += &buf[0];
-    }
-
-    float kal1 = myLevelDetection.getRawDetection(UnitIndex::U1)->getKalmanValue();
-
-    if (kal1 > 0.1  && !isnan(kal1)) {
-      snprintf(&buf[0], sizeof(buf), ",level-kalman1=%f",
-              isnan(kal1) ? 0 : kal1);
-      s += &buf[0];
-    }
-
+    // scale stability/drift over time. The simulated samples come faster than
+    // once per second so each one is posted on its own and gets the server
+    // time.
+    char buf[300];
+    LineProtocol lp(&buf[0], sizeof(buf));
+    RawLevelDetection* raw = myLevelDetection.getRawDetection(UnitIndex::U1);
+    float kal1 = raw->getKalmanValue();
     float stats1 =
         myLevelDetection.getStatsDetection(UnitIndex::U1)->getStableValue();
+    float temp1 = raw->getTempCorrValue();
 
-    if( stats1 > 0  && !isnan(stats1)) { // Skip the 0 values to make focus the scale in influx.
-      snprintf(&buf[0], sizeof(buf), ",level-stats1=%f",
-              isnan(stats1) ? 0 : stats1);
-      s += &buf[0];
-    }
-
-    float temp1 =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getTempCorrValue();
-
-    if( temp1 > 0 && !isnan(temp1)) { // Skip the 0 values to make focus the scale in influx.
-      snprintf(&buf[0], sizeof(buf), ",level-temp1=%f",
-              isnan(temp1) ? 0 : temp1);
-      s += &buf[0];
-    }
-
-    float slope1 =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getSlopeValue();
-
-    if(!isnan(slope1)) { 
-      snprintf(&buf[0], sizeof(buf), ",level-slope1=%f",
-              isnan(slope1) ? 0 : slope1);
-      s += &buf[0];
-    }
+    lp.beginLine("simulate");
+    lp.tag("host", myConfig.getMDNS());
+    lp.tag("device", myConfig.getID());
+    lp.field("level-raw1", isnan(raw->getRawValue()) ? 0 : raw->getRawValue());
+    lp.field("temp", t);
+    lp.field("level-average1", raw->getAverageValue());
 
-    float tempCorr1 =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getTempCorrValue();
+    // Skip the 0 values to make focus the scale in influx.
+    if (kal1 > 0.1) lp.field("level-kalman1", kal1);
+    if (stats1 > 0) lp.field("level-stats1", stats1);
+    if (temp1 > 0) lp.field("level-temp1", temp1);
 
-    if(!isnan(tempCorr1)) { 
-      snprintf(&buf[0], sizeof(buf), ",level-temp=%f",
-              isnan(tempCorr1) ? 0 : tempCorr1);
-      s += &buf[0];
-    }
+    lp.field("level-slope1", raw->getSlopeValue(), 5);
+    lp.field("level-temp", temp1);
+    lp.endLine();
 
-    Log.verbose(F("%s" CR), s.c_str());
+    Log.verbose(F("%s" CR), lp.c_str());
 
     // Change loglevel to avoid filling console with trace information
     Log.setLevel(LOG_LEVEL_WARNING);
+    String s(lp.c_str());
     myPush.sendInfluxDb2(s, PUSH_INFLUX_TARGET, PUSH_INFLUX_ORG,
                          PUSH_INFLUX_BUCKET, PUSH_INFLUX_TOKEN);
     Log.setLevel(LOG_LEVEL);
@@ -196,6 +199,13 @@ void loop() {
     simulatedIndex++;
     delay(simulatedDelay);
   } else {
+    if (!simulatedReported && simulatedIndex) {
+      Log.notice(F("LOOP: Processed %d values, average %l us read and %l us "
+                   "level detection per value." CR),
+                 simulatedIndex, simulatedReadTime / simulatedIndex,
+                 simulatedUpdateTime / simulatedIndex);
+      simulatedReported = true;
+    }
     myDisplay.clear(UnitIndex::U1);
     myDisplay.setFont(UnitIndex::U1, FontSize::FONT_10);
     myDisplay.printLineCentered(UnitIndex::U1, 0, "Done");
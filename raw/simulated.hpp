@@ -1,5360 +1,361 @@
-// Generated by data converter.
-struct ScaleRecord { float scale1; float scale2; float temp; };
+// Generated by data converter, 5353 records in 5588 bytes.
+// Decode with SimulatedTrace (raw/trace.hpp).
+constexpr auto SIMULATED_COUNT = 5353;
+constexpr auto SIMULATED_CHANNELS = 2;
+constexpr auto SIMULATED_WEIGHT_SCALE = 1000;
+constexpr auto SIMULATED_TEMP_SCALE = 100;
 
-const ScaleRecord simulatedData [] PROGMEM = {
-{ 20.153151, 13.446844, 3.6 },
-{ 20.152193, 13.447708, 3.6 },
-{ 20.153833, 13.447189, 3.6 },
-{ 20.151875, 13.447838, 3.6 },
-{ 20.153423, 13.447708, 3.6 },
-{ 20.154289, 13.447838, 3.6 },
-{ 20.154564, 13.448313, 3.6 },
-{ 20.152239, 13.447276, 3.6 },
-{ 20.15192, 13.447017, 3.6 },
-{ 20.154016, 13.447362, 3.6 },
-{ 20.154974, 13.446542, 3.6 },
-{ 20.154289, 13.445894, 3.6 },
-{ 20.153013, 13.448226, 3.6 },
-{ 20.152695, 13.447708, 3.6 },
-{ 20.153242, 13.447881, 3.6 },
-{ 20.151464, 13.446283, 3.6 },
-{ 20.152285, 13.448788, 3.6 },
-{ 20.153423, 13.447233, 3.6 },
-{ 20.15274, 13.446154, 3.6 },
-{ 20.15274, 13.448183, 3.6 },
-{ 20.152603, 13.446542, 3.6 },
-{ 20.153288, 13.446974, 3.6 },
-{ 20.153833, 13.446067, 3.6 },
-{ 20.153332, 13.447449, 3.6 },
-{ 20.15192, 13.447708, 3.6 },
-{ 20.153059, 13.446974, 3.6 },
-{ 20.153288, 13.445851, 3.6 },
-{ 20.153515, 13.44896, 3.6 },
-{ 20.153242, 13.447578, 3.6 },
-{ 20.152557, 13.447924, 3.6 },
-{ 20.153652, 13.446369, 3.6 },
-{ 20.151737, 13.446887, 3.6 },
-{ 20.153196, 13.446758, 3.6 },
-{ 20.153059, 13.447536, 3.6 },
-{ 20.152695, 13.446326, 3.6 },
-{ 20.152832, 13.446499, 3.6 },
-{ 20.152786, 13.447319, 3.6 },
-{ 20.152786, 13.448096, 3.6 },
-{ 20.153013, 13.447708, 3.6 },
-{ 20.15192, 13.448313, 3.6 },
-{ 20.153151, 13.447061, 3.6 },
-{ 20.153332, 13.447794, 3.6 },
-{ 20.153332, 13.448571, 3.6 },
-{ 20.153925, 13.446887, 3.6 },
-{ 20.152786, 13.446714, 3.6 },
-{ 20.153378, 13.447406, 3.6 },
-{ 20.152102, 13.447406, 3.6 },
-{ 20.151419, 13.446801, 3.6 },
-{ 20.152512, 13.445808, 3.6 },
-{ 20.152603, 13.446801, 3.6 },
-{ 20.151554, 13.447017, 3.6 },
-{ 20.151783, 13.447708, 3.6 },
-{ 20.150734, 13.448053, 3.6 },
-{ 20.1516, 13.448485, 3.6 },
-{ 20.150826, 13.446412, 3.6 },
-{ 20.152967, 13.448053, 3.6 },
-{ 20.153606, 13.448614, 3.6 },
-{ 20.153013, 13.447017, 3.6 },
-{ 20.152557, 13.447017, 3.6 },
-{ 20.152922, 13.445894, 3.6 },
-{ 20.152466, 13.448614, 3.6 },
-{ 20.153196, 13.446197, 3.6 },
-{ 20.151464, 13.447967, 3.6 },
-{ 20.15119, 13.446369, 3.6 },
-{ 20.152786, 13.446412, 3.6 },
-{ 20.152466, 13.447492, 3.6 },
-{ 20.153606, 13.448571, 3.7 },
-{ 20.152285, 13.447146, 3.7 },
-{ 20.151144, 13.445549, 3.7 },
-{ 20.15233, 13.446671, 3.7 },
-{ 20.15201, 13.447881, 3.7 },
-{ 20.15274, 13.446887, 3.6 },
-{ 20.153469, 13.448226, 3.6 },
-{ 20.15242, 13.447276, 3.6 },
-{ 20.151464, 13.447492, 3.6 },
-{ 20.152102, 13.448269, 3.6 },
-{ 20.152922, 13.44801, 3.6 },
-{ 20.151646, 13.447664, 3.6 },
-{ 20.152512, 13.446154, 3.6 },
-{ 20.15242, 13.447146, 3.6 },
-{ 20.152285, 13.448183, 3.6 },
-{ 20.152193, 13.447621, 3.6 },
-{ 20.151783, 13.447406, 3.6 },
-{ 20.153515, 13.447838, 3.6 },
-{ 20.150642, 13.446024, 3.6 },
-{ 20.153925, 13.448139, 3.6 },
-{ 20.151508, 13.449046, 3.6 },
-{ 20.153196, 13.447233, 3.6 },
-{ 20.152466, 13.448614, 3.6 },
-{ 20.15192, 13.446456, 3.6 },
-{ 20.152786, 13.447664, 3.6 },
-{ 20.152695, 13.446671, 3.6 },
-{ 20.15192, 13.447924, 3.6 },
-{ 20.15233, 13.447406, 3.6 },
-{ 20.153013, 13.446412, 3.6 },
-{ 20.151373, 13.44801, 3.6 },
-{ 20.151419, 13.447104, 3.6 },
-{ 20.15274, 13.447881, 3.6 },
-{ 20.151783, 13.447881, 3.6 },
-{ 20.153606, 13.448658, 3.6 },
-{ 20.152056, 13.448571, 3.6 },
-{ 20.15119, 13.448356, 3.6 },
-{ 20.152147, 13.448053, 3.6 },
-{ 20.152876, 13.447362, 3.6 },
-{ 20.15242, 13.447146, 3.6 },
-{ 20.151054, 13.446239, 3.6 },
-{ 20.152603, 13.447536, 3.7 },
-{ 20.15192, 13.447924, 3.7 },
-{ 20.152876, 13.44801, 3.7 },
-{ 20.151875, 13.447017, 3.7 },
-{ 20.150599, 13.448183, 3.7 },
-{ 20.15242, 13.446369, 3.7 },
-{ 20.150005, 13.448442, 3.7 },
-{ 20.15242, 13.447536, 3.7 },
-{ 20.151009, 13.448744, 3.7 },
-{ 20.152376, 13.445722, 3.7 },
-{ 20.15037, 13.448744, 3.7 },
-{ 20.152466, 13.449348, 3.7 },
-{ 20.152649, 13.44896, 3.7 },
-{ 20.15242, 13.447536, 3.7 },
-{ 20.149641, 13.44801, 3.7 },
-{ 20.153196, 13.447881, 3.7 },
-{ 20.15119, 13.447276, 3.7 },
-{ 20.150642, 13.447233, 3.7 },
-{ 20.151646, 13.447924, 3.7 },
-{ 20.153925, 13.446412, 3.7 },
-{ 20.153242, 13.447924, 3.7 },
-{ 20.151009, 13.447881, 3.7 },
-{ 20.152147, 13.447233, 3.7 },
-{ 20.151737, 13.446369, 3.7 },
-{ 20.153059, 13.447189, 3.7 },
-{ 20.152285, 13.448788, 3.7 },
-{ 20.150963, 13.447664, 3.7 },
-{ 20.153013, 13.446974, 3.7 },
-{ 20.152056, 13.447276, 3.7 },
-{ 20.150963, 13.448226, 3.7 },
-{ 20.153242, 13.449348, 3.7 },
-{ 20.150871, 13.447621, 3.7 },
-{ 20.152376, 13.446671, 3.7 },
-{ 20.151508, 13.447708, 3.7 },
-{ 20.15078, 13.447794, 3.7 },
-{ 20.151236, 13.448269, 3.6 },
-{ 20.152285, 13.446758, 3.6 },
-{ 20.151464, 13.448226, 3.6 },
-{ 20.151281, 13.448053, 3.6 },
-{ 20.154016, 13.446844, 3.6 },
-{ 20.152239, 13.44801, 3.7 },
-{ 20.153378, 13.448916, 3.7 },
-{ 20.151464, 13.448485, 3.7 },
-{ 20.150917, 13.448916, 3.7 },
-{ 20.15119, 13.450428, 3.7 },
-{ 20.152239, 13.448399, 3.7 },
-{ 20.153698, 13.448399, 3.7 },
-{ 20.15233, 13.448874, 3.7 },
-{ 20.152193, 13.449694, 3.7 },
-{ 20.150324, 13.449435, 3.7 },
-{ 20.153196, 13.44978, 3.7 },
-{ 20.15233, 13.448183, 3.7 },
-{ 20.151737, 13.449133, 3.7 },
-{ 20.152147, 13.449565, 3.7 },
-{ 20.151829, 13.44896, 3.7 },
-{ 20.150507, 13.448096, 3.7 },
-{ 20.153378, 13.448053, 3.7 },
-{ 20.150963, 13.447276, 3.7 },
-{ 20.152193, 13.447578, 3.7 },
-{ 20.151646, 13.447924, 3.7 },
-{ 20.152466, 13.447838, 3.7 },
-{ 20.151829, 13.44801, 3.7 },
-{ 20.150734, 13.449306, 3.7 },
-{ 20.152967, 13.450126, 3.7 },
-{ 20.152832, 13.448356, 3.7 },
-{ 20.150507, 13.447362, 3.7 },
-{ 20.153515, 13.447924, 3.7 },
-{ 20.152876, 13.447794, 3.7 },
-{ 20.150963, 13.447406, 3.7 },
-{ 20.151964, 13.447708, 3.7 },
-{ 20.151691, 13.447794, 3.7 },
-{ 20.151964, 13.448485, 3.7 },
-{ 20.151464, 13.448485, 3.7 },
-{ 20.152695, 13.447838, 3.7 },
-{ 20.153698, 13.448226, 3.7 },
-{ 20.151554, 13.449435, 3.7 },
-{ 20.152832, 13.449176, 3.7 },
-{ 20.152512, 13.449176, 3.7 },
-{ 20.154062, 13.450471, 3.7 },
-{ 20.151964, 13.447664, 3.7 },
-{ 20.151829, 13.447664, 3.7 },
-{ 20.15233, 13.447449, 3.7 },
-{ 20.152557, 13.44978, 3.7 },
-{ 20.152285, 13.447967, 3.7 },
-{ 20.152285, 13.448096, 3.7 },
-{ 20.15201, 13.449219, 3.7 },
-{ 20.151508, 13.44896, 3.7 },
-{ 20.152695, 13.448658, 3.7 },
-{ 20.153105, 13.447449, 3.7 },
-{ 20.151373, 13.448744, 3.7 },
-{ 20.151098, 13.450515, 3.7 },
-{ 20.152695, 13.448313, 3.7 },
-{ 20.153059, 13.448658, 3.7 },
-{ 20.151373, 13.448831, 3.7 },
-{ 20.152193, 13.44896, 3.7 },
-{ 20.151236, 13.449391, 3.7 },
-{ 20.152376, 13.449176, 3.7 },
-{ 20.151691, 13.449348, 3.7 },
-{ 20.151098, 13.448614, 3.7 },
-{ 20.152376, 13.449738, 3.7 },
-{ 20.153378, 13.449003, 3.7 },
-{ 20.152512, 13.448658, 3.7 },
-{ 20.151327, 13.449694, 3.7 },
-{ 20.152239, 13.448874, 3.7 },
-{ 20.150734, 13.45004, 3.7 },
-{ 20.151236, 13.449219, 3.7 },
-{ 20.153698, 13.449003, 3.7 },
-{ 20.152876, 13.449565, 3.7 },
-{ 20.151419, 13.450773, 3.7 },
-{ 20.153105, 13.447449, 3.7 },
-{ 20.152466, 13.449435, 3.7 },
-{ 20.151327, 13.448701, 3.7 },
-{ 20.153288, 13.449651, 3.7 },
-{ 20.153196, 13.447406, 3.7 },
-{ 20.153151, 13.450515, 3.7 },
-{ 20.153879, 13.449478, 3.7 },
-{ 20.151964, 13.449046, 3.7 },
-{ 20.151327, 13.447794, 3.7 },
-{ 20.152512, 13.450644, 3.7 },
-{ 20.151419, 13.448874, 3.7 },
-{ 20.152922, 13.45004, 3.7 },
-{ 20.152147, 13.448442, 3.7 },
-{ 20.152147, 13.449003, 3.7 },
-{ 20.151508, 13.450169, 3.7 },
-{ 20.153788, 13.448096, 3.7 },
-{ 20.152603, 13.448053, 3.7 },
-{ 20.151646, 13.447664, 3.7 },
-{ 20.153059, 13.448744, 3.7 },
-{ 20.151281, 13.449651, 3.7 },
-{ 20.15242, 13.448831, 3.7 },
-{ 20.152967, 13.449176, 3.7 },
-{ 20.152193, 13.45073, 3.7 },
-{ 20.151554, 13.44896, 3.7 },
-{ 20.152832, 13.450601, 3.7 },
-{ 20.153242, 13.449996, 3.7 },
-{ 20.152695, 13.450212, 3.7 },
-{ 20.153879, 13.448614, 3.7 },
-{ 20.15242, 13.449348, 3.7 },
-{ 20.151419, 13.450773, 3.7 },
-{ 20.15119, 13.450428, 3.7 },
-{ 20.151737, 13.449996, 3.7 },
-{ 20.151327, 13.448788, 3.7 },
-{ 20.152876, 13.449306, 3.7 },
-{ 20.151875, 13.449694, 3.7 },
-{ 20.153515, 13.449866, 3.7 },
-{ 20.152922, 13.450601, 3.7 },
-{ 20.153059, 13.449306, 3.7 },
-{ 20.15233, 13.450255, 3.7 },
-{ 20.15201, 13.45004, 3.7 },
-{ 20.15274, 13.449391, 3.7 },
-{ 20.152285, 13.449694, 3.7 },
-{ 20.152695, 13.451033, 3.7 },
-{ 20.153288, 13.448614, 3.7 },
-{ 20.152876, 13.449866, 3.7 },
-{ 20.152056, 13.449219, 3.7 },
-{ 20.150871, 13.448831, 3.7 },
-{ 20.152649, 13.448356, 3.7 },
-{ 20.1542, 13.449953, 3.7 },
-{ 20.152922, 13.449738, 3.7 },
-{ 20.152832, 13.448614, 3.7 },
-{ 20.15274, 13.448096, 3.7 },
-{ 20.152102, 13.45073, 3.7 },
-{ 20.152147, 13.449391, 3.7 },
-{ 20.152922, 13.44991, 3.7 },
-{ 20.154154, 13.449306, 3.7 },
-{ 20.151783, 13.450385, 3.7 },
-{ 20.151281, 13.450946, 3.7 },
-{ 20.152285, 13.450083, 3.7 },
-{ 20.152239, 13.448916, 3.7 },
-{ 20.152056, 13.451033, 3.7 },
-{ 20.151419, 13.450342, 3.7 },
-{ 20.152285, 13.448485, 3.7 },
-{ 20.152102, 13.449565, 3.7 },
-{ 20.151098, 13.450385, 3.7 },
-{ 20.153105, 13.44978, 3.7 },
-{ 20.15119, 13.449435, 3.7 },
-{ 20.152056, 13.450471, 3.7 },
-{ 20.152603, 13.449046, 3.7 },
-{ 20.150278, 13.449133, 3.7 },
-{ 20.15274, 13.449133, 3.7 },
-{ 20.151783, 13.450644, 3.7 },
-{ 20.151144, 13.44991, 3.7 },
-{ 20.151054, 13.450083, 3.7 },
-{ 20.152285, 13.449391, 3.7 },
-{ 20.151281, 13.45004, 3.7 },
-{ 20.152832, 13.450298, 3.7 },
-{ 20.152512, 13.450601, 3.7 },
-{ 20.153242, 13.450644, 3.7 },
-{ 20.153515, 13.451292, 3.7 },
-{ 20.152786, 13.450342, 3.7 },
-{ 20.151829, 13.451033, 3.7 },
-{ 20.152876, 13.450773, 3.7 },
-{ 20.153698, 13.450687, 3.7 },
-{ 20.151373, 13.450428, 3.7 },
-{ 20.151646, 13.449003, 3.7 },
-{ 20.15242, 13.450385, 3.8 },
-{ 20.15242, 13.449694, 3.8 },
-{ 20.153652, 13.449996, 3.8 },
-{ 20.153925, 13.450515, 3.8 },
-{ 20.152056, 13.450126, 3.8 },
-{ 20.152466, 13.451205, 3.7 },
-{ 20.152695, 13.450342, 3.7 },
-{ 20.152056, 13.450169, 3.7 },
-{ 20.15502, 13.449694, 3.7 },
-{ 20.151737, 13.449176, 3.7 },
-{ 20.153606, 13.449391, 3.7 },
-{ 20.154016, 13.450817, 3.7 },
-{ 20.152239, 13.449435, 3.7 },
-{ 20.152466, 13.451162, 3.7 },
-{ 20.15242, 13.450773, 3.7 },
-{ 20.151646, 13.450558, 3.7 },
-{ 20.152466, 13.450946, 3.7 },
-{ 20.152285, 13.450903, 3.7 },
-{ 20.152786, 13.450169, 3.7 },
-{ 20.152876, 13.450687, 3.7 },
-{ 20.153606, 13.450515, 3.8 },
-{ 20.153833, 13.451982, 3.8 },
-{ 20.153515, 13.450471, 3.8 },
-{ 20.152922, 13.451767, 3.8 },
-{ 20.152603, 13.450255, 3.8 },
-{ 20.153013, 13.449521, 3.7 },
-{ 20.153105, 13.44991, 3.7 },
-{ 20.153332, 13.450212, 3.7 },
-{ 20.151783, 13.450903, 3.7 },
-{ 20.150917, 13.450817, 3.7 },
-{ 20.153151, 13.449478, 3.8 },
-{ 20.152557, 13.451118, 3.8 },
-{ 20.152557, 13.451594, 3.8 },
-{ 20.154427, 13.450644, 3.8 },
-{ 20.152376, 13.452155, 3.8 },
-{ 20.152649, 13.45073, 3.7 },
-{ 20.152466, 13.451508, 3.7 },
-{ 20.153378, 13.450687, 3.7 },
-{ 20.152102, 13.449608, 3.7 },
-{ 20.153059, 13.450428, 3.7 },
-{ 20.152512, 13.45099, 3.8 },
-{ 20.151829, 13.449953, 3.8 },
-{ 20.151646, 13.450428, 3.8 },
-{ 20.154289, 13.451421, 3.8 },
-{ 20.152557, 13.451421, 3.8 },
-{ 20.154243, 13.451723, 3.7 },
-{ 20.152786, 13.451292, 3.7 },
-{ 20.152056, 13.451335, 3.7 },
-{ 20.151964, 13.451378, 3.7 },
-{ 20.152376, 13.450601, 3.7 },
-{ 20.15233, 13.452847, 3.8 },
-{ 20.151419, 13.450126, 3.8 },
-{ 20.153652, 13.450169, 3.8 },
-{ 20.153788, 13.450083, 3.8 },
-{ 20.153332, 13.451378, 3.8 },
-{ 20.152649, 13.4525, 3.7 },
-{ 20.151783, 13.451248, 3.7 },
-{ 20.153652, 13.451378, 3.7 },
-{ 20.15233, 13.449866, 3.7 },
-{ 20.153059, 13.451594, 3.7 },
-{ 20.153833, 13.452025, 3.8 },
-{ 20.15242, 13.451335, 3.8 },
-{ 20.152056, 13.452155, 3.8 },
-{ 20.152512, 13.45155, 3.8 },
-{ 20.152147, 13.450385, 3.8 },
-{ 20.1516, 13.450773, 3.8 },
-{ 20.152239, 13.451594, 3.8 },
-{ 20.152695, 13.450515, 3.8 },
-{ 20.152603, 13.45181, 3.8 },
-{ 20.151875, 13.452673, 3.8 },
-{ 20.153288, 13.451335, 3.8 },
-{ 20.153652, 13.451335, 3.8 },
-{ 20.154837, 13.450644, 3.8 },
-{ 20.153606, 13.451118, 3.8 },
-{ 20.154289, 13.449391, 3.8 },
-{ 20.153698, 13.450385, 3.8 },
-{ 20.15233, 13.451292, 3.8 },
-{ 20.151646, 13.453364, 3.8 },
-{ 20.15274, 13.45086, 3.8 },
-{ 20.152557, 13.451292, 3.8 },
-{ 20.153469, 13.452847, 3.8 },
-{ 20.152512, 13.451421, 3.8 },
-{ 20.153744, 13.450169, 3.8 },
-{ 20.152102, 13.452415, 3.8 },
-{ 20.151236, 13.452544, 3.8 },
-{ 20.151691, 13.450817, 3.8 },
-{ 20.153059, 13.452025, 3.8 },
-{ 20.154289, 13.450558, 3.8 },
-{ 20.152102, 13.450515, 3.8 },
-{ 20.152786, 13.45155, 3.8 },
-{ 20.15242, 13.452069, 3.8 },
-{ 20.151464, 13.452803, 3.8 },
-{ 20.153196, 13.450946, 3.8 },
-{ 20.153833, 13.451853, 3.8 },
-{ 20.153151, 13.45263, 3.8 },
-{ 20.153105, 13.451853, 3.8 },
-{ 20.154108, 13.451162, 3.8 },
-{ 20.154518, 13.450428, 3.8 },
-{ 20.154243, 13.451248, 3.8 },
-{ 20.152557, 13.452803, 3.8 },
-{ 20.153925, 13.452155, 3.8 },
-{ 20.154016, 13.451033, 3.8 },
-{ 20.153378, 13.45181, 3.8 },
-{ 20.15242, 13.452285, 3.8 },
-{ 20.152832, 13.452717, 3.8 },
-{ 20.152512, 13.451896, 3.8 },
-{ 20.153288, 13.453019, 3.8 },
-{ 20.154108, 13.452285, 3.8 },
-{ 20.152557, 13.45099, 3.8 },
-{ 20.153788, 13.450385, 3.8 },
-{ 20.153151, 13.451118, 3.8 },
-{ 20.153652, 13.449866, 3.8 },
-{ 20.153242, 13.451465, 3.8 },
-{ 20.152557, 13.452328, 3.8 },
-{ 20.152147, 13.450601, 3.8 },
-{ 20.153423, 13.453235, 3.8 },
-{ 20.154062, 13.45155, 3.8 },
-{ 20.154791, 13.451767, 3.8 },
-{ 20.153332, 13.452112, 3.8 },
-{ 20.152603, 13.451335, 3.8 },
-{ 20.153196, 13.451248, 3.8 },
-{ 20.15274, 13.452328, 3.8 },
-{ 20.1542, 13.452544, 3.8 },
-{ 20.152376, 13.450601, 3.8 },
-{ 20.151783, 13.4525, 3.8 },
-{ 20.154062, 13.453235, 3.8 },
-{ 20.152695, 13.451335, 3.8 },
-{ 20.153242, 13.452069, 3.8 },
-{ 20.153561, 13.45194, 3.8 },
-{ 20.153288, 13.451767, 3.8 },
-{ 20.152832, 13.45276, 3.8 },
-{ 20.152557, 13.451853, 3.8 },
-{ 20.153788, 13.451162, 3.8 },
-{ 20.151327, 13.452285, 3.8 },
-{ 20.153059, 13.45168, 3.8 },
-{ 20.153652, 13.453019, 3.8 },
-{ 20.153332, 13.451508, 3.8 },
-{ 20.154108, 13.452717, 3.8 },
-{ 20.153013, 13.45263, 3.8 },
-{ 20.154518, 13.450644, 3.8 },
-{ 20.152376, 13.450773, 3.8 },
-{ 20.152695, 13.453969, 3.8 },
-{ 20.152922, 13.450903, 3.8 },
-{ 20.153606, 13.451248, 3.8 },
-{ 20.152695, 13.453192, 3.8 },
-{ 20.153151, 13.452415, 3.8 },
-{ 20.152512, 13.452198, 3.8 },
-{ 20.152876, 13.45358, 3.8 },
-{ 20.153698, 13.451853, 3.8 },
-{ 20.15192, 13.45181, 3.8 },
-{ 20.152557, 13.45263, 3.8 },
-{ 20.153698, 13.451767, 3.8 },
-{ 20.152695, 13.451465, 3.8 },
-{ 20.154062, 13.450644, 3.8 },
-{ 20.153971, 13.451853, 3.8 },
-{ 20.153515, 13.451853, 3.8 },
-{ 20.152876, 13.450342, 3.8 },
-{ 20.153971, 13.451723, 3.8 },
-{ 20.153332, 13.45358, 3.8 },
-{ 20.15192, 13.451378, 3.8 },
-{ 20.152557, 13.45099, 3.8 },
-{ 20.154882, 13.452457, 3.8 },
-{ 20.152922, 13.451205, 3.8 },
-{ 20.152376, 13.452198, 3.8 },
-{ 20.152967, 13.450946, 3.8 },
-{ 20.151373, 13.451637, 3.8 },
-{ 20.152967, 13.453364, 3.8 },
-{ 20.153423, 13.452069, 3.8 },
-{ 20.155748, 13.452717, 3.8 },
-{ 20.156342, 13.451723, 3.8 },
-{ 20.153242, 13.451896, 3.8 },
-{ 20.152786, 13.451723, 3.8 },
-{ 20.154289, 13.450644, 3.8 },
-{ 20.153833, 13.452803, 3.8 },
-{ 20.155977, 13.451076, 3.8 },
-{ 20.155611, 13.453321, 3.8 },
-{ 20.155794, 13.45276, 3.8 },
-{ 20.155384, 13.451465, 3.8 },
-{ 20.154062, 13.451162, 3.8 },
-{ 20.154381, 13.452544, 3.8 },
-{ 20.154154, 13.452242, 3.8 },
-{ 20.152876, 13.451205, 3.8 },
-{ 20.153469, 13.452587, 3.8 },
-{ 20.154427, 13.452847, 3.8 },
-{ 20.154289, 13.45194, 3.8 },
-{ 20.153744, 13.451248, 3.8 },
-{ 20.154882, 13.451723, 3.8 },
-{ 20.154928, 13.452242, 3.8 },
-{ 20.154745, 13.453062, 3.8 },
-{ 20.15502, 13.451896, 3.8 },
-{ 20.154427, 13.451292, 3.8 },
-{ 20.155201, 13.451637, 3.8 },
-{ 20.154335, 13.45073, 3.8 },
-{ 20.153833, 13.452803, 3.8 },
-{ 20.153196, 13.449694, 3.8 },
-{ 20.154472, 13.451637, 3.8 },
-{ 20.155565, 13.451248, 3.8 },
-{ 20.154882, 13.452803, 3.8 },
-{ 20.157162, 13.452587, 3.8 },
-{ 20.15543, 13.450558, 3.8 },
-{ 20.156523, 13.451853, 3.8 },
-{ 20.154837, 13.451335, 3.8 },
-{ 20.1542, 13.451292, 3.8 },
-{ 20.154745, 13.45168, 3.8 },
-{ 20.154518, 13.451076, 3.8 },
-{ 20.154016, 13.453364, 3.8 },
-{ 20.154791, 13.452415, 3.8 },
-{ 20.154974, 13.450515, 3.8 },
-{ 20.156296, 13.451767, 3.8 },
-{ 20.156021, 13.452328, 3.8 },
-{ 20.156296, 13.451378, 3.8 },
-{ 20.155703, 13.45155, 3.8 },
-{ 20.155338, 13.451421, 3.8 },
-{ 20.156797, 13.451767, 3.8 },
-{ 20.156752, 13.452198, 3.8 },
-{ 20.156342, 13.451335, 3.8 },
-{ 20.156889, 13.453235, 3.8 },
-{ 20.15584, 13.453235, 3.8 },
-{ 20.156614, 13.452069, 3.8 },
-{ 20.156387, 13.45155, 3.8 },
-{ 20.15584, 13.452112, 3.8 },
-{ 20.155201, 13.452025, 3.8 },
-{ 20.156433, 13.452285, 3.8 },
-{ 20.156433, 13.45086, 3.8 },
-{ 20.15502, 13.450903, 3.8 },
-{ 20.156113, 13.450903, 3.8 },
-{ 20.157345, 13.451508, 3.8 },
-{ 20.15584, 13.451421, 3.8 },
-{ 20.155247, 13.45181, 3.8 },
-{ 20.157162, 13.453148, 3.8 },
-{ 20.156752, 13.451076, 3.8 },
-{ 20.156067, 13.451292, 3.8 },
-{ 20.156477, 13.452285, 3.8 },
-{ 20.156979, 13.452025, 3.8 },
-{ 20.156342, 13.451076, 3.8 },
-{ 20.15666, 13.452025, 3.8 },
-{ 20.157434, 13.451033, 3.8 },
-{ 20.156523, 13.450687, 3.8 },
-{ 20.156569, 13.449219, 3.8 },
-{ 20.157345, 13.451076, 3.8 },
-{ 20.157345, 13.451637, 3.9 },
-{ 20.15748, 13.452025, 3.9 },
-{ 20.15666, 13.451982, 3.9 },
-{ 20.157526, 13.450946, 3.9 },
-{ 20.156296, 13.451076, 3.9 },
-{ 20.158939, 13.450946, 3.9 },
-{ 20.157162, 13.451594, 3.9 },
-{ 20.157162, 13.451033, 3.9 },
-{ 20.158119, 13.450515, 3.9 },
-{ 20.157434, 13.450298, 3.9 },
-{ 20.157116, 13.451033, 3.8 },
-{ 20.158028, 13.452587, 3.8 },
-{ 20.156296, 13.451076, 3.8 },
-{ 20.158119, 13.450773, 3.8 },
-{ 20.158346, 13.450428, 3.8 },
-{ 20.159304, 13.450342, 3.9 },
-{ 20.157755, 13.451076, 3.9 },
-{ 20.158346, 13.45073, 3.9 },
-{ 20.157755, 13.45168, 3.9 },
-{ 20.158438, 13.451465, 3.9 },
-{ 20.157618, 13.450471, 3.9 },
-{ 20.159212, 13.452112, 3.9 },
-{ 20.157801, 13.450428, 3.9 },
-{ 20.159349, 13.449565, 3.9 },
-{ 20.157982, 13.450817, 3.9 },
-{ 20.156979, 13.451162, 3.9 },
-{ 20.159805, 13.451896, 3.9 },
-{ 20.158756, 13.450644, 3.9 },
-{ 20.159031, 13.449694, 3.9 },
-{ 20.158575, 13.450687, 3.9 },
-{ 20.156614, 13.45099, 3.8 },
-{ 20.158529, 13.45099, 3.8 },
-{ 20.158529, 13.450255, 3.8 },
-{ 20.158346, 13.450903, 3.8 },
-{ 20.158257, 13.451162, 3.8 },
-{ 20.159166, 13.451248, 3.9 },
-{ 20.157755, 13.450773, 3.9 },
-{ 20.159122, 13.450471, 3.9 },
-{ 20.157024, 13.451033, 3.9 },
-{ 20.158667, 13.450428, 3.9 },
-{ 20.158894, 13.45004, 3.9 },
-{ 20.159441, 13.449263, 3.9 },
-{ 20.159258, 13.451248, 3.9 },
-{ 20.159943, 13.450342, 3.9 },
-{ 20.159578, 13.450471, 3.9 },
-{ 20.158894, 13.450126, 3.9 },
-{ 20.159122, 13.447104, 3.9 },
-{ 20.16049, 13.449133, 3.9 },
-{ 20.157982, 13.450903, 3.9 },
-{ 20.1583, 13.449866, 3.9 },
-{ 20.160398, 13.44896, 3.9 },
-{ 20.157755, 13.449263, 3.9 },
-{ 20.159487, 13.449738, 3.9 },
-{ 20.158848, 13.450601, 3.9 },
-{ 20.160717, 13.451248, 3.9 },
-{ 20.159304, 13.449651, 3.9 },
-{ 20.159304, 13.448571, 3.9 },
-{ 20.159031, 13.449391, 3.9 },
-{ 20.160763, 13.450601, 3.9 },
-{ 20.15976, 13.450342, 3.9 },
-{ 20.161858, 13.448744, 3.9 },
-{ 20.159622, 13.449608, 3.9 },
-{ 20.159805, 13.44978, 3.9 },
-{ 20.158939, 13.450601, 3.9 },
-{ 20.162268, 13.450255, 3.9 },
-{ 20.160534, 13.449133, 3.9 },
-{ 20.159805, 13.448485, 3.9 },
-{ 20.16017, 13.450083, 3.9 },
-{ 20.16099, 13.449003, 3.9 },
-{ 20.161583, 13.449608, 3.9 },
-{ 20.16017, 13.449866, 3.9 },
-{ 20.16172, 13.449348, 3.9 },
-{ 20.161674, 13.449176, 3.9 },
-{ 20.159805, 13.450083, 3.9 },
-{ 20.160261, 13.44978, 3.9 },
-{ 20.160307, 13.449306, 3.9 },
-{ 20.158939, 13.450644, 3.9 },
-{ 20.159988, 13.449263, 3.9 },
-{ 20.160034, 13.449823, 3.9 },
-{ 20.161264, 13.448744, 3.9 },
-{ 20.16058, 13.450558, 3.9 },
-{ 20.160261, 13.449608, 3.9 },
-{ 20.162222, 13.449176, 3.9 },
-{ 20.159395, 13.44909, 3.9 },
-{ 20.160854, 13.45073, 3.9 },
-{ 20.16131, 13.449866, 3.9 },
-{ 20.160809, 13.450169, 3.9 },
-{ 20.160215, 13.449565, 3.9 },
-{ 20.159943, 13.448916, 3.9 },
-{ 20.161081, 13.449823, 3.9 },
-{ 20.160398, 13.44991, 3.9 },
-{ 20.160078, 13.448744, 3.9 },
-{ 20.162586, 13.449608, 3.9 },
-{ 20.160625, 13.44991, 3.9 },
-{ 20.160671, 13.448701, 3.9 },
-{ 20.162176, 13.44896, 3.9 },
-{ 20.162905, 13.450212, 3.9 },
-{ 20.160946, 13.449565, 3.9 },
-{ 20.162678, 13.448139, 3.9 },
-{ 20.159578, 13.449391, 3.9 },
-{ 20.162085, 13.450169, 3.9 },
-{ 20.161491, 13.448356, 3.9 },
-{ 20.161173, 13.449263, 3.9 },
-{ 20.161402, 13.448226, 3.9 },
-{ 20.162176, 13.449263, 3.9 },
-{ 20.161812, 13.448356, 3.9 },
-{ 20.161446, 13.448485, 3.9 },
-{ 20.162859, 13.448356, 3.9 },
-{ 20.160809, 13.448701, 3.9 },
-{ 20.162085, 13.449391, 3.9 },
-{ 20.160717, 13.447967, 3.9 },
-{ 20.161993, 13.447838, 3.9 },
-{ 20.162312, 13.449996, 3.9 },
-{ 20.162039, 13.449565, 3.9 },
-{ 20.16172, 13.448442, 3.9 },
-{ 20.16213, 13.448096, 3.9 },
-{ 20.163269, 13.448356, 3.9 },
-{ 20.161947, 13.449565, 3.9 },
-{ 20.161947, 13.450212, 3.9 },
-{ 20.161402, 13.448571, 3.9 },
-{ 20.162449, 13.448571, 3.9 },
-{ 20.162813, 13.448614, 3.9 },
-{ 20.16254, 13.449003, 3.9 },
-{ 20.162724, 13.449176, 3.9 },
-{ 20.16213, 13.448528, 3.9 },
-{ 20.161947, 13.447621, 3.9 },
-{ 20.162039, 13.449263, 3.9 },
-{ 20.161993, 13.449219, 3.9 },
-{ 20.16099, 13.448701, 3.9 },
-{ 20.162357, 13.448614, 3.9 },
-{ 20.162767, 13.448139, 3.9 },
-{ 20.163088, 13.447838, 3.9 },
-{ 20.155247, 13.447924, 3.9 },
-{ 20.163088, 13.447751, 3.9 },
-{ 20.162678, 13.450083, 3.9 },
-{ 20.163452, 13.450342, 3.9 },
-{ 20.161583, 13.447362, 3.9 },
-{ 20.161812, 13.448614, 3.9 },
-{ 20.161081, 13.447881, 3.9 },
-{ 20.162586, 13.447751, 3.9 },
-{ 20.163223, 13.448356, 3.9 },
-{ 20.165367, 13.448571, 3.9 },
-{ 20.163406, 13.446974, 3.9 },
-{ 20.163589, 13.448916, 3.9 },
-{ 20.163544, 13.446801, 3.9 },
-{ 20.162859, 13.448485, 3.9 },
-{ 20.163406, 13.447708, 3.9 },
-{ 20.163452, 13.448096, 3.9 },
-{ 20.162222, 13.449003, 3.9 },
-{ 20.164591, 13.448183, 3.9 },
-{ 20.164272, 13.448269, 3.9 },
-{ 20.162996, 13.446239, 3.9 },
-{ 20.162859, 13.448399, 3.9 },
-{ 20.164227, 13.448053, 3.9 },
-{ 20.155521, 13.416058, 3.9 },
-{ 20.16254, 13.448313, 3.9 },
-{ 20.163725, 13.448614, 3.9 },
-{ 20.164455, 13.447233, 3.9 },
-{ 20.162859, 13.447664, 3.9 },
-{ 20.162357, 13.447276, 3.9 },
-{ 20.165276, 13.447924, 3.9 },
-{ 20.16482, 13.448528, 3.9 },
-{ 20.164911, 13.449003, 3.9 },
-{ 20.164091, 13.447536, 3.9 },
-{ 20.164272, 13.449003, 3.9 },
-{ 20.164957, 13.447664, 3.9 },
-{ 20.164, 13.447708, 3.9 },
-{ 20.163315, 13.448313, 3.9 },
-{ 20.164, 13.447967, 3.9 },
-{ 20.16564, 13.44801, 3.9 },
-{ 20.163771, 13.447924, 3.9 },
-{ 20.163452, 13.447708, 3.9 },
-{ 20.164045, 13.448226, 3.9 },
-{ 20.163361, 13.448831, 3.9 },
-{ 20.163406, 13.449046, 3.9 },
-{ 20.162632, 13.448269, 3.9 },
-{ 20.163361, 13.447621, 3.9 },
-{ 20.166187, 13.447406, 3.9 },
-{ 20.162268, 13.447708, 3.9 },
-{ 20.165594, 13.448485, 3.9 },
-{ 20.164501, 13.446887, 3.9 },
-{ 20.162724, 13.448183, 3.9 },
-{ 20.164272, 13.447492, 3.9 },
-{ 20.164501, 13.445894, 3.9 },
-{ 20.163042, 13.447061, 3.9 },
-{ 20.165459, 13.447146, 3.9 },
-{ 20.165092, 13.448916, 3.9 },
-{ 20.16213, 13.448139, 3.9 },
-{ 20.164455, 13.447536, 3.9 },
-{ 20.163816, 13.445851, 3.9 },
-{ 20.164957, 13.447967, 3.9 },
-{ 20.162449, 13.449176, 3.9 },
-{ 20.163635, 13.446154, 3.9 },
-{ 20.164774, 13.446326, 3.9 },
-{ 20.163954, 13.448139, 3.9 },
-{ 20.164091, 13.447189, 3.9 },
-{ 20.163816, 13.448269, 3.9 },
-{ 20.164181, 13.448614, 3.9 },
-{ 20.163908, 13.446887, 3.9 },
-{ 20.164911, 13.447492, 3.9 },
-{ 20.163042, 13.447061, 3.9 },
-{ 20.163269, 13.447664, 3.9 },
-{ 20.164045, 13.446974, 3.9 },
-{ 20.164091, 13.447449, 3.9 },
-{ 20.163406, 13.446887, 3.9 },
-{ 20.164728, 13.446887, 3.9 },
-{ 20.164774, 13.445808, 3.9 },
-{ 20.164591, 13.447881, 3.9 },
-{ 20.165003, 13.447319, 3.9 },
-{ 20.163862, 13.446714, 3.9 },
-{ 20.164091, 13.446931, 3.9 },
-{ 20.164181, 13.449133, 3.9 },
-{ 20.164682, 13.446067, 3.9 },
-{ 20.165138, 13.446844, 3.9 },
-{ 20.162268, 13.446671, 3.9 },
-{ 20.164728, 13.446412, 3.9 },
-{ 20.163361, 13.446369, 3.9 },
-{ 20.162632, 13.447233, 3.9 },
-{ 20.163361, 13.448053, 3.9 },
-{ 20.163862, 13.446239, 3.9 },
-{ 20.163679, 13.447751, 3.9 },
-{ 20.163771, 13.446714, 3.9 },
-{ 20.16441, 13.447276, 3.9 },
-{ 20.163589, 13.448313, 3.9 },
-{ 20.165594, 13.447536, 3.9 },
-{ 20.16441, 13.447233, 4.0 },
-{ 20.163498, 13.447967, 4.0 },
-{ 20.162724, 13.446067, 4.0 },
-{ 20.162996, 13.446671, 4.0 },
-{ 20.164272, 13.446844, 4.0 },
-{ 20.163635, 13.448053, 4.0 },
-{ 20.163679, 13.447362, 4.0 },
-{ 20.163908, 13.446801, 4.0 },
-{ 20.163088, 13.446931, 4.0 },
-{ 20.164547, 13.448614, 4.0 },
-{ 20.164181, 13.446887, 3.9 },
-{ 20.165092, 13.446629, 3.9 },
-{ 20.164364, 13.447233, 3.9 },
-{ 20.162632, 13.446542, 3.9 },
-{ 20.164637, 13.446024, 3.9 },
-{ 20.16441, 13.446283, 3.9 },
-{ 20.164045, 13.446714, 3.9 },
-{ 20.163269, 13.446067, 3.9 },
-{ 20.163544, 13.446758, 3.9 },
-{ 20.164227, 13.447061, 3.9 },
-{ 20.163223, 13.445679, 4.0 },
-{ 20.164364, 13.447406, 4.0 },
-{ 20.164318, 13.446154, 4.0 },
-{ 20.163452, 13.447276, 4.0 },
-{ 20.164045, 13.445765, 4.0 },
-{ 20.163725, 13.446887, 3.9 },
-{ 20.163908, 13.448269, 3.9 },
-{ 20.163406, 13.446629, 3.9 },
-{ 20.164865, 13.447189, 3.9 },
-{ 20.164, 13.449003, 3.9 },
-{ 20.163771, 13.446326, 3.9 },
-{ 20.164637, 13.445376, 3.9 },
-{ 20.163315, 13.446499, 3.9 },
-{ 20.164045, 13.447276, 3.9 },
-{ 20.164318, 13.447536, 3.9 },
-{ 20.164774, 13.446412, 4.0 },
-{ 20.164501, 13.44611, 4.0 },
-{ 20.165367, 13.444858, 4.0 },
-{ 20.164547, 13.447104, 4.0 },
-{ 20.163088, 13.447233, 4.0 },
-{ 20.165276, 13.446456, 4.0 },
-{ 20.163452, 13.447967, 4.0 },
-{ 20.164272, 13.447189, 4.0 },
-{ 20.162767, 13.447536, 4.0 },
-{ 20.162724, 13.446369, 4.0 },
-{ 20.164501, 13.447146, 4.0 },
-{ 20.162632, 13.448053, 4.0 },
-{ 20.162085, 13.446499, 4.0 },
-{ 20.147772, 13.460791, 4.0 },
-{ 20.134871, 13.4696, 4.0 },
-{ 20.129629, 13.471542, 3.9 },
-{ 20.124935, 13.471585, 3.9 },
-{ 20.12571, 13.473787, 3.9 },
-{ 20.12425, 13.474781, 3.9 },
-{ 20.122883, 13.476076, 3.9 },
-{ 20.122381, 13.476896, 4.0 },
-{ 20.123703, 13.477113, 4.0 },
-{ 20.122335, 13.476421, 4.0 },
-{ 20.121653, 13.47776, 4.0 },
-{ 20.121561, 13.478796, 4.0 },
-{ 20.122017, 13.47858, 4.0 },
-{ 20.121288, 13.478926, 4.0 },
-{ 20.122154, 13.480998, 4.0 },
-{ 20.122154, 13.479358, 4.0 },
-{ 20.124113, 13.478623, 4.0 },
-{ 20.124844, 13.477803, 4.0 },
-{ 20.124569, 13.477846, 4.0 },
-{ 20.12571, 13.476594, 4.0 },
-{ 20.127077, 13.474004, 4.0 },
-{ 20.127989, 13.472277, 4.0 },
-{ 20.129219, 13.470808, 4.0 },
-{ 20.131088, 13.467916, 4.0 },
-{ 20.133549, 13.465929, 4.0 },
-{ 20.133915, 13.465843, 4.0 },
-{ 20.135283, 13.463857, 4.0 },
-{ 20.135828, 13.460445, 4.0 },
-{ 20.137241, 13.459668, 4.0 },
-{ 20.137789, 13.458243, 4.0 },
-{ 20.137651, 13.457121, 4.0 },
-{ 20.138382, 13.457379, 4.0 },
-{ 20.138927, 13.455264, 4.0 },
-{ 20.137926, 13.453925, 4.0 },
-{ 20.138838, 13.451292, 4.0 },
-{ 20.13975, 13.452069, 4.0 },
-{ 20.139202, 13.451248, 4.0 },
-{ 20.139931, 13.449823, 4.0 },
-{ 20.138792, 13.448658, 4.0 },
-{ 20.137697, 13.448701, 4.0 },
-{ 20.136604, 13.449565, 4.0 },
-{ 20.137516, 13.447276, 4.0 },
-{ 20.136103, 13.448916, 4.0 },
-{ 20.136969, 13.448442, 4.0 },
-{ 20.134598, 13.44516, 4.0 },
-{ 20.133139, 13.446714, 4.0 },
-{ 20.131954, 13.447362, 4.0 },
-{ 20.132046, 13.445549, 4.0 },
-{ 20.131361, 13.445592, 4.0 },
-{ 20.131226, 13.444772, 4.0 },
-{ 20.128946, 13.446239, 4.0 },
-{ 20.127714, 13.444685, 4.0 },
-{ 20.129492, 13.444944, 4.0 },
-{ 20.126575, 13.444772, 4.0 },
-{ 20.126211, 13.443649, 4.0 },
-{ 20.126074, 13.441663, 4.0 },
-{ 20.12571, 13.442267, 4.0 },
-{ 20.12571, 13.440972, 4.0 },
-{ 20.124615, 13.441835, 4.0 },
-{ 20.12571, 13.441965, 4.0 },
-{ 20.125481, 13.442138, 4.0 },
-{ 20.124023, 13.441015, 4.0 },
-{ 20.124706, 13.439979, 4.0 },
-{ 20.123384, 13.439245, 4.0 },
-{ 20.123886, 13.436352, 4.0 },
-{ 20.123749, 13.437302, 4.0 },
-{ 20.123112, 13.437172, 4.0 },
-{ 20.123247, 13.436179, 4.0 },
-{ 20.123795, 13.434711, 4.0 },
-{ 20.123795, 13.435316, 4.0 },
-{ 20.124569, 13.431386, 4.0 },
-{ 20.122427, 13.431818, 4.0 },
-{ 20.125391, 13.429832, 4.0 },
-{ 20.125481, 13.429314, 4.0 },
-{ 20.125116, 13.428191, 4.0 },
-{ 20.125254, 13.426809, 4.0 },
-{ 20.125526, 13.425342, 4.0 },
-{ 20.126074, 13.424047, 4.0 },
-{ 20.126211, 13.422794, 4.0 },
-{ 20.127668, 13.421412, 4.0 },
-{ 20.126757, 13.419426, 4.0 },
-{ 20.12694, 13.419513, 4.0 },
-{ 20.128307, 13.418131, 4.0 },
-{ 20.129538, 13.416533, 4.0 },
-{ 20.12808, 13.417439, 4.0 },
-{ 20.128626, 13.41541, 4.0 },
-{ 20.128307, 13.412863, 4.0 },
-{ 20.130131, 13.412, 4.0 },
-{ 20.130177, 13.41092, 4.0 },
-{ 20.130404, 13.410748, 4.0 },
-{ 20.130814, 13.410488, 4.0 },
-{ 20.130724, 13.409366, 4.0 },
-{ 20.13118, 13.409106, 4.0 },
-{ 20.129356, 13.408286, 4.0 },
-{ 20.131226, 13.407854, 4.0 },
-{ 20.129858, 13.40535, 4.0 },
-{ 20.131771, 13.405609, 4.0 },
-{ 20.131863, 13.405479, 4.0 },
-{ 20.130997, 13.40604, 4.0 },
-{ 20.131269, 13.404659, 4.0 },
-{ 20.131042, 13.404487, 4.0 },
-{ 20.131226, 13.404012, 4.0 },
-{ 20.131269, 13.402975, 4.0 },
-{ 20.131134, 13.402716, 4.0 },
-{ 20.131315, 13.403105, 4.0 },
-{ 20.131407, 13.401938, 4.0 },
-{ 20.129904, 13.402241, 4.0 },
-{ 20.131453, 13.401982, 4.0 },
-{ 20.129448, 13.401982, 4.0 },
-{ 20.128672, 13.400298, 4.0 },
-{ 20.128992, 13.401421, 4.0 },
-{ 20.127533, 13.401507, 4.0 },
-{ 20.125572, 13.401291, 4.0 },
-{ 20.123703, 13.400686, 4.0 },
-{ 20.123201, 13.401464, 4.0 },
-{ 20.122154, 13.401118, 4.0 },
-{ 20.120422, 13.403795, 4.0 },
-{ 20.119373, 13.402111, 4.0 },
-{ 20.116274, 13.403882, 4.0 },
-{ 20.115271, 13.405005, 4.0 },
-{ 20.114496, 13.406602, 4.0 },
-{ 20.114542, 13.405997, 4.0 },
-{ 20.113264, 13.405782, 4.0 },
-{ 20.111988, 13.405739, 4.0 },
-{ 20.110394, 13.404659, 4.0 },
-{ 20.111443, 13.405393, 4.0 },
-{ 20.110666, 13.406084, 4.0 },
-{ 20.111076, 13.404184, 4.0 },
-{ 20.110941, 13.406084, 4.0 },
-{ 20.110531, 13.404702, 4.0 },
-{ 20.111578, 13.401766, 4.0 },
-{ 20.111853, 13.401938, 4.0 },
-{ 20.111076, 13.402845, 4.0 },
-{ 20.114086, 13.40155, 4.0 },
-{ 20.113493, 13.400903, 4.0 },
-{ 20.1129, 13.401118, 4.0 },
-{ 20.114132, 13.398355, 4.0 },
-{ 20.115088, 13.399823, 4.0 },
-{ 20.115772, 13.399607, 4.0 },
-{ 20.114998, 13.397189, 4.0 },
-{ 20.116821, 13.397319, 4.0 },
-{ 20.116228, 13.396152, 4.0 },
-{ 20.116865, 13.395678, 4.0 },
-{ 20.119009, 13.395894, 4.0 },
-{ 20.11673, 13.39434, 4.0 },
-{ 20.119465, 13.394857, 4.0 },
-{ 20.120331, 13.395419, 4.0 },
-{ 20.118963, 13.394469, 4.0 },
-{ 20.119783, 13.395505, 4.0 },
-{ 20.12188, 13.39395, 4.0 },
-{ 20.121197, 13.391835, 4.0 },
-{ 20.121424, 13.391878, 4.0 },
-{ 20.121334, 13.392223, 4.0 },
-{ 20.12229, 13.39041, 4.0 },
-{ 20.122837, 13.391921, 4.0 },
-{ 20.121288, 13.39136, 4.0 },
-{ 20.124023, 13.390324, 4.0 },
-{ 20.123611, 13.390928, 4.0 },
-{ 20.124113, 13.390194, 4.0 },
-{ 20.123339, 13.388899, 4.0 },
-{ 20.123978, 13.390496, 4.0 },
-{ 20.123978, 13.388769, 4.0 },
-{ 20.124523, 13.388726, 4.0 },
-{ 20.12343, 13.388424, 4.0 },
-{ 20.123749, 13.388122, 4.0 },
-{ 20.121971, 13.389892, 4.0 },
-{ 20.124752, 13.387301, 4.0 },
-{ 20.121378, 13.386179, 4.0 },
-{ 20.124706, 13.387301, 4.0 },
-{ 20.123568, 13.387258, 4.0 },
-{ 20.122746, 13.387733, 4.0 },
-{ 20.122929, 13.387474, 4.0 },
-{ 20.123066, 13.387647, 4.0 },
-{ 20.120604, 13.387301, 4.0 },
-{ 20.123156, 13.387906, 4.0 },
-{ 20.124388, 13.38553, 4.0 },
-{ 20.124523, 13.385099, 4.0 },
-{ 20.124523, 13.385315, 4.0 },
-{ 20.123795, 13.386135, 4.0 },
-{ 20.125116, 13.385358, 4.0 },
-{ 20.123932, 13.38376, 4.0 },
-{ 20.127031, 13.384883, 4.0 },
-{ 20.125847, 13.382551, 4.0 },
-{ 20.127579, 13.382293, 4.0 },
-{ 20.127851, 13.381645, 4.0 },
-{ 20.128445, 13.380651, 4.0 },
-{ 20.129812, 13.381083, 4.0 },
-{ 20.130541, 13.379443, 4.0 },
-{ 20.129904, 13.378234, 4.0 },
-{ 20.132866, 13.377932, 4.0 },
-{ 20.132318, 13.376204, 4.0 },
-{ 20.134916, 13.376162, 4.0 },
-{ 20.135738, 13.377154, 4.0 },
-{ 20.13592, 13.374693, 4.0 },
-{ 20.135464, 13.37452, 4.0 },
-{ 20.136923, 13.373182, 4.0 },
-{ 20.137196, 13.373528, 4.0 },
-{ 20.138517, 13.372793, 4.0 },
-{ 20.140432, 13.372361, 4.0 },
-{ 20.140524, 13.371843, 4.0 },
-{ 20.142029, 13.371325, 4.0 },
-{ 20.141663, 13.369771, 4.0 },
-{ 20.142712, 13.370159, 4.0 },
-{ 20.142347, 13.368302, 4.0 },
-{ 20.144033, 13.368044, 4.0 },
-{ 20.143167, 13.367612, 4.0 },
-{ 20.144217, 13.369209, 4.0 },
-{ 20.144125, 13.366619, 4.0 },
-{ 20.143896, 13.365712, 4.0 },
-{ 20.144762, 13.36623, 4.0 },
-{ 20.144718, 13.365669, 4.0 },
-{ 20.146906, 13.36433, 4.0 },
-{ 20.147316, 13.364892, 4.0 },
-{ 20.144581, 13.36351, 4.0 },
-{ 20.146677, 13.363596, 4.0 },
-{ 20.147179, 13.363898, 4.0 },
-{ 20.14768, 13.363121, 4.0 },
-{ 20.147543, 13.362516, 4.0 },
-{ 20.146585, 13.36161, 4.0 },
-{ 20.147589, 13.361481, 4.0 },
-{ 20.14809, 13.360574, 4.0 },
-{ 20.147087, 13.361653, 4.0 },
-{ 20.148136, 13.361178, 4.0 },
-{ 20.147953, 13.361092, 4.0 },
-{ 20.149776, 13.359408, 4.0 },
-{ 20.148409, 13.359322, 4.0 },
-{ 20.148363, 13.359062, 4.0 },
-{ 20.149687, 13.358717, 4.0 },
-{ 20.149458, 13.357637, 4.0 },
-{ 20.150507, 13.357637, 4.0 },
-{ 20.150734, 13.358027, 4.0 },
-{ 20.152102, 13.356904, 4.0 },
-{ 20.151737, 13.356385, 4.0 },
-{ 20.153332, 13.355392, 4.0 },
-{ 20.152649, 13.354528, 4.0 },
-{ 20.152376, 13.354615, 4.0 },
-{ 20.154699, 13.354183, 4.0 },
-{ 20.155109, 13.355177, 4.0 },
-{ 20.154699, 13.354572, 4.0 },
-{ 20.157299, 13.352024, 4.0 },
-{ 20.157709, 13.352543, 4.0 },
-{ 20.1583, 13.350124, 4.0 },
-{ 20.157845, 13.349779, 4.0 },
-{ 20.158438, 13.348527, 4.0 },
-{ 20.158848, 13.350039, 4.0 },
-{ 20.160124, 13.348052, 4.0 },
-{ 20.160215, 13.347318, 4.0 },
-{ 20.161036, 13.34749, 4.0 },
-{ 20.160809, 13.346066, 4.0 },
-{ 20.160763, 13.34503, 4.0 },
-{ 20.163544, 13.345893, 4.0 },
-{ 20.16254, 13.345288, 4.0 },
-{ 20.164455, 13.343906, 4.0 },
-{ 20.165503, 13.342568, 4.0 },
-{ 20.164135, 13.342957, 4.0 },
-{ 20.164318, 13.34313, 4.0 },
-{ 20.165958, 13.341187, 4.0 },
-{ 20.165321, 13.341532, 4.0 },
-{ 20.16687, 13.339762, 4.0 },
-{ 20.16646, 13.340323, 4.0 },
-{ 20.165823, 13.340669, 4.0 },
-{ 20.167463, 13.340021, 4.0 },
-{ 20.168421, 13.338164, 4.0 },
-{ 20.168329, 13.338078, 4.0 },
-{ 20.168968, 13.337387, 4.0 },
-{ 20.169333, 13.337042, 4.0 },
-{ 20.170425, 13.334063, 4.0 },
-{ 20.182369, 13.319382, 4.0 },
-{ 20.187885, 13.318388, 4.0 },
-{ 20.189617, 13.316013, 4.0 },
-{ 20.192488, 13.315366, 4.0 },
-{ 20.194038, 13.312214, 4.0 },
-{ 20.196045, 13.311437, 3.9 },
-{ 20.195633, 13.310616, 3.9 },
-{ 20.196545, 13.309148, 3.9 },
-{ 20.197912, 13.309752, 3.9 },
-{ 20.197046, 13.308112, 3.9 },
-{ 20.198414, 13.309062, 3.9 },
-{ 20.19919, 13.308025, 3.9 },
-{ 20.201103, 13.30699, 3.9 },
-{ 20.201834, 13.307853, 3.9 },
-{ 20.200466, 13.307076, 3.9 },
-{ 20.199099, 13.305651, 3.9 },
-{ 20.201788, 13.307593, 3.9 },
-{ 20.201424, 13.305521, 3.9 },
-{ 20.202425, 13.305133, 3.9 },
-{ 20.202471, 13.305348, 3.9 },
-{ 20.199326, 13.308155, 3.9 },
-{ 20.198643, 13.306687, 3.9 },
-{ 20.199099, 13.307593, 3.9 },
-{ 20.199417, 13.307982, 3.9 },
-{ 20.197138, 13.30686, 3.9 },
-{ 20.198368, 13.307465, 3.9 },
-{ 20.197685, 13.308846, 3.9 },
-{ 20.19659, 13.307896, 3.9 },
-{ 20.197731, 13.3085, 3.9 },
-{ 20.198368, 13.308587, 3.9 },
-{ 20.19618, 13.308544, 3.9 },
-{ 20.196957, 13.308414, 3.9 },
-{ 20.19618, 13.307118, 3.9 },
-{ 20.196135, 13.308414, 3.9 },
-{ 20.195816, 13.30755, 3.9 },
-{ 20.196819, 13.308198, 3.9 },
-{ 20.198278, 13.308112, 3.9 },
-{ 20.197092, 13.307378, 3.9 },
-{ 20.197912, 13.30768, 3.9 },
-{ 20.195908, 13.307637, 3.9 },
-{ 20.195679, 13.307248, 3.9 },
-{ 20.197412, 13.309105, 3.9 },
-{ 20.195862, 13.308069, 3.9 },
-{ 20.195133, 13.308069, 3.9 },
-{ 20.197639, 13.308414, 3.9 },
-{ 20.19536, 13.308803, 3.9 },
-{ 20.197001, 13.308242, 3.9 },
-{ 20.197502, 13.30781, 3.9 },
-{ 20.195862, 13.308889, 3.9 },
-{ 20.197367, 13.310012, 3.9 },
-{ 20.197685, 13.3085, 3.9 },
-{ 20.197229, 13.310702, 3.9 },
-{ 20.195633, 13.310659, 3.9 },
-{ 20.196636, 13.310616, 3.9 },
-{ 20.196363, 13.309969, 3.9 },
-{ 20.197456, 13.310314, 3.9 },
-{ 20.198778, 13.309494, 3.9 },
-{ 20.197184, 13.30876, 3.9 },
-{ 20.196226, 13.31148, 3.9 },
-{ 20.19805, 13.310055, 3.9 },
-{ 20.196501, 13.312861, 3.9 },
-{ 20.198004, 13.310789, 3.9 },
-{ 20.196682, 13.311782, 3.9 },
-{ 20.196318, 13.312344, 3.9 },
-{ 20.19805, 13.312473, 3.9 },
-{ 20.196957, 13.312473, 3.9 },
-{ 20.198597, 13.313854, 3.9 },
-{ 20.197685, 13.313639, 3.9 },
-{ 20.196089, 13.314114, 3.9 },
-{ 20.196865, 13.314805, 3.9 },
-{ 20.198004, 13.314373, 3.9 },
-{ 20.198597, 13.315409, 3.9 },
-{ 20.197731, 13.31774, 3.9 },
-{ 20.197685, 13.316445, 3.9 },
-{ 20.199099, 13.315798, 3.9 },
-{ 20.198414, 13.317827, 3.9 },
-{ 20.19928, 13.317309, 3.9 },
-{ 20.198551, 13.318172, 3.9 },
-{ 20.196865, 13.318302, 3.9 },
-{ 20.19928, 13.31813, 3.9 },
-{ 20.197456, 13.31882, 3.8 },
-{ 20.200237, 13.318734, 3.8 },
-{ 20.19846, 13.320417, 3.8 },
-{ 20.198322, 13.32072, 3.8 },
-{ 20.199234, 13.320417, 3.8 },
-{ 20.198734, 13.322318, 3.8 },
-{ 20.200739, 13.323483, 3.8 },
-{ 20.199554, 13.321756, 3.8 },
-{ 20.201014, 13.324174, 3.8 },
-{ 20.199463, 13.323829, 3.8 },
-{ 20.200056, 13.324261, 3.8 },
-{ 20.200693, 13.322879, 3.8 },
-{ 20.198961, 13.324736, 3.8 },
-{ 20.200102, 13.326678, 3.8 },
-{ 20.20083, 13.327715, 3.8 },
-{ 20.200512, 13.326852, 3.8 },
-{ 20.200739, 13.327715, 3.8 },
-{ 20.200146, 13.327628, 3.8 },
-{ 20.199371, 13.329097, 3.8 },
-{ 20.199781, 13.328794, 3.8 },
-{ 20.200329, 13.329399, 3.8 },
-{ 20.20083, 13.330349, 3.8 },
-{ 20.201605, 13.329312, 3.8 },
-{ 20.202061, 13.329787, 3.8 },
-{ 20.200876, 13.330132, 3.8 },
-{ 20.200375, 13.332983, 3.8 },
-{ 20.200375, 13.332033, 3.8 },
-{ 20.202015, 13.332119, 3.8 },
-{ 20.203291, 13.332939, 3.8 },
-{ 20.202562, 13.332681, 3.8 },
-{ 20.201969, 13.332853, 3.8 },
-{ 20.202791, 13.332983, 3.8 },
-{ 20.203793, 13.333285, 3.8 },
-{ 20.203976, 13.33458, 3.8 },
-{ 20.202791, 13.33281, 3.8 },
-{ 20.201923, 13.333846, 3.8 },
-{ 20.203747, 13.336005, 3.8 },
-{ 20.203703, 13.33566, 3.8 },
-{ 20.205025, 13.33579, 3.8 },
-{ 20.204477, 13.334926, 3.8 },
-{ 20.204615, 13.336221, 3.8 },
-{ 20.205435, 13.337646, 3.8 },
-{ 20.205206, 13.335487, 3.8 },
-{ 20.206528, 13.337732, 3.8 },
-{ 20.204796, 13.336998, 3.8 },
-{ 20.204615, 13.337689, 3.8 },
-{ 20.205616, 13.33851, 3.8 },
-{ 20.206757, 13.339675, 3.8 },
-{ 20.205435, 13.338078, 3.8 },
-{ 20.204659, 13.338294, 3.8 },
-{ 20.204294, 13.33838, 3.8 },
-{ 20.204569, 13.339546, 3.8 },
-{ 20.206347, 13.338855, 3.8 },
-{ 20.205069, 13.340971, 3.8 },
-{ 20.204796, 13.34028, 3.8 },
-{ 20.205708, 13.341532, 3.8 },
-{ 20.205662, 13.341878, 3.8 },
-{ 20.206209, 13.341187, 3.8 },
-{ 20.204979, 13.341273, 3.8 },
-{ 20.206392, 13.342439, 3.8 },
-{ 20.207029, 13.340971, 3.8 },
-{ 20.207075, 13.341921, 3.8 },
-{ 20.207304, 13.343778, 3.8 },
-{ 20.206482, 13.342266, 3.8 },
-{ 20.205753, 13.343043, 3.8 },
-{ 20.20557, 13.343518, 3.8 },
-{ 20.208351, 13.344296, 3.8 },
-{ 20.205343, 13.34477, 3.8 },
-{ 20.20598, 13.34408, 3.8 },
-{ 20.207804, 13.343778, 3.8 },
-{ 20.207895, 13.344468, 3.7 },
-{ 20.206392, 13.345159, 3.7 },
-{ 20.207439, 13.344857, 3.7 },
-{ 20.207804, 13.345893, 3.7 },
-{ 20.206436, 13.345159, 3.7 },
-{ 20.208305, 13.345677, 3.7 },
-{ 20.206848, 13.347447, 3.7 },
-{ 20.20598, 13.347232, 3.7 },
-{ 20.208761, 13.346843, 3.7 },
-{ 20.20785, 13.34598, 3.7 },
-{ 20.207394, 13.346972, 3.7 },
-{ 20.209126, 13.346282, 3.7 },
-{ 20.206938, 13.34749, 3.7 },
-{ 20.206757, 13.34762, 3.7 },
-{ 20.205343, 13.34775, 3.7 },
-{ 20.204523, 13.348052, 3.7 },
-{ 20.208216, 13.349174, 3.7 },
-{ 20.208305, 13.348742, 3.7 },
-{ 20.208853, 13.348182, 3.7 },
-{ 20.206255, 13.348484, 3.7 },
-{ 20.206711, 13.349002, 3.7 },
-{ 20.20867, 13.348484, 3.7 },
-{ 20.206984, 13.349779, 3.7 },
-{ 20.205799, 13.349434, 3.7 },
-{ 20.208351, 13.350039, 3.7 },
-{ 20.207258, 13.349174, 3.7 },
-{ 20.207714, 13.349089, 3.7 },
-{ 20.206619, 13.349434, 3.7 },
-{ 20.207167, 13.350988, 3.7 },
-{ 20.207439, 13.351031, 3.7 },
-{ 20.207531, 13.349822, 3.7 },
-{ 20.20785, 13.350643, 3.7 },
-{ 20.208216, 13.351377, 3.7 },
-{ 20.207258, 13.351334, 3.7 },
-{ 20.206984, 13.351636, 3.7 },
-{ 20.207895, 13.351938, 3.7 },
-{ 20.207804, 13.350167, 3.7 },
-{ 20.207987, 13.35237, 3.7 },
-{ 20.206347, 13.352629, 3.7 },
-{ 20.2094, 13.352715, 3.7 },
-{ 20.207348, 13.354528, 3.7 },
-{ 20.206573, 13.352845, 3.7 },
-{ 20.206209, 13.355435, 3.7 },
-{ 20.207167, 13.354183, 3.7 },
-{ 20.205114, 13.354443, 3.7 },
-{ 20.206619, 13.352974, 3.7 },
-{ 20.20516, 13.355177, 3.7 },
-{ 20.206392, 13.354443, 3.7 },
-{ 20.205845, 13.354745, 3.7 },
-{ 20.206573, 13.354097, 3.7 },
-{ 20.206848, 13.355738, 3.7 },
-{ 20.205435, 13.355306, 3.7 },
-{ 20.204659, 13.355565, 3.7 },
-{ 20.206347, 13.356515, 3.7 },
-{ 20.205891, 13.355824, 3.7 },
-{ 20.206209, 13.356299, 3.7 },
-{ 20.20598, 13.356342, 3.7 },
-{ 20.204615, 13.355478, 3.7 },
-{ 20.206482, 13.357767, 3.7 },
-{ 20.205616, 13.35712, 3.7 },
-{ 20.205206, 13.358717, 3.6 },
-{ 20.203382, 13.358285, 3.6 },
-{ 20.205662, 13.35686, 3.6 },
-{ 20.20475, 13.358976, 3.6 },
-{ 20.20393, 13.359624, 3.6 },
-{ 20.205114, 13.35794, 3.7 },
-{ 20.203291, 13.358587, 3.7 },
-{ 20.20598, 13.359279, 3.7 },
-{ 20.204979, 13.358847, 3.7 },
-{ 20.203156, 13.359408, 3.7 },
-{ 20.204021, 13.35794, 3.6 },
-{ 20.20475, 13.361092, 3.6 },
-{ 20.204067, 13.360789, 3.6 },
-{ 20.202608, 13.361135, 3.6 },
-{ 20.204067, 13.359408, 3.6 },
-{ 20.202244, 13.359235, 3.7 },
-{ 20.202471, 13.360271, 3.7 },
-{ 20.204477, 13.359754, 3.7 },
-{ 20.202379, 13.361438, 3.7 },
-{ 20.203018, 13.362041, 3.7 },
-{ 20.203018, 13.35971, 3.6 },
-{ 20.202835, 13.360487, 3.6 },
-{ 20.202745, 13.363251, 3.6 },
-{ 20.201969, 13.361264, 3.6 },
-{ 20.201834, 13.361783, 3.6 },
-{ 20.203291, 13.361869, 3.6 },
-{ 20.201696, 13.363078, 3.6 },
-{ 20.202654, 13.362733, 3.6 },
-{ 20.202881, 13.36364, 3.6 },
-{ 20.200968, 13.364028, 3.6 },
-{ 20.201923, 13.362258, 3.6 },
-{ 20.201424, 13.363165, 3.6 },
-{ 20.201332, 13.361438, 3.6 },
-{ 20.201378, 13.363338, 3.6 },
-{ 20.201286, 13.364805, 3.6 },
-{ 20.201969, 13.365582, 3.6 },
-{ 20.201788, 13.363294, 3.6 },
-{ 20.20188, 13.363898, 3.6 },
-{ 20.201332, 13.364244, 3.6 },
-{ 20.200056, 13.365021, 3.6 },
-{ 20.201468, 13.366575, 3.6 },
-{ 20.200056, 13.364676, 3.6 },
-{ 20.200876, 13.363726, 3.6 },
-{ 20.201286, 13.36541, 3.6 },
-{ 20.199736, 13.365971, 3.6 },
-{ 20.200237, 13.366014, 3.6 },
-{ 20.200512, 13.365712, 3.6 },
-{ 20.201605, 13.365496, 3.6 },
-{ 20.199919, 13.365928, 3.6 },
-{ 20.200968, 13.366878, 3.6 },
-{ 20.199873, 13.366532, 3.6 },
-{ 20.199144, 13.36541, 3.6 },
-{ 20.199509, 13.367396, 3.6 },
-{ 20.200237, 13.367007, 3.6 },
-{ 20.200283, 13.366921, 3.6 },
-{ 20.199873, 13.367957, 3.6 },
-{ 20.19919, 13.367785, 3.6 },
-{ 20.199053, 13.368174, 3.6 },
-{ 20.198095, 13.367352, 3.6 },
-{ 20.197594, 13.367482, 3.6 },
-{ 20.199554, 13.368174, 3.6 },
-{ 20.19919, 13.369641, 3.6 },
-{ 20.19887, 13.368562, 3.6 },
-{ 20.199736, 13.369037, 3.6 },
-{ 20.19846, 13.369166, 3.6 },
-{ 20.19805, 13.367827, 3.6 },
-{ 20.199053, 13.368734, 3.6 },
-{ 20.198505, 13.368605, 3.6 },
-{ 20.197548, 13.368475, 3.6 },
-{ 20.199144, 13.369901, 3.6 },
-{ 20.19805, 13.369512, 3.5 },
-{ 20.198505, 13.371196, 3.5 },
-{ 20.199371, 13.368691, 3.5 },
-{ 20.198597, 13.370936, 3.5 },
-{ 20.198689, 13.369684, 3.5 },
-{ 20.198505, 13.370591, 3.6 },
-{ 20.19919, 13.369771, 3.6 },
-{ 20.198368, 13.371109, 3.6 },
-{ 20.198414, 13.371109, 3.6 },
-{ 20.198095, 13.370893, 3.6 },
-{ 20.196272, 13.369771, 3.6 },
-{ 20.197958, 13.370851, 3.6 },
-{ 20.198643, 13.370289, 3.6 },
-{ 20.196911, 13.371757, 3.6 },
-{ 20.197321, 13.370029, 3.6 },
-{ 20.197639, 13.371411, 3.5 },
-{ 20.196318, 13.372275, 3.5 },
-{ 20.197866, 13.372405, 3.5 },
-{ 20.197777, 13.372146, 3.5 },
-{ 20.196272, 13.372448, 3.5 },
-{ 20.194403, 13.371584, 3.5 },
-{ 20.196865, 13.37452, 3.5 },
-{ 20.196226, 13.372578, 3.5 },
-{ 20.195816, 13.372361, 3.5 },
-{ 20.195633, 13.372361, 3.5 },
-{ 20.195816, 13.372318, 3.5 },
-{ 20.197275, 13.371239, 3.5 },
-{ 20.196819, 13.372578, 3.5 },
-{ 20.19618, 13.373138, 3.5 },
-{ 20.194721, 13.37478, 3.5 },
-{ 20.195452, 13.374002, 3.5 },
-{ 20.196501, 13.375557, 3.5 },
-{ 20.195589, 13.374823, 3.5 },
-{ 20.194494, 13.372491, 3.5 },
-{ 20.19659, 13.374088, 3.5 },
-{ 20.195452, 13.373311, 3.5 },
-{ 20.196318, 13.372405, 3.5 },
-{ 20.19331, 13.375168, 3.5 },
-{ 20.195498, 13.376162, 3.5 },
-{ 20.196272, 13.374348, 3.5 },
-{ 20.195589, 13.376204, 3.5 },
-{ 20.194859, 13.374693, 3.5 },
-{ 20.195679, 13.37478, 3.5 },
-{ 20.196089, 13.374563, 3.5 },
-{ 20.194221, 13.374823, 3.5 },
-{ 20.195679, 13.375384, 3.5 },
-{ 20.194494, 13.375988, 3.5 },
-{ 20.19536, 13.376593, 3.5 },
-{ 20.193674, 13.374477, 3.5 },
-{ 20.195633, 13.376334, 3.5 },
-{ 20.193583, 13.374823, 3.5 },
-{ 20.19372, 13.377154, 3.5 },
-{ 20.196045, 13.376377, 3.5 },
-{ 20.193766, 13.377414, 3.5 },
-{ 20.19331, 13.375643, 3.5 },
-{ 20.1929, 13.375772, 3.5 },
-{ 20.193993, 13.377111, 3.5 },
-{ 20.193081, 13.376809, 3.5 },
-{ 20.193081, 13.375902, 3.5 },
-{ 20.193264, 13.375643, 3.5 },
-{ 20.194176, 13.375082, 3.5 },
-{ 20.194176, 13.377284, 3.5 },
-{ 20.194586, 13.377327, 3.5 },
-{ 20.195042, 13.377586, 3.5 },
-{ 20.192169, 13.377802, 3.5 },
-{ 20.193491, 13.378449, 3.5 },
-{ 20.193264, 13.377889, 3.5 },
-{ 20.193491, 13.378277, 3.5 },
-{ 20.193172, 13.376377, 3.5 },
-{ 20.192625, 13.377284, 3.5 },
-{ 20.193947, 13.377154, 3.5 },
-{ 20.193491, 13.377802, 3.5 },
-{ 20.192488, 13.378449, 3.5 },
-{ 20.192488, 13.377111, 3.5 },
-{ 20.193628, 13.378277, 3.5 },
-{ 20.192671, 13.376982, 3.4 },
-{ 20.192579, 13.378839, 3.4 },
-{ 20.192854, 13.379616, 3.4 },
-{ 20.191441, 13.378536, 3.4 },
-{ 20.192215, 13.380609, 3.4 },
-{ 20.191713, 13.379184, 3.5 },
-{ 20.192352, 13.378795, 3.5 },
-{ 20.191805, 13.379831, 3.5 },
-{ 20.193537, 13.379011, 3.5 },
-{ 20.193081, 13.378839, 3.5 },
-{ 20.1929, 13.378449, 3.4 },
-{ 20.19071, 13.380695, 3.4 },
-{ 20.192261, 13.37927, 3.4 },
-{ 20.190939, 13.379529, 3.4 },
-{ 20.1903, 13.380695, 3.4 },
-{ 20.191713, 13.380479, 3.4 },
-{ 20.191395, 13.379918, 3.4 },
-{ 20.190575, 13.380393, 3.4 },
-{ 20.192944, 13.381083, 3.4 },
-{ 20.192169, 13.380349, 3.4 },
-{ 20.189709, 13.379702, 3.4 },
-{ 20.192032, 13.38117, 3.4 },
-{ 20.190575, 13.379572, 3.4 },
-{ 20.19021, 13.380177, 3.4 },
-{ 20.191668, 13.380609, 3.4 },
-{ 20.190939, 13.381299, 3.4 },
-{ 20.189981, 13.381126, 3.4 },
-{ 20.191076, 13.381429, 3.4 },
-{ 20.191713, 13.380349, 3.4 },
-{ 20.191212, 13.380954, 3.4 },
-{ 20.189342, 13.379227, 3.4 },
-{ 20.190893, 13.381516, 3.4 },
-{ 20.192808, 13.381731, 3.4 },
-{ 20.190802, 13.378968, 3.4 },
-{ 20.191349, 13.380997, 3.4 },
-{ 20.190165, 13.381041, 3.4 },
-{ 20.192215, 13.382725, 3.4 },
-{ 20.191076, 13.382163, 3.4 },
-{ 20.188797, 13.380954, 3.4 },
-{ 20.189798, 13.381473, 3.4 },
-{ 20.190392, 13.381343, 3.4 },
-{ 20.189161, 13.382854, 3.4 },
-{ 20.189116, 13.38212, 3.4 },
-{ 20.190802, 13.381299, 3.4 },
-{ 20.188751, 13.383026, 3.4 },
-{ 20.191349, 13.382725, 3.4 },
-{ 20.18784, 13.381473, 3.4 },
-{ 20.190529, 13.384495, 3.4 },
-{ 20.189663, 13.382725, 3.4 },
-{ 20.188295, 13.383286, 3.4 },
-{ 20.189798, 13.382681, 3.4 },
-{ 20.189844, 13.384927, 3.4 },
-{ 20.188751, 13.381601, 3.4 },
-{ 20.188978, 13.381731, 3.4 },
-{ 20.18784, 13.382508, 3.4 },
-{ 20.188978, 13.382163, 3.4 },
-{ 20.188932, 13.3832, 3.4 },
-{ 20.188978, 13.3832, 3.4 },
-{ 20.187794, 13.383458, 3.4 },
-{ 20.187794, 13.383718, 3.4 },
-{ 20.18907, 13.382422, 3.4 },
-{ 20.18866, 13.384106, 3.4 },
-{ 20.188797, 13.383415, 3.4 },
-{ 20.188021, 13.38484, 3.4 },
-{ 20.189388, 13.383545, 3.4 },
-{ 20.188112, 13.384581, 3.4 },
-{ 20.189388, 13.385272, 3.4 },
-{ 20.187748, 13.38415, 3.4 },
-{ 20.187475, 13.384408, 3.4 },
-{ 20.188522, 13.385402, 3.4 },
-{ 20.188568, 13.384365, 3.4 },
-{ 20.187519, 13.38402, 3.4 },
-{ 20.187702, 13.384495, 3.4 },
-{ 20.188797, 13.384797, 3.4 },
-{ 20.187063, 13.386005, 3.4 },
-{ 20.188387, 13.384106, 3.4 },
-{ 20.186836, 13.384538, 3.4 },
-{ 20.187338, 13.385229, 3.4 },
-{ 20.188477, 13.385272, 3.4 },
-{ 20.187109, 13.385358, 3.4 },
-{ 20.186974, 13.386999, 3.4 },
-{ 20.186426, 13.385877, 3.4 },
-{ 20.185925, 13.385142, 3.4 },
-{ 20.186653, 13.386222, 3.4 },
-{ 20.18638, 13.386049, 3.4 },
-{ 20.187109, 13.385358, 3.4 },
-{ 20.185879, 13.386437, 3.4 },
-{ 20.185377, 13.385272, 3.4 },
-{ 20.185514, 13.384106, 3.4 },
-{ 20.185606, 13.386524, 3.4 },
-{ 20.184694, 13.386395, 3.4 },
-{ 20.184786, 13.387431, 3.4 },
-{ 20.186974, 13.385445, 3.4 },
-{ 20.186289, 13.387042, 3.4 },
-{ 20.185242, 13.387172, 3.4 },
-{ 20.185013, 13.387474, 3.3 },
-{ 20.185331, 13.387129, 3.3 },
-{ 20.18556, 13.388683, 3.3 },
-{ 20.185514, 13.386869, 3.3 },
-{ 20.185423, 13.38674, 3.3 },
-{ 20.18515, 13.386395, 3.3 },
-{ 20.184557, 13.386697, 3.3 },
-{ 20.184511, 13.388208, 3.3 },
-{ 20.183599, 13.386697, 3.3 },
-{ 20.183691, 13.386999, 3.3 },
-{ 20.184557, 13.386999, 3.4 },
-{ 20.185377, 13.386827, 3.4 },
-{ 20.184557, 13.386999, 3.4 },
-{ 20.184603, 13.387085, 3.4 },
-{ 20.184284, 13.386912, 3.4 },
-{ 20.184649, 13.388597, 3.3 },
-{ 20.183737, 13.388208, 3.3 },
-{ 20.184786, 13.38769, 3.3 },
-{ 20.18433, 13.387992, 3.3 },
-{ 20.183008, 13.388165, 3.3 },
-{ 20.185787, 13.388769, 3.3 },
-{ 20.183144, 13.389331, 3.3 },
-{ 20.183052, 13.390539, 3.3 },
-{ 20.184921, 13.389461, 3.3 },
-{ 20.182825, 13.38756, 3.3 },
-{ 20.182507, 13.387344, 3.3 },
-{ 20.182642, 13.388986, 3.3 },
-{ 20.183737, 13.388165, 3.3 },
-{ 20.182186, 13.388639, 3.3 },
-{ 20.182278, 13.38851, 3.3 },
-{ 20.183599, 13.388467, 3.3 },
-{ 20.184238, 13.389244, 3.3 },
-{ 20.183372, 13.388769, 3.3 },
-{ 20.182596, 13.388942, 3.3 },
-{ 20.181776, 13.388165, 3.3 },
-{ 20.181549, 13.39041, 3.3 },
-{ 20.182779, 13.389071, 3.3 },
-{ 20.181549, 13.389849, 3.3 },
-{ 20.181959, 13.390324, 3.3 },
-{ 20.183008, 13.388597, 3.3 },
-{ 20.182642, 13.389892, 3.3 },
-{ 20.181503, 13.391058, 3.3 },
-{ 20.18173, 13.390108, 3.3 },
-{ 20.182369, 13.390626, 3.3 },
-{ 20.181366, 13.390151, 3.3 },
-{ 20.181868, 13.389503, 3.3 },
-{ 20.179726, 13.391965, 3.3 },
-{ 20.182096, 13.391058, 3.3 },
-{ 20.180773, 13.392008, 3.3 },
-{ 20.180227, 13.390626, 3.3 },
-{ 20.18214, 13.390928, 3.3 },
-{ 20.181047, 13.390238, 3.3 },
-{ 20.180454, 13.391576, 3.3 },
-{ 20.180546, 13.390367, 3.3 },
-{ 20.181595, 13.391273, 3.3 },
-{ 20.181595, 13.390453, 3.3 },
-{ 20.178951, 13.39136, 3.3 },
-{ 20.179634, 13.391014, 3.3 },
-{ 20.179953, 13.392958, 3.3 },
-{ 20.181776, 13.389978, 3.3 },
-{ 20.179771, 13.39244, 3.3 },
-{ 20.179771, 13.392223, 3.3 },
-{ 20.180819, 13.393865, 3.3 },
-{ 20.182642, 13.392958, 3.3 },
-{ 20.18009, 13.390669, 3.3 },
-{ 20.179041, 13.39244, 3.3 },
-{ 20.179998, 13.392266, 3.3 },
-{ 20.180546, 13.392094, 3.3 },
-{ 20.179361, 13.39313, 3.3 },
-{ 20.179953, 13.391663, 3.3 },
-{ 20.177856, 13.393303, 3.3 },
-{ 20.18009, 13.390324, 3.3 },
-{ 20.179451, 13.393648, 3.3 },
-{ 20.179178, 13.391878, 3.3 },
-{ 20.177263, 13.392612, 3.3 },
-{ 20.177628, 13.39395, 3.3 },
-{ 20.177492, 13.392266, 3.3 },
-{ 20.178312, 13.392785, 3.3 },
-{ 20.179543, 13.391706, 3.3 },
-{ 20.178129, 13.393821, 3.3 },
-{ 20.180136, 13.393217, 3.3 },
-{ 20.178129, 13.394857, 3.3 },
-{ 20.178722, 13.392008, 3.3 },
-{ 20.178905, 13.394512, 3.3 },
-{ 20.178495, 13.393692, 3.3 },
-{ 20.178175, 13.393562, 3.2 },
-{ 20.177765, 13.395894, 3.2 },
-{ 20.178722, 13.393605, 3.2 },
-{ 20.177628, 13.395548, 3.2 },
-{ 20.177128, 13.393303, 3.2 },
-{ 20.177719, 13.395289, 3.3 },
-{ 20.176945, 13.394598, 3.3 },
-{ 20.177309, 13.394037, 3.3 },
-{ 20.17585, 13.396152, 3.3 },
-{ 20.177673, 13.394123, 3.3 },
-{ 20.176853, 13.395375, 3.3 },
-{ 20.177856, 13.394425, 3.3 },
-{ 20.176991, 13.394469, 3.3 },
-{ 20.176079, 13.39408, 3.3 },
-{ 20.177082, 13.394857, 3.3 },
-{ 20.177673, 13.395332, 3.2 },
-{ 20.17576, 13.395505, 3.2 },
-{ 20.176306, 13.394814, 3.2 },
-{ 20.174711, 13.394814, 3.2 },
-{ 20.17576, 13.394685, 3.2 },
-{ 20.176079, 13.39503, 3.3 },
-{ 20.176125, 13.394382, 3.3 },
-{ 20.174984, 13.395635, 3.3 },
-{ 20.176397, 13.394512, 3.3 },
-{ 20.176262, 13.395419, 3.3 },
-{ 20.174711, 13.396325, 3.3 },
-{ 20.176079, 13.395289, 3.3 },
-{ 20.17544, 13.39611, 3.3 },
-{ 20.176535, 13.397102, 3.3 },
-{ 20.175669, 13.395073, 3.3 },
-{ 20.175714, 13.397577, 3.2 },
-{ 20.176079, 13.396152, 3.2 },
-{ 20.175669, 13.396152, 3.2 },
-{ 20.175623, 13.397189, 3.2 },
-{ 20.174347, 13.396455, 3.2 },
-{ 20.174164, 13.395505, 3.2 },
-{ 20.175076, 13.395635, 3.2 },
-{ 20.1738, 13.396585, 3.2 },
-{ 20.174301, 13.398829, 3.2 },
-{ 20.175259, 13.396974, 3.2 },
-{ 20.172661, 13.396585, 3.2 },
-{ 20.173845, 13.39788, 3.2 },
-{ 20.175121, 13.396023, 3.2 },
-{ 20.174711, 13.398052, 3.2 },
-{ 20.17421, 13.398096, 3.2 },
-{ 20.174938, 13.397362, 3.2 },
-{ 20.175076, 13.397232, 3.2 },
-{ 20.173571, 13.398226, 3.2 },
-{ 20.173206, 13.397059, 3.2 },
-{ 20.173662, 13.398269, 3.2 },
-{ 20.174438, 13.398527, 3.2 },
-{ 20.173891, 13.397491, 3.2 },
-{ 20.17421, 13.398484, 3.2 },
-{ 20.172661, 13.398829, 3.2 },
-{ 20.173845, 13.400384, 3.2 },
-{ 20.171839, 13.398744, 3.2 },
-{ 20.173206, 13.398398, 3.2 },
-{ 20.173025, 13.400384, 3.2 },
-{ 20.173845, 13.399434, 3.2 },
-{ 20.172295, 13.399046, 3.2 },
-{ 20.172934, 13.399953, 3.2 },
-{ 20.171612, 13.399434, 3.2 },
-{ 20.173344, 13.400903, 3.2 },
-{ 20.17234, 13.399478, 3.2 },
-{ 20.171749, 13.398398, 3.2 },
-{ 20.1707, 13.399176, 3.2 },
-{ 20.17275, 13.399607, 3.2 },
-{ 20.172159, 13.400255, 3.2 },
-{ 20.17275, 13.399607, 3.2 },
-{ 20.172705, 13.398829, 3.2 },
-{ 20.171064, 13.400168, 3.2 },
-{ 20.173435, 13.400255, 3.2 },
-{ 20.173298, 13.400773, 3.2 },
-{ 20.172615, 13.400557, 3.2 },
-{ 20.171293, 13.400686, 3.2 },
-{ 20.173161, 13.400168, 3.2 },
-{ 20.17111, 13.400384, 3.2 },
-{ 20.172615, 13.40073, 3.2 },
-{ 20.170927, 13.40073, 3.2 },
-{ 20.170881, 13.400643, 3.2 },
-{ 20.171156, 13.399651, 3.2 },
-{ 20.170881, 13.401334, 3.2 },
-{ 20.171156, 13.401421, 3.2 },
-{ 20.1707, 13.4006, 3.2 },
-{ 20.172113, 13.401161, 3.2 },
-{ 20.16997, 13.400859, 3.2 },
-{ 20.171293, 13.401723, 3.2 },
-{ 20.172295, 13.401378, 3.2 },
-{ 20.1707, 13.402328, 3.2 },
-{ 20.17111, 13.40155, 3.2 },
-{ 20.170517, 13.400903, 3.2 },
-{ 20.171566, 13.401723, 3.2 },
-{ 20.169333, 13.400298, 3.2 },
-{ 20.16906, 13.400643, 3.2 },
-{ 20.170792, 13.40263, 3.2 },
-{ 20.170837, 13.402068, 3.2 },
-{ 20.171474, 13.401809, 3.2 },
-{ 20.171749, 13.403061, 3.2 },
-{ 20.168558, 13.402155, 3.2 },
-{ 20.16997, 13.403234, 3.2 },
-{ 20.170517, 13.4025, 3.2 },
-{ 20.170153, 13.401291, 3.2 },
-{ 20.169743, 13.401982, 3.2 },
-{ 20.170382, 13.403105, 3.2 },
-{ 20.171202, 13.402457, 3.2 },
-{ 20.169287, 13.403493, 3.2 },
-{ 20.171202, 13.404443, 3.2 },
-{ 20.169424, 13.404962, 3.2 },
-{ 20.170336, 13.403018, 3.2 },
-{ 20.169333, 13.40345, 3.2 },
-{ 20.167555, 13.40276, 3.2 },
-{ 20.16947, 13.403795, 3.2 },
-{ 20.168421, 13.404572, 3.2 },
-{ 20.169287, 13.402845, 3.2 },
-{ 20.170609, 13.403795, 3.2 },
-{ 20.168148, 13.404012, 3.2 },
-{ 20.16947, 13.403968, 3.2 },
-{ 20.168785, 13.405652, 3.2 },
-{ 20.167828, 13.40453, 3.2 },
-{ 20.168648, 13.404875, 3.2 },
-{ 20.168831, 13.404832, 3.2 },
-{ 20.168558, 13.405437, 3.2 },
-{ 20.168375, 13.404832, 3.2 },
-{ 20.167236, 13.404918, 3.2 },
-{ 20.168922, 13.405479, 3.2 },
-{ 20.167418, 13.404659, 3.2 },
-{ 20.16728, 13.404962, 3.2 },
-{ 20.168512, 13.404357, 3.2 },
-{ 20.167191, 13.404313, 3.2 },
-{ 20.168739, 13.404615, 3.2 },
-{ 20.168922, 13.40617, 3.2 },
-{ 20.166552, 13.4044, 3.2 },
-{ 20.169149, 13.405479, 3.2 },
-{ 20.167007, 13.40604, 3.2 },
-{ 20.16687, 13.4044, 3.2 },
-{ 20.166643, 13.405522, 3.2 },
-{ 20.165594, 13.405739, 3.2 },
-{ 20.168192, 13.405047, 3.2 },
-{ 20.167782, 13.405005, 3.2 },
-{ 20.167236, 13.405695, 3.2 },
-{ 20.167463, 13.406472, 3.2 },
-{ 20.168375, 13.405565, 3.2 },
-{ 20.167555, 13.405522, 3.2 },
-{ 20.166735, 13.406689, 3.2 },
-{ 20.167601, 13.406429, 3.2 },
-{ 20.165913, 13.407552, 3.2 },
-{ 20.168011, 13.406775, 3.2 },
-{ 20.165913, 13.405911, 3.2 },
-{ 20.166142, 13.407207, 3.2 },
-{ 20.16678, 13.407941, 3.2 },
-{ 20.166506, 13.406861, 3.2 },
-{ 20.166506, 13.406602, 3.2 },
-{ 20.16728, 13.407034, 3.2 },
-{ 20.165503, 13.406645, 3.2 },
-{ 20.16678, 13.406127, 3.2 },
-{ 20.16605, 13.406127, 3.2 },
-{ 20.165047, 13.407509, 3.2 },
-{ 20.166597, 13.406861, 3.2 },
-{ 20.167145, 13.408459, 3.2 },
-{ 20.165276, 13.408934, 3.2 },
-{ 20.165913, 13.407422, 3.2 },
-{ 20.166233, 13.407207, 3.2 },
-{ 20.166325, 13.408502, 3.2 },
-{ 20.165367, 13.407336, 3.2 },
-{ 20.165184, 13.407941, 3.2 },
-{ 20.166824, 13.408156, 3.2 },
-{ 20.165548, 13.408199, 3.2 },
-{ 20.16605, 13.407509, 3.2 },
-{ 20.165092, 13.407724, 3.2 },
-{ 20.16523, 13.409451, 3.2 },
-{ 20.165869, 13.409106, 3.2 },
-{ 20.16441, 13.407724, 3.2 },
-{ 20.164911, 13.409883, 3.2 },
-{ 20.165823, 13.409106, 3.2 },
-{ 20.166325, 13.408674, 3.2 },
-{ 20.164865, 13.40902, 3.2 },
-{ 20.165459, 13.409322, 3.2 },
-{ 20.163269, 13.408286, 3.2 },
-{ 20.165731, 13.408977, 3.2 },
-{ 20.16605, 13.410316, 3.2 },
-{ 20.165731, 13.408934, 3.2 },
-{ 20.163954, 13.409193, 3.2 },
-{ 20.164364, 13.408459, 3.2 },
-{ 20.16605, 13.410143, 3.2 },
-{ 20.163589, 13.410143, 3.2 },
-{ 20.162632, 13.40902, 3.2 },
-{ 20.164911, 13.410574, 3.2 },
-{ 20.165548, 13.409236, 3.2 },
-{ 20.163269, 13.410704, 3.2 },
-{ 20.164637, 13.410704, 3.2 },
-{ 20.164591, 13.410574, 3.2 },
-{ 20.165321, 13.409409, 3.2 },
-{ 20.163361, 13.409841, 3.2 },
-{ 20.163452, 13.410229, 3.2 },
-{ 20.163544, 13.411525, 3.2 },
-{ 20.163589, 13.409711, 3.2 },
-{ 20.164091, 13.410574, 3.2 },
-{ 20.162586, 13.411956, 3.2 },
-{ 20.163498, 13.410143, 3.2 },
-{ 20.16254, 13.410531, 3.2 },
-{ 20.163862, 13.41174, 3.2 },
-{ 20.163862, 13.409495, 3.2 },
-{ 20.160809, 13.41174, 3.2 },
-{ 20.163134, 13.410488, 3.2 },
-{ 20.164, 13.412172, 3.2 },
-{ 20.162996, 13.412603, 3.2 },
-{ 20.163134, 13.410401, 3.2 },
-{ 20.16441, 13.412388, 3.2 },
-{ 20.163908, 13.412086, 3.2 },
-{ 20.162678, 13.412172, 3.2 },
-{ 20.162996, 13.41269, 3.2 },
-{ 20.163042, 13.413338, 3.2 },
-{ 20.162039, 13.412992, 3.2 },
-{ 20.162312, 13.41187, 3.2 },
-{ 20.161674, 13.413165, 3.2 },
-{ 20.163725, 13.411783, 3.2 },
-{ 20.162859, 13.413727, 3.2 },
-{ 20.161901, 13.41282, 3.2 },
-{ 20.161219, 13.411093, 3.2 },
-{ 20.162268, 13.413985, 3.2 },
-{ 20.161219, 13.413467, 3.2 },
-{ 20.161491, 13.413035, 3.2 },
-{ 20.161858, 13.413208, 3.2 },
-{ 20.160124, 13.413942, 3.2 },
-{ 20.162495, 13.413727, 3.2 },
-{ 20.161812, 13.413942, 3.2 },
-{ 20.162724, 13.41256, 3.2 },
-{ 20.16172, 13.413856, 3.2 },
-{ 20.161219, 13.412992, 3.2 },
-{ 20.161491, 13.413985, 3.2 },
-{ 20.161812, 13.411956, 3.2 },
-{ 20.16017, 13.413338, 3.2 },
-{ 20.161812, 13.414115, 3.2 },
-{ 20.161674, 13.414158, 3.2 },
-{ 20.161173, 13.414202, 3.2 },
-{ 20.161674, 13.413165, 3.2 },
-{ 20.162403, 13.41541, 3.2 },
-{ 20.161219, 13.414677, 3.2 },
-{ 20.161173, 13.414029, 3.2 },
-{ 20.159988, 13.414633, 3.2 },
-{ 20.160444, 13.413338, 3.2 },
-{ 20.161674, 13.414935, 3.2 },
-{ 20.160625, 13.414504, 3.2 },
-{ 20.161127, 13.415152, 3.2 },
-{ 20.16131, 13.414158, 3.2 },
-{ 20.160261, 13.41446, 3.2 },
-{ 20.161173, 13.414504, 3.2 },
-{ 20.159668, 13.414417, 3.2 },
-{ 20.160671, 13.415972, 3.2 },
-{ 20.160809, 13.414892, 3.2 },
-{ 20.160625, 13.415799, 3.2 },
-{ 20.159533, 13.414762, 3.2 },
-{ 20.158802, 13.414979, 3.2 },
-{ 20.158894, 13.415195, 3.2 },
-{ 20.159487, 13.416533, 3.2 },
-{ 20.161446, 13.416058, 3.2 },
-{ 20.159668, 13.415108, 3.2 },
-{ 20.158028, 13.415799, 3.2 },
-{ 20.159533, 13.416274, 3.2 },
-{ 20.159988, 13.415842, 3.2 },
-{ 20.160261, 13.416533, 3.2 },
-{ 20.160671, 13.416447, 3.2 },
-{ 20.160854, 13.417569, 3.2 },
-{ 20.16017, 13.416015, 3.2 },
-{ 20.157709, 13.414805, 3.2 },
-{ 20.160534, 13.415497, 3.2 },
-{ 20.158211, 13.415756, 3.2 },
-{ 20.159349, 13.416187, 3.2 },
-{ 20.159851, 13.417483, 3.2 },
-{ 20.15871, 13.415972, 3.2 },
-{ 20.158939, 13.417008, 3.2 },
-{ 20.159533, 13.416835, 3.2 },
-{ 20.159395, 13.417914, 3.2 },
-{ 20.1583, 13.417137, 3.2 },
-{ 20.158894, 13.418736, 3.2 },
-{ 20.158848, 13.417397, 3.2 },
-{ 20.158438, 13.416101, 3.2 },
-{ 20.157936, 13.41636, 3.2 },
-{ 20.15871, 13.416879, 3.2 },
-{ 20.159578, 13.418131, 3.2 },
-{ 20.157755, 13.417094, 3.2 },
-{ 20.159395, 13.417612, 3.2 },
-{ 20.160034, 13.418261, 3.2 },
-{ 20.159304, 13.417699, 3.2 },
-{ 20.159533, 13.418217, 3.2 },
-{ 20.158211, 13.417958, 3.2 },
-{ 20.158529, 13.418778, 3.2 },
-{ 20.157936, 13.418433, 3.2 },
-{ 20.158985, 13.418389, 3.2 },
-{ 20.15871, 13.419038, 3.2 },
-{ 20.159166, 13.418001, 3.2 },
-{ 20.158529, 13.418389, 3.2 },
-{ 20.157755, 13.417786, 3.2 },
-{ 20.157116, 13.420506, 3.2 },
-{ 20.158211, 13.417742, 3.2 },
-{ 20.156158, 13.418692, 3.2 },
-{ 20.158165, 13.418303, 3.2 },
-{ 20.157663, 13.419901, 3.2 },
-{ 20.158165, 13.418476, 3.2 },
-{ 20.157663, 13.420765, 3.2 },
-{ 20.156797, 13.420463, 3.2 },
-{ 20.15789, 13.419296, 3.2 },
-{ 20.156889, 13.419728, 3.2 },
-{ 20.15748, 13.419296, 3.2 },
-{ 20.156433, 13.418736, 3.2 },
-{ 20.158392, 13.420851, 3.2 },
-{ 20.154928, 13.419383, 3.2 },
-{ 20.157389, 13.420031, 3.2 },
-{ 20.158621, 13.421066, 3.2 },
-{ 20.15748, 13.419383, 3.2 },
-{ 20.157663, 13.419988, 3.2 },
-{ 20.156843, 13.419944, 3.2 },
-{ 20.157162, 13.420765, 3.2 },
-{ 20.156752, 13.419253, 3.2 },
-{ 20.155794, 13.421066, 3.2 },
-{ 20.156706, 13.420506, 3.2 },
-{ 20.155521, 13.420591, 3.2 },
-{ 20.157572, 13.420203, 3.2 },
-{ 20.155384, 13.420765, 3.2 },
-{ 20.157936, 13.421283, 3.2 },
-{ 20.156113, 13.420894, 3.2 },
-{ 20.156204, 13.420246, 3.2 },
-{ 20.156477, 13.421153, 3.2 },
-{ 20.156933, 13.421585, 3.2 },
-{ 20.157299, 13.422448, 3.2 },
-{ 20.156933, 13.42206, 3.2 },
-{ 20.156067, 13.421844, 3.2 },
-{ 20.155384, 13.421585, 3.2 },
-{ 20.157982, 13.42098, 3.2 },
-{ 20.156204, 13.423355, 3.2 },
-{ 20.155611, 13.420074, 3.2 },
-{ 20.155565, 13.421844, 3.2 },
-{ 20.156067, 13.421498, 3.2 },
-{ 20.155748, 13.421844, 3.2 },
-{ 20.156569, 13.421758, 3.2 },
-{ 20.156979, 13.420851, 3.2 },
-{ 20.156843, 13.422665, 3.2 },
-{ 20.15543, 13.420808, 3.2 },
-{ 20.156387, 13.4237, 3.2 },
-{ 20.156387, 13.422103, 3.2 },
-{ 20.154837, 13.421326, 3.2 },
-{ 20.155794, 13.423398, 3.2 },
-{ 20.156021, 13.421628, 3.2 },
-{ 20.156296, 13.422405, 3.2 },
-{ 20.155247, 13.423485, 3.2 },
-{ 20.154882, 13.423269, 3.2 },
-{ 20.155201, 13.42301, 3.2 },
-{ 20.155565, 13.422665, 3.2 },
-{ 20.156296, 13.422448, 3.2 },
-{ 20.155977, 13.423355, 3.2 },
-{ 20.154655, 13.423744, 3.2 },
-{ 20.15502, 13.424262, 3.2 },
-{ 20.154335, 13.423787, 3.2 },
-{ 20.155521, 13.422708, 3.2 },
-{ 20.154655, 13.4237, 3.2 },
-{ 20.153469, 13.423053, 3.2 },
-{ 20.155247, 13.42396, 3.2 },
-{ 20.153788, 13.424694, 3.2 },
-{ 20.153744, 13.42396, 3.2 },
-{ 20.154564, 13.424175, 3.2 },
-{ 20.156113, 13.423485, 3.2 },
-{ 20.155338, 13.425471, 3.2 },
-{ 20.154289, 13.42465, 3.2 },
-{ 20.153242, 13.423571, 3.2 },
-{ 20.155748, 13.422578, 3.2 },
-{ 20.154655, 13.424219, 3.2 },
-{ 20.153013, 13.424694, 3.2 },
-{ 20.154699, 13.42491, 3.2 },
-{ 20.153788, 13.425427, 3.2 },
-{ 20.153652, 13.424521, 3.2 },
-{ 20.153151, 13.425169, 3.2 },
-{ 20.152649, 13.426291, 3.2 },
-{ 20.154928, 13.424607, 3.2 },
-{ 20.154108, 13.425212, 3.2 },
-{ 20.152832, 13.426119, 3.2 },
-{ 20.15201, 13.425385, 3.2 },
-{ 20.153971, 13.425946, 3.2 },
-{ 20.153423, 13.425817, 3.2 },
-{ 20.154289, 13.4256, 3.2 },
-{ 20.153652, 13.425427, 3.2 },
-{ 20.153059, 13.426162, 3.2 },
-{ 20.153698, 13.427629, 3.2 },
-{ 20.152466, 13.424435, 3.2 },
-{ 20.153242, 13.425989, 3.2 },
-{ 20.151327, 13.426464, 3.2 },
-{ 20.153833, 13.426723, 3.2 },
-{ 20.153788, 13.427629, 3.2 },
-{ 20.15233, 13.425427, 3.2 },
-{ 20.152512, 13.425989, 3.2 },
-{ 20.153561, 13.426809, 3.2 },
-{ 20.152832, 13.426594, 3.2 },
-{ 20.153561, 13.426939, 3.2 },
-{ 20.153423, 13.426723, 3.2 },
-{ 20.15233, 13.426377, 3.2 },
-{ 20.152786, 13.426205, 3.2 },
-{ 20.152603, 13.427544, 3.2 },
-{ 20.151327, 13.426421, 3.2 },
-{ 20.154564, 13.428451, 3.2 },
-{ 20.150599, 13.427544, 3.2 },
-{ 20.152512, 13.428407, 3.2 },
-{ 20.151508, 13.426637, 3.2 },
-{ 20.152102, 13.428579, 3.2 },
-{ 20.152193, 13.429271, 3.2 },
-{ 20.151875, 13.427327, 3.2 },
-{ 20.152922, 13.426075, 3.2 },
-{ 20.152376, 13.428061, 3.2 },
-{ 20.15192, 13.426421, 3.2 },
-{ 20.151875, 13.428234, 3.2 },
-{ 20.152922, 13.428019, 3.2 },
-{ 20.152285, 13.426551, 3.2 },
-{ 20.153469, 13.428796, 3.2 },
-{ 20.15192, 13.427629, 3.2 },
-{ 20.153469, 13.428104, 3.2 },
-{ 20.152056, 13.428579, 3.2 },
-{ 20.150553, 13.428104, 3.2 },
-{ 20.15274, 13.428753, 3.2 },
-{ 20.151783, 13.426939, 3.2 },
-{ 20.152922, 13.428191, 3.2 },
-{ 20.151737, 13.427846, 3.2 },
-{ 20.153378, 13.428191, 3.2 },
-{ 20.152147, 13.427846, 3.2 },
-{ 20.152603, 13.427544, 3.2 },
-{ 20.151646, 13.429573, 3.2 },
-{ 20.152695, 13.427327, 3.2 },
-{ 20.151964, 13.429011, 3.2 },
-{ 20.151737, 13.427241, 3.2 },
-{ 20.15192, 13.428796, 3.2 },
-{ 20.152193, 13.427976, 3.2 },
-{ 20.153242, 13.429486, 3.2 },
-{ 20.15201, 13.427414, 3.2 },
-{ 20.152922, 13.427889, 3.2 },
-{ 20.151327, 13.428278, 3.2 },
-{ 20.151554, 13.429011, 3.2 },
-{ 20.150143, 13.430134, 3.2 },
-{ 20.151646, 13.428796, 3.2 },
-{ 20.151964, 13.427932, 3.2 },
-{ 20.1516, 13.428839, 3.2 },
-{ 20.151464, 13.429314, 3.2 },
-{ 20.153059, 13.429573, 3.2 },
-{ 20.153879, 13.428451, 3.2 },
-{ 20.15242, 13.428191, 3.2 },
-{ 20.15078, 13.427414, 3.2 },
-{ 20.151737, 13.427327, 3.2 },
-{ 20.1516, 13.430134, 3.2 },
-{ 20.150461, 13.430221, 3.2 },
-{ 20.1516, 13.431084, 3.2 },
-{ 20.151236, 13.429271, 3.2 },
-{ 20.151783, 13.428104, 3.2 },
-{ 20.15192, 13.430393, 3.2 },
-{ 20.151144, 13.428451, 3.2 },
-{ 20.15242, 13.429055, 3.2 },
-{ 20.15119, 13.42953, 3.2 },
-{ 20.150963, 13.430134, 3.2 },
-{ 20.152147, 13.430091, 3.2 },
-{ 20.151327, 13.43048, 3.2 },
-{ 20.15233, 13.430393, 3.2 },
-{ 20.15233, 13.428926, 3.2 },
-{ 20.151964, 13.430264, 3.2 },
-{ 20.151875, 13.430911, 3.2 },
-{ 20.152285, 13.430436, 3.2 },
-{ 20.150688, 13.43048, 3.2 },
-{ 20.152102, 13.430868, 3.2 },
-{ 20.151373, 13.42953, 3.2 },
-{ 20.15201, 13.430264, 3.2 },
-{ 20.152193, 13.432034, 3.2 },
-{ 20.152603, 13.429055, 3.2 },
-{ 20.152239, 13.430436, 3.2 },
-{ 20.15119, 13.429875, 3.2 },
-{ 20.152239, 13.43035, 3.2 },
-{ 20.152376, 13.430005, 3.2 },
-{ 20.152466, 13.431213, 3.2 },
-{ 20.1516, 13.430955, 3.2 },
-{ 20.151737, 13.431861, 3.2 },
-{ 20.153378, 13.430955, 3.2 },
-{ 20.152376, 13.429875, 3.2 },
-{ 20.152512, 13.43035, 3.2 },
-{ 20.153833, 13.43048, 3.2 },
-{ 20.152967, 13.429098, 3.2 },
-{ 20.15242, 13.431128, 3.2 },
-{ 20.15233, 13.431386, 3.2 },
-{ 20.15119, 13.43156, 3.2 },
-{ 20.153196, 13.43156, 3.2 },
-{ 20.152056, 13.430221, 3.2 },
-{ 20.152147, 13.430738, 3.2 },
-{ 20.152466, 13.43156, 3.2 },
-{ 20.152376, 13.43212, 3.2 },
-{ 20.150187, 13.430696, 3.2 },
-{ 20.151327, 13.430868, 3.2 },
-{ 20.151646, 13.431041, 3.2 },
-{ 20.151508, 13.43048, 3.2 },
-{ 20.152285, 13.43143, 3.2 },
-{ 20.153196, 13.430609, 3.2 },
-{ 20.150507, 13.430998, 3.2 },
-{ 20.151464, 13.431128, 3.2 },
-{ 20.152603, 13.430134, 3.2 },
-{ 20.152922, 13.432293, 3.2 },
-{ 20.151875, 13.431128, 3.2 },
-{ 20.15242, 13.432034, 3.2 },
-{ 20.15201, 13.431645, 3.2 },
-{ 20.152832, 13.430825, 3.2 },
-{ 20.15192, 13.432077, 3.2 },
-{ 20.153013, 13.431343, 3.2 },
-{ 20.150553, 13.431128, 3.2 },
-{ 20.152376, 13.431386, 3.2 },
-{ 20.153105, 13.431084, 3.2 },
-{ 20.150826, 13.431688, 3.2 },
-{ 20.152239, 13.432725, 3.2 },
-{ 20.152193, 13.432077, 3.2 },
-{ 20.152239, 13.432034, 3.2 },
-{ 20.152967, 13.43238, 3.2 },
-{ 20.152603, 13.43035, 3.2 },
-{ 20.153105, 13.432207, 3.2 },
-{ 20.152285, 13.430566, 3.2 },
-{ 20.15201, 13.430566, 3.2 },
-{ 20.153013, 13.431041, 3.2 },
-{ 20.152876, 13.431688, 3.2 },
-{ 20.153059, 13.4332, 3.2 },
-{ 20.151875, 13.432293, 3.2 },
-{ 20.152695, 13.431645, 3.2 },
-{ 20.153151, 13.43048, 3.2 },
-{ 20.15201, 13.43497, 3.2 },
-{ 20.15274, 13.433718, 3.2 },
-{ 20.153698, 13.43225, 3.2 },
-{ 20.151508, 13.431818, 3.2 },
-{ 20.153013, 13.433113, 3.2 },
-{ 20.153059, 13.43307, 3.2 },
-{ 20.152832, 13.432898, 3.2 },
-{ 20.150871, 13.434322, 3.2 },
-{ 20.152832, 13.432207, 3.2 },
-{ 20.15119, 13.433847, 3.2 },
-{ 20.152922, 13.432077, 3.2 },
-{ 20.151829, 13.431128, 3.2 },
-{ 20.153925, 13.431861, 3.2 },
-{ 20.151737, 13.4332, 3.2 },
-{ 20.153332, 13.433805, 3.2 },
-{ 20.152786, 13.431948, 3.2 },
-{ 20.152376, 13.433718, 3.2 },
-{ 20.153059, 13.43415, 3.2 },
-{ 20.153925, 13.432725, 3.2 },
-{ 20.153744, 13.431948, 3.2 },
-{ 20.153288, 13.431041, 3.2 },
-{ 20.151464, 13.434754, 3.2 },
-{ 20.15233, 13.432768, 3.2 },
-{ 20.151327, 13.432725, 3.2 },
-{ 20.152147, 13.432466, 3.2 },
-{ 20.151508, 13.431818, 3.2 },
-{ 20.15242, 13.432638, 3.2 },
-{ 20.151964, 13.432509, 3.2 },
-{ 20.152056, 13.432812, 3.2 },
-{ 20.151783, 13.433762, 3.2 },
-{ 20.150963, 13.433847, 3.2 },
-{ 20.151964, 13.432855, 3.2 },
-{ 20.154108, 13.434322, 3.2 },
-{ 20.152285, 13.43389, 3.2 },
-{ 20.152967, 13.432984, 3.2 },
-{ 20.153698, 13.432423, 3.3 },
-{ 20.152922, 13.433588, 3.3 },
-{ 20.15242, 13.43402, 3.3 },
-{ 20.150599, 13.432423, 3.3 },
-{ 20.15274, 13.432595, 3.3 },
-{ 20.152512, 13.433027, 3.2 },
-{ 20.152193, 13.433113, 3.2 },
-{ 20.151554, 13.434064, 3.2 },
-{ 20.152147, 13.432984, 3.2 },
-{ 20.153744, 13.433502, 3.2 },
-{ 20.153105, 13.43333, 3.2 },
-{ 20.151419, 13.432855, 3.2 },
-{ 20.152832, 13.433588, 3.2 },
-{ 20.152285, 13.432336, 3.2 },
-{ 20.152102, 13.43307, 3.2 },
-{ 20.153332, 13.433847, 3.2 },
-{ 20.15274, 13.433977, 3.2 },
-{ 20.153423, 13.433675, 3.2 },
-{ 20.154016, 13.43294, 3.2 },
-{ 20.151964, 13.43307, 3.2 },
-{ 20.15274, 13.433588, 3.2 },
-{ 20.151691, 13.434237, 3.2 },
-{ 20.152603, 13.434625, 3.2 },
-{ 20.152056, 13.434365, 3.2 },
-{ 20.153744, 13.4332, 3.2 },
-{ 20.152922, 13.435143, 3.2 },
-{ 20.151373, 13.434064, 3.2 },
-{ 20.151098, 13.436524, 3.2 },
-{ 20.153423, 13.434193, 3.2 },
-{ 20.150963, 13.433415, 3.2 },
-{ 20.15274, 13.435229, 3.2 },
-{ 20.152285, 13.435489, 3.2 },
-{ 20.153059, 13.433718, 3.2 },
-{ 20.152376, 13.434064, 3.2 },
-{ 20.151236, 13.433545, 3.2 },
-{ 20.153151, 13.435316, 3.3 },
-{ 20.153698, 13.435014, 3.3 },
-{ 20.15201, 13.434711, 3.3 },
-{ 20.15274, 13.433588, 3.3 },
-{ 20.152512, 13.434107, 3.3 },
-{ 20.153879, 13.435445, 3.3 },
-{ 20.152285, 13.434107, 3.3 },
-{ 20.153288, 13.435014, 3.3 },
-{ 20.152147, 13.433588, 3.3 },
-{ 20.151829, 13.434322, 3.3 },
-{ 20.154289, 13.43484, 3.2 },
-{ 20.153013, 13.43402, 3.2 },
-{ 20.153652, 13.435143, 3.2 },
-{ 20.153105, 13.434365, 3.2 },
-{ 20.151281, 13.435272, 3.2 },
-{ 20.152147, 13.435359, 3.3 },
-{ 20.152056, 13.435057, 3.3 },
-{ 20.152056, 13.434237, 3.3 },
-{ 20.152147, 13.434452, 3.3 },
-{ 20.153059, 13.434279, 3.3 },
-{ 20.15274, 13.43484, 3.3 },
-{ 20.151829, 13.435014, 3.3 },
-{ 20.152695, 13.434365, 3.3 },
-{ 20.152102, 13.434711, 3.3 },
-{ 20.152876, 13.433847, 3.3 },
-{ 20.152876, 13.434625, 3.3 },
-{ 20.153105, 13.435617, 3.3 },
-{ 20.151783, 13.434452, 3.3 },
-{ 20.152876, 13.434409, 3.3 },
-{ 20.152102, 13.433977, 3.3 },
-{ 20.151829, 13.434668, 3.3 },
-{ 20.151964, 13.43389, 3.3 },
-{ 20.15242, 13.435402, 3.3 },
-{ 20.152056, 13.435143, 3.3 },
-{ 20.151098, 13.435834, 3.3 },
-{ 20.153288, 13.434754, 3.3 },
-{ 20.151737, 13.434711, 3.3 },
-{ 20.151281, 13.4351, 3.3 },
-{ 20.152239, 13.434754, 3.3 },
-{ 20.153242, 13.435143, 3.3 },
-{ 20.15242, 13.435316, 3.3 },
-{ 20.152832, 13.435617, 3.3 },
-{ 20.152239, 13.418001, 3.3 },
-{ 20.151691, 13.435964, 3.3 },
-{ 20.153879, 13.435014, 3.3 },
-{ 20.1516, 13.435747, 3.3 },
-{ 20.152512, 13.435445, 3.3 },
-{ 20.151098, 13.435791, 3.3 },
-{ 20.151281, 13.434625, 3.3 },
-{ 20.151464, 13.435834, 3.3 },
-{ 20.152512, 13.435791, 3.3 },
-{ 20.152056, 13.434625, 3.3 },
-{ 20.153059, 13.434754, 3.3 },
-{ 20.151646, 13.436481, 3.3 },
-{ 20.1516, 13.435359, 3.3 },
-{ 20.152376, 13.43484, 3.3 },
-{ 20.152466, 13.436352, 3.3 },
-{ 20.152285, 13.436352, 3.3 },
-{ 20.152285, 13.434322, 3.3 },
-{ 20.150871, 13.434754, 3.3 },
-{ 20.153332, 13.436741, 3.3 },
-{ 20.152876, 13.436611, 3.3 },
-{ 20.152285, 13.435445, 3.3 },
-{ 20.152512, 13.437604, 3.3 },
-{ 20.152147, 13.436049, 3.3 },
-{ 20.152466, 13.434884, 3.2 },
-{ 20.150963, 13.436697, 3.2 },
-{ 20.153561, 13.434711, 3.2 },
-{ 20.152922, 13.436049, 3.2 },
-{ 20.152557, 13.436654, 3.2 },
-{ 20.151464, 13.435617, 3.3 },
-{ 20.152147, 13.435661, 3.3 },
-{ 20.15201, 13.434625, 3.3 },
-{ 20.151964, 13.43592, 3.3 },
-{ 20.151829, 13.435359, 3.3 },
-{ 20.153652, 13.435445, 3.3 },
-{ 20.15274, 13.435704, 3.3 },
-{ 20.151236, 13.435402, 3.3 },
-{ 20.153332, 13.435704, 3.3 },
-{ 20.152512, 13.436136, 3.3 },
-{ 20.15201, 13.43687, 3.3 },
-{ 20.150642, 13.436568, 3.3 },
-{ 20.153196, 13.436266, 3.3 },
-{ 20.153196, 13.436266, 3.3 },
-{ 20.151554, 13.436999, 3.3 },
-{ 20.152967, 13.435402, 3.3 },
-{ 20.153151, 13.436956, 3.3 },
-{ 20.15274, 13.436611, 3.3 },
-{ 20.152512, 13.437259, 3.3 },
-{ 20.150871, 13.435316, 3.3 },
-{ 20.151691, 13.437691, 3.3 },
-{ 20.152512, 13.436395, 3.3 },
-{ 20.151144, 13.435877, 3.3 },
-{ 20.151691, 13.434625, 3.3 },
-{ 20.149504, 13.436568, 3.3 },
-{ 20.151691, 13.437906, 3.3 },
-{ 20.151464, 13.437431, 3.3 },
-{ 20.152603, 13.437691, 3.3 },
-{ 20.150642, 13.436999, 3.3 },
-{ 20.151419, 13.436395, 3.3 },
-{ 20.150599, 13.437431, 3.3 },
-{ 20.150963, 13.437604, 3.3 },
-{ 20.149776, 13.437172, 3.3 },
-{ 20.152056, 13.43687, 3.3 },
-{ 20.15201, 13.437345, 3.3 },
-{ 20.150826, 13.436827, 3.3 },
-{ 20.15078, 13.437604, 3.3 },
-{ 20.151144, 13.43687, 3.3 },
-{ 20.151691, 13.437518, 3.3 },
-{ 20.153196, 13.436999, 3.3 },
-{ 20.150688, 13.437561, 3.3 },
-{ 20.152967, 13.438166, 3.3 },
-{ 20.151236, 13.437172, 3.3 },
-{ 20.149687, 13.437604, 3.3 },
-{ 20.151737, 13.437216, 3.3 },
-{ 20.1516, 13.438251, 3.3 },
-{ 20.1516, 13.436913, 3.3 },
-{ 20.150917, 13.437647, 3.3 },
-{ 20.14996, 13.437518, 3.3 },
-{ 20.150599, 13.436697, 3.3 },
-{ 20.150917, 13.437518, 3.3 },
-{ 20.150005, 13.437647, 3.3 },
-{ 20.150599, 13.437561, 3.3 },
-{ 20.150963, 13.437863, 3.3 },
-{ 20.151009, 13.436827, 3.3 },
-{ 20.151144, 13.43782, 3.3 },
-{ 20.149139, 13.437172, 3.3 },
-{ 20.150005, 13.438209, 3.3 },
-{ 20.148363, 13.438684, 3.3 },
-{ 20.148775, 13.437302, 3.3 },
-{ 20.149231, 13.439073, 3.3 },
-{ 20.14768, 13.437086, 3.3 },
-{ 20.150553, 13.439245, 3.3 },
-{ 20.148182, 13.437129, 3.3 },
-{ 20.149321, 13.439461, 3.3 },
-{ 20.148638, 13.437518, 3.3 },
-{ 20.149641, 13.437043, 3.3 },
-{ 20.149549, 13.439201, 3.3 },
-{ 20.149412, 13.437216, 3.3 },
-{ 20.15037, 13.439763, 3.3 },
-{ 20.150187, 13.437086, 3.3 },
-{ 20.149275, 13.439979, 3.3 },
-{ 20.150963, 13.437777, 3.3 },
-{ 20.151144, 13.437518, 3.3 },
-{ 20.150415, 13.438597, 3.3 },
-{ 20.148546, 13.439245, 3.3 },
-{ 20.149094, 13.439245, 3.3 },
-{ 20.149185, 13.438684, 3.3 },
-{ 20.147497, 13.440454, 3.3 },
-{ 20.149048, 13.438856, 3.3 },
-{ 20.149048, 13.437302, 3.3 },
-{ 20.149048, 13.438856, 3.3 },
-{ 20.151464, 13.439201, 3.3 },
-{ 20.149094, 13.437216, 3.3 },
-{ 20.147589, 13.43959, 3.3 },
-{ 20.149822, 13.439893, 3.3 },
-{ 20.149731, 13.439374, 3.3 },
-{ 20.1485, 13.438338, 3.3 },
-{ 20.148455, 13.438209, 3.3 },
-{ 20.148819, 13.439201, 3.3 },
-{ 20.149321, 13.439633, 3.3 },
-{ 20.150232, 13.43959, 3.3 },
-{ 20.1485, 13.438122, 3.3 },
-{ 20.148455, 13.439548, 3.3 },
-{ 20.149231, 13.439504, 3.3 },
-{ 20.1485, 13.439979, 3.3 },
-{ 20.1485, 13.439633, 3.3 },
-{ 20.148819, 13.439676, 3.3 },
-{ 20.149595, 13.438122, 3.3 },
-{ 20.148409, 13.440583, 3.3 },
-{ 20.148273, 13.439893, 3.3 },
-{ 20.148455, 13.440454, 3.3 },
-{ 20.14996, 13.440065, 3.3 },
-{ 20.149185, 13.437863, 3.3 },
-{ 20.148182, 13.440108, 3.3 },
-{ 20.149139, 13.440281, 3.3 },
-{ 20.147224, 13.439806, 3.3 },
-{ 20.149595, 13.438899, 3.3 },
-{ 20.149139, 13.439548, 3.3 },
-{ 20.148182, 13.439331, 3.3 },
-{ 20.148409, 13.440713, 3.3 },
-{ 20.148409, 13.441275, 3.3 },
-{ 20.149412, 13.439504, 3.3 },
-{ 20.149595, 13.440022, 3.3 },
-{ 20.147726, 13.439548, 3.3 },
-{ 20.147726, 13.438338, 3.3 },
-{ 20.146906, 13.439763, 3.3 },
-{ 20.147179, 13.440713, 3.3 },
-{ 20.147907, 13.440886, 3.3 },
-{ 20.147362, 13.44067, 3.3 },
-{ 20.149641, 13.440886, 3.4 },
-{ 20.148455, 13.440713, 3.4 },
-{ 20.148182, 13.44067, 3.4 },
-{ 20.146997, 13.442656, 3.4 },
-{ 20.15037, 13.439418, 3.4 },
-{ 20.147543, 13.439073, 3.3 },
-{ 20.148819, 13.440583, 3.3 },
-{ 20.14809, 13.440454, 3.3 },
-{ 20.147818, 13.440281, 3.3 },
-{ 20.14809, 13.440454, 3.3 },
-{ 20.148638, 13.44149, 3.3 },
-{ 20.147087, 13.441663, 3.3 },
-{ 20.147543, 13.441533, 3.3 },
-{ 20.148592, 13.440368, 3.3 },
-{ 20.147635, 13.440108, 3.3 },
-{ 20.147907, 13.439893, 3.3 },
-{ 20.148911, 13.440583, 3.3 },
-{ 20.147907, 13.442397, 3.3 },
-{ 20.147907, 13.442052, 3.3 },
-{ 20.14809, 13.442656, 3.3 },
-{ 20.148182, 13.440843, 3.3 },
-{ 20.146631, 13.440713, 3.3 },
-{ 20.148363, 13.440454, 3.3 },
-{ 20.148775, 13.441835, 3.3 },
-{ 20.147497, 13.441101, 3.3 },
-{ 20.146997, 13.441878, 3.4 },
-{ 20.147818, 13.440713, 3.4 },
-{ 20.148546, 13.44162, 3.4 },
-{ 20.147863, 13.440928, 3.4 },
-{ 20.146221, 13.441447, 3.4 },
-{ 20.146631, 13.44326, 3.4 },
-{ 20.148045, 13.440713, 3.4 },
-{ 20.146313, 13.4408, 3.4 },
-{ 20.147818, 13.443605, 3.4 },
-{ 20.14809, 13.441188, 3.4 },
-{ 20.147408, 13.442008, 3.4 },
-{ 20.147772, 13.441447, 3.4 },
-{ 20.147179, 13.440713, 3.4 },
-{ 20.147224, 13.44257, 3.4 },
-{ 20.147179, 13.442829, 3.4 },
-{ 20.148228, 13.441577, 3.4 },
-{ 20.147316, 13.442483, 3.4 },
-{ 20.146769, 13.440108, 3.4 },
-{ 20.147133, 13.441188, 3.4 },
-{ 20.147999, 13.4408, 3.4 },
-{ 20.147133, 13.440151, 3.3 },
-{ 20.147408, 13.442181, 3.3 },
-{ 20.14572, 13.44313, 3.3 },
-{ 20.14645, 13.442872, 3.3 },
-{ 20.14604, 13.441058, 3.3 },
-{ 20.145674, 13.442613, 3.4 },
-{ 20.145811, 13.442353, 3.4 },
-{ 20.146496, 13.442138, 3.4 },
-{ 20.147316, 13.440281, 3.4 },
-{ 20.14727, 13.441447, 3.4 },
-{ 20.147224, 13.442267, 3.4 },
-{ 20.147635, 13.44162, 3.4 },
-{ 20.14809, 13.44339, 3.4 },
-{ 20.147772, 13.442138, 3.4 },
-{ 20.147133, 13.44175, 3.4 },
-{ 20.145218, 13.440368, 3.4 },
-{ 20.145994, 13.44162, 3.4 },
-{ 20.146267, 13.443563, 3.4 },
-{ 20.146404, 13.442052, 3.4 },
-{ 20.145674, 13.441922, 3.4 },
-{ 20.145037, 13.442699, 3.3 },
-{ 20.145765, 13.442181, 3.3 },
-{ 20.147179, 13.442613, 3.3 },
-{ 20.14613, 13.441403, 3.3 },
-{ 20.147589, 13.441447, 3.3 },
-{ 20.147224, 13.44136, 3.3 },
-{ 20.147362, 13.442527, 3.3 },
-{ 20.145857, 13.442225, 3.3 },
-{ 20.146677, 13.442742, 3.3 },
-{ 20.147179, 13.44244, 3.3 },
-{ 20.145082, 13.442958, 3.4 },
-{ 20.146358, 13.443045, 3.4 },
-{ 20.147087, 13.444037, 3.4 },
-{ 20.145903, 13.442181, 3.4 },
-{ 20.145857, 13.44313, 3.4 },
-{ 20.147362, 13.444383, 3.4 },
-{ 20.146267, 13.44257, 3.4 },
-{ 20.146723, 13.44339, 3.4 },
-{ 20.147316, 13.442397, 3.4 },
-{ 20.148684, 13.442958, 3.4 },
-{ 20.145994, 13.442872, 3.4 },
-{ 20.146769, 13.442699, 3.4 },
-{ 20.145447, 13.443045, 3.4 },
-{ 20.147453, 13.443822, 3.4 },
-{ 20.14645, 13.443174, 3.4 },
-{ 20.147818, 13.442483, 3.4 },
-{ 20.147041, 13.44231, 3.4 },
-{ 20.146221, 13.443347, 3.4 },
-{ 20.147133, 13.442915, 3.4 },
-{ 20.144718, 13.442915, 3.4 },
-{ 20.147453, 13.445247, 3.4 },
-{ 20.147087, 13.44313, 3.4 },
-{ 20.145674, 13.443692, 3.4 },
-{ 20.147133, 13.444987, 3.4 },
-{ 20.147087, 13.443822, 3.4 },
-{ 20.14645, 13.44434, 3.4 },
-{ 20.14727, 13.443908, 3.4 },
-{ 20.145174, 13.442527, 3.4 },
-{ 20.146769, 13.442267, 3.4 },
-{ 20.145765, 13.442742, 3.4 },
-{ 20.146496, 13.443477, 3.4 },
-{ 20.145857, 13.443433, 3.4 },
-{ 20.147316, 13.443822, 3.4 },
-{ 20.144854, 13.442008, 3.4 },
-{ 20.146769, 13.443735, 3.4 },
-{ 20.144991, 13.443563, 3.4 },
-{ 20.145994, 13.443995, 3.4 },
-{ 20.145309, 13.444729, 3.4 },
-{ 20.14613, 13.442958, 3.4 },
-{ 20.146631, 13.442483, 3.4 },
-{ 20.14572, 13.443605, 3.4 },
-{ 20.14645, 13.444987, 3.4 },
-{ 20.145037, 13.444815, 3.4 },
-{ 20.146358, 13.443779, 3.4 },
-{ 20.14686, 13.443822, 3.4 },
-{ 20.146267, 13.44339, 3.4 },
-{ 20.144444, 13.443692, 3.4 },
-{ 20.146585, 13.443735, 3.4 },
-{ 20.145857, 13.44313, 3.4 },
-{ 20.14768, 13.444512, 3.4 },
-{ 20.145174, 13.44421, 3.4 },
-{ 20.147726, 13.444599, 3.4 },
-{ 20.146358, 13.443995, 3.4 },
-{ 20.144352, 13.446499, 3.4 },
-{ 20.146769, 13.445679, 3.4 },
-{ 20.145082, 13.443908, 3.4 },
-{ 20.14563, 13.445247, 3.4 },
-{ 20.14613, 13.443347, 3.4 },
-{ 20.145948, 13.444383, 3.4 },
-{ 20.144581, 13.444599, 3.4 },
-{ 20.1485, 13.44421, 3.4 },
-{ 20.146677, 13.44434, 3.4 },
-{ 20.144762, 13.443433, 3.4 },
-{ 20.14572, 13.445635, 3.4 },
-{ 20.14613, 13.444729, 3.4 },
-{ 20.145218, 13.444642, 3.4 },
-{ 20.145401, 13.44516, 3.4 },
-{ 20.14563, 13.444427, 3.4 },
-{ 20.147179, 13.445462, 3.4 },
-{ 20.14645, 13.444383, 3.4 },
-{ 20.144672, 13.44529, 3.4 },
-{ 20.144627, 13.445894, 3.4 },
-{ 20.144899, 13.444987, 3.4 },
-{ 20.145401, 13.445117, 3.4 },
-{ 20.146221, 13.445679, 3.4 },
-{ 20.144627, 13.445679, 3.4 },
-{ 20.145128, 13.443692, 3.4 },
-{ 20.146358, 13.445031, 3.4 },
-{ 20.146542, 13.444729, 3.4 },
-{ 20.148273, 13.444081, 3.4 },
-{ 20.144489, 13.444729, 3.4 },
-{ 20.145174, 13.446024, 3.4 },
-{ 20.145903, 13.444599, 3.4 },
-{ 20.144079, 13.443908, 3.4 },
-{ 20.146267, 13.445462, 3.4 },
-{ 20.146313, 13.445851, 3.4 },
-{ 20.145309, 13.445851, 3.4 },
-{ 20.145309, 13.445074, 3.4 },
-{ 20.146814, 13.444427, 3.4 },
-{ 20.144262, 13.445592, 3.4 },
-{ 20.146496, 13.445376, 3.4 },
-{ 20.146175, 13.445549, 3.4 },
-{ 20.144854, 13.446154, 3.4 },
-{ 20.145447, 13.44611, 3.4 },
-{ 20.145538, 13.446499, 3.4 },
-{ 20.14563, 13.446197, 3.4 },
-{ 20.144489, 13.446499, 3.4 },
-{ 20.146542, 13.445031, 3.4 },
-{ 20.144217, 13.444729, 3.4 },
-{ 20.14645, 13.445981, 3.4 },
-{ 20.145584, 13.445894, 3.4 },
-{ 20.145309, 13.444469, 3.4 },
-{ 20.146086, 13.445204, 3.4 },
-{ 20.144217, 13.445894, 3.4 },
-{ 20.14613, 13.446456, 3.4 },
-{ 20.145765, 13.444815, 3.4 },
-{ 20.144489, 13.447061, 3.4 },
-{ 20.145401, 13.445074, 3.4 },
-{ 20.146086, 13.446801, 3.4 },
-{ 20.14563, 13.445851, 3.4 },
-{ 20.146358, 13.446239, 3.4 },
-{ 20.14645, 13.445981, 3.4 },
-{ 20.146221, 13.446586, 3.4 },
-{ 20.144171, 13.445722, 3.4 },
-{ 20.14563, 13.445592, 3.4 },
-{ 20.145218, 13.447061, 3.4 },
-{ 20.14563, 13.447017, 3.4 },
-{ 20.145584, 13.446758, 3.4 },
-{ 20.144627, 13.446067, 3.4 },
-{ 20.145584, 13.447621, 3.4 },
-{ 20.143988, 13.446024, 3.4 },
-{ 20.145082, 13.447664, 3.4 },
-{ 20.146267, 13.447276, 3.4 },
-{ 20.145811, 13.445981, 3.4 },
-{ 20.145994, 13.448053, 3.4 },
-{ 20.144808, 13.447146, 3.4 },
-{ 20.144991, 13.447146, 3.4 },
-{ 20.145538, 13.447189, 3.4 },
-{ 20.145948, 13.447276, 3.4 },
-{ 20.145948, 13.445635, 3.4 },
-{ 20.146175, 13.445462, 3.4 },
-{ 20.144306, 13.445462, 3.4 },
-{ 20.144718, 13.447017, 3.4 },
-{ 20.147316, 13.445117, 3.4 },
-{ 20.144535, 13.445592, 3.4 },
-{ 20.14563, 13.446197, 3.4 },
-{ 20.145994, 13.447104, 3.4 },
-{ 20.144398, 13.446024, 3.4 },
-{ 20.14563, 13.447881, 3.4 },
-{ 20.145218, 13.446974, 3.4 },
-{ 20.144991, 13.445549, 3.5 },
-{ 20.145309, 13.446629, 3.5 },
-{ 20.145218, 13.446714, 3.5 },
-{ 20.144489, 13.448313, 3.5 },
-{ 20.145903, 13.448096, 3.5 },
-{ 20.145082, 13.447578, 3.4 },
-{ 20.143988, 13.448571, 3.4 },
-{ 20.145994, 13.446671, 3.4 },
-{ 20.145857, 13.447881, 3.4 },
-{ 20.145174, 13.446844, 3.4 },
-{ 20.145447, 13.448571, 3.5 },
-{ 20.145355, 13.447708, 3.5 },
-{ 20.145493, 13.448183, 3.5 },
-{ 20.145128, 13.446671, 3.5 },
-{ 20.145765, 13.446542, 3.5 },
-{ 20.145401, 13.447146, 3.5 },
-{ 20.145355, 13.448183, 3.5 },
-{ 20.146358, 13.447449, 3.5 },
-{ 20.144672, 13.449306, 3.5 },
-{ 20.145264, 13.446931, 3.5 },
-{ 20.146221, 13.447751, 3.5 },
-{ 20.143852, 13.446887, 3.5 },
-{ 20.145355, 13.447967, 3.5 },
-{ 20.147179, 13.447621, 3.5 },
-{ 20.143988, 13.447492, 3.5 },
-{ 20.145584, 13.447319, 3.4 },
-{ 20.146175, 13.448874, 3.4 },
-{ 20.144808, 13.448399, 3.4 },
-{ 20.145584, 13.448139, 3.4 },
-{ 20.145264, 13.447104, 3.4 },
-{ 20.145493, 13.448874, 3.5 },
-{ 20.143988, 13.448658, 3.5 },
-{ 20.145355, 13.447967, 3.5 },
-{ 20.145584, 13.448571, 3.5 },
-{ 20.144899, 13.450515, 3.5 },
-{ 20.14604, 13.449046, 3.5 },
-{ 20.145401, 13.44896, 3.5 },
-{ 20.145401, 13.448658, 3.5 },
-{ 20.144306, 13.448442, 3.5 },
-{ 20.144217, 13.445247, 3.5 },
-{ 20.146814, 13.447881, 3.5 },
-{ 20.144535, 13.447621, 3.5 },
-{ 20.144899, 13.448916, 3.5 },
-{ 20.144535, 13.44801, 3.5 },
-{ 20.145401, 13.446024, 3.5 },
-{ 20.143761, 13.447319, 3.4 },
-{ 20.145765, 13.449133, 3.4 },
-{ 20.145538, 13.448313, 3.4 },
-{ 20.144991, 13.447664, 3.4 },
-{ 20.144581, 13.448916, 3.4 },
-{ 20.143669, 13.449391, 3.5 },
-{ 20.143988, 13.448874, 3.5 },
-{ 20.145037, 13.44801, 3.5 },
-{ 20.146358, 13.447794, 3.5 },
-{ 20.145674, 13.448528, 3.5 },
-{ 20.145174, 13.448614, 3.5 },
-{ 20.146358, 13.448356, 3.5 },
-{ 20.145037, 13.449521, 3.5 },
-{ 20.145082, 13.449176, 3.5 },
-{ 20.144306, 13.449478, 3.5 },
-{ 20.143806, 13.448528, 3.5 },
-{ 20.144672, 13.448614, 3.5 },
-{ 20.14563, 13.448313, 3.5 },
-{ 20.145218, 13.449866, 3.5 },
-{ 20.145218, 13.44896, 3.5 },
-{ 20.144398, 13.447536, 3.5 },
-{ 20.145493, 13.448356, 3.5 },
-{ 20.144808, 13.448831, 3.5 },
-{ 20.143532, 13.448313, 3.5 },
-{ 20.146086, 13.448916, 3.5 },
-{ 20.145401, 13.450946, 3.5 },
-{ 20.145493, 13.45004, 3.5 },
-{ 20.143623, 13.448701, 3.5 },
-{ 20.144627, 13.448485, 3.5 },
-{ 20.144444, 13.448053, 3.5 },
-{ 20.145128, 13.447708, 3.5 },
-{ 20.14613, 13.449953, 3.5 },
-{ 20.14613, 13.44909, 3.5 },
-{ 20.144945, 13.449348, 3.5 },
-{ 20.145538, 13.449348, 3.5 },
-{ 20.145355, 13.448658, 3.5 },
-{ 20.145994, 13.448701, 3.5 },
-{ 20.144762, 13.450212, 3.5 },
-{ 20.145994, 13.448614, 3.5 },
-{ 20.145174, 13.450773, 3.5 },
-{ 20.144444, 13.450169, 3.5 },
-{ 20.143988, 13.450471, 3.5 },
-{ 20.145264, 13.448916, 3.5 },
-{ 20.144945, 13.448701, 3.5 },
-{ 20.144217, 13.449521, 3.5 },
-{ 20.146906, 13.449046, 3.5 },
-{ 20.145948, 13.449478, 3.5 },
-{ 20.146086, 13.447794, 3.5 },
-{ 20.145128, 13.448916, 3.5 },
-{ 20.144306, 13.449651, 3.5 },
-{ 20.144991, 13.450169, 3.5 },
-{ 20.144489, 13.449996, 3.5 },
-{ 20.144444, 13.44909, 3.5 },
-{ 20.143852, 13.44909, 3.5 },
-{ 20.146221, 13.450169, 3.5 },
-{ 20.144262, 13.448658, 3.5 },
-{ 20.144352, 13.449263, 3.5 },
-{ 20.145994, 13.450817, 3.5 },
-{ 20.144535, 13.448788, 3.5 },
-{ 20.144489, 13.449565, 3.5 },
-{ 20.144581, 13.450212, 3.5 },
-{ 20.144854, 13.449306, 3.5 },
-{ 20.14563, 13.448399, 3.5 },
-{ 20.144444, 13.449133, 3.5 },
-{ 20.146542, 13.448399, 3.5 },
-{ 20.145174, 13.449953, 3.5 },
-{ 20.145447, 13.451118, 3.5 },
-{ 20.145128, 13.450471, 3.5 },
-{ 20.144535, 13.448874, 3.5 },
-{ 20.146769, 13.450342, 3.5 },
-{ 20.14572, 13.45004, 3.5 },
-{ 20.144306, 13.451033, 3.5 },
-{ 20.146585, 13.450428, 3.5 },
-{ 20.144306, 13.450212, 3.5 },
-{ 20.145264, 13.450644, 3.5 },
-{ 20.146221, 13.449176, 3.5 },
-{ 20.143532, 13.449996, 3.5 },
-{ 20.14572, 13.450644, 3.5 },
-{ 20.144672, 13.44909, 3.5 },
-{ 20.145309, 13.450687, 3.5 },
-{ 20.144899, 13.44991, 3.5 },
-{ 20.144581, 13.451465, 3.5 },
-{ 20.144718, 13.449996, 3.5 },
-{ 20.144762, 13.451421, 3.5 },
-{ 20.145493, 13.451853, 3.5 },
-{ 20.145082, 13.449348, 3.5 },
-{ 20.144352, 13.450558, 3.5 },
-{ 20.14604, 13.45004, 3.5 },
-{ 20.145082, 13.451465, 3.5 },
-{ 20.145903, 13.450169, 3.5 },
-{ 20.145811, 13.451033, 3.5 },
-{ 20.145584, 13.450773, 3.5 },
-{ 20.143942, 13.45073, 3.5 },
-{ 20.145174, 13.44991, 3.5 },
-{ 20.144033, 13.449306, 3.5 },
-{ 20.145447, 13.449391, 3.5 },
-{ 20.145765, 13.452198, 3.5 },
-{ 20.146313, 13.448053, 3.5 },
-{ 20.144672, 13.44978, 3.5 },
-{ 20.145309, 13.450342, 3.5 },
-{ 20.145447, 13.450903, 3.5 },
-{ 20.146221, 13.448701, 3.5 },
-{ 20.143806, 13.450946, 3.5 },
-{ 20.145948, 13.44991, 3.5 },
-{ 20.144762, 13.451594, 3.5 },
-{ 20.14686, 13.450169, 3.5 },
-{ 20.146221, 13.449565, 3.5 },
-{ 20.145264, 13.449003, 3.5 },
-{ 20.144945, 13.451033, 3.5 },
-{ 20.144489, 13.450255, 3.5 },
-{ 20.145309, 13.449651, 3.5 },
-{ 20.14563, 13.451465, 3.5 },
-{ 20.145401, 13.450126, 3.5 },
-{ 20.144489, 13.449348, 3.5 },
-{ 20.145811, 13.450169, 3.5 },
-{ 20.145128, 13.450471, 3.5 },
-{ 20.146496, 13.453019, 3.5 },
-{ 20.144581, 13.45194, 3.5 },
-{ 20.144672, 13.450601, 3.5 },
-{ 20.144262, 13.452025, 3.5 },
-{ 20.146175, 13.451594, 3.5 },
-{ 20.146585, 13.450255, 3.5 },
-{ 20.145674, 13.450817, 3.5 },
-{ 20.145538, 13.450428, 3.5 },
-{ 20.145674, 13.450126, 3.5 },
-{ 20.146313, 13.452198, 3.5 },
-{ 20.146677, 13.452025, 3.5 },
-{ 20.145401, 13.451205, 3.5 },
-{ 20.143669, 13.451465, 3.5 },
-{ 20.145948, 13.450083, 3.5 },
-{ 20.145538, 13.452544, 3.5 },
-{ 20.144991, 13.450903, 3.5 },
-{ 20.144854, 13.451853, 3.5 },
-{ 20.145948, 13.449866, 3.5 },
-{ 20.145218, 13.449565, 3.5 },
-{ 20.144718, 13.451723, 3.5 },
-{ 20.144171, 13.451594, 3.5 },
-{ 20.144627, 13.452198, 3.5 },
-{ 20.145174, 13.452587, 3.5 },
-{ 20.145493, 13.450903, 3.5 },
-{ 20.14604, 13.451982, 3.5 },
-{ 20.145355, 13.450298, 3.5 },
-{ 20.146404, 13.451421, 3.5 },
-{ 20.144535, 13.451421, 3.5 },
-{ 20.144718, 13.452242, 3.5 },
-{ 20.145811, 13.451637, 3.5 },
-{ 20.146267, 13.45155, 3.5 },
-{ 20.148684, 13.450515, 3.5 },
-{ 20.14572, 13.451076, 3.5 },
-{ 20.146221, 13.450817, 3.5 },
-{ 20.144489, 13.451248, 3.5 },
-{ 20.144991, 13.452025, 3.5 },
-{ 20.145994, 13.45276, 3.5 },
-{ 20.14604, 13.452112, 3.5 },
-{ 20.145174, 13.451076, 3.5 },
-{ 20.146677, 13.45155, 3.5 },
-{ 20.145765, 13.45155, 3.5 },
-{ 20.145493, 13.451205, 3.5 },
-{ 20.146267, 13.45263, 3.5 },
-{ 20.144444, 13.452328, 3.5 },
-{ 20.145493, 13.451076, 3.5 },
-{ 20.146769, 13.451465, 3.5 },
-{ 20.146313, 13.452242, 3.5 },
-{ 20.147999, 13.451767, 3.5 },
-{ 20.145401, 13.45073, 3.5 },
-{ 20.145538, 13.452415, 3.5 },
-{ 20.14613, 13.451853, 3.5 },
-{ 20.146221, 13.451982, 3.5 },
-{ 20.145994, 13.451292, 3.5 },
-{ 20.148045, 13.45155, 3.5 },
-{ 20.145082, 13.452112, 3.5 },
-{ 20.14613, 13.45263, 3.5 },
-{ 20.146267, 13.451637, 3.5 },
-{ 20.146997, 13.450773, 3.5 },
-{ 20.146906, 13.450601, 3.5 },
-{ 20.145857, 13.453796, 3.6 },
-{ 20.146496, 13.450083, 3.6 },
-{ 20.146585, 13.451162, 3.6 },
-{ 20.146175, 13.45168, 3.6 },
-{ 20.145674, 13.45168, 3.6 },
-{ 20.145857, 13.452198, 3.6 },
-{ 20.146585, 13.452328, 3.6 },
-{ 20.14645, 13.452717, 3.6 },
-{ 20.146175, 13.45086, 3.6 },
-{ 20.147041, 13.451508, 3.6 },
-{ 20.148363, 13.452889, 3.6 },
-{ 20.145811, 13.450687, 3.6 },
-{ 20.146769, 13.451896, 3.6 },
-{ 20.146358, 13.453192, 3.6 },
-{ 20.146997, 13.45263, 3.6 },
-{ 20.146631, 13.451767, 3.6 },
-{ 20.148409, 13.45086, 3.6 },
-{ 20.147589, 13.450126, 3.6 },
-{ 20.147543, 13.452415, 3.6 },
-{ 20.147589, 13.452285, 3.6 },
-{ 20.146313, 13.452242, 3.5 },
-{ 20.148729, 13.451076, 3.5 },
-{ 20.146631, 13.451637, 3.5 },
-{ 20.147408, 13.451637, 3.5 },
-{ 20.149002, 13.4525, 3.5 },
-{ 20.146631, 13.450817, 3.6 },
-{ 20.146952, 13.451637, 3.6 },
-{ 20.149048, 13.44978, 3.6 },
-{ 20.147543, 13.45099, 3.6 },
-{ 20.147726, 13.451982, 3.6 },
-{ 20.147726, 13.451378, 3.5 },
-{ 20.148638, 13.451378, 3.5 },
-{ 20.148592, 13.45099, 3.5 },
-{ 20.147589, 13.453062, 3.5 },
-{ 20.147953, 13.451118, 3.5 },
-{ 20.148546, 13.451421, 3.6 },
-{ 20.147589, 13.450817, 3.6 },
-{ 20.147999, 13.451033, 3.6 },
-{ 20.148182, 13.452155, 3.6 },
-{ 20.148363, 13.452371, 3.6 },
-{ 20.148182, 13.452415, 3.6 },
-{ 20.148455, 13.450428, 3.6 },
-{ 20.148182, 13.451853, 3.6 },
-{ 20.14768, 13.452328, 3.6 },
-{ 20.147907, 13.451248, 3.6 },
-{ 20.150734, 13.45004, 3.6 },
-{ 20.148182, 13.450558, 3.6 },
-{ 20.148228, 13.451465, 3.6 },
-{ 20.147818, 13.449866, 3.6 },
-{ 20.149185, 13.451292, 3.6 },
-{ 20.149822, 13.452544, 3.5 },
-{ 20.149458, 13.451896, 3.5 },
-{ 20.149731, 13.451896, 3.5 },
-{ 20.148775, 13.453105, 3.5 },
-{ 20.149595, 13.452155, 3.5 },
-{ 20.147316, 13.450385, 3.6 },
-{ 20.147497, 13.451033, 3.6 },
-{ 20.147907, 13.450644, 3.6 },
-{ 20.15078, 13.451723, 3.6 },
-{ 20.149002, 13.451594, 3.6 },
-{ 20.150461, 13.451853, 3.6 },
-{ 20.148729, 13.450298, 3.6 },
-{ 20.149094, 13.451853, 3.6 },
-{ 20.150051, 13.452025, 3.6 },
-{ 20.150642, 13.451378, 3.6 },
-{ 20.148819, 13.450644, 3.6 },
-{ 20.150051, 13.450903, 3.6 },
-{ 20.15119, 13.452544, 3.6 },
-{ 20.149094, 13.45004, 3.6 },
-{ 20.149412, 13.453407, 3.6 },
-{ 20.148684, 13.450644, 3.6 },
-{ 20.151054, 13.450298, 3.6 },
-{ 20.150734, 13.449866, 3.6 },
-{ 20.148911, 13.450255, 3.6 },
-{ 20.151098, 13.452975, 3.6 },
-{ 20.149822, 13.452847, 3.6 },
-{ 20.14996, 13.45073, 3.6 },
-{ 20.148638, 13.451896, 3.6 },
-{ 20.151054, 13.451421, 3.6 },
-{ 20.151144, 13.450903, 3.6 },
-{ 20.150415, 13.450644, 3.6 },
-{ 20.150232, 13.450515, 3.6 },
-{ 20.15078, 13.451248, 3.6 },
-{ 20.151054, 13.450644, 3.6 },
-{ 20.151327, 13.45086, 3.6 },
-{ 20.149094, 13.450946, 3.6 },
-{ 20.151373, 13.450601, 3.6 },
-{ 20.151054, 13.450515, 3.6 },
-{ 20.147907, 13.45181, 3.6 },
-{ 20.150688, 13.452112, 3.6 },
-{ 20.150278, 13.450903, 3.6 },
-{ 20.15192, 13.450342, 3.6 },
-{ 20.15201, 13.451637, 3.6 },
-{ 20.150642, 13.450903, 3.6 },
-{ 20.151236, 13.450817, 3.6 },
-{ 20.151419, 13.452587, 3.6 },
-{ 20.15037, 13.450644, 3.6 },
-{ 20.152832, 13.450817, 3.6 },
-{ 20.151554, 13.450255, 3.6 },
-{ 20.151009, 13.450083, 3.6 },
-{ 20.150553, 13.449866, 3.6 },
-{ 20.15201, 13.45168, 3.6 },
-{ 20.15119, 13.451205, 3.6 },
-{ 20.150507, 13.45168, 3.6 },
-{ 20.151009, 13.450298, 3.6 },
-{ 20.151508, 13.45099, 3.6 },
-{ 20.151281, 13.450169, 3.6 },
-{ 20.15242, 13.450255, 3.6 },
-{ 20.152922, 13.451508, 3.6 },
-{ 20.151054, 13.451033, 3.6 },
-{ 20.151281, 13.449521, 3.6 },
-{ 20.153788, 13.449263, 3.6 },
-{ 20.151829, 13.450817, 3.6 },
-{ 20.1516, 13.449738, 3.6 },
-{ 20.153105, 13.450169, 3.6 },
-{ 20.15078, 13.45004, 3.6 },
-{ 20.153332, 13.450558, 3.6 },
-{ 20.153059, 13.449953, 3.6 },
-{ 20.153925, 13.45168, 3.6 },
-{ 20.152832, 13.450644, 3.6 },
-{ 20.152649, 13.449823, 3.6 },
-{ 20.153105, 13.450385, 3.6 },
-{ 20.153561, 13.450083, 3.6 },
-{ 20.152056, 13.449219, 3.6 },
-{ 20.153013, 13.449306, 3.6 },
-{ 20.152239, 13.450601, 3.6 },
-{ 20.153698, 13.450385, 3.6 },
-{ 20.153332, 13.450515, 3.6 },
-{ 20.153196, 13.45073, 3.6 },
-{ 20.152512, 13.449651, 3.6 },
-{ 20.153515, 13.449003, 3.6 },
-{ 20.151829, 13.449521, 3.6 },
-{ 20.154381, 13.44991, 3.6 },
-{ 20.153105, 13.451205, 3.6 },
-{ 20.152786, 13.450298, 3.6 },
-{ 20.152285, 13.44991, 3.6 },
-{ 20.153698, 13.450083, 3.6 },
-{ 20.152102, 13.450083, 3.6 },
-{ 20.153059, 13.449521, 3.6 },
-{ 20.151373, 13.44978, 3.6 },
-{ 20.153332, 13.452198, 3.6 },
-{ 20.152832, 13.450342, 3.6 },
-{ 20.153423, 13.449391, 3.6 },
-{ 20.153423, 13.450817, 3.6 },
-{ 20.152922, 13.44896, 3.6 },
-{ 20.152102, 13.451162, 3.6 },
-{ 20.1542, 13.450342, 3.6 },
-{ 20.153788, 13.451292, 3.6 },
-{ 20.15242, 13.449263, 3.6 },
-{ 20.153561, 13.449391, 3.6 },
-{ 20.153151, 13.449823, 3.6 },
-{ 20.153606, 13.44896, 3.6 },
-{ 20.15233, 13.449608, 3.6 },
-{ 20.153515, 13.450255, 3.6 },
-{ 20.153971, 13.448096, 3.6 },
-{ 20.154381, 13.448831, 3.6 },
-{ 20.154243, 13.449996, 3.6 },
-{ 20.152967, 13.449521, 3.6 },
-{ 20.153698, 13.450083, 3.6 },
-{ 20.153561, 13.44978, 3.6 },
-{ 20.154016, 13.449478, 3.6 },
-{ 20.154289, 13.449738, 3.6 },
-{ 20.153788, 13.448614, 3.6 },
-{ 20.153879, 13.449651, 3.6 },
-{ 20.154062, 13.448571, 3.6 },
-{ 20.152649, 13.447362, 3.6 },
-{ 20.154837, 13.449391, 3.6 },
-{ 20.1542, 13.44896, 3.6 },
-{ 20.154745, 13.449651, 3.6 },
-{ 20.154564, 13.449521, 3.6 },
-{ 20.153469, 13.450083, 3.6 },
-{ 20.154655, 13.449046, 3.6 },
-{ 20.154882, 13.450342, 3.6 },
-{ 20.15502, 13.44978, 3.6 },
-{ 20.153698, 13.449046, 3.6 },
-{ 20.154699, 13.447492, 3.7 },
-{ 20.156021, 13.448788, 3.7 },
-{ 20.151875, 13.447967, 3.7 },
-{ 20.153332, 13.449738, 3.7 },
-{ 20.153105, 13.449738, 3.7 },
-{ 20.156113, 13.448528, 3.7 },
-{ 20.153971, 13.449478, 3.7 },
-{ 20.152786, 13.449435, 3.7 },
-{ 20.153606, 13.449219, 3.7 },
-{ 20.151009, 13.450385, 3.7 },
-{ 20.153242, 13.450169, 3.7 },
-{ 20.154655, 13.448226, 3.7 },
-{ 20.155338, 13.448788, 3.7 },
-{ 20.154564, 13.449391, 3.7 },
-{ 20.153151, 13.449738, 3.7 },
-{ 20.154154, 13.448916, 3.7 },
-{ 20.154289, 13.448485, 3.7 },
-{ 20.154335, 13.447967, 3.7 },
-{ 20.153561, 13.449176, 3.7 },
-{ 20.151691, 13.446629, 3.7 },
-{ 20.154108, 13.448399, 3.7 },
-{ 20.155384, 13.449651, 3.7 },
-{ 20.154655, 13.449953, 3.7 },
-{ 20.155384, 13.446758, 3.7 },
-{ 20.157345, 13.448356, 3.7 },
-{ 20.155293, 13.448744, 3.7 },
-{ 20.154791, 13.448788, 3.7 },
-{ 20.155657, 13.448269, 3.7 },
-{ 20.15543, 13.447708, 3.7 },
-{ 20.155293, 13.448701, 3.7 },
-{ 20.142941, 13.446887, 3.6 },
-{ 20.155384, 13.447881, 3.6 },
-{ 20.155521, 13.44909, 3.6 },
-{ 20.154243, 13.448874, 3.6 },
-{ 20.154564, 13.448614, 3.6 },
-{ 20.155201, 13.448831, 3.7 },
-{ 20.155794, 13.449478, 3.7 },
-{ 20.154016, 13.44991, 3.7 },
-{ 20.153242, 13.448571, 3.7 },
-{ 20.154745, 13.447664, 3.7 },
-{ 20.154108, 13.449176, 3.7 },
-{ 20.153059, 13.448313, 3.7 },
-{ 20.154745, 13.448788, 3.7 },
-{ 20.15625, 13.447362, 3.7 },
-{ 20.154154, 13.448053, 3.7 },
-{ 20.155521, 13.449996, 3.7 },
-{ 20.156158, 13.447924, 3.7 },
-{ 20.155748, 13.448874, 3.7 },
-{ 20.154699, 13.448528, 3.7 },
-{ 20.155565, 13.448139, 3.7 },
-{ 20.153606, 13.447838, 3.7 },
-{ 20.154974, 13.449608, 3.7 },
-{ 20.154791, 13.448788, 3.7 },
-{ 20.154837, 13.448399, 3.7 },
-{ 20.156067, 13.447751, 3.7 },
-{ 20.154882, 13.449219, 3.6 },
-{ 20.155155, 13.450601, 3.6 },
-{ 20.156296, 13.448269, 3.6 },
-{ 20.153515, 13.447794, 3.6 },
-{ 20.155657, 13.44896, 3.6 },
-{ 20.154655, 13.447967, 3.7 },
-{ 20.156706, 13.447578, 3.7 },
-{ 20.156158, 13.448658, 3.7 },
-{ 20.1542, 13.448139, 3.7 },
-{ 20.155611, 13.448701, 3.7 },
-{ 20.155611, 13.449651, 3.6 },
-{ 20.155794, 13.448701, 3.6 },
-{ 20.154837, 13.447492, 3.6 },
-{ 20.153469, 13.449996, 3.6 },
-{ 20.157299, 13.448183, 3.6 },
-{ 20.156113, 13.448614, 3.7 },
-{ 20.155886, 13.448614, 3.7 },
-{ 20.1542, 13.447794, 3.7 },
-{ 20.156843, 13.446714, 3.7 },
-{ 20.155794, 13.448701, 3.7 },
-{ 20.15625, 13.448528, 3.7 },
-{ 20.155293, 13.450083, 3.7 },
-{ 20.155794, 13.448701, 3.7 },
-{ 20.154108, 13.447794, 3.7 },
-{ 20.155611, 13.44801, 3.7 },
-{ 20.156067, 13.448528, 3.7 },
-{ 20.156569, 13.448139, 3.7 },
-{ 20.155066, 13.448183, 3.7 },
-{ 20.154243, 13.449478, 3.7 },
-{ 20.15748, 13.449306, 3.7 },
-{ 20.156021, 13.447751, 3.7 },
-{ 20.156706, 13.448874, 3.7 },
-{ 20.155611, 13.446974, 3.7 },
-{ 20.156204, 13.448916, 3.7 },
-{ 20.155565, 13.447621, 3.7 },
-{ 20.155521, 13.446844, 3.7 },
-{ 20.155886, 13.447664, 3.7 },
-{ 20.153788, 13.449133, 3.7 },
-{ 20.155066, 13.447578, 3.7 },
-{ 20.154427, 13.449823, 3.7 },
-{ 20.153698, 13.447146, 3.7 },
-{ 20.153833, 13.448874, 3.7 },
-{ 20.154564, 13.448399, 3.7 },
-{ 20.155155, 13.448139, 3.7 },
-{ 20.155109, 13.448269, 3.7 },
-{ 20.157162, 13.448658, 3.7 },
-{ 20.154655, 13.449521, 3.7 },
-{ 20.154791, 13.449306, 3.7 },
-{ 20.155565, 13.448399, 3.7 },
-{ 20.156021, 13.44801, 3.7 },
-{ 20.154381, 13.449176, 3.7 },
-{ 20.154154, 13.448399, 3.7 },
-{ 20.154928, 13.448831, 3.7 },
-{ 20.156158, 13.448916, 3.7 },
-{ 20.154791, 13.447924, 3.7 },
-{ 20.154381, 13.449003, 3.7 },
-{ 20.156477, 13.447362, 3.7 },
-{ 20.156296, 13.449478, 3.7 },
-{ 20.155748, 13.447967, 3.7 },
-{ 20.154518, 13.447664, 3.7 },
-{ 20.154655, 13.447406, 3.7 },
-{ 20.155794, 13.449046, 3.7 },
-{ 20.155066, 13.449219, 3.7 },
-{ 20.15543, 13.447621, 3.7 },
-{ 20.154837, 13.449263, 3.7 },
-{ 20.153833, 13.449263, 3.7 },
-{ 20.154564, 13.448096, 3.7 },
-{ 20.15502, 13.447449, 3.7 },
-{ 20.155201, 13.447189, 3.7 },
-{ 20.154243, 13.448788, 3.7 },
-{ 20.155066, 13.447838, 3.7 },
-{ 20.153788, 13.449176, 3.7 },
-{ 20.154655, 13.448788, 3.7 },
-{ 20.154335, 13.450169, 3.7 },
-{ 20.156342, 13.448269, 3.7 },
-{ 20.154655, 13.448485, 3.7 },
-{ 20.156067, 13.449738, 3.7 },
-{ 20.153971, 13.447924, 3.7 },
-{ 20.154928, 13.448269, 3.7 },
-{ 20.154016, 13.449996, 3.7 },
-{ 20.154699, 13.448313, 3.7 },
-{ 20.154518, 13.448528, 3.7 },
-{ 20.154882, 13.449823, 3.7 },
-{ 20.156296, 13.447794, 3.7 },
-{ 20.153925, 13.449046, 3.7 },
-{ 20.154882, 13.448658, 3.7 },
-{ 20.154882, 13.448701, 3.7 },
-{ 20.1542, 13.449219, 3.7 },
-{ 20.154427, 13.448874, 3.7 },
-{ 20.155886, 13.450169, 3.7 },
-{ 20.15584, 13.448701, 3.7 },
-{ 20.15543, 13.448139, 3.7 },
-{ 20.155703, 13.448916, 3.7 },
-{ 20.155066, 13.450342, 3.7 },
-{ 20.153196, 13.448096, 3.7 },
-{ 20.154882, 13.447794, 3.7 },
-{ 20.154745, 13.449478, 3.7 },
-{ 20.155109, 13.448874, 3.7 },
-{ 20.154518, 13.449435, 3.7 },
-{ 20.155066, 13.449306, 3.7 },
-{ 20.154108, 13.448356, 3.7 },
-{ 20.156477, 13.450817, 3.7 },
-{ 20.154791, 13.450212, 3.7 },
-{ 20.154564, 13.449391, 3.7 },
-{ 20.155109, 13.449176, 3.7 },
-{ 20.152466, 13.448658, 3.7 },
-{ 20.154289, 13.448399, 3.7 },
-{ 20.153744, 13.45004, 3.7 },
-{ 20.15543, 13.448571, 3.7 },
-{ 20.155977, 13.447794, 3.7 },
-{ 20.154699, 13.448916, 3.7 },
-{ 20.153515, 13.448701, 3.7 },
-{ 20.153242, 13.448571, 3.7 },
-{ 20.153469, 13.448096, 3.7 },
-{ 20.15625, 13.449651, 3.7 },
-{ 20.15461, 13.450212, 3.7 },
-{ 20.153698, 13.449478, 3.7 },
-{ 20.152649, 13.449866, 3.7 },
-{ 20.154381, 13.449996, 3.7 },
-{ 20.154154, 13.44896, 3.7 },
-{ 20.15543, 13.449823, 3.7 },
-{ 20.154016, 13.449306, 3.7 },
-{ 20.154154, 13.448139, 3.7 },
-{ 20.154427, 13.448831, 3.7 },
-{ 20.153698, 13.450342, 3.7 },
-{ 20.153151, 13.449823, 3.7 },
-{ 20.153242, 13.448485, 3.7 },
-{ 20.152376, 13.449953, 3.7 },
-{ 20.152832, 13.448916, 3.7 },
-{ 20.153196, 13.449263, 3.7 },
-{ 20.153059, 13.448614, 3.7 },
-{ 20.153606, 13.449263, 3.7 },
-{ 20.154289, 13.447967, 3.7 },
-{ 20.152512, 13.451637, 3.7 },
-{ 20.15502, 13.448399, 3.7 },
-{ 20.153332, 13.448831, 3.7 },
-{ 20.153833, 13.450817, 3.7 },
-{ 20.153151, 13.451118, 3.7 },
-{ 20.15461, 13.448744, 3.7 },
-{ 20.152695, 13.448528, 3.7 },
-{ 20.154335, 13.449176, 3.8 },
-{ 20.154289, 13.45004, 3.8 },
-{ 20.1542, 13.449565, 3.8 },
-{ 20.154062, 13.449306, 3.8 },
-{ 20.1542, 13.448788, 3.8 },
-{ 20.154745, 13.450342, 3.7 },
-{ 20.1516, 13.448485, 3.7 },
-{ 20.153652, 13.450428, 3.7 },
-{ 20.153879, 13.449694, 3.7 },
-{ 20.154154, 13.447621, 3.7 },
-{ 20.153332, 13.44991, 3.7 },
-{ 20.154335, 13.449996, 3.7 },
-{ 20.153698, 13.449391, 3.7 },
-{ 20.154016, 13.44991, 3.7 },
-{ 20.155521, 13.44978, 3.7 },
-{ 20.154243, 13.45073, 3.7 },
-{ 20.153561, 13.449133, 3.7 },
-{ 20.153561, 13.449435, 3.7 },
-{ 20.152876, 13.449003, 3.7 },
-{ 20.153879, 13.449565, 3.7 },
-{ 20.154062, 13.449866, 3.7 },
-{ 20.153606, 13.449694, 3.7 },
-{ 20.154655, 13.45155, 3.7 },
-{ 20.154655, 13.448313, 3.7 },
-{ 20.152922, 13.450298, 3.7 },
-{ 20.152193, 13.450558, 3.7 },
-{ 20.154472, 13.450083, 3.7 },
-{ 20.152376, 13.447104, 3.7 },
-{ 20.153606, 13.450385, 3.7 },
-{ 20.154154, 13.449738, 3.7 },
-{ 20.1542, 13.449003, 3.8 },
-{ 20.153744, 13.448916, 3.8 },
-{ 20.154882, 13.449694, 3.8 },
-{ 20.154016, 13.44896, 3.8 },
-{ 20.152967, 13.449953, 3.8 },
-{ 20.155155, 13.45004, 3.8 },
-{ 20.152239, 13.449953, 3.8 },
-{ 20.154518, 13.45181, 3.8 },
-{ 20.154335, 13.448831, 3.8 },
-{ 20.154062, 13.45181, 3.8 },
-{ 20.154335, 13.449996, 3.7 },
-{ 20.153288, 13.448701, 3.7 },
-{ 20.154974, 13.44991, 3.7 },
-{ 20.153561, 13.448658, 3.7 },
-{ 20.153105, 13.449565, 3.7 },
-{ 20.154655, 13.449478, 3.8 },
-{ 20.154154, 13.450169, 3.8 },
-{ 20.153059, 13.450428, 3.8 },
-{ 20.152466, 13.449521, 3.8 },
-{ 20.152147, 13.450342, 3.8 },
-{ 20.153971, 13.450342, 3.8 },
-{ 20.155247, 13.448399, 3.8 },
-{ 20.15502, 13.449348, 3.8 },
-{ 20.153242, 13.45004, 3.8 },
-{ 20.154335, 13.449176, 3.8 },
-{ 20.152102, 13.451248, 3.8 },
-{ 20.153288, 13.450385, 3.8 },
-{ 20.153971, 13.451465, 3.8 },
-{ 20.153606, 13.449996, 3.8 },
-{ 20.151646, 13.449953, 3.8 },
-{ 20.153059, 13.450428, 3.8 },
-{ 20.153105, 13.449263, 3.8 },
-{ 20.153423, 13.450169, 3.8 },
-{ 20.152967, 13.449046, 3.8 },
-{ 20.153332, 13.45099, 3.8 },
-{ 20.155703, 13.448571, 3.8 },
-{ 20.152967, 13.45099, 3.8 },
-{ 20.152239, 13.448399, 3.8 },
-{ 20.154699, 13.450255, 3.8 },
-{ 20.15274, 13.448916, 3.8 },
-{ 20.152967, 13.452889, 3.8 },
-{ 20.154655, 13.44978, 3.8 },
-{ 20.153288, 13.449348, 3.8 },
-{ 20.153561, 13.450298, 3.8 },
-{ 20.153423, 13.449478, 3.8 },
-{ 20.154154, 13.448139, 3.8 },
-{ 20.151691, 13.449219, 3.8 },
-{ 20.154791, 13.449866, 3.8 },
-{ 20.152876, 13.450298, 3.8 },
-{ 20.154928, 13.451378, 3.8 },
-{ 20.154655, 13.450212, 3.8 },
-{ 20.153288, 13.450773, 3.8 },
-{ 20.152786, 13.451162, 3.8 },
-{ 20.154699, 13.449478, 3.8 },
-{ 20.153698, 13.450083, 3.8 },
-{ 20.154791, 13.450342, 3.8 },
-{ 20.15192, 13.450428, 3.8 },
-{ 20.152876, 13.449046, 3.8 },
-{ 20.152239, 13.449608, 3.8 },
-{ 20.153469, 13.449435, 3.8 },
-{ 20.153744, 13.45155, 3.8 },
-{ 20.153925, 13.450687, 3.8 },
-{ 20.154472, 13.450773, 3.8 },
-{ 20.153059, 13.450515, 3.8 },
-{ 20.15233, 13.449996, 3.8 },
-{ 20.153242, 13.451421, 3.8 },
-{ 20.1542, 13.450773, 3.8 },
-{ 20.153698, 13.44896, 3.8 },
-{ 20.153013, 13.449348, 3.8 },
-{ 20.153788, 13.449046, 3.8 },
-{ 20.153744, 13.452155, 3.8 },
-{ 20.152193, 13.449391, 3.8 },
-{ 20.153561, 13.451162, 3.8 },
-{ 20.154289, 13.451378, 3.8 },
-{ 20.153469, 13.450687, 3.8 },
-{ 20.154564, 13.449694, 3.8 },
-{ 20.154381, 13.451465, 3.8 },
-{ 20.152239, 13.450083, 3.8 },
-{ 20.153151, 13.450471, 3.8 },
-{ 20.153196, 13.450471, 3.8 },
-{ 20.154518, 13.450515, 3.8 },
-{ 20.153196, 13.451292, 3.8 },
-{ 20.151646, 13.450687, 3.8 },
-{ 20.153879, 13.450817, 3.8 },
-{ 20.155338, 13.450601, 3.8 },
-{ 20.154108, 13.450515, 3.8 },
-{ 20.153744, 13.450169, 3.8 },
-{ 20.153332, 13.451205, 3.8 },
-{ 20.153515, 13.450773, 3.8 },
-{ 20.153652, 13.450083, 3.8 },
-{ 20.153151, 13.451421, 3.8 },
-{ 20.153744, 13.450298, 3.8 },
-{ 20.153879, 13.449263, 3.8 },
-{ 20.152102, 13.449608, 3.8 },
-{ 20.152285, 13.450601, 3.8 },
-{ 20.153059, 13.45004, 3.8 },
-{ 20.153788, 13.449953, 3.8 },
-{ 20.15461, 13.44991, 3.8 },
-{ 20.154699, 13.449651, 3.8 },
-{ 20.153788, 13.45073, 3.8 },
-{ 20.153971, 13.451421, 3.8 },
-{ 20.154108, 13.451767, 3.8 },
-{ 20.154108, 13.449348, 3.8 },
-{ 20.15274, 13.45073, 3.8 },
-{ 20.153698, 13.450687, 3.8 },
-{ 20.154745, 13.450601, 3.8 },
-{ 20.153698, 13.450558, 3.8 },
-{ 20.153515, 13.450601, 3.8 },
-{ 20.154472, 13.450169, 3.8 },
-{ 20.154472, 13.451508, 3.8 },
-{ 20.154108, 13.450644, 3.8 },
-{ 20.153925, 13.450471, 3.8 },
-{ 20.152603, 13.449435, 3.8 },
-{ 20.155384, 13.452112, 3.8 },
-{ 20.153833, 13.451594, 3.8 },
-{ 20.153744, 13.44991, 3.8 },
-{ 20.153515, 13.451162, 3.8 },
-{ 20.154882, 13.451162, 3.8 },
-{ 20.154518, 13.448788, 3.8 },
-{ 20.154381, 13.450471, 3.8 },
-{ 20.153744, 13.453494, 3.8 },
-{ 20.153744, 13.449866, 3.8 },
-{ 20.155748, 13.451292, 3.8 },
-{ 20.152786, 13.451508, 3.8 },
-{ 20.154154, 13.450946, 3.8 },
-{ 20.154699, 13.450644, 3.8 },
-{ 20.152832, 13.450169, 3.8 },
-{ 20.153469, 13.450644, 3.8 },
-{ 20.153105, 13.451162, 3.8 },
-{ 20.15242, 13.449521, 3.8 },
-{ 20.154062, 13.450946, 3.8 },
-{ 20.153788, 13.451378, 3.8 },
-{ 20.153652, 13.450644, 3.8 },
-{ 20.154108, 13.451076, 3.8 },
-{ 20.154745, 13.451421, 3.8 },
-{ 20.15502, 13.451378, 3.8 },
-{ 20.153788, 13.451292, 3.8 },
-{ 20.154289, 13.44909, 3.8 },
-{ 20.153332, 13.450083, 3.8 },
-{ 20.152922, 13.449694, 3.8 },
-{ 20.152193, 13.450903, 3.8 },
-{ 20.154745, 13.452932, 3.8 },
-{ 20.153788, 13.450515, 3.8 },
-{ 20.154745, 13.449263, 3.8 },
-{ 20.154154, 13.450385, 3.8 },
-{ 20.154108, 13.451335, 3.8 },
-{ 20.15543, 13.45086, 3.8 },
-{ 20.15461, 13.450558, 3.8 },
-{ 20.153879, 13.450946, 3.8 },
-{ 20.15461, 13.450644, 3.8 },
-{ 20.153652, 13.45194, 3.8 },
-{ 20.153925, 13.450903, 3.8 },
-{ 20.154472, 13.45073, 3.8 },
-{ 20.154699, 13.451723, 3.8 },
-{ 20.153288, 13.450558, 3.8 },
-{ 20.155201, 13.448831, 3.8 },
-{ 20.153059, 13.451033, 3.8 },
-{ 20.155748, 13.45099, 3.8 },
-{ 20.153971, 13.453062, 3.8 },
-{ 20.1542, 13.450083, 3.8 },
-{ 20.155338, 13.452198, 3.8 },
-{ 20.153833, 13.450558, 3.8 },
-{ 20.155293, 13.450212, 3.8 },
-{ 20.153378, 13.450773, 3.8 },
-{ 20.154882, 13.451421, 3.8 },
-{ 20.154335, 13.451162, 3.8 },
-{ 20.154154, 13.450428, 3.8 },
-{ 20.153744, 13.451594, 3.8 },
-{ 20.153698, 13.451076, 3.8 },
-{ 20.155886, 13.450558, 3.8 },
-{ 20.153606, 13.450515, 3.8 },
-{ 20.155201, 13.451723, 3.8 },
-{ 20.154427, 13.449651, 3.8 },
-{ 20.152603, 13.450126, 3.8 },
-{ 20.154472, 13.45168, 3.8 },
-{ 20.156523, 13.45073, 3.8 },
-{ 20.153332, 13.451118, 3.8 },
-{ 20.15584, 13.451594, 3.8 },
-{ 20.155657, 13.451508, 3.8 },
-{ 20.153925, 13.450342, 3.8 },
-{ 20.154472, 13.450471, 3.8 },
-{ 20.153971, 13.451896, 3.8 },
-{ 20.152967, 13.45181, 3.8 },
-{ 20.154791, 13.451508, 3.8 },
-{ 20.153288, 13.45155, 3.8 },
-{ 20.154928, 13.450946, 3.8 },
-{ 20.155066, 13.45073, 3.8 },
-{ 20.155521, 13.450601, 3.8 },
-{ 20.154974, 13.450644, 3.8 },
-{ 20.154518, 13.450385, 3.8 },
-{ 20.156296, 13.449996, 3.8 },
-{ 20.15502, 13.451421, 3.8 },
-{ 20.1542, 13.450342, 3.8 },
-{ 20.155338, 13.451205, 3.8 },
-{ 20.154016, 13.450471, 3.8 },
-{ 20.154289, 13.452673, 3.8 },
-{ 20.155247, 13.45004, 3.8 },
-{ 20.154974, 13.451853, 3.8 },
-{ 20.15461, 13.451421, 3.8 },
-{ 20.153698, 13.451205, 3.8 },
-{ 20.153288, 13.45099, 3.8 },
-{ 20.155155, 13.452112, 3.8 },
-{ 20.1542, 13.451335, 3.8 },
-{ 20.154108, 13.451162, 3.8 },
-{ 20.154974, 13.452069, 3.8 },
-{ 20.155611, 13.451205, 3.8 },
-{ 20.154655, 13.45194, 3.8 },
-{ 20.154289, 13.450298, 3.8 },
-{ 20.153242, 13.450558, 3.8 },
-{ 20.154699, 13.451292, 3.8 },
-{ 20.154289, 13.450773, 3.9 },
-{ 20.153879, 13.450298, 3.9 },
-{ 20.153833, 13.451076, 3.9 },
-{ 20.154745, 13.451033, 3.9 },
-{ 20.155247, 13.452371, 3.9 },
-{ 20.155066, 13.452932, 3.8 },
-{ 20.156569, 13.450817, 3.8 },
-{ 20.154882, 13.452242, 3.8 },
-{ 20.155066, 13.4525, 3.8 },
-{ 20.156021, 13.451421, 3.8 },
-{ 20.154837, 13.45073, 3.8 },
-{ 20.154154, 13.45168, 3.8 },
-{ 20.157207, 13.451508, 3.8 },
-{ 20.15461, 13.451508, 3.8 },
-{ 20.153788, 13.452932, 3.8 },
-{ 20.155338, 13.450342, 3.8 },
-{ 20.154837, 13.451076, 3.8 },
-{ 20.154518, 13.45155, 3.8 },
-{ 20.155977, 13.450385, 3.8 },
-{ 20.153744, 13.450342, 3.8 },
-{ 20.154427, 13.452415, 3.8 },
-{ 20.155565, 13.452544, 3.8 },
-{ 20.155384, 13.45073, 3.8 },
-{ 20.154655, 13.453062, 3.8 },
-{ 20.155066, 13.452544, 3.8 },
-{ 20.156158, 13.45181, 3.8 },
-{ 20.154518, 13.450946, 3.8 },
-{ 20.154745, 13.451508, 3.8 },
-{ 20.154381, 13.452371, 3.8 },
-{ 20.156158, 13.452544, 3.8 },
-{ 20.155748, 13.450558, 3.8 },
-{ 20.156021, 13.451767, 3.8 },
-{ 20.153561, 13.451594, 3.8 },
-{ 20.153606, 13.451076, 3.8 },
-{ 20.155155, 13.450169, 3.8 },
-{ 20.154335, 13.451896, 3.9 },
-{ 20.156979, 13.451508, 3.9 },
-{ 20.154974, 13.450817, 3.9 },
-{ 20.154699, 13.453148, 3.9 },
-{ 20.153242, 13.451076, 3.9 },
-{ 20.15584, 13.451982, 3.8 },
-{ 20.155247, 13.45181, 3.8 },
-{ 20.155521, 13.451205, 3.8 },
-{ 20.155565, 13.451335, 3.8 },
-{ 20.155521, 13.451465, 3.8 },
-{ 20.154472, 13.452587, 3.8 },
-{ 20.155155, 13.452415, 3.8 },
-{ 20.155155, 13.452285, 3.8 },
-{ 20.154791, 13.451637, 3.8 },
-{ 20.155338, 13.453105, 3.8 },
-{ 20.156113, 13.450255, 3.9 },
-{ 20.157024, 13.451767, 3.9 },
-{ 20.155521, 13.450471, 3.9 },
-{ 20.155521, 13.45099, 3.9 },
-{ 20.155293, 13.451033, 3.9 },
-{ 20.155293, 13.452285, 3.9 },
-{ 20.155247, 13.452242, 3.9 },
-{ 20.155977, 13.452717, 3.9 },
-{ 20.155886, 13.451637, 3.9 },
-{ 20.156158, 13.450817, 3.9 },
-{ 20.154518, 13.45155, 3.9 },
-{ 20.156933, 13.451335, 3.9 },
-{ 20.153469, 13.451205, 3.9 },
-{ 20.155476, 13.451896, 3.9 },
-{ 20.156021, 13.451982, 3.9 },
-{ 20.153196, 13.452198, 3.9 },
-{ 20.155247, 13.452285, 3.9 },
-{ 20.153606, 13.451853, 3.9 },
-{ 20.155748, 13.452025, 3.9 },
-{ 20.155384, 13.452415, 3.9 },
-{ 20.155293, 13.45194, 3.9 },
-{ 20.155886, 13.452371, 3.9 },
-{ 20.155155, 13.449478, 3.9 },
-{ 20.156706, 13.451982, 3.9 },
-{ 20.155293, 13.451076, 3.9 },
-{ 20.154381, 13.451162, 3.9 },
-{ 20.155748, 13.45086, 3.9 },
-{ 20.154974, 13.452415, 3.9 },
-{ 20.155476, 13.451421, 3.9 },
-{ 20.155247, 13.453278, 3.9 },
-{ 20.15748, 13.452889, 3.9 },
-{ 20.15502, 13.453105, 3.9 },
-{ 20.157345, 13.452198, 3.9 },
-{ 20.156433, 13.452457, 3.9 },
-{ 20.154928, 13.451248, 3.9 },
-{ 20.155977, 13.452069, 3.9 },
-{ 20.15584, 13.451723, 3.9 },
-{ 20.154472, 13.452415, 3.9 },
-{ 20.155384, 13.452717, 3.9 },
-{ 20.156979, 13.45099, 3.9 },
-{ 20.155886, 13.452198, 3.9 },
-{ 20.156569, 13.45181, 3.9 },
-{ 20.155247, 13.45086, 3.9 },
-{ 20.155611, 13.452155, 3.9 },
-{ 20.155565, 13.451162, 3.9 },
-{ 20.156523, 13.451248, 3.9 },
-{ 20.156296, 13.452155, 3.9 },
-{ 20.15666, 13.452587, 3.9 },
-{ 20.156523, 13.44991, 3.9 },
-{ 20.15543, 13.453882, 3.9 },
-{ 20.157572, 13.45073, 3.9 },
-{ 20.156021, 13.452371, 3.9 },
-{ 20.157845, 13.450773, 3.9 },
-{ 20.155977, 13.450558, 3.9 },
-{ 20.156204, 13.452587, 3.9 },
-{ 20.15625, 13.451465, 3.9 },
-{ 20.15707, 13.452328, 3.9 },
-{ 20.156296, 13.45181, 3.9 },
-{ 20.1542, 13.452371, 3.9 },
-{ 20.155703, 13.453364, 3.9 },
-{ 20.155794, 13.45194, 3.9 },
-{ 20.156433, 13.450903, 3.9 },
-{ 20.155703, 13.452889, 3.9 },
-{ 20.15461, 13.453192, 3.9 },
-{ 20.155066, 13.452155, 3.9 },
-{ 20.15584, 13.45194, 3.9 },
-{ 20.155748, 13.452544, 3.9 },
-{ 20.156477, 13.452371, 3.9 },
-{ 20.156706, 13.451033, 3.9 },
-{ 20.15666, 13.452932, 3.9 },
-{ 20.15543, 13.451076, 3.9 },
-{ 20.157253, 13.452198, 3.9 },
-{ 20.15666, 13.45345, 3.9 },
-{ 20.155476, 13.452932, 3.9 },
-{ 20.155476, 13.452457, 3.9 },
-{ 20.156614, 13.452112, 3.9 },
-{ 20.15584, 13.452025, 3.9 },
-{ 20.155611, 13.451723, 3.9 },
-{ 20.15666, 13.452932, 3.9 },
-{ 20.154745, 13.452847, 3.9 },
-{ 20.156614, 13.45181, 3.9 },
-{ 20.156204, 13.452415, 3.9 },
-{ 20.156296, 13.452717, 3.9 },
-{ 20.157982, 13.45168, 3.9 },
-{ 20.15625, 13.451896, 3.9 },
-{ 20.155155, 13.4525, 3.9 },
-{ 20.156433, 13.452069, 3.9 },
-{ 20.156067, 13.453062, 3.9 },
-{ 20.156614, 13.45181, 3.9 },
-{ 20.156113, 13.452112, 3.9 },
-{ 20.154928, 13.452285, 3.9 },
-{ 20.154427, 13.451378, 3.9 },
-{ 20.156523, 13.454012, 3.9 },
-{ 20.156477, 13.452717, 3.9 },
-{ 20.156979, 13.45155, 3.9 },
-{ 20.155476, 13.451594, 3.9 },
-{ 20.156569, 13.45168, 3.9 },
-{ 20.156433, 13.45276, 3.9 },
-{ 20.156843, 13.452847, 3.9 },
-{ 20.156979, 13.451508, 3.9 },
-{ 20.154564, 13.452371, 3.9 },
-{ 20.156433, 13.45263, 3.9 },
-{ 20.156933, 13.45358, 3.9 },
-{ 20.157526, 13.452069, 3.9 },
-{ 20.157162, 13.452457, 3.9 },
-{ 20.156158, 13.453148, 3.9 },
-{ 20.157162, 13.452587, 3.9 },
-{ 20.157345, 13.45263, 3.9 },
-{ 20.157207, 13.452847, 3.9 },
-{ 20.155565, 13.452415, 3.9 },
-{ 20.15666, 13.451594, 3.9 },
-{ 20.155748, 13.451378, 3.9 },
-{ 20.155155, 13.452155, 3.9 },
-{ 20.156158, 13.451723, 3.9 },
-{ 20.155521, 13.451205, 3.9 },
-{ 20.15707, 13.451594, 3.9 },
-{ 20.157709, 13.454055, 3.9 },
-{ 20.15748, 13.452242, 3.9 },
-{ 20.15748, 13.453537, 3.9 },
-{ 20.156477, 13.451982, 3.9 },
-{ 20.158802, 13.450903, 3.9 },
-{ 20.156933, 13.452371, 3.9 },
-{ 20.157982, 13.452155, 3.9 },
-{ 20.157663, 13.451594, 3.9 },
-{ 20.157663, 13.45099, 3.9 },
-{ 20.15789, 13.45194, 3.9 },
-{ 20.157162, 13.45194, 3.9 },
-{ 20.158165, 13.451767, 3.9 },
-{ 20.159122, 13.450773, 3.9 },
-{ 20.156933, 13.451205, 3.9 },
-{ 20.15789, 13.453278, 3.9 },
-{ 20.158484, 13.451508, 3.9 },
-{ 20.157572, 13.450471, 3.9 },
-{ 20.158484, 13.452457, 3.9 },
-{ 20.15789, 13.452717, 3.9 },
-{ 20.159166, 13.451335, 3.9 },
-{ 20.157299, 13.450601, 3.9 },
-{ 20.157618, 13.452371, 3.9 },
-{ 20.15748, 13.452975, 3.9 },
-{ 20.157982, 13.452889, 3.9 },
-{ 20.157936, 13.452155, 3.9 },
-{ 20.159166, 13.451853, 3.9 },
-{ 20.158257, 13.452371, 3.9 },
-{ 20.157526, 13.452975, 3.9 },
-{ 20.157663, 13.452587, 3.9 },
-{ 20.157024, 13.451723, 3.9 },
-{ 20.157936, 13.449565, 3.9 },
-{ 20.157982, 13.451853, 3.9 },
-{ 20.159622, 13.450558, 3.9 },
-{ 20.158621, 13.450687, 3.9 },
-{ 20.158073, 13.450515, 3.9 },
-{ 20.157982, 13.45194, 3.9 },
-{ 20.158211, 13.451205, 3.9 },
-{ 20.158985, 13.452457, 3.9 },
-{ 20.159031, 13.452069, 3.9 },
-{ 20.159304, 13.45099, 3.9 },
-{ 20.159622, 13.451076, 3.9 },
-{ 20.158438, 13.451118, 3.9 },
-{ 20.158529, 13.451896, 3.9 },
-{ 20.158529, 13.450515, 3.9 },
-{ 20.159166, 13.451637, 3.9 },
-{ 20.157709, 13.450212, 3.9 },
-{ 20.159714, 13.451205, 3.9 },
-{ 20.159943, 13.452112, 3.9 },
-{ 20.159578, 13.451118, 3.9 },
-{ 20.160261, 13.450817, 3.9 },
-{ 20.158985, 13.451508, 3.9 },
-{ 20.159258, 13.451853, 3.9 },
-{ 20.160078, 13.450342, 3.9 },
-{ 20.159988, 13.450817, 3.9 },
-{ 20.161127, 13.452025, 3.9 },
-{ 20.160398, 13.451076, 3.9 },
-{ 20.159622, 13.449953, 3.9 },
-{ 20.158756, 13.450773, 3.9 },
-{ 20.159031, 13.451033, 3.9 },
-{ 20.159077, 13.45181, 4.0 },
-{ 20.159304, 13.450212, 4.0 },
-{ 20.159943, 13.451292, 4.0 },
-{ 20.160078, 13.449953, 4.0 },
-{ 20.160809, 13.450428, 4.0 },
-{ 20.160353, 13.451248, 3.9 },
-{ 20.159578, 13.452587, 3.9 },
-{ 20.15976, 13.451853, 3.9 },
-{ 20.160534, 13.448744, 3.9 },
-{ 20.160625, 13.45194, 3.9 },
-{ 20.160717, 13.451292, 3.9 },
-{ 20.161993, 13.450255, 3.9 },
-{ 20.159988, 13.450385, 3.9 },
-{ 20.16058, 13.451594, 3.9 },
-{ 20.16058, 13.450471, 3.9 },
-{ 20.159487, 13.450515, 3.9 },
-{ 20.161947, 13.452069, 3.9 },
-{ 20.161766, 13.450342, 3.9 },
-{ 20.161081, 13.451033, 3.9 },
-{ 20.161036, 13.451465, 3.9 },
-{ 20.160307, 13.450773, 3.9 },
-{ 20.161993, 13.451205, 3.9 },
-{ 20.160398, 13.450773, 3.9 },
-{ 20.161219, 13.451594, 3.9 },
-{ 20.160854, 13.450471, 3.9 },
-{ 20.160261, 13.450255, 3.9 },
-{ 20.161766, 13.45099, 3.9 },
-{ 20.162268, 13.449306, 3.9 },
-{ 20.160946, 13.450946, 3.9 },
-{ 20.16049, 13.450903, 3.9 },
-{ 20.161402, 13.450342, 3.9 },
-{ 20.163679, 13.449565, 3.9 },
-{ 20.162586, 13.450428, 3.9 },
-{ 20.162357, 13.451205, 3.9 },
-{ 20.162268, 13.449478, 3.9 },
-{ 20.162312, 13.450515, 3.9 },
-{ 20.162222, 13.449219, 3.9 },
-{ 20.16131, 13.450212, 3.9 },
-{ 20.163088, 13.449348, 3.9 },
-{ 20.161537, 13.449003, 3.9 },
-{ 20.163134, 13.451421, 3.9 },
-{ 20.162176, 13.449521, 3.9 },
-{ 20.162495, 13.450385, 3.9 },
-{ 20.162222, 13.450169, 3.9 },
-{ 20.161858, 13.449608, 3.9 },
-{ 20.162085, 13.45099, 3.9 },
-{ 20.160215, 13.449953, 3.9 },
-{ 20.163042, 13.449694, 3.9 },
-{ 20.16131, 13.450428, 3.9 },
-{ 20.162767, 13.44801, 3.9 },
-{ 20.162176, 13.449521, 4.0 },
-{ 20.16172, 13.44978, 4.0 },
-{ 20.162357, 13.449003, 4.0 },
-{ 20.16254, 13.450428, 4.0 },
-{ 20.162176, 13.450298, 4.0 },
-{ 20.163816, 13.450601, 4.0 },
-{ 20.162905, 13.450212, 4.0 },
-{ 20.163635, 13.449176, 4.0 },
-{ 20.162403, 13.449521, 4.0 },
-{ 20.164135, 13.448528, 4.0 },
-{ 20.162724, 13.451033, 3.9 },
-{ 20.162586, 13.449521, 3.9 },
-{ 20.164364, 13.449348, 3.9 },
-{ 20.161356, 13.453019, 3.9 },
-{ 20.141344, 13.466404, 3.9 },
-{ 20.134371, 13.469988, 4.0 },
-{ 20.128901, 13.471542, 4.0 },
-{ 20.12808, 13.473097, 4.0 },
-{ 20.125982, 13.472881, 4.0 },
-{ 20.126484, 13.474392, 4.0 },
-{ 20.125572, 13.474651, 4.0 },
-{ 20.126028, 13.476076, 4.0 },
-{ 20.124388, 13.478753, 4.0 },
-{ 20.123932, 13.476896, 4.0 },
-{ 20.123978, 13.478451, 4.0 },
-{ 20.124023, 13.479573, 4.0 },
-{ 20.124798, 13.479746, 4.0 },
-{ 20.124569, 13.478538, 4.0 },
-{ 20.128035, 13.479012, 4.0 },
-{ 20.125071, 13.479315, 4.0 },
-{ 20.127123, 13.477069, 4.0 },
-{ 20.126392, 13.477156, 4.0 },
-{ 20.129448, 13.476681, 4.0 },
-{ 20.128717, 13.474565, 4.0 },
-{ 20.130039, 13.472795, 4.0 },
-{ 20.133276, 13.469858, 4.0 },
-{ 20.132729, 13.468736, 4.0 },
-{ 20.136559, 13.467095, 4.0 },
-{ 20.13706, 13.464936, 4.0 },
-{ 20.138792, 13.463468, 4.0 },
-{ 20.139294, 13.460316, 4.0 },
-{ 20.139566, 13.458805, 4.0 },
-{ 20.14139, 13.457294, 4.0 },
-{ 20.143122, 13.456559, 4.0 },
-{ 20.142849, 13.454962, 4.0 },
-{ 20.142803, 13.454185, 4.0 },
-{ 20.141891, 13.454012, 4.0 },
-{ 20.141983, 13.451982, 4.0 },
-{ 20.142849, 13.451465, 4.0 },
-{ 20.142118, 13.450169, 4.0 },
-{ 20.142393, 13.449176, 4.0 },
-{ 20.142073, 13.449694, 4.0 },
-{ 20.142347, 13.448788, 4.0 },
-{ 20.140251, 13.448096, 4.0 },
-{ 20.139156, 13.448485, 4.0 },
-{ 20.14016, 13.446758, 4.0 },
-{ 20.138609, 13.447406, 4.0 },
-{ 20.138472, 13.446197, 4.0 },
-{ 20.137789, 13.446283, 4.0 },
-{ 20.136011, 13.44611, 4.0 },
-{ 20.134871, 13.447017, 4.0 },
-{ 20.135099, 13.44611, 4.0 },
-{ 20.133595, 13.446844, 4.0 },
-{ 20.132593, 13.44529, 4.0 },
-{ 20.130222, 13.446326, 4.0 },
-{ 20.129356, 13.444729, 4.0 },
-{ 20.131315, 13.446456, 4.0 },
-{ 20.130358, 13.445549, 4.0 },
-{ 20.129128, 13.443952, 4.0 },
-{ 20.128124, 13.444297, 4.0 },
-{ 20.129629, 13.44326, 4.0 },
-{ 20.128216, 13.443347, 4.0 },
-{ 20.129082, 13.441878, 4.0 },
-{ 20.12776, 13.442225, 4.0 },
-{ 20.127441, 13.442181, 4.0 },
-{ 20.126074, 13.441231, 4.0 },
-{ 20.126484, 13.441145, 4.0 },
-{ 20.126802, 13.439073, 4.0 },
-{ 20.126757, 13.438726, 4.0 },
-{ 20.127714, 13.437777, 4.0 },
-{ 20.127396, 13.436827, 4.0 },
-{ 20.128124, 13.435532, 4.0 },
-{ 20.127441, 13.434711, 4.0 },
-{ 20.12858, 13.434539, 4.0 },
-{ 20.126438, 13.434107, 4.0 },
-{ 20.128035, 13.431905, 4.0 },
-{ 20.127441, 13.430609, 4.0 },
-{ 20.128445, 13.429271, 4.0 },
-{ 20.130222, 13.427976, 4.0 },
-{ 20.129948, 13.426162, 4.0 },
-{ 20.129356, 13.424953, 4.0 },
-{ 20.130997, 13.42219, 4.0 },
-{ 20.132318, 13.421196, 4.0 },
-{ 20.132364, 13.420808, 4.0 },
-{ 20.132547, 13.418736, 4.0 },
-{ 20.132683, 13.418087, 4.0 },
-{ 20.133413, 13.417137, 4.0 },
-{ 20.132456, 13.416792, 4.0 },
-{ 20.13241, 13.412, 4.0 },
-{ 20.133778, 13.413467, 4.0 },
-{ 20.135191, 13.413295, 4.0 },
-{ 20.134735, 13.411049, 4.0 },
-{ 20.135008, 13.411006, 4.0 },
-{ 20.135099, 13.410056, 4.0 },
-{ 20.134962, 13.409366, 4.0 },
-{ 20.135647, 13.407768, 4.0 },
-{ 20.136877, 13.407639, 4.0 },
-{ 20.132181, 13.403709, 4.0 },
-{ 20.137333, 13.40617, 4.0 },
-{ 20.13788, 13.40427, 4.0 },
-{ 20.137241, 13.404313, 4.0 },
-{ 20.137743, 13.403795, 4.0 },
-{ 20.138563, 13.402198, 4.0 },
-{ 20.137697, 13.403018, 4.0 },
-{ 20.13633, 13.401766, 4.0 },
-{ 20.136011, 13.401291, 4.0 },
-{ 20.136831, 13.401205, 4.0 },
-{ 20.137196, 13.398052, 4.0 },
-{ 20.13747, 13.400039, 4.0 },
-{ 20.136375, 13.398787, 4.0 },
-{ 20.136011, 13.400082, 4.0 },
-{ 20.135509, 13.398441, 4.0 },
-{ 20.137196, 13.400989, 4.0 },
-{ 20.134506, 13.398829, 4.0 },
-{ 20.133686, 13.398744, 4.0 },
-{ 20.132227, 13.398527, 4.0 },
-{ 20.130404, 13.399779, 4.0 },
-{ 20.130039, 13.398096, 4.0 },
-{ 20.129173, 13.401723, 4.0 },
-{ 20.126757, 13.399607, 4.0 },
-{ 20.125208, 13.400946, 4.0 },
-{ 20.123611, 13.401291, 4.0 },
-{ 20.122017, 13.402673, 4.0 },
-{ 20.123066, 13.40155, 4.0 },
-{ 20.118324, 13.40155, 4.0 },
-{ 20.119101, 13.401421, 4.0 },
-{ 20.11673, 13.403061, 4.0 },
-{ 20.116365, 13.402716, 4.0 },
-{ 20.115953, 13.403407, 4.0 },
-{ 20.117868, 13.40414, 4.0 },
-{ 20.118097, 13.401853, 4.0 },
-{ 20.116684, 13.404055, 4.0 },
-{ 20.116501, 13.399564, 4.0 },
-{ 20.116409, 13.401421, 4.0 },
-{ 20.116592, 13.401031, 4.0 },
-{ 20.118006, 13.400039, 4.0 },
-{ 20.11796, 13.400514, 4.0 },
-{ 20.119101, 13.400773, 4.0 },
-{ 20.11714, 13.399953, 4.0 },
-{ 20.120695, 13.398614, 4.0 },
-{ 20.119373, 13.399176, 4.0 },
-{ 20.120285, 13.399089, 4.0 },
-{ 20.119921, 13.397491, 4.0 },
-{ 20.120649, 13.396671, 4.0 },
-{ 20.121105, 13.397232, 4.0 },
-{ 20.124388, 13.395247, 4.0 },
-{ 20.121469, 13.395894, 4.0 },
-{ 20.122154, 13.395289, 4.0 },
-{ 20.123978, 13.394469, 4.0 },
-{ 20.124798, 13.395117, 4.0 },
-{ 20.125391, 13.392353, 4.0 },
-{ 20.125391, 13.391791, 4.0 },
-{ 20.126484, 13.393476, 4.0 },
-{ 20.126074, 13.392569, 4.0 },
-{ 20.128445, 13.39136, 4.0 },
-{ 20.12808, 13.391144, 4.0 },
-{ 20.126028, 13.390713, 4.0 },
-{ 20.127668, 13.390367, 4.0 },
-{ 20.127258, 13.390064, 4.0 },
-{ 20.128445, 13.389071, 4.0 },
-{ 20.128307, 13.388165, 4.0 },
-{ 20.127668, 13.389158, 4.0 },
-{ 20.129492, 13.388208, 4.0 },
-{ 20.12858, 13.387776, 4.0 },
-{ 20.128262, 13.387949, 4.0 },
-{ 20.12808, 13.386912, 4.0 },
-{ 20.129993, 13.388424, 4.0 },
-{ 20.127304, 13.38674, 4.0 },
-{ 20.127441, 13.387129, 4.0 },
-{ 20.128672, 13.387258, 4.0 },
-{ 20.129082, 13.38661, 4.0 },
-{ 20.126713, 13.385747, 4.0 },
-{ 20.12808, 13.387431, 4.0 },
-{ 20.12612, 13.386395, 4.0 },
-{ 20.128809, 13.386912, 4.0 },
-{ 20.127396, 13.386869, 4.0 },
-{ 20.126347, 13.386005, 4.0 },
-{ 20.128536, 13.385747, 4.0 },
-{ 20.128855, 13.386179, 4.0 },
-{ 20.128536, 13.385056, 4.0 },
-{ 20.128353, 13.38415, 4.0 },
-{ 20.128307, 13.384883, 4.0 },
-{ 20.129356, 13.383933, 4.0 },
-{ 20.128717, 13.382811, 4.0 },
-{ 20.129629, 13.382725, 4.0 },
-{ 20.130951, 13.383545, 4.0 },
-{ 20.131725, 13.382076, 4.0 },
-{ 20.131407, 13.379356, 4.0 },
-{ 20.131725, 13.378752, 4.0 },
-{ 20.132957, 13.377889, 4.0 },
-{ 20.135509, 13.377975, 4.0 },
-{ 20.136513, 13.377889, 4.0 },
-{ 20.13715, 13.376982, 4.0 },
-{ 20.137926, 13.377414, 4.0 },
-{ 20.137606, 13.374823, 4.0 },
-{ 20.139339, 13.37383, 4.0 },
-{ 20.141207, 13.374909, 4.0 },
-{ 20.140524, 13.372534, 4.0 },
-{ 20.141117, 13.371671, 4.0 },
-{ 20.143076, 13.372189, 4.0 },
-{ 20.141527, 13.371671, 4.0 },
-{ 20.143076, 13.370504, 4.0 },
-{ 20.144489, 13.369252, 4.0 },
-{ 20.144854, 13.370246, 4.0 },
-{ 20.145082, 13.368907, 4.0 },
-{ 20.14613, 13.36731, 4.0 },
-{ 20.146358, 13.367439, 4.0 },
-{ 20.146906, 13.367742, 4.0 },
-{ 20.147589, 13.367525, 4.0 },
-{ 20.148182, 13.366921, 4.0 },
-{ 20.147362, 13.364287, 4.0 },
-{ 20.150461, 13.364805, 4.0 },
-{ 20.148956, 13.363423, 4.0 },
-{ 20.149776, 13.364071, 4.0 },
-{ 20.148684, 13.36351, 4.0 },
-{ 20.150507, 13.362603, 4.0 },
-{ 20.150051, 13.363812, 4.0 },
-{ 20.149776, 13.361524, 4.0 },
-{ 20.152147, 13.362646, 4.0 },
-{ 20.151327, 13.361826, 4.0 },
-{ 20.151144, 13.360574, 4.0 },
-{ 20.150871, 13.360789, 4.0 },
-{ 20.151098, 13.361783, 4.0 },
-{ 20.151098, 13.360962, 4.0 },
-{ 20.151508, 13.358847, 4.0 },
-{ 20.151646, 13.359624, 4.0 },
-{ 20.151464, 13.359322, 4.0 },
-{ 20.152285, 13.359322, 4.0 },
-{ 20.152695, 13.358587, 4.0 },
-{ 20.152786, 13.360401, 4.0 },
-{ 20.153059, 13.356429, 4.0 },
-{ 20.153971, 13.356947, 4.0 },
-{ 20.153788, 13.357465, 4.0 },
-{ 20.154564, 13.356817, 4.0 },
-{ 20.156523, 13.356299, 4.0 },
-{ 20.155338, 13.355003, 4.0 },
-{ 20.155565, 13.353449, 4.0 },
-{ 20.15666, 13.352413, 4.0 },
-{ 20.156433, 13.352888, 4.0 },
-{ 20.159077, 13.353104, 4.0 },
-{ 20.157345, 13.351981, 4.0 },
-{ 20.159622, 13.350081, 4.0 },
-{ 20.160307, 13.350643, 4.0 },
-{ 20.161629, 13.349779, 4.0 },
-{ 20.159304, 13.350211, 4.0 },
-{ 20.161081, 13.347836, 4.0 },
-{ 20.161537, 13.349217, 4.0 },
-{ 20.161537, 13.346887, 4.0 },
-{ 20.163088, 13.347922, 4.0 },
-{ 20.162678, 13.346325, 4.0 },
-{ 20.162951, 13.345288, 4.0 },
-{ 20.164227, 13.345505, 4.0 },
-{ 20.166187, 13.344036, 4.0 },
-{ 20.16605, 13.345505, 4.0 },
-{ 20.166233, 13.343216, 4.0 },
-{ 20.166597, 13.341576, 4.0 },
-{ 20.167736, 13.343173, 4.0 },
-{ 20.168148, 13.341446, 4.0 },
-{ 20.168329, 13.341359, 4.0 },
-{ 20.167145, 13.340798, 4.0 },
-{ 20.168102, 13.339589, 4.0 },
-{ 20.169195, 13.340107, 4.0 },
-{ 20.169424, 13.339762, 4.0 },
-{ 20.167965, 13.338121, 4.0 },
-{ 20.170425, 13.340452, 4.0 },
-{ 20.16988, 13.338423, 4.0 },
-{ 20.170881, 13.338164, 4.0 },
-{ 20.171566, 13.334408, 4.0 },
-{ 20.176216, 13.323958, 4.0 },
-{ 20.187019, 13.320289, 4.0 },
-{ 20.190073, 13.316402, 3.9 },
-{ 20.193172, 13.3161, 3.9 },
-{ 20.195908, 13.313251, 3.9 },
-{ 20.19577, 13.312689, 3.9 },
-{ 20.197138, 13.312257, 3.9 },
-{ 20.197001, 13.310875, 3.9 },
-{ 20.199736, 13.309364, 3.9 },
-{ 20.19887, 13.30958, 3.9 },
-{ 20.199646, 13.308846, 3.9 },
-{ 20.198824, 13.307465, 3.9 },
-{ 20.201923, 13.307205, 3.9 },
-{ 20.199873, 13.308673, 3.9 },
-{ 20.201332, 13.305866, 3.9 },
-{ 20.201605, 13.307205, 3.9 },
-{ 20.202061, 13.306428, 3.9 },
-{ 20.201513, 13.305348, 4.0 },
-{ 20.201923, 13.30604, 4.0 },
-{ 20.200329, 13.305391, 4.0 },
-{ 20.201241, 13.305737, 4.0 },
-{ 20.200876, 13.307076, 4.0 },
-{ 20.20083, 13.30699, 3.9 },
-{ 20.19928, 13.306687, 3.9 },
-{ 20.201332, 13.308328, 3.9 },
-{ 20.201103, 13.307118, 3.9 },
-{ 20.198368, 13.30794, 3.9 },
-{ 20.198233, 13.309062, 3.9 },
-{ 20.199554, 13.307205, 3.9 },
-{ 20.198187, 13.308803, 3.9 },
-{ 20.199007, 13.309494, 3.9 },
-{ 20.199053, 13.308198, 3.9 },
-{ 20.197412, 13.30781, 3.9 },
-{ 20.198824, 13.308069, 3.9 },
-{ 20.199827, 13.30755, 3.9 },
-{ 20.197456, 13.308587, 3.9 },
-{ 20.199326, 13.307292, 3.9 },
-{ 20.199144, 13.308328, 3.9 },
-{ 20.198141, 13.306558, 3.9 },
-{ 20.198643, 13.308155, 3.9 },
-{ 20.199234, 13.308198, 3.9 },
-{ 20.197001, 13.308328, 3.9 },
-{ 20.198597, 13.308112, 3.9 },
-{ 20.198551, 13.306601, 3.9 },
-{ 20.197823, 13.310616, 3.9 },
-{ 20.198689, 13.307465, 3.9 },
-{ 20.197731, 13.309796, 3.9 },
-{ 20.197275, 13.307896, 3.9 },
-{ 20.197367, 13.308414, 3.9 },
-{ 20.197912, 13.309062, 3.9 },
-{ 20.198187, 13.309105, 3.9 },
-{ 20.198322, 13.308025, 3.9 },
-{ 20.19846, 13.309148, 3.9 },
-{ 20.198734, 13.309494, 3.9 },
-{ 20.199234, 13.310962, 3.9 },
-{ 20.198961, 13.310962, 3.9 },
-{ 20.198643, 13.310314, 3.9 },
-{ 20.198915, 13.311782, 3.9 },
-{ 20.199736, 13.313293, 3.9 },
-{ 20.200056, 13.312861, 3.9 },
-{ 20.201149, 13.315409, 3.9 },
-{ 20.19919, 13.312127, 3.9 },
-{ 20.199053, 13.314373, 3.9 },
-{ 20.199417, 13.315063, 3.9 },
-{ 20.200191, 13.315711, 3.9 },
-{ 20.200466, 13.315538, 3.9 },
-{ 20.199781, 13.313898, 3.9 },
-{ 20.201241, 13.314114, 3.9 },
-{ 20.199053, 13.316186, 3.9 },
-{ 20.20229, 13.316877, 3.9 },
-{ 20.201332, 13.317352, 3.9 },
-{ 20.201014, 13.317611, 3.9 },
-{ 20.201468, 13.318345, 3.9 },
-{ 20.200329, 13.317309, 3.9 },
-{ 20.200693, 13.319339, 3.9 },
-{ 20.200739, 13.317957, 3.9 },
-{ 20.200968, 13.318777, 3.9 },
-{ 20.20083, 13.31964, 3.9 },
-{ 20.201969, 13.320764, 3.9 },
-{ 20.201559, 13.320764, 3.9 },
-{ 20.203291, 13.322922, 3.9 },
-{ 20.201149, 13.322966, 3.8 },
-{ 20.202015, 13.323224, 3.8 },
-{ 20.201696, 13.325297, 3.8 },
-{ 20.201513, 13.323441, 3.8 },
-{ 20.200785, 13.324347, 3.8 },
-{ 20.202244, 13.324088, 3.8 },
-{ 20.201742, 13.324563, 3.8 },
-{ 20.203291, 13.326981, 3.8 },
-{ 20.202517, 13.3256, 3.8 },
-{ 20.203247, 13.32711, 3.8 },
-{ 20.202244, 13.32724, 3.8 },
-{ 20.202745, 13.326938, 3.8 },
-{ 20.203838, 13.328277, 3.8 },
-{ 20.203382, 13.329356, 3.8 },
-{ 20.202608, 13.328233, 3.8 },
-{ 20.20311, 13.32914, 3.8 },
-{ 20.203566, 13.329917, 3.8 },
-{ 20.203657, 13.330522, 3.8 },
-{ 20.203064, 13.328665, 3.8 },
-{ 20.204113, 13.33091, 3.8 },
-{ 20.203156, 13.331644, 3.8 },
-{ 20.204659, 13.331817, 3.8 },
-{ 20.204432, 13.331903, 3.8 },
-{ 20.204933, 13.331989, 3.8 },
-{ 20.205025, 13.333285, 3.8 },
-{ 20.206938, 13.331989, 3.8 },
-{ 20.20475, 13.333846, 3.8 },
-{ 20.204842, 13.333544, 3.8 },
-{ 20.206938, 13.339934, 3.8 },
-{ 20.208397, 13.340237, 3.8 },
-{ 20.208534, 13.338898, 3.8 },
-{ 20.208944, 13.341014, 3.8 },
-{ 20.209764, 13.340971, 3.8 },
-{ 20.209171, 13.34313, 3.8 },
-{ 20.209446, 13.342396, 3.8 },
-{ 20.206848, 13.343389, 3.8 },
-{ 20.208715, 13.344813, 3.8 },
-{ 20.207075, 13.344555, 3.8 },
-{ 20.209036, 13.343431, 3.8 },
-{ 20.209492, 13.343691, 3.8 },
-{ 20.209309, 13.343216, 3.8 },
-{ 20.209217, 13.34313, 3.7 },
-{ 20.209171, 13.34408, 3.7 },
-{ 20.208626, 13.343863, 3.7 },
-{ 20.207348, 13.345375, 3.7 },
-{ 20.209263, 13.344511, 3.7 },
-{ 20.208488, 13.345418, 3.7 },
-{ 20.207167, 13.343389, 3.7 },
-{ 20.209581, 13.345548, 3.7 },
-{ 20.208488, 13.346066, 3.7 },
-{ 20.209538, 13.344857, 3.7 },
-{ 20.210585, 13.346887, 3.7 },
-{ 20.209309, 13.345418, 3.7 },
-{ 20.208351, 13.34503, 3.7 },
-{ 20.207212, 13.347015, 3.7 },
-{ 20.209171, 13.345548, 3.7 },
-{ 20.209354, 13.346282, 3.7 },
-{ 20.20826, 13.347275, 3.7 },
-{ 20.209309, 13.347447, 3.7 },
-{ 20.209217, 13.347275, 3.7 },
-{ 20.211224, 13.348268, 3.7 },
-{ 20.20776, 13.347879, 3.7 },
-{ 20.209036, 13.347145, 3.7 },
-{ 20.209902, 13.348397, 3.7 },
-{ 20.207577, 13.34762, 3.7 },
-{ 20.208488, 13.34857, 3.7 },
-{ 20.209217, 13.349261, 3.7 },
-{ 20.209217, 13.350081, 3.7 },
-{ 20.208351, 13.348009, 3.7 },
-{ 20.209538, 13.350167, 3.7 },
-{ 20.209538, 13.34775, 3.7 },
-{ 20.208715, 13.350081, 3.7 },
-{ 20.209902, 13.350124, 3.7 },
-{ 20.209993, 13.350772, 3.7 },
-{ 20.209581, 13.348915, 3.7 },
-{ 20.207895, 13.351118, 3.7 },
-{ 20.207577, 13.352413, 3.7 },
-{ 20.208761, 13.350945, 3.7 },
-{ 20.20867, 13.352197, 3.7 },
-{ 20.206802, 13.352586, 3.7 },
-{ 20.206026, 13.352111, 3.7 },
-{ 20.207075, 13.351549, 3.7 },
-{ 20.207895, 13.352672, 3.7 },
-{ 20.208397, 13.351549, 3.7 },
-{ 20.209856, 13.353018, 3.7 },
-{ 20.207714, 13.353665, 3.7 },
-{ 20.208351, 13.352672, 3.7 },
-{ 20.207485, 13.353406, 3.7 },
-{ 20.207895, 13.354011, 3.7 },
-{ 20.205891, 13.353493, 3.7 },
-{ 20.205753, 13.353751, 3.7 },
-{ 20.205524, 13.354183, 3.7 },
-{ 20.207348, 13.353925, 3.7 },
-{ 20.206938, 13.353579, 3.7 },
-{ 20.20598, 13.354745, 3.7 },
-{ 20.205114, 13.354443, 3.7 },
-{ 20.205891, 13.35496, 3.7 },
-{ 20.20598, 13.354615, 3.7 },
-{ 20.206072, 13.35591, 3.7 },
-{ 20.204979, 13.35496, 3.7 },
-{ 20.207304, 13.356127, 3.7 },
-{ 20.206665, 13.355306, 3.6 },
-{ 20.204569, 13.356472, 3.6 },
-{ 20.204569, 13.358631, 3.6 },
-{ 20.205524, 13.356645, 3.6 },
-{ 20.205389, 13.357335, 3.6 },
-{ 20.205435, 13.356602, 3.7 },
-{ 20.204887, 13.357897, 3.7 },
-{ 20.205481, 13.359667, 3.7 },
-{ 20.203703, 13.359581, 3.7 },
-{ 20.204294, 13.357897, 3.7 },
-{ 20.203884, 13.356947, 3.7 },
-{ 20.204659, 13.356817, 3.7 },
-{ 20.203291, 13.360271, 3.7 },
-{ 20.20434, 13.35971, 3.7 },
-{ 20.203611, 13.359926, 3.7 },
-{ 20.203156, 13.360574, 3.7 },
-{ 20.202562, 13.35971, 3.7 },
-{ 20.2027, 13.358674, 3.7 },
-{ 20.202927, 13.360099, 3.7 },
-{ 20.204159, 13.360574, 3.7 },
-{ 20.201651, 13.360962, 3.7 },
-{ 20.203201, 13.361394, 3.7 },
-{ 20.201014, 13.361567, 3.7 },
-{ 20.202517, 13.361956, 3.7 },
-{ 20.201651, 13.361006, 3.7 },
-{ 20.20229, 13.362128, 3.6 },
-{ 20.202061, 13.361092, 3.6 },
-{ 20.201332, 13.362516, 3.6 },
-{ 20.200739, 13.363208, 3.6 },
-{ 20.200922, 13.361481, 3.6 },
-{ 20.200876, 13.362516, 3.6 },
-{ 20.201014, 13.36269, 3.6 },
-{ 20.199417, 13.36269, 3.6 },
-{ 20.200739, 13.362906, 3.6 },
-{ 20.201014, 13.362128, 3.6 },
-{ 20.200329, 13.362948, 3.6 },
-{ 20.201424, 13.363251, 3.6 },
-{ 20.19928, 13.364244, 3.6 },
-{ 20.198187, 13.362646, 3.6 },
-{ 20.199873, 13.363121, 3.6 },
-{ 20.199736, 13.363942, 3.6 },
-{ 20.19969, 13.365108, 3.6 },
-{ 20.199919, 13.365453, 3.6 },
-{ 20.199965, 13.365021, 3.6 },
-{ 20.200329, 13.364762, 3.6 },
-{ 20.199326, 13.366489, 3.6 },
-{ 20.198322, 13.364373, 3.6 },
-{ 20.199827, 13.365065, 3.6 },
-{ 20.198141, 13.368475, 3.6 },
-{ 20.199417, 13.366792, 3.6 },
-{ 20.198689, 13.364805, 3.6 },
-{ 20.200512, 13.366748, 3.6 },
-{ 20.19928, 13.365367, 3.6 },
-{ 20.197412, 13.36433, 3.6 },
-{ 20.199053, 13.365928, 3.6 },
-{ 20.198824, 13.368519, 3.6 },
-{ 20.197823, 13.366792, 3.6 },
-{ 20.198004, 13.366144, 3.6 },
-{ 20.198004, 13.36813, 3.6 },
-{ 20.198004, 13.368389, 3.6 },
-{ 20.196728, 13.367137, 3.6 },
-{ 20.197866, 13.367871, 3.6 },
-{ 20.198233, 13.369382, 3.6 },
-{ 20.197912, 13.367655, 3.6 },
-{ 20.196774, 13.368217, 3.6 },
-{ 20.196363, 13.369512, 3.5 },
-{ 20.196728, 13.368951, 3.5 },
-{ 20.195269, 13.368087, 3.5 },
-{ 20.194904, 13.368389, 3.5 },
-{ 20.197777, 13.370073, 3.5 },
-{ 20.195679, 13.369469, 3.5 },
-{ 20.196728, 13.369209, 3.5 },
-{ 20.195953, 13.370548, 3.5 },
-{ 20.195406, 13.369252, 3.5 },
-{ 20.19495, 13.371066, 3.5 },
-{ 20.19495, 13.368519, 3.5 },
-{ 20.19536, 13.368951, 3.5 },
-{ 20.195633, 13.370678, 3.5 },
-{ 20.194996, 13.370807, 3.5 },
-{ 20.195406, 13.370678, 3.5 },
-{ 20.194586, 13.370721, 3.5 },
-{ 20.194767, 13.371455, 3.5 },
-{ 20.194767, 13.370419, 3.5 },
-{ 20.193537, 13.371196, 3.5 },
-{ 20.195269, 13.372016, 3.5 },
-{ 20.195816, 13.371628, 3.5 },
-{ 20.193811, 13.372663, 3.5 },
-{ 20.194494, 13.371973, 3.5 },
-{ 20.194038, 13.37383, 3.5 },
-{ 20.194176, 13.372189, 3.5 },
-{ 20.194311, 13.371411, 3.5 },
-{ 20.194403, 13.372405, 3.5 },
-{ 20.194357, 13.37383, 3.5 },
-{ 20.193537, 13.372707, 3.5 },
-{ 20.194176, 13.37275, 3.5 },
-{ 20.193264, 13.372836, 3.5 },
-{ 20.193356, 13.373657, 3.5 },
-{ 20.192944, 13.374002, 3.5 },
-{ 20.192717, 13.373398, 3.5 },
-{ 20.194221, 13.37396, 3.5 },
-{ 20.193445, 13.374823, 3.5 },
-{ 20.192533, 13.374995, 3.5 },
-{ 20.19372, 13.374736, 3.5 },
-{ 20.193035, 13.375212, 3.5 },
-{ 20.191257, 13.374909, 3.5 },
-{ 20.192352, 13.375298, 3.5 },
-{ 20.192261, 13.37465, 3.5 },
-{ 20.192352, 13.374477, 3.5 },
-{ 20.193766, 13.37547, 3.5 },
-{ 20.191257, 13.374305, 3.5 },
-{ 20.190756, 13.373484, 3.5 },
-{ 20.191349, 13.376247, 3.5 },
-{ 20.191851, 13.37534, 3.5 },
-{ 20.191031, 13.37642, 3.5 },
-{ 20.191942, 13.375255, 3.5 },
-{ 20.192123, 13.375815, 3.5 },
-{ 20.191486, 13.377586, 3.5 },
-{ 20.189754, 13.376507, 3.5 },
-{ 20.19071, 13.3756, 3.5 },
-{ 20.19112, 13.375212, 3.5 },
-{ 20.191486, 13.375255, 3.5 },
-{ 20.191486, 13.377586, 3.5 },
-{ 20.191166, 13.375687, 3.5 },
-{ 20.190073, 13.377802, 3.5 },
-{ 20.189936, 13.377586, 3.5 },
-{ 20.191441, 13.377197, 3.5 },
-{ 20.189663, 13.375687, 3.5 },
-{ 20.1903, 13.377111, 3.5 },
-{ 20.190575, 13.377672, 3.5 },
-{ 20.189342, 13.378061, 3.5 },
-{ 20.189617, 13.378104, 3.5 },
-{ 20.192625, 13.3775, 3.5 },
-{ 20.190756, 13.378752, 3.5 },
-{ 20.190939, 13.377759, 3.5 },
-{ 20.191212, 13.377197, 3.5 },
-{ 20.189798, 13.379788, 3.5 },
-{ 20.190483, 13.377759, 3.5 },
-{ 20.189434, 13.379313, 3.5 },
-{ 20.19112, 13.378147, 3.5 },
-{ 20.189526, 13.380004, 3.5 },
-{ 20.1903, 13.379097, 3.5 },
-{ 20.188932, 13.37927, 3.5 },
-{ 20.189253, 13.379443, 3.5 },
-{ 20.188751, 13.379184, 3.5 },
-{ 20.188568, 13.37832, 3.5 },
-{ 20.189526, 13.379874, 3.5 },
-{ 20.188614, 13.378277, 3.5 },
-{ 20.188295, 13.379659, 3.5 },
-{ 20.189981, 13.379659, 3.5 },
-{ 20.189663, 13.380738, 3.5 },
-{ 20.189161, 13.380954, 3.4 },
-{ 20.191031, 13.380263, 3.4 },
-{ 20.186609, 13.379054, 3.4 },
-{ 20.190073, 13.380824, 3.4 },
-{ 20.187975, 13.381386, 3.4 },
-{ 20.188295, 13.381083, 3.4 },
-{ 20.188705, 13.379616, 3.4 },
-{ 20.190254, 13.380436, 3.4 },
-{ 20.188431, 13.379745, 3.4 },
-{ 20.187794, 13.381818, 3.4 },
-{ 20.18866, 13.378924, 3.4 },
-{ 20.187246, 13.38117, 3.4 },
-{ 20.188705, 13.382422, 3.4 },
-{ 20.189571, 13.381861, 3.4 },
-{ 20.186882, 13.382206, 3.4 },
-{ 20.189161, 13.380911, 3.4 },
-{ 20.187748, 13.381083, 3.4 },
-{ 20.187656, 13.382551, 3.4 },
-{ 20.187975, 13.381861, 3.4 },
-{ 20.186928, 13.380911, 3.4 },
-{ 20.186243, 13.381299, 3.4 },
-{ 20.186153, 13.381473, 3.4 },
-{ 20.188387, 13.380954, 3.4 },
-{ 20.186289, 13.384106, 3.4 },
-{ 20.186745, 13.382638, 3.4 },
-{ 20.188477, 13.382508, 3.4 },
-{ 20.187931, 13.381688, 3.4 },
-{ 20.187565, 13.381818, 3.4 },
-{ 20.187246, 13.381213, 3.4 },
-{ 20.187201, 13.383328, 3.4 },
-{ 20.186243, 13.381861, 3.4 },
-{ 20.188431, 13.382508, 3.4 },
-{ 20.187063, 13.383977, 3.4 },
-{ 20.186745, 13.382725, 3.4 },
-{ 20.18638, 13.380997, 3.4 },
-{ 20.188021, 13.38294, 3.4 },
-{ 20.187931, 13.383243, 3.4 },
-{ 20.187519, 13.383458, 3.4 },
-{ 20.187794, 13.382725, 3.4 },
-{ 20.186609, 13.382508, 3.4 },
-{ 20.187246, 13.38294, 3.4 },
-{ 20.185741, 13.383328, 3.4 },
-{ 20.188522, 13.383113, 3.4 },
-{ 20.18638, 13.383243, 3.4 },
-{ 20.187475, 13.383113, 3.4 },
-{ 20.185514, 13.384322, 3.4 },
-{ 20.188614, 13.383372, 3.4 },
-{ 20.185787, 13.384235, 3.4 },
-{ 20.186197, 13.38471, 3.4 },
-{ 20.185741, 13.382336, 3.4 },
-{ 20.186108, 13.383933, 3.4 },
-{ 20.185423, 13.384365, 3.4 },
-{ 20.187702, 13.38553, 3.4 },
-{ 20.185787, 13.385315, 3.4 },
-{ 20.185925, 13.384235, 3.4 },
-{ 20.185833, 13.385272, 3.4 },
-{ 20.188021, 13.384667, 3.4 },
-{ 20.184511, 13.382983, 3.4 },
-{ 20.186197, 13.385402, 3.4 },
-{ 20.186882, 13.384408, 3.4 },
-{ 20.184875, 13.384235, 3.4 },
-{ 20.186335, 13.384063, 3.4 },
-{ 20.185652, 13.385358, 3.4 },
-{ 20.185698, 13.387215, 3.4 },
-{ 20.186472, 13.38471, 3.4 },
-{ 20.186928, 13.385617, 3.4 },
-{ 20.184786, 13.385229, 3.4 },
-{ 20.187748, 13.385099, 3.4 },
-{ 20.187519, 13.385574, 3.4 },
-{ 20.187475, 13.386352, 3.4 },
-{ 20.18638, 13.387647, 3.3 },
-{ 20.186699, 13.385488, 3.3 },
-{ 20.18638, 13.385574, 3.3 },
-{ 20.18442, 13.38566, 3.3 },
-{ 20.186928, 13.38579, 3.3 },
-{ 20.185514, 13.38592, 3.3 },
-{ 20.186062, 13.38592, 3.3 },
-{ 20.185925, 13.385358, 3.3 },
-{ 20.186882, 13.385574, 3.3 },
-{ 20.185879, 13.386783, 3.3 },
-{ 20.187155, 13.387258, 3.4 },
-{ 20.185652, 13.385402, 3.4 },
-{ 20.184511, 13.385056, 3.4 },
-{ 20.185514, 13.387474, 3.4 },
-{ 20.185606, 13.386265, 3.4 },
-{ 20.186108, 13.38674, 3.3 },
-{ 20.185423, 13.385315, 3.3 },
-{ 20.185331, 13.386567, 3.3 },
-{ 20.184967, 13.387215, 3.3 },
-{ 20.187109, 13.386308, 3.3 },
-{ 20.186426, 13.386352, 3.3 },
-{ 20.186928, 13.387949, 3.3 },
-{ 20.185331, 13.38756, 3.3 },
-{ 20.184557, 13.386352, 3.3 },
-{ 20.185698, 13.38661, 3.3 },
-{ 20.185423, 13.388208, 3.3 },
-{ 20.185787, 13.387085, 3.3 },
-{ 20.18556, 13.387604, 3.3 },
-{ 20.185514, 13.386999, 3.3 },
-{ 20.185925, 13.387517, 3.3 },
-{ 20.186153, 13.387172, 3.3 },
-{ 20.186518, 13.387344, 3.3 },
-{ 20.184101, 13.387906, 3.3 },
-{ 20.184875, 13.387776, 3.3 },
-{ 20.185514, 13.388165, 3.3 },
-{ 20.184921, 13.388726, 3.3 },
-{ 20.185242, 13.388035, 3.3 },
-{ 20.185698, 13.387647, 3.3 },
-{ 20.184786, 13.386956, 3.3 },
-{ 20.184147, 13.388079, 3.3 },
-{ 20.185104, 13.388122, 3.3 },
-{ 20.18556, 13.387604, 3.3 },
-{ 20.184967, 13.387604, 3.3 },
-{ 20.184238, 13.389158, 3.3 },
-{ 20.184649, 13.387992, 3.3 },
-{ 20.185833, 13.38851, 3.3 },
-{ 20.182825, 13.389806, 3.3 },
-{ 20.183918, 13.388251, 3.3 },
-{ 20.182051, 13.38756, 3.3 },
-{ 20.185196, 13.389071, 3.3 },
-{ 20.185698, 13.389503, 3.3 },
-{ 20.185013, 13.389114, 3.3 },
-{ 20.183462, 13.389029, 3.3 },
-{ 20.184193, 13.389374, 3.3 },
-{ 20.183098, 13.390669, 3.3 },
-{ 20.185196, 13.389114, 3.3 },
-{ 20.183645, 13.389676, 3.3 },
-{ 20.183964, 13.388942, 3.3 },
-{ 20.183737, 13.389158, 3.3 },
-{ 20.183599, 13.390453, 3.3 },
-{ 20.18401, 13.390238, 3.3 },
-{ 20.18515, 13.391101, 3.3 },
-{ 20.185242, 13.389676, 3.3 },
-{ 20.183645, 13.390971, 3.3 },
-{ 20.185925, 13.389762, 3.3 },
-{ 20.183599, 13.390281, 3.3 },
-{ 20.184786, 13.389806, 3.3 },
-{ 20.185013, 13.390669, 3.3 },
-{ 20.184511, 13.389503, 3.3 },
-{ 20.182825, 13.390496, 3.3 },
-{ 20.184694, 13.391446, 3.3 },
-{ 20.183645, 13.391058, 3.3 },
-{ 20.182734, 13.390281, 3.3 },
-{ 20.183691, 13.390453, 3.3 },
-{ 20.183098, 13.390756, 3.3 },
-{ 20.184284, 13.39149, 3.3 },
-{ 20.184374, 13.390583, 3.3 },
-{ 20.183418, 13.390669, 3.3 },
-{ 20.185469, 13.391791, 3.3 },
-{ 20.182507, 13.391791, 3.3 },
-{ 20.184649, 13.391921, 3.3 },
-{ 20.183189, 13.39244, 3.3 },
-{ 20.182461, 13.391273, 3.3 },
-{ 20.183235, 13.391748, 3.3 },
-{ 20.183235, 13.391058, 3.3 },
-{ 20.183052, 13.392396, 3.3 },
-{ 20.181503, 13.392223, 3.3 },
-{ 20.182825, 13.393433, 3.3 },
-{ 20.18433, 13.391533, 3.3 },
-{ 20.182871, 13.391533, 3.3 },
-{ 20.181549, 13.39231, 3.3 },
-{ 20.182051, 13.393044, 3.3 },
-{ 20.182369, 13.392785, 3.3 },
-{ 20.18214, 13.393908, 3.3 },
-{ 20.183372, 13.393346, 3.3 },
-{ 20.182688, 13.392785, 3.3 },
-{ 20.182779, 13.39218, 3.3 },
-{ 20.182461, 13.39231, 3.3 },
-{ 20.182552, 13.392353, 3.3 },
-{ 20.181641, 13.392008, 3.3 },
-{ 20.183599, 13.392353, 3.3 },
-{ 20.183418, 13.392223, 3.3 },
-{ 20.183235, 13.392526, 3.3 },
-{ 20.183645, 13.392915, 3.3 },
-{ 20.18401, 13.393087, 3.3 },
-{ 20.181366, 13.393648, 3.3 },
-{ 20.181684, 13.39395, 3.3 },
-{ 20.181458, 13.394296, 3.3 },
-{ 20.182461, 13.39421, 3.3 },
-{ 20.182369, 13.393648, 3.3 },
-{ 20.183372, 13.394685, 3.3 },
-{ 20.182962, 13.39408, 3.3 },
-{ 20.181776, 13.392915, 3.3 },
-{ 20.181959, 13.393346, 3.3 },
-{ 20.181366, 13.39326, 3.3 },
-{ 20.182051, 13.394253, 3.3 },
-{ 20.181959, 13.39339, 3.3 },
-{ 20.180317, 13.394944, 3.3 },
-{ 20.181229, 13.395203, 3.3 },
-{ 20.181822, 13.39326, 3.3 },
-{ 20.182825, 13.394469, 3.3 },
-{ 20.182917, 13.395332, 3.3 },
-{ 20.182369, 13.394598, 3.3 },
-{ 20.181047, 13.395894, 3.3 },
-{ 20.181549, 13.39503, 3.3 },
-{ 20.181412, 13.395247, 3.3 },
-{ 20.182051, 13.396067, 3.3 },
-{ 20.181684, 13.39516, 3.3 },
-{ 20.181959, 13.395203, 3.3 },
-{ 20.179771, 13.394512, 3.3 },
-{ 20.180317, 13.394685, 3.3 },
-{ 20.181002, 13.394167, 3.3 },
-{ 20.180773, 13.39598, 3.3 },
-{ 20.180592, 13.393518, 3.3 },
-{ 20.179998, 13.39421, 3.3 },
-{ 20.180637, 13.395592, 3.3 },
-{ 20.17804, 13.396974, 3.3 },
-{ 20.180592, 13.394857, 3.3 },
-{ 20.179726, 13.39408, 3.3 },
-{ 20.178814, 13.394253, 3.3 },
-{ 20.179998, 13.394167, 3.2 },
-{ 20.179726, 13.393692, 3.2 },
-{ 20.179041, 13.395289, 3.2 },
-{ 20.180408, 13.396282, 3.2 },
-{ 20.181366, 13.395332, 3.2 },
-{ 20.181093, 13.397102, 3.2 },
-{ 20.180637, 13.397146, 3.2 },
-{ 20.179771, 13.396067, 3.2 },
-{ 20.180819, 13.395289, 3.2 },
-{ 20.179907, 13.397449, 3.2 },
-{ 20.179861, 13.396974, 3.2 },
-{ 20.181641, 13.395937, 3.2 },
-{ 20.180317, 13.395894, 3.2 },
-{ 20.179407, 13.396671, 3.2 },
-{ 20.179543, 13.396023, 3.2 },
-{ 20.180683, 13.396282, 3.3 },
-{ 20.17845, 13.396974, 3.3 },
-{ 20.177902, 13.396239, 3.3 },
-{ 20.180182, 13.396542, 3.3 },
-{ 20.179316, 13.397059, 3.3 },
-{ 20.178951, 13.395894, 3.2 },
-{ 20.180136, 13.396887, 3.2 },
-{ 20.178768, 13.397491, 3.2 },
-{ 20.178175, 13.397102, 3.2 },
-{ 20.179178, 13.397275, 3.2 },
-{ 20.179861, 13.399391, 3.2 },
-{ 20.179543, 13.397966, 3.2 },
-{ 20.177902, 13.396499, 3.2 },
-{ 20.179178, 13.397319, 3.2 },
-{ 20.178768, 13.397146, 3.2 },
-{ 20.179497, 13.398182, 3.2 },
-{ 20.179178, 13.398096, 3.2 },
-{ 20.168877, 13.397102, 3.2 },
-{ 20.178404, 13.397534, 3.2 },
-{ 20.177902, 13.39611, 3.2 },
-{ 20.179316, 13.396887, 3.2 },
-{ 20.180182, 13.397189, 3.2 },
-{ 20.178905, 13.398916, 3.2 },
-{ 20.17845, 13.398484, 3.2 },
-{ 20.179041, 13.398701, 3.2 },
-{ 20.178905, 13.397232, 3.2 },
-{ 20.178539, 13.39693, 3.2 },
-{ 20.179178, 13.398096, 3.2 },
-{ 20.177492, 13.398269, 3.2 },
-{ 20.179224, 13.397837, 3.2 },
-{ 20.177628, 13.400126, 3.2 },
-{ 20.17845, 13.397707, 3.2 },
-{ 20.178677, 13.397966, 3.2 },
-{ 20.177948, 13.398312, 3.2 },
-{ 20.178585, 13.399132, 3.2 },
-{ 20.178083, 13.399046, 3.2 },
-{ 20.177673, 13.398009, 3.2 },
-{ 20.177217, 13.399089, 3.2 },
-{ 20.17845, 13.399304, 3.2 },
-{ 20.177082, 13.398701, 3.2 },
-{ 20.177217, 13.399996, 3.2 },
-{ 20.17886, 13.399736, 3.2 },
-{ 20.177446, 13.397534, 3.2 },
-{ 20.176945, 13.398744, 3.2 },
-{ 20.177128, 13.399651, 3.2 },
-{ 20.177492, 13.399607, 3.2 },
-{ 20.177994, 13.398441, 3.2 },
-{ 20.178267, 13.400557, 3.2 },
-{ 20.177719, 13.399521, 3.2 },
-{ 20.17658, 13.399953, 3.2 },
-{ 20.177263, 13.400039, 3.2 },
-{ 20.175896, 13.399779, 3.2 },
-{ 20.176762, 13.400514, 3.2 },
-{ 20.177128, 13.400298, 3.2 },
-{ 20.176216, 13.400816, 3.2 },
-{ 20.17576, 13.399823, 3.3 },
-{ 20.176853, 13.401421, 3.3 },
-{ 20.175896, 13.401118, 3.3 },
-{ 20.176899, 13.400082, 3.3 },
-{ 20.177446, 13.40073, 3.3 },
-{ 20.17658, 13.400428, 3.2 },
-{ 20.175304, 13.402975, 3.2 },
-{ 20.175259, 13.401031, 3.2 },
-{ 20.174164, 13.400168, 3.2 },
-{ 20.174984, 13.400946, 3.2 },
-{ 20.175259, 13.401723, 3.2 },
-{ 20.175394, 13.400643, 3.2 },
-{ 20.175577, 13.401507, 3.2 },
-{ 20.176397, 13.40168, 3.2 },
-{ 20.174938, 13.401636, 3.2 },
-{ 20.174164, 13.401896, 3.2 },
-{ 20.175076, 13.40073, 3.2 },
-{ 20.174528, 13.403105, 3.2 },
-{ 20.173389, 13.401593, 3.2 },
-{ 20.17544, 13.401507, 3.2 },
-{ 20.174393, 13.401075, 3.2 },
-{ 20.174757, 13.402716, 3.2 },
-{ 20.175486, 13.400859, 3.2 },
-{ 20.173845, 13.402198, 3.2 },
-{ 20.174849, 13.402543, 3.2 },
-{ 20.174938, 13.401334, 3.2 },
-{ 20.175076, 13.402845, 3.2 },
-{ 20.175121, 13.401636, 3.2 },
-{ 20.173708, 13.403234, 3.2 },
-{ 20.173025, 13.402241, 3.2 },
-{ 20.172979, 13.402328, 3.2 },
-{ 20.17421, 13.402802, 3.2 },
-{ 20.173481, 13.401766, 3.2 },
-{ 20.174026, 13.402413, 3.2 },
-{ 20.17462, 13.402457, 3.2 },
-{ 20.17275, 13.403363, 3.2 },
-{ 20.173344, 13.402198, 3.2 },
-{ 20.173252, 13.402932, 3.2 },
-{ 20.173389, 13.40276, 3.2 },
-{ 20.172295, 13.402457, 3.2 },
-{ 20.171429, 13.402888, 3.2 },
-{ 20.173571, 13.403191, 3.2 },
-{ 20.173161, 13.40414, 3.2 },
-{ 20.173206, 13.405047, 3.2 },
-{ 20.173662, 13.402068, 3.2 },
-{ 20.173252, 13.403277, 3.2 },
-{ 20.173708, 13.402068, 3.2 },
-{ 20.173252, 13.403536, 3.2 },
-{ 20.172432, 13.403493, 3.2 },
-{ 20.173025, 13.403666, 3.2 },
-{ 20.173025, 13.405609, 3.2 },
-{ 20.171885, 13.404832, 3.2 },
-{ 20.172661, 13.404012, 3.2 },
-{ 20.17275, 13.404227, 3.2 },
-{ 20.172386, 13.403148, 3.2 },
-{ 20.170336, 13.40427, 3.2 },
-{ 20.172432, 13.402284, 3.2 },
-{ 20.170792, 13.403363, 3.2 },
-{ 20.171703, 13.4044, 3.2 },
-{ 20.17193, 13.405437, 3.2 },
-{ 20.17111, 13.405047, 3.2 },
-{ 20.173571, 13.405005, 3.2 },
-{ 20.173435, 13.405177, 3.2 },
-{ 20.170792, 13.4044, 3.2 },
-{ 20.171976, 13.405565, 3.2 },
-{ 20.170792, 13.403968, 3.2 },
-{ 20.172661, 13.405782, 3.2 },
-{ 20.17029, 13.403882, 3.2 },
-{ 20.169514, 13.4063, 3.2 },
-{ 20.169605, 13.40427, 3.2 },
-{ 20.170198, 13.405437, 3.2 },
-{ 20.171019, 13.405609, 3.2 },
-{ 20.171019, 13.407466, 3.2 },
-{ 20.169287, 13.40535, 3.2 },
-{ 20.169378, 13.404918, 3.2 },
-{ 20.170927, 13.40712, 3.2 },
-{ 20.169104, 13.4044, 3.2 },
-{ 20.168558, 13.40535, 3.2 },
-{ 20.170471, 13.406343, 3.2 },
-{ 20.170654, 13.406516, 3.2 },
-{ 20.170881, 13.406127, 3.2 },
-{ 20.172068, 13.407034, 3.2 },
-{ 20.169195, 13.405609, 3.2 },
-{ 20.16988, 13.406775, 3.2 },
-{ 20.16997, 13.406257, 3.2 },
-{ 20.170061, 13.407639, 3.2 },
-{ 20.169195, 13.406559, 3.2 },
-{ 20.169195, 13.405911, 3.2 },
-{ 20.169014, 13.407768, 3.2 },
-{ 20.169834, 13.406689, 3.2 },
-{ 20.170015, 13.405264, 3.2 },
-{ 20.168922, 13.406991, 3.2 },
-{ 20.169651, 13.405825, 3.2 },
-{ 20.169241, 13.408027, 3.2 },
-{ 20.168694, 13.408199, 3.2 },
-{ 20.170198, 13.407552, 3.2 },
-{ 20.168648, 13.406991, 3.2 },
-{ 20.169424, 13.407595, 3.2 },
-{ 20.1707, 13.408631, 3.2 },
-{ 20.167965, 13.40712, 3.2 },
-{ 20.167053, 13.407724, 3.2 },
-{ 20.168283, 13.408416, 3.2 },
-{ 20.167736, 13.408674, 3.2 },
-{ 20.169014, 13.406732, 3.2 },
-{ 20.167919, 13.407811, 3.2 },
-{ 20.169651, 13.408372, 3.2 },
-{ 20.167418, 13.406817, 3.2 },
-{ 20.168238, 13.408113, 3.2 },
-{ 20.166962, 13.409538, 3.2 },
-{ 20.168604, 13.407552, 3.2 },
-{ 20.167873, 13.407077, 3.2 },
-{ 20.169333, 13.408416, 3.2 },
-{ 20.167646, 13.410099, 3.2 },
-{ 20.167736, 13.407854, 3.2 },
-{ 20.168375, 13.408847, 3.2 },
-{ 20.16687, 13.406947, 3.2 },
-{ 20.167873, 13.408674, 3.2 },
-{ 20.166916, 13.408156, 3.2 },
-{ 20.169014, 13.409193, 3.2 },
-{ 20.168329, 13.406947, 3.2 },
-{ 20.167692, 13.409451, 3.2 },
-{ 20.16564, 13.40902, 3.2 },
-{ 20.167965, 13.408934, 3.2 },
-{ 20.166279, 13.409063, 3.2 },
-{ 20.167919, 13.407941, 3.2 },
-{ 20.168968, 13.409668, 3.2 },
-{ 20.166279, 13.409149, 3.2 },
-{ 20.166325, 13.409581, 3.2 },
-{ 20.166916, 13.410531, 3.2 },
-{ 20.168375, 13.411006, 3.2 },
-{ 20.16687, 13.409322, 3.2 },
-{ 20.166962, 13.412215, 3.2 },
-{ 20.16646, 13.409883, 3.2 },
-{ 20.165459, 13.411395, 3.2 },
-{ 20.166096, 13.410358, 3.2 },
-{ 20.166689, 13.409711, 3.2 },
-{ 20.165594, 13.41092, 3.2 },
-{ 20.16728, 13.409711, 3.2 },
-{ 20.167463, 13.40902, 3.2 },
-{ 20.165594, 13.410574, 3.2 },
-{ 20.165367, 13.411395, 3.2 },
-{ 20.166187, 13.411179, 3.2 },
-{ 20.165594, 13.409668, 3.2 },
-{ 20.165594, 13.411136, 3.2 },
-{ 20.168238, 13.411308, 3.2 },
-{ 20.164865, 13.411438, 3.2 },
-{ 20.165594, 13.41079, 3.2 },
-{ 20.165184, 13.409538, 3.2 },
-{ 20.166368, 13.412172, 3.2 },
-{ 20.16441, 13.410748, 3.2 },
-{ 20.165869, 13.41092, 3.1 },
-{ 20.164637, 13.411956, 3.1 },
-{ 20.165594, 13.411568, 3.1 },
-{ 20.166368, 13.411913, 3.1 },
-{ 20.164091, 13.411568, 3.1 },
-{ 20.164547, 13.411351, 3.2 },
-{ 20.164865, 13.41282, 3.2 },
-{ 20.164, 13.412128, 3.2 },
-{ 20.164591, 13.410704, 3.2 },
-{ 20.165823, 13.411611, 3.2 },
-{ 20.165548, 13.41174, 3.2 },
-{ 20.164045, 13.412086, 3.2 },
-{ 20.165503, 13.41092, 3.2 },
-{ 20.166004, 13.412128, 3.2 },
-{ 20.164227, 13.41269, 3.2 },
-{ 20.163544, 13.41187, 3.2 },
-{ 20.164091, 13.412777, 3.2 },
-{ 20.163269, 13.41256, 3.2 },
-{ 20.163361, 13.413035, 3.2 },
-{ 20.162724, 13.412258, 3.2 },
-{ 20.165594, 13.41282, 3.2 },
-{ 20.163862, 13.413165, 3.2 },
-{ 20.163679, 13.412043, 3.2 },
-{ 20.163042, 13.414072, 3.2 },
-{ 20.163908, 13.412518, 3.2 },
-{ 20.163088, 13.41364, 3.2 },
-{ 20.164135, 13.413295, 3.2 },
-{ 20.164091, 13.412777, 3.2 },
-{ 20.162268, 13.41377, 3.2 },
-{ 20.162813, 13.414029, 3.2 },
-{ 20.163315, 13.413467, 3.2 },
-{ 20.163954, 13.412258, 3.2 },
-{ 20.161947, 13.413295, 3.2 },
-{ 20.163862, 13.41377, 3.2 },
-{ 20.163544, 13.415108, 3.2 },
-{ 20.162724, 13.413683, 3.2 },
-{ 20.161858, 13.412777, 3.2 },
-{ 20.163589, 13.414417, 3.2 },
-{ 20.163635, 13.413122, 3.2 },
-{ 20.164227, 13.41269, 3.2 },
-{ 20.162767, 13.413122, 3.2 },
-{ 20.163725, 13.414547, 3.2 },
-{ 20.163179, 13.414935, 3.2 },
-{ 20.162268, 13.414029, 3.2 },
-{ 20.160717, 13.414547, 3.2 },
-{ 20.162268, 13.415756, 3.2 },
-{ 20.163635, 13.415324, 3.2 },
-{ 20.162403, 13.414115, 3.2 },
-{ 20.162859, 13.413553, 3.2 },
-{ 20.160854, 13.415237, 3.2 },
-{ 20.162951, 13.413381, 3.2 },
-{ 20.162996, 13.414849, 3.2 },
-{ 20.162403, 13.414547, 3.2 },
-{ 20.161036, 13.416835, 3.2 },
-{ 20.162813, 13.416058, 3.2 },
-{ 20.162996, 13.415669, 3.2 },
-{ 20.162312, 13.415237, 3.2 },
-{ 20.162586, 13.415108, 3.2 },
-{ 20.16254, 13.416317, 3.2 },
-{ 20.160946, 13.415842, 3.2 },
-{ 20.160854, 13.416749, 3.2 },
-{ 20.162905, 13.415065, 3.2 },
-{ 20.162312, 13.41554, 3.2 },
-{ 20.161219, 13.416231, 3.2 },
-{ 20.161858, 13.417051, 3.2 },
-{ 20.161812, 13.416447, 3.2 },
-{ 20.162085, 13.41649, 3.2 },
-{ 20.161537, 13.416058, 3.2 },
-{ 20.161402, 13.41541, 3.2 },
-{ 20.160215, 13.415195, 3.2 },
-{ 20.160717, 13.418044, 3.2 },
-{ 20.161446, 13.417181, 3.2 },
-{ 20.16058, 13.416749, 3.2 },
-{ 20.162268, 13.417914, 3.2 },
-{ 20.159988, 13.416965, 3.2 },
-{ 20.160946, 13.416706, 3.2 },
-{ 20.160625, 13.417008, 3.2 },
-{ 20.161219, 13.416922, 3.2 },
-{ 20.161264, 13.416274, 3.2 },
-{ 20.160398, 13.417871, 3.2 },
-{ 20.159714, 13.417051, 3.2 },
-{ 20.159805, 13.417786, 3.2 },
-{ 20.160854, 13.418217, 3.2 },
-{ 20.160809, 13.418131, 3.2 },
-{ 20.16049, 13.416965, 3.2 },
-{ 20.160444, 13.418044, 3.2 },
-{ 20.15871, 13.417612, 3.2 },
-{ 20.159349, 13.418174, 3.2 },
-{ 20.159258, 13.417397, 3.2 },
-{ 20.159805, 13.417871, 3.2 },
-{ 20.160763, 13.419339, 3.2 },
-{ 20.159441, 13.418346, 3.2 },
-{ 20.159943, 13.417742, 3.2 },
-{ 20.160261, 13.419513, 3.2 },
-{ 20.158257, 13.417871, 3.2 },
-{ 20.159441, 13.419685, 3.2 },
-{ 20.160398, 13.420721, 3.2 },
-{ 20.159578, 13.417829, 3.2 },
-{ 20.159668, 13.419038, 3.2 },
-{ 20.160078, 13.419728, 3.2 },
-{ 20.160353, 13.419038, 3.2 },
-{ 20.16131, 13.419124, 3.2 },
-{ 20.159578, 13.418519, 3.2 },
-{ 20.157801, 13.419599, 3.2 },
-{ 20.158346, 13.419383, 3.2 },
-{ 20.159851, 13.41921, 3.2 },
-{ 20.159395, 13.419167, 3.2 },
-{ 20.160215, 13.419124, 3.2 },
-{ 20.158802, 13.420506, 3.2 },
-{ 20.157434, 13.420376, 3.2 },
-{ 20.160078, 13.420548, 3.2 },
-{ 20.158165, 13.419858, 3.2 },
-{ 20.158575, 13.418778, 3.2 },
-{ 20.158756, 13.420116, 3.2 },
-{ 20.159441, 13.419944, 3.2 },
-{ 20.159441, 13.419426, 3.2 },
-{ 20.158621, 13.420678, 3.2 },
-{ 20.159304, 13.420938, 3.2 },
-{ 20.158484, 13.420246, 3.2 },
-{ 20.15789, 13.421887, 3.2 },
-{ 20.158073, 13.420506, 3.2 },
-{ 20.157663, 13.420851, 3.2 },
-{ 20.158985, 13.420463, 3.2 },
-{ 20.157663, 13.421973, 3.2 },
-{ 20.160034, 13.421758, 3.2 },
-{ 20.159258, 13.420591, 3.2 },
-{ 20.158073, 13.420721, 3.2 },
-{ 20.157389, 13.421283, 3.2 },
-{ 20.1583, 13.421023, 3.2 },
-{ 20.158894, 13.420721, 3.2 },
-{ 20.15789, 13.422146, 3.2 },
-{ 20.158165, 13.421628, 3.2 },
-{ 20.158119, 13.421283, 3.2 },
-{ 20.15789, 13.421153, 3.2 },
-{ 20.157572, 13.422794, 3.2 },
-{ 20.157526, 13.421412, 3.2 },
-{ 20.1583, 13.421153, 3.2 },
-{ 20.155703, 13.420678, 3.2 },
-{ 20.157526, 13.422276, 3.2 },
-{ 20.156752, 13.423615, 3.2 },
-{ 20.157207, 13.421671, 3.2 },
-{ 20.156342, 13.422665, 3.2 },
-{ 20.156752, 13.421973, 3.2 },
-{ 20.156433, 13.421844, 3.2 },
-{ 20.156889, 13.421671, 3.2 },
-{ 20.157024, 13.42275, 3.2 },
-{ 20.157299, 13.422535, 3.2 },
-{ 20.157801, 13.422665, 3.2 },
-{ 20.157434, 13.422578, 3.2 },
-{ 20.156752, 13.422535, 3.2 },
-{ 20.157024, 13.421196, 3.2 },
-{ 20.156979, 13.423528, 3.2 },
-{ 20.157345, 13.424435, 3.2 },
-{ 20.158392, 13.423312, 3.2 },
-{ 20.158575, 13.423269, 3.2 },
-{ 20.155794, 13.422578, 3.2 },
-{ 20.15625, 13.424003, 3.2 },
-{ 20.155794, 13.423744, 3.2 },
-{ 20.156113, 13.424175, 3.2 },
-{ 20.15543, 13.425514, 3.2 },
-{ 20.156979, 13.425169, 3.2 },
-{ 20.155338, 13.424564, 3.2 },
-{ 20.156158, 13.424219, 3.2 },
-{ 20.156706, 13.424521, 3.2 },
-{ 20.156342, 13.42275, 3.2 },
-{ 20.155247, 13.423182, 3.2 },
-{ 20.154655, 13.422492, 3.2 },
-{ 20.154837, 13.423355, 3.2 },
-{ 20.155066, 13.42465, 3.2 },
-{ 20.155611, 13.42383, 3.2 },
-{ 20.156706, 13.42383, 3.2 },
-{ 20.155657, 13.424521, 3.2 },
-{ 20.156021, 13.42573, 3.2 },
-{ 20.154564, 13.424737, 3.2 },
-{ 20.155521, 13.424953, 3.2 },
-{ 20.156433, 13.425817, 3.2 },
-{ 20.155521, 13.424435, 3.2 },
-{ 20.154882, 13.425255, 3.2 },
-{ 20.155066, 13.425471, 3.2 },
-{ 20.155703, 13.424564, 3.2 },
-{ 20.156113, 13.424521, 3.2 },
-{ 20.154062, 13.424348, 3.2 },
-{ 20.155201, 13.425212, 3.2 },
-{ 20.154016, 13.425471, 3.2 },
-{ 20.154108, 13.426421, 3.2 },
-{ 20.154699, 13.425946, 3.2 },
-{ 20.15461, 13.425644, 3.2 },
-{ 20.154335, 13.424867, 3.2 },
-{ 20.155384, 13.4256, 3.2 },
-{ 20.153879, 13.426939, 3.2 },
-{ 20.154518, 13.425082, 3.2 },
-{ 20.153196, 13.428148, 3.2 },
-{ 20.154016, 13.426939, 3.2 },
-{ 20.155066, 13.427155, 3.2 },
-{ 20.153059, 13.426377, 3.2 },
-{ 20.152512, 13.426939, 3.2 },
-{ 20.153971, 13.427976, 3.2 },
-{ 20.1542, 13.427327, 3.2 },
-{ 20.153105, 13.427759, 3.2 },
-{ 20.154016, 13.427759, 3.2 },
-{ 20.152967, 13.427501, 3.2 },
-{ 20.154289, 13.428191, 3.2 },
-{ 20.153378, 13.428061, 3.2 },
-{ 20.152147, 13.429141, 3.2 },
-{ 20.15461, 13.426809, 3.2 },
-{ 20.154335, 13.428364, 3.2 },
-{ 20.153332, 13.427803, 3.2 },
-{ 20.152285, 13.427932, 3.2 },
-{ 20.153879, 13.429228, 3.2 },
-{ 20.153515, 13.427932, 3.2 },
-{ 20.1542, 13.427544, 3.2 },
-{ 20.154745, 13.426852, 3.2 },
-{ 20.15461, 13.428104, 3.2 },
-{ 20.153879, 13.429443, 3.2 },
-{ 20.153423, 13.429832, 3.2 },
-{ 20.153423, 13.429832, 3.2 },
-{ 20.153151, 13.430307, 3.2 },
-{ 20.153332, 13.428148, 3.2 },
-{ 20.153469, 13.428061, 3.2 },
-{ 20.15242, 13.428666, 3.2 },
-{ 20.152466, 13.428148, 3.2 },
-{ 20.152603, 13.429184, 3.2 },
-{ 20.153013, 13.427629, 3.2 },
-{ 20.154745, 13.429228, 3.2 },
-{ 20.152557, 13.429271, 3.3 },
-{ 20.152786, 13.429961, 3.3 },
-{ 20.152876, 13.429314, 3.3 },
-{ 20.15242, 13.429271, 3.3 },
-{ 20.152285, 13.429961, 3.3 },
-{ 20.153833, 13.429659, 3.2 },
-{ 20.154289, 13.429746, 3.2 },
-{ 20.153196, 13.429918, 3.2 },
-{ 20.153105, 13.429875, 3.2 },
-{ 20.153561, 13.428753, 3.2 },
-{ 20.152649, 13.430221, 3.2 },
-{ 20.15233, 13.429789, 3.2 },
-{ 20.15201, 13.430782, 3.2 },
-{ 20.150415, 13.4294, 3.2 },
-{ 20.152832, 13.430221, 3.2 },
-{ 20.151783, 13.431516, 3.2 },
-{ 20.152147, 13.429055, 3.2 },
-{ 20.151829, 13.43048, 3.2 },
-{ 20.151373, 13.431602, 3.2 },
-{ 20.151875, 13.430868, 3.2 },
-{ 20.150553, 13.430653, 3.2 },
-{ 20.150963, 13.431818, 3.2 },
-{ 20.150688, 13.430178, 3.2 },
-{ 20.151054, 13.431905, 3.2 },
-{ 20.152285, 13.429789, 3.2 },
-{ 20.151098, 13.430998, 3.2 },
-{ 20.151373, 13.431602, 3.2 },
-{ 20.151964, 13.431473, 3.2 },
-{ 20.152193, 13.430393, 3.2 },
-{ 20.150963, 13.430653, 3.2 },
-{ 20.149822, 13.432034, 3.2 },
-{ 20.151009, 13.43212, 3.2 },
-{ 20.151964, 13.43035, 3.2 },
-{ 20.151236, 13.431688, 3.2 },
-{ 20.151691, 13.431516, 3.2 },
-{ 20.151009, 13.431084, 3.2 },
-{ 20.151236, 13.430738, 3.2 },
-{ 20.14996, 13.431602, 3.2 },
-{ 20.150599, 13.432466, 3.2 },
-{ 20.150232, 13.432077, 3.2 },
-{ 20.150826, 13.431213, 3.2 },
-{ 20.15201, 13.4313, 3.2 },
-{ 20.151098, 13.433027, 3.2 },
-{ 20.151419, 13.43225, 3.2 },
-{ 20.150688, 13.433113, 3.2 },
-{ 20.151373, 13.432552, 3.2 },
-{ 20.150734, 13.432682, 3.2 },
-{ 20.150963, 13.432423, 3.2 },
-{ 20.149549, 13.432595, 3.2 },
-{ 20.151737, 13.432855, 3.2 },
-{ 20.149776, 13.43294, 3.2 },
-{ 20.151009, 13.432638, 3.2 },
-{ 20.149549, 13.431905, 3.2 },
-{ 20.150097, 13.432207, 3.2 },
-{ 20.150097, 13.431948, 3.2 },
-{ 20.149048, 13.43238, 3.2 },
-{ 20.148319, 13.432638, 3.2 },
-{ 20.150553, 13.432293, 3.2 },
-{ 20.150553, 13.433243, 3.2 },
-{ 20.149504, 13.432725, 3.2 },
-{ 20.150051, 13.434409, 3.2 },
-{ 20.149731, 13.432638, 3.2 },
-{ 20.150642, 13.434711, 3.2 },
-{ 20.150507, 13.433632, 3.2 },
-{ 20.149822, 13.432984, 3.2 },
-{ 20.148956, 13.434452, 3.2 },
-{ 20.149868, 13.434884, 3.2 },
-{ 20.149412, 13.433372, 3.2 },
-{ 20.150278, 13.433675, 3.2 },
-{ 20.149687, 13.434754, 3.2 },
-{ 20.15078, 13.433977, 3.2 },
-{ 20.149275, 13.432898, 3.2 },
-{ 20.149002, 13.434539, 3.2 },
-{ 20.149549, 13.432682, 3.2 },
-{ 20.147589, 13.4332, 3.2 },
-{ 20.149185, 13.433977, 3.3 },
-{ 20.150553, 13.434625, 3.3 },
-{ 20.149641, 13.434495, 3.3 },
-{ 20.147907, 13.43333, 3.3 },
-{ 20.149185, 13.435014, 3.3 },
-{ 20.147453, 13.432725, 3.2 },
-{ 20.148775, 13.435402, 3.2 },
-{ 20.147453, 13.434237, 3.2 },
-{ 20.148455, 13.435445, 3.2 },
-{ 20.149458, 13.435186, 3.2 },
-{ 20.148228, 13.433502, 3.2 },
-{ 20.149231, 13.435791, 3.2 },
-{ 20.147772, 13.434625, 3.2 },
-{ 20.149504, 13.435316, 3.2 },
-{ 20.148684, 13.436913, 3.2 },
-{ 20.148319, 13.435143, 3.3 },
-{ 20.149868, 13.435747, 3.3 },
-{ 20.149914, 13.437172, 3.3 },
-{ 20.14768, 13.437129, 3.3 },
-{ 20.149185, 13.436092, 3.3 },
-{ 20.150097, 13.436741, 3.3 },
-{ 20.149641, 13.436395, 3.3 },
-{ 20.148775, 13.436179, 3.3 },
-{ 20.147953, 13.435316, 3.3 },
-{ 20.149549, 13.435661, 3.3 },
-{ 20.147316, 13.43497, 3.3 },
-{ 20.148319, 13.436179, 3.3 },
-{ 20.150734, 13.436439, 3.3 },
-{ 20.149321, 13.435489, 3.3 },
-{ 20.147635, 13.436266, 3.3 },
-{ 20.148045, 13.434927, 3.2 },
-{ 20.148911, 13.436741, 3.2 },
-{ 20.148729, 13.435964, 3.2 },
-{ 20.14809, 13.436999, 3.2 },
-{ 20.148865, 13.436222, 3.2 },
-{ 20.151054, 13.435964, 3.2 },
-{ 20.148638, 13.436049, 3.2 },
-{ 20.148363, 13.436611, 3.2 },
-{ 20.146404, 13.436999, 3.2 },
-{ 20.147953, 13.436222, 3.2 },
-{ 20.14768, 13.437043, 3.3 },
-{ 20.147087, 13.436999, 3.3 },
-{ 20.148684, 13.435057, 3.3 },
-{ 20.148363, 13.437604, 3.3 },
-{ 20.147818, 13.435057, 3.3 },
-{ 20.149687, 13.436439, 3.3 },
-{ 20.146906, 13.435402, 3.3 },
-{ 20.147772, 13.438338, 3.3 },
-{ 20.149048, 13.437691, 3.3 },
-{ 20.1485, 13.437086, 3.3 },
-{ 20.146814, 13.437604, 3.3 },
-{ 20.147543, 13.437043, 3.3 },
-{ 20.147999, 13.435834, 3.3 },
-{ 20.148911, 13.436524, 3.3 },
-{ 20.149275, 13.436913, 3.3 },
-{ 20.146997, 13.437561, 3.3 },
-{ 20.149687, 13.438381, 3.3 },
-{ 20.149504, 13.437216, 3.3 },
-{ 20.147818, 13.436524, 3.3 },
-{ 20.1485, 13.437518, 3.3 },
-{ 20.147408, 13.437302, 3.3 },
-{ 20.147543, 13.438684, 3.3 },
-{ 20.146906, 13.439073, 3.3 },
-{ 20.14768, 13.438684, 3.3 },
-{ 20.148182, 13.437345, 3.3 },
-{ 20.147772, 13.436956, 3.3 },
-{ 20.147635, 13.439331, 3.3 },
-{ 20.147863, 13.438899, 3.3 },
-{ 20.148865, 13.438036, 3.3 },
-{ 20.148729, 13.438899, 3.3 },
-{ 20.147224, 13.437604, 3.3 },
-{ 20.147635, 13.438684, 3.3 },
-{ 20.1485, 13.438554, 3.3 },
-{ 20.148775, 13.438251, 3.3 },
-{ 20.148638, 13.437949, 3.3 },
-{ 20.146542, 13.438813, 3.3 },
-{ 20.148363, 13.439331, 3.3 },
-{ 20.147589, 13.438338, 3.3 },
-{ 20.148273, 13.438251, 3.3 },
-{ 20.147087, 13.43782, 3.3 },
-{ 20.145493, 13.438338, 3.3 },
-{ 20.147316, 13.438641, 3.3 },
-{ 20.14727, 13.439245, 3.3 },
-{ 20.148409, 13.438726, 3.3 },
-{ 20.147818, 13.437863, 3.3 },
-{ 20.14768, 13.438511, 3.3 },
-{ 20.147087, 13.440238, 3.3 },
-{ 20.147543, 13.438381, 3.3 },
-{ 20.146358, 13.438511, 3.3 },
-{ 20.147224, 13.439849, 3.3 },
-{ 20.148819, 13.439849, 3.3 },
-{ 20.148455, 13.438295, 3.3 },
-{ 20.149687, 13.439158, 3.3 },
-{ 20.146585, 13.439418, 3.3 },
-{ 20.14645, 13.439158, 3.3 },
-{ 20.147362, 13.440325, 3.3 },
-{ 20.146358, 13.439029, 3.3 },
-{ 20.147999, 13.440022, 3.3 },
-{ 20.147179, 13.43877, 3.3 },
-{ 20.148319, 13.438899, 3.3 },
-{ 20.147953, 13.439763, 3.3 },
-{ 20.148638, 13.440108, 3.3 },
-{ 20.147589, 13.439504, 3.3 },
-{ 20.147863, 13.439461, 3.3 },
-{ 20.148228, 13.438684, 3.3 },
-{ 20.147543, 13.440411, 3.3 },
-{ 20.147133, 13.440151, 3.3 },
-{ 20.149048, 13.439245, 3.3 },
-{ 20.147863, 13.440886, 3.3 },
-{ 20.148819, 13.438036, 3.3 },
-{ 20.148136, 13.439979, 3.3 },
-{ 20.146677, 13.439806, 3.3 },
-{ 20.148638, 13.439893, 3.3 },
-{ 20.149048, 13.438684, 3.3 },
-{ 20.147041, 13.438597, 3.3 },
-{ 20.148729, 13.440368, 3.3 },
-{ 20.149776, 13.44162, 3.3 },
-{ 20.146906, 13.440756, 3.3 },
-{ 20.148911, 13.441577, 3.3 },
-{ 20.148684, 13.43972, 3.3 },
-{ 20.148228, 13.439245, 3.3 },
-{ 20.148865, 13.441275, 3.3 },
-{ 20.149321, 13.440454, 3.3 },
-{ 20.147999, 13.440281, 3.3 },
-{ 20.147497, 13.440756, 3.3 },
-{ 20.148409, 13.440368, 3.3 },
-{ 20.148363, 13.439073, 3.3 },
-{ 20.149321, 13.438986, 3.3 },
-{ 20.149868, 13.441101, 3.3 },
-{ 20.149231, 13.441792, 3.3 },
-{ 20.147179, 13.438856, 3.3 },
-{ 20.147818, 13.438251, 3.3 },
-{ 20.147999, 13.44067, 3.3 },
-{ 20.148956, 13.439548, 3.3 },
-{ 20.148409, 13.439158, 3.3 },
-{ 20.149048, 13.440928, 3.3 },
-{ 20.149139, 13.43972, 3.3 },
-{ 20.147953, 13.440022, 3.3 },
-{ 20.147907, 13.439201, 3.3 },
-{ 20.147133, 13.44231, 3.3 },
-{ 20.147772, 13.440151, 3.3 },
-{ 20.147635, 13.438986, 3.3 },
-{ 20.148911, 13.440626, 3.3 },
-{ 20.148363, 13.439936, 3.3 },
-{ 20.150688, 13.441015, 3.3 },
-{ 20.149231, 13.441101, 3.3 },
-{ 20.148729, 13.438122, 3.3 },
-{ 20.150507, 13.43972, 3.3 },
-{ 20.148273, 13.441101, 3.3 },
-{ 20.14996, 13.439158, 3.3 },
-{ 20.148956, 13.439461, 3.3 },
-{ 20.149412, 13.439418, 3.3 },
-{ 20.149094, 13.440972, 3.3 },
-{ 20.149048, 13.440151, 3.3 },
-{ 20.149002, 13.440497, 3.3 },
-{ 20.150599, 13.440325, 3.3 },
-{ 20.149822, 13.440626, 3.3 },
-{ 20.150097, 13.441706, 3.3 },
-{ 20.149504, 13.43972, 3.3 },
-{ 20.149595, 13.441058, 3.3 },
-{ 20.148865, 13.441058, 3.3 },
-{ 20.148546, 13.4408, 3.3 },
-{ 20.151236, 13.440195, 3.3 },
-{ 20.149822, 13.440108, 3.3 },
-{ 20.150642, 13.442699, 3.3 },
-{ 20.151236, 13.440886, 3.3 },
-{ 20.147316, 13.439979, 3.3 },
-{ 20.14996, 13.440411, 3.3 },
-{ 20.149094, 13.439936, 3.3 },
-{ 20.150507, 13.43972, 3.3 },
-{ 20.151054, 13.440972, 3.3 },
-{ 20.152056, 13.440626, 3.3 },
-{ 20.149366, 13.440583, 3.3 },
-{ 20.149275, 13.44054, 3.3 },
-{ 20.148638, 13.440928, 3.3 },
-{ 20.150963, 13.441188, 3.3 },
-{ 20.148045, 13.441447, 3.3 },
-{ 20.150642, 13.441231, 3.3 },
-{ 20.149458, 13.440195, 3.3 },
-{ 20.150005, 13.439893, 3.3 },
-{ 20.150005, 13.441318, 3.3 },
-{ 20.148956, 13.441318, 3.3 },
-{ 20.149185, 13.440756, 3.3 },
-{ 20.149321, 13.439849, 3.3 },
-{ 20.150324, 13.440065, 3.3 },
-{ 20.150232, 13.441101, 3.3 },
-{ 20.149822, 13.44231, 3.3 },
-{ 20.149002, 13.440713, 3.3 },
-{ 20.149868, 13.441058, 3.3 },
-{ 20.150278, 13.441275, 3.3 },
-{ 20.150278, 13.441792, 3.3 },
-{ 20.150642, 13.442699, 3.3 },
-{ 20.149687, 13.441533, 3.3 },
-{ 20.149504, 13.443045, 3.3 },
-{ 20.151691, 13.442397, 3.3 },
-{ 20.149275, 13.441965, 3.3 },
-{ 20.150143, 13.442829, 3.3 },
-{ 20.149366, 13.44149, 3.3 },
-{ 20.151327, 13.440325, 3.3 },
-{ 20.149731, 13.442267, 3.3 },
-{ 20.150917, 13.441275, 3.3 },
-{ 20.150734, 13.441447, 3.3 },
-{ 20.150871, 13.440886, 3.3 },
-{ 20.15037, 13.441145, 3.3 },
-{ 20.150642, 13.440713, 3.3 },
-{ 20.1516, 13.439633, 3.4 },
-{ 20.150553, 13.441188, 3.4 },
-{ 20.150324, 13.44149, 3.4 },
-{ 20.15078, 13.441188, 3.4 },
-{ 20.149595, 13.441706, 3.4 },
-{ 20.149504, 13.441058, 3.4 },
-{ 20.149231, 13.442225, 3.4 },
-{ 20.150278, 13.44231, 3.4 },
-{ 20.149321, 13.441188, 3.4 },
-{ 20.149914, 13.441922, 3.4 },
-{ 20.149094, 13.441188, 3.3 },
-{ 20.150143, 13.442397, 3.3 },
-{ 20.151554, 13.440497, 3.3 },
-{ 20.149458, 13.441706, 3.3 },
-{ 20.149822, 13.441663, 3.3 },
-{ 20.149231, 13.44175, 3.3 },
-{ 20.149458, 13.440151, 3.3 },
-{ 20.149504, 13.440411, 3.3 },
-{ 20.150097, 13.442872, 3.3 },
-{ 20.149822, 13.440928, 3.3 },
-{ 20.150143, 13.439979, 3.4 },
-{ 20.15201, 13.4408, 3.4 },
-{ 20.150734, 13.441318, 3.4 },
-{ 20.150871, 13.442353, 3.4 },
-{ 20.151691, 13.440238, 3.4 },
-{ 20.15119, 13.441965, 3.4 },
-{ 20.150826, 13.440108, 3.4 },
-{ 20.149231, 13.441965, 3.4 },
-{ 20.151964, 13.442483, 3.4 },
-{ 20.149458, 13.44162, 3.4 },
-{ 20.150187, 13.442181, 3.4 },
-{ 20.151829, 13.44136, 3.4 },
-{ 20.151783, 13.44313, 3.4 },
-{ 20.150097, 13.442181, 3.4 },
-{ 20.152557, 13.441922, 3.4 },
-{ 20.151646, 13.441878, 3.4 },
-{ 20.15201, 13.442138, 3.4 },
-{ 20.153196, 13.441403, 3.4 },
-{ 20.149595, 13.439936, 3.4 },
-{ 20.153515, 13.44244, 3.4 },
-{ 20.150324, 13.442008, 3.4 },
-{ 20.149822, 13.440411, 3.4 },
-{ 20.15078, 13.442656, 3.4 },
-{ 20.151327, 13.442527, 3.4 },
-{ 20.151236, 13.44244, 3.4 },
-{ 20.150599, 13.441403, 3.4 },
-{ 20.150324, 13.443605, 3.4 },
-{ 20.151144, 13.442008, 3.4 },
-{ 20.152557, 13.443045, 3.4 },
-{ 20.149731, 13.442742, 3.4 },
-{ 20.150461, 13.441447, 3.4 },
-{ 20.153059, 13.441663, 3.4 },
-{ 20.150051, 13.441577, 3.4 },
-{ 20.150599, 13.441447, 3.4 },
-{ 20.150642, 13.443088, 3.4 },
-{ 20.151009, 13.442181, 3.3 },
-{ 20.149868, 13.442613, 3.3 },
-{ 20.150507, 13.441403, 3.3 },
-{ 20.151327, 13.441231, 3.3 },
-{ 20.151964, 13.440928, 3.3 },
-{ 20.15078, 13.441101, 3.4 },
-{ 20.151419, 13.443174, 3.4 },
-{ 20.150507, 13.443088, 3.4 },
-{ 20.150734, 13.442613, 3.4 },
-{ 20.151281, 13.440843, 3.4 },
-{ 20.150143, 13.442483, 3.4 },
-{ 20.15233, 13.441403, 3.4 },
-{ 20.15201, 13.441403, 3.4 },
-{ 20.151098, 13.441792, 3.4 },
-{ 20.152147, 13.442052, 3.4 },
-{ 20.151419, 13.443304, 3.4 },
-{ 20.150917, 13.44257, 3.4 },
-{ 20.1516, 13.442785, 3.4 },
-{ 20.151508, 13.442613, 3.4 },
-{ 20.150688, 13.442742, 3.4 },
-{ 20.151737, 13.442052, 3.4 },
-{ 20.152147, 13.442095, 3.4 },
-{ 20.15242, 13.443088, 3.4 },
-{ 20.151327, 13.442138, 3.4 },
-{ 20.151554, 13.442613, 3.4 },
-{ 20.139475, 13.442613, 3.4 },
-{ 20.15192, 13.443088, 3.4 },
-{ 20.152967, 13.443304, 3.4 },
-{ 20.150642, 13.442181, 3.4 },
-{ 20.151098, 13.441835, 3.4 },
-{ 20.151464, 13.44244, 3.4 },
-{ 20.151098, 13.440928, 3.4 },
-{ 20.151737, 13.442958, 3.4 },
-{ 20.15192, 13.442742, 3.4 },
-{ 20.134552, 13.442785, 3.4 },
-{ 20.15078, 13.441015, 3.3 },
-{ 20.151783, 13.441577, 3.3 },
-{ 20.152557, 13.441835, 3.3 },
-{ -1.0, -1.0, -1.0 } };
+const uint8_t simulatedData[] PROGMEM = {
+0x81,0xf2,0xba,0x02,0x8e,0xd2,0x01,0xd0,0x05,0x14,0x42,0x34,0x20,0x20,0x20,0x52,
+0x00,0x40,0x20,0x12,0x18,0x00,0x00,0x36,0x2c,0x26,0x02,0x08,0x02,0x00,0x22,0x14,
+0x14,0x22,0x02,0x2c,0x12,0x00,0x26,0x34,0x20,0x04,0x06,0x00,0x04,0x04,0x00,0x10,
+0x22,0x04,0x04,0x26,0x10,0x00,0x10,0x10,0x42,0x04,0x10,0x04,0x10,0x20,0x16,0x48,
+0x24,0x16,0x00,0x02,0x1c,0x2a,0x38,0x06,0x40,0x14,0x49,0x14,0x36,0x12,0x24,0x04,
+0x23,0x13,0x04,0x12,0x10,0x24,0x20,0x10,0x26,0x14,0x04,0x00,0x02,0x44,0x56,0x68,
+0x34,0x26,0x18,0x0a,0x28,0x02,0x14,0x02,0x22,0x38,0x02,0x44,0x10,0x44,0x30,0x12,
+0x20,0x22,0x10,0x12,0x49,0x14,0x10,0x20,0x12,0x14,0x26,0x38,0x40,0x14,0x2a,0x3c,
+0x40,0x20,0x12,0x30,0x60,0x32,0x00,0x24,0x46,0x18,0x30,0x22,0x02,0x24,0x18,0x12,
+0x42,0x10,0x14,0x44,0x32,0x22,0x04,0x10,0x01,0x13,0x22,0x14,0x00,0x62,0x35,0x14,
+0x24,0x32,0x04,0x04,0x26,0x40,0x34,0x04,0x32,0x64,0x16,0x04,0x04,0x02,0x12,0x40,
+0x32,0x24,0x00,0x00,0x00,0x14,0x44,0x06,0x32,0x64,0x10,0x32,0x24,0x00,0x00,0x10,
+0x40,0x20,0x34,0x20,0x00,0x24,0x36,0x00,0x02,0x2c,0x16,0x00,0x04,0x00,0x20,0x06,
+0x38,0x08,0x4a,0x04,0x30,0x20,0x10,0x20,0x00,0x10,0x24,0x22,0x00,0x34,0x22,0x14,
+0x02,0x60,0x14,0x34,0x4e,0x18,0x10,0x44,0x0a,0x80,0x00,0x08,0x26,0x30,0x12,0x4c,
+0x36,0x44,0x16,0x04,0x04,0x46,0x10,0x10,0x24,0x34,0x22,0x20,0x18,0x06,0x28,0x02,
+0x00,0x22,0x30,0x18,0x02,0x20,0x12,0x40,0x14,0x40,0x14,0x06,0x14,0x00,0x22,0x14,
+0x24,0x06,0x04,0x12,0x10,0x42,0x28,0x10,0x02,0x02,0x1c,0x06,0x24,0x22,0x34,0x14,
+0x22,0x02,0x08,0x12,0x26,0x08,0x10,0x40,0x32,0x24,0x22,0x50,0x60,0x18,0x12,0x00,
+0x22,0x14,0x40,0x04,0x00,0x20,0x12,0x14,0x20,0x20,0x52,0x22,0x05,0x14,0x00,0x40,
+0x04,0x32,0x05,0x13,0x22,0x10,0x60,0x52,0x40,0x08,0x36,0x08,0x00,0x00,0x00,0x00,
+0x22,0x04,0x21,0x14,0x04,0x06,0x18,0x06,0x01,0x13,0x00,0x00,0x14,0x10,0x47,0x14,
+0x08,0x04,0x22,0x34,0x23,0x13,0x14,0x22,0x12,0x20,0x05,0x14,0x12,0x00,0x44,0x10,
+0x25,0x13,0x12,0x10,0x00,0x00,0x09,0x14,0x1a,0x60,0x00,0x14,0x05,0x13,0x12,0x40,
+0x32,0x28,0x21,0x14,0x32,0x04,0x20,0x16,0x04,0x04,0x22,0x04,0x14,0x26,0x20,0x20,
+0x10,0x06,0x04,0x34,0x08,0x26,0x00,0x08,0x06,0x22,0x38,0x14,0x26,0x24,0x22,0x30,
+0x24,0x10,0x14,0x46,0x24,0x14,0x02,0x22,0x22,0x14,0x18,0x22,0x02,0x14,0x10,0x24,
+0x02,0x04,0x22,0x12,0x22,0x14,0x22,0x14,0x04,0x12,0x28,0x22,0x20,0x30,0x02,0x00,
+0x04,0x24,0x36,0x04,0x44,0x16,0x04,0x20,0x10,0x04,0x02,0x22,0x54,0x40,0x24,0x12,
+0x24,0x10,0x46,0x50,0x2c,0x0a,0x20,0x18,0x02,0x00,0x08,0x26,0x30,0x24,0x22,0x12,
+0x20,0x04,0x00,0x16,0x28,0x18,0x1a,0x20,0x44,0x32,0x14,0x22,0x34,0x44,0x02,0x64,
+0x02,0x50,0x00,0x22,0x08,0x46,0x08,0x00,0x16,0x10,0x08,0x02,0x12,0x08,0x20,0x02,
+0x02,0x24,0x00,0x04,0x02,0x12,0x24,0x12,0x08,0x1a,0x28,0x42,0x18,0x40,0x36,0x44,
+0x32,0x10,0x24,0x02,0x18,0x22,0x02,0x24,0x00,0x02,0x04,0x12,0x44,0x00,0x12,0x28,
+0x10,0x22,0x10,0x00,0x10,0x20,0x02,0x10,0x20,0x24,0x12,0x14,0x44,0x06,0x10,0x04,
+0x20,0x12,0x24,0x02,0x00,0x06,0x08,0x05,0x14,0x00,0x00,0x22,0x30,0x60,0x34,0x02,
+0x20,0x12,0x05,0x13,0x28,0x36,0x40,0x02,0x21,0x14,0x14,0x00,0x04,0x02,0x02,0x28,
+0x16,0x20,0x14,0x10,0x64,0x12,0x02,0x04,0x31,0x13,0x40,0x02,0x14,0x00,0x21,0x14,
+0x10,0x22,0x34,0x42,0x00,0x02,0x08,0x22,0x00,0x10,0x0a,0x28,0x38,0x02,0x42,0x30,
+0x24,0x04,0x40,0x32,0x02,0x00,0x48,0x12,0x42,0x34,0x00,0x14,0x62,0x12,0x12,0x08,
+0x22,0x24,0x30,0x42,0x00,0x34,0x00,0x02,0x18,0x26,0x04,0x22,0x08,0x12,0x42,0x50,
+0x48,0x02,0x00,0x10,0x02,0x24,0x10,0x02,0x64,0x30,0x02,0x20,0x24,0x30,0x46,0x54,
+0x44,0x16,0x04,0x02,0x24,0x02,0x10,0x40,0x34,0x20,0x12,0x20,0x08,0x00,0x06,0x00,
+0x20,0x18,0x00,0x12,0x20,0x20,0x00,0x00,0x10,0x02,0x04,0x00,0x10,0x20,0x22,0x00,
+0x80,0x0f,0x00,0x80,0x10,0x00,0x08,0x00,0x1a,0x08,0x12,0x40,0x00,0x44,0x36,0x28,
+0x06,0x14,0x00,0x00,0x14,0x62,0x10,0x16,0x08,0x20,0x80,0x0f,0x3f,0x80,0x0e,0x40,
+0x24,0x06,0x14,0x12,0x64,0x04,0x00,0x12,0x04,0x22,0x10,0x10,0x20,0x40,0x30,0x10,
+0x20,0x14,0x00,0x02,0x00,0x62,0x74,0x80,0x08,0x00,0x12,0x34,0x22,0x22,0x34,0x40,
+0x08,0x52,0x40,0x06,0x28,0x54,0x4a,0x20,0x18,0x02,0x04,0x04,0x06,0x20,0x30,0x04,
+0x22,0x00,0x10,0x40,0x02,0x08,0x02,0x10,0x00,0x08,0x2a,0x04,0x50,0x62,0x30,0x04,
+0x04,0x26,0x08,0x02,0x00,0x04,0x40,0x33,0x14,0x14,0x06,0x04,0x20,0x04,0x02,0x00,
+0x10,0x48,0x17,0x13,0x20,0x10,0x10,0x42,0x10,0x04,0x12,0x24,0x00,0x13,0x14,0x24,
+0x02,0x14,0x22,0x05,0x13,0x04,0x12,0x40,0x18,0x0a,0x22,0x34,0x24,0x04,0x27,0x14,
+0x00,0x02,0x08,0x30,0x42,0x38,0x22,0x14,0x06,0x44,0x34,0x16,0x80,0x1b,0x1e,0x80,
+0x19,0x12,0x81,0x09,0x04,0x13,0x80,0x09,0x00,0x28,0x34,0x14,0x15,0x14,0x40,0x32,
+0x08,0x04,0x00,0x10,0x28,0x06,0x40,0x22,0x00,0x22,0x2a,0x26,0x22,0x4a,0x66,0x00,
+0x26,0x2e,0x20,0x26,0x02,0x00,0x26,0x12,0x2a,0x24,0x12,0x22,0x12,0x10,0x14,0x2a,
+0x38,0x22,0x3a,0x38,0x10,0x02,0x10,0x02,0x34,0x12,0x20,0x30,0x12,0x06,0x00,0x02,
+0x14,0x20,0x10,0x12,0x22,0x32,0x2a,0x04,0x10,0x02,0x22,0x00,0x2e,0x54,0x66,0x02,
+0x02,0x02,0x26,0x02,0x02,0x46,0x16,0x04,0x26,0x42,0x30,0x26,0x16,0x42,0x02,0x00,
+0x22,0x02,0x00,0x32,0x40,0x1a,0x44,0x02,0x14,0x02,0x02,0x00,0x02,0x00,0x00,0x02,
+0x10,0x20,0x30,0x06,0x04,0x14,0x32,0x30,0x10,0x10,0x3c,0x16,0x58,0x14,0x18,0x22,
+0x30,0x10,0x32,0x20,0x04,0x06,0x08,0x02,0x2a,0x00,0x14,0x62,0x12,0x00,0x2a,0x28,
+0x20,0x1a,0x40,0x12,0x20,0x40,0x36,0x44,0x20,0x12,0x28,0x46,0x16,0x00,0x00,0x26,
+0x28,0x32,0x62,0x04,0x02,0x12,0x24,0x02,0x20,0x32,0x20,0x38,0x6a,0x72,0x80,0x08,
+0x02,0x10,0x14,0x02,0x04,0x32,0x44,0x26,0x22,0x00,0x14,0x22,0x12,0x64,0x16,0x42,
+0x00,0x02,0x40,0x26,0x12,0x60,0x16,0x60,0x24,0x06,0x10,0x46,0x04,0x42,0x22,0x20,
+0x22,0x02,0x20,0x16,0x40,0x10,0x24,0x06,0x02,0x20,0x00,0x46,0x04,0x32,0x40,0x00,
+0x22,0x00,0x12,0x22,0x00,0x14,0x22,0x00,0x46,0x30,0x00,0x40,0x12,0x40,0x00,0x22,
+0x02,0x22,0x00,0x10,0x62,0x04,0x00,0x4a,0x24,0x0a,0x00,0x02,0x24,0x26,0x02,0x20,
+0x02,0x02,0x64,0x12,0x22,0x42,0x30,0x00,0x46,0x14,0x46,0x10,0x04,0x22,0x26,0x00,
+0x22,0x00,0x2a,0x80,0x18,0x1d,0x80,0x0c,0x01,0x46,0x42,0x4a,0x43,0x13,0x00,0x26,
+0x24,0x16,0x24,0x22,0x42,0x24,0x32,0x12,0x68,0x16,0x22,0x00,0x5c,0x02,0x04,0x00,
+0x32,0x20,0x08,0x12,0x20,0x04,0x30,0x22,0x12,0x04,0x00,0x20,0x20,0x12,0x24,0x30,
+0x02,0x28,0x12,0x10,0x60,0x54,0x42,0x20,0x34,0x24,0x26,0x1c,0x10,0x20,0x12,0x20,
+0x42,0x30,0x18,0x42,0x1c,0x26,0x14,0x10,0x40,0x10,0x48,0x10,0x30,0x24,0x22,0x24,
+0x1c,0x06,0x20,0x18,0x22,0x04,0x30,0x40,0x35,0x13,0x60,0x34,0x04,0x22,0x08,0x44,
+0x12,0x28,0x30,0x20,0x22,0x38,0x28,0x24,0x02,0x04,0x10,0x14,0x20,0x00,0x24,0x22,
+0x04,0x10,0x1c,0x02,0x40,0x24,0x00,0x10,0x20,0x20,0x08,0x16,0x14,0x48,0x00,0x20,
+0x12,0x24,0x08,0x0a,0x4c,0x32,0x04,0x24,0x24,0x36,0x00,0x10,0x28,0x22,0x18,0x02,
+0x28,0x00,0x02,0x10,0x24,0x22,0x04,0x08,0x16,0x04,0x04,0x40,0x54,0x22,0x40,0x01,
+0x13,0x34,0x20,0x24,0x32,0x44,0x14,0x10,0x60,0x12,0x14,0x42,0x34,0x04,0x30,0x00,
+0x64,0x00,0x22,0x50,0x24,0x42,0x38,0x12,0x44,0x12,0x20,0x10,0x08,0x00,0x22,0x04,
+0x00,0x10,0x04,0x20,0x06,0x08,0x34,0x60,0x38,0x06,0x18,0x22,0x30,0x42,0x38,0x22,
+0x04,0x22,0x08,0x32,0x04,0x24,0x02,0x00,0x00,0x12,0x2c,0x02,0x19,0x13,0x32,0x62,
+0x18,0x14,0x27,0x14,0x34,0x60,0x10,0x30,0x23,0x13,0x2c,0x10,0x10,0x26,0x31,0x14,
+0x04,0x40,0x34,0x24,0x07,0x13,0x00,0x0c,0x16,0x04,0x20,0x14,0x20,0x04,0x30,0x26,
+0x14,0x06,0x08,0x08,0x24,0x0a,0x04,0x10,0x14,0x28,0x16,0x22,0x04,0x14,0x00,0x20,
+0x22,0x34,0x24,0x10,0x16,0x28,0x00,0x00,0x04,0x10,0x00,0x12,0x00,0x44,0x18,0x02,
+0x20,0x30,0x02,0x24,0x00,0x12,0x28,0x11,0x13,0x24,0x06,0x08,0x02,0x05,0x14,0x02,
+0x14,0x00,0x00,0x32,0x44,0x22,0x38,0x06,0x25,0x13,0x34,0x40,0x00,0x30,0x30,0x6c,
+0x16,0x02,0x00,0x00,0x22,0x08,0x10,0x18,0x02,0x48,0x12,0x3a,0x68,0x32,0x22,0x5c,
+0x44,0x26,0x08,0x12,0x20,0x00,0x30,0x40,0x34,0x24,0x1a,0x48,0x32,0x08,0x42,0x34,
+0x12,0x00,0x24,0x10,0x02,0x00,0x22,0x08,0x20,0x04,0x50,0x20,0x00,0x00,0x06,0x04,
+0x20,0x14,0x10,0x02,0x44,0x13,0x13,0x08,0x04,0x32,0x28,0x07,0x14,0x00,0x04,0x42,
+0x10,0x03,0x13,0x3c,0x26,0x14,0x14,0x42,0x10,0x00,0x44,0x12,0x30,0x44,0x12,0x10,
+0x44,0x10,0x10,0x20,0x22,0x14,0x36,0x4c,0x40,0x3a,0x08,0x10,0x48,0x12,0x32,0x20,
+0x00,0x18,0x02,0x42,0x38,0x40,0x56,0x6c,0x12,0x30,0x40,0x08,0x1a,0x00,0x14,0x22,
+0x04,0x00,0x10,0x04,0x26,0x08,0x02,0x18,0x22,0x14,0x20,0x12,0x10,0x44,0x02,0x10,
+0x00,0x24,0x34,0x26,0x14,0x00,0x20,0x10,0x08,0x12,0x02,0x24,0x10,0x22,0x14,0x12,
+0x22,0x0c,0x12,0x04,0x46,0x18,0x10,0x01,0x13,0x00,0x28,0x06,0x10,0x02,0x04,0x04,
+0x12,0x00,0x21,0x14,0x00,0x00,0x00,0x10,0x29,0x13,0x12,0x20,0x10,0x10,0x64,0x50,
+0x08,0x46,0x32,0x02,0x08,0x22,0x34,0x00,0x42,0x04,0x10,0x00,0x12,0x08,0x22,0x14,
+0x00,0x22,0x04,0x14,0x02,0x04,0x12,0x20,0x38,0x42,0x14,0x12,0x40,0x12,0x18,0x26,
+0x24,0x02,0x54,0x20,0x08,0x4a,0x38,0x00,0x28,0x42,0x56,0x14,0x20,0x20,0x34,0x22,
+0x34,0x4a,0x80,0x01,0x08,0x06,0x34,0x24,0x16,0x24,0x42,0x38,0x42,0x38,0x2a,0x0c,
+0x12,0x01,0x13,0x08,0x26,0x18,0x1a,0x29,0x14,0x10,0x02,0x18,0x46,0x14,0x22,0x10,
+0x10,0x24,0x21,0x13,0x34,0x02,0x10,0x20,0x01,0x14,0x02,0x18,0x22,0x00,0x14,0x22,
+0x14,0x44,0x16,0x0d,0x13,0x06,0x00,0x04,0x32,0x00,0x20,0x14,0x08,0x26,0x30,0x24,
+0x26,0x08,0x10,0x22,0x00,0x14,0x12,0x24,0x04,0x06,0x04,0x14,0x24,0x32,0x22,0x08,
+0x22,0x30,0x24,0x12,0x28,0x16,0x02,0x14,0x44,0x10,0x20,0x02,0x34,0x40,0x04,0x00,
+0x30,0x42,0x30,0x44,0x30,0x00,0x02,0x04,0x00,0x00,0x20,0x30,0x24,0x22,0x14,0x00,
+0x02,0x24,0x56,0x04,0x48,0x02,0x00,0x24,0x52,0x24,0x22,0x12,0x04,0x04,0x22,0x34,
+0x44,0x34,0x26,0x10,0x10,0x24,0x14,0x26,0x44,0x50,0x20,0x08,0x12,0x20,0x00,0x00,
+0x10,0x10,0x40,0x30,0x00,0x42,0x30,0x44,0x04,0x36,0x44,0x34,0x06,0x08,0x10,0x42,
+0x00,0x14,0x00,0x20,0x00,0x14,0x22,0x38,0x42,0x32,0x04,0x24,0x02,0x00,0x00,0x10,
+0x22,0x10,0x18,0x42,0x04,0x34,0x26,0x00,0x08,0x16,0x04,0x40,0x10,0x00,0x10,0x04,
+0x20,0x32,0x28,0x22,0x00,0x10,0x00,0x32,0x64,0x04,0x02,0x30,0x02,0x48,0x30,0x12,
+0x48,0x26,0x58,0x40,0x00,0x06,0x34,0x00,0x28,0x06,0x04,0x14,0x06,0x04,0x24,0x0a,
+0x5c,0x46,0x28,0x14,0x0a,0x28,0x00,0x10,0x04,0x00,0x10,0x02,0x04,0x42,0x18,0x12,
+0x16,0x2c,0x12,0x00,0x20,0x34,0x40,0x00,0x22,0x14,0x12,0x04,0x26,0x34,0x44,0x00,
+0x10,0x22,0x08,0x10,0x02,0x14,0x06,0x48,0x10,0x00,0x02,0x10,0x24,0x12,0x28,0x02,
+0x04,0x12,0x10,0x00,0x08,0x42,0x12,0x34,0x40,0x00,0x04,0x22,0x08,0x16,0x32,0x60,
+0x54,0x20,0x24,0x12,0x04,0x20,0x14,0x12,0x28,0x06,0x12,0x00,0x24,0x24,0x32,0x24,
+0x20,0x10,0x20,0x30,0x24,0x12,0x20,0x04,0x02,0x00,0x10,0x1c,0x2a,0x34,0x42,0x08,
+0x06,0x0c,0x12,0x22,0x14,0x02,0x10,0x48,0x56,0x44,0x44,0x36,0x24,0x10,0x04,0x06,
+0x18,0x20,0x10,0x42,0x54,0x60,0x30,0x02,0x04,0x24,0x00,0x00,0x10,0x10,0x62,0x38,
+0x0a,0x08,0x02,0x04,0x20,0x02,0x08,0x36,0x2c,0x06,0x12,0x28,0x02,0x00,0x14,0x00,
+0x00,0x20,0x02,0x04,0x14,0x00,0x10,0x42,0x14,0x32,0x44,0x14,0x02,0x20,0x22,0x18,
+0x10,0x12,0x62,0x14,0x34,0x40,0x10,0x00,0x10,0x04,0x42,0x10,0x14,0x12,0x44,0x10,
+0x20,0x02,0x14,0x28,0x3e,0x28,0x30,0x64,0x04,0x3a,0x24,0x24,0x10,0x20,0x10,0x12,
+0x20,0x08,0x36,0x80,0x08,0x04,0x70,0x40,0x12,0x08,0x00,0x06,0x22,0x18,0x06,0x08,
+0x20,0x12,0x28,0x12,0x20,0x14,0x12,0x44,0x16,0x24,0x10,0x20,0x10,0x20,0x18,0x2a,
+0x18,0x06,0x08,0x02,0x24,0x16,0x24,0x30,0x24,0x34,0x42,0x02,0x04,0x10,0x44,0x26,
+0x30,0x12,0x20,0x0c,0x30,0x44,0x16,0x22,0x08,0x16,0x24,0x14,0x00,0x20,0x10,0x20,
+0x02,0x04,0x04,0x02,0x10,0x24,0x12,0x20,0x08,0x2a,0x14,0x10,0x20,0x00,0x04,0x00,
+0x04,0x22,0x12,0x20,0x20,0x12,0x18,0x00,0x14,0x40,0x16,0x04,0x04,0x00,0x32,0x20,
+0x20,0x02,0x04,0x20,0x30,0x00,0x42,0x08,0x12,0x04,0x00,0x22,0x14,0x22,0x30,0x20,
+0x20,0x34,0x24,0x02,0x00,0x20,0x06,0x08,0x12,0x00,0x20,0x04,0x04,0x12,0x20,0x06,
+0x80,0x01,0x0a,0x22,0x26,0x30,0x24,0x00,0x00,0x34,0x46,0x38,0x46,0x12,0x44,0x34,
+0x24,0x06,0x18,0x20,0x22,0x02,0x12,0x80,0x03,0x08,0x26,0x10,0x22,0x00,0x04,0x00,
+0x00,0x04,0x10,0x22,0x44,0x30,0x22,0x23,0x14,0x18,0x10,0x16,0x44,0x01,0x13,0x10,
+0x04,0x02,0x44,0x12,0x30,0x44,0x16,0x04,0x24,0x00,0x00,0x22,0x30,0x24,0x10,0x24,
+0x12,0x42,0x18,0x32,0x0c,0x4a,0x32,0x48,0x10,0x22,0x10,0x10,0x45,0x14,0x20,0x30,
+0x22,0x00,0x24,0x32,0x24,0x12,0x00,0x45,0x13,0x12,0x24,0x12,0x34,0x21,0x14,0x00,
+0x02,0x00,0x20,0x04,0x10,0x22,0x14,0x22,0x04,0x04,0x16,0x20,0x10,0x04,0x02,0x04,
+0x00,0x14,0x42,0x10,0x10,0x20,0x20,0x10,0x24,0x80,0x01,0x23,0x80,0x00,0x24,0x42,
+0x34,0x22,0x34,0x02,0x04,0x40,0x12,0x20,0x14,0x02,0x00,0x04,0x00,0x06,0x14,0x48,
+0x00,0x16,0x2c,0x16,0x03,0x13,0x18,0x66,0x14,0x04,0x33,0x14,0x20,0x02,0x04,0x02,
+0x40,0x14,0x32,0x44,0x00,0x14,0x10,0x42,0x00,0x14,0x26,0x08,0x00,0x00,0x36,0x2c,
+0x26,0x30,0x22,0x38,0x44,0x12,0x44,0x32,0x02,0x04,0x04,0x12,0x40,0x00,0x10,0x04,
+0x02,0x24,0x22,0x34,0x40,0x32,0x14,0x42,0x04,0x02,0x14,0x10,0x22,0x04,0x10,0x20,
+0x00,0x02,0x04,0x32,0x24,0x34,0x26,0x08,0x16,0x68,0x56,0x28,0x02,0x22,0x08,0x16,
+0x2c,0x0a,0x1c,0x46,0x00,0x14,0x10,0x00,0x00,0x34,0x42,0x06,0x08,0x40,0x36,0x1c,
+0x40,0x02,0x32,0x00,0x24,0x04,0x20,0x36,0x08,0x20,0x10,0x00,0x20,0x26,0x3c,0x02,
+0x00,0x40,0x16,0x18,0x20,0x30,0x62,0x14,0x12,0x08,0x00,0x22,0x20,0x30,0x06,0x18,
+0x04,0x20,0x10,0x61,0x14,0x30,0x00,0x18,0x6e,0x31,0x13,0x28,0x12,0x00,0x00,0x24,
+0x34,0x20,0x26,0x10,0x00,0x24,0x14,0x00,0x04,0x06,0x10,0x22,0x28,0x32,0x05,0x14,
+0x22,0x24,0x12,0x30,0x28,0x26,0x30,0x4c,0x0a,0x14,0x22,0x10,0x08,0x00,0x22,0x10,
+0x06,0x04,0x20,0x13,0x13,0x08,0x14,0x00,0x06,0x09,0x14,0x02,0x00,0x26,0x04,0x04,
+0x20,0x04,0x02,0x10,0x36,0x28,0x08,0x06,0x00,0x15,0x13,0x22,0x24,0x16,0x40,0x10,
+0x08,0x12,0x24,0x02,0x35,0x14,0x20,0x24,0x16,0x04,0x24,0x12,0x20,0x02,0x44,0x50,
+0x20,0x30,0x44,0x12,0x42,0x10,0x14,0x20,0x30,0x48,0x06,0x14,0x24,0x02,0x10,0x20,
+0x32,0x42,0x14,0x00,0x00,0x24,0x36,0x48,0x30,0x20,0x14,0x26,0x22,0x18,0x04,0x10,
+0x22,0x20,0x12,0x34,0x60,0x12,0x48,0x52,0x64,0x32,0x38,0x60,0x36,0x24,0x06,0x04,
+0x14,0x62,0x10,0x32,0x2c,0x02,0x10,0x00,0x22,0x24,0x12,0x14,0x04,0x02,0x00,0x24,
+0x10,0x06,0x24,0x20,0x22,0x74,0x24,0x22,0x32,0x44,0x04,0x10,0x02,0x42,0x58,0x42,
+0x04,0x10,0x00,0x20,0x00,0x30,0x62,0x50,0x44,0x00,0x16,0x24,0x34,0x40,0x02,0x38,
+0x26,0x28,0x02,0x00,0x00,0x04,0x32,0x40,0x14,0x20,0x00,0x12,0x28,0x36,0x28,0x22,
+0x02,0x08,0x12,0x00,0x20,0x00,0x02,0x02,0x30,0x28,0x46,0x34,0x20,0x04,0x32,0x48,
+0x12,0x03,0x14,0x04,0x00,0x14,0x40,0x11,0x13,0x14,0x46,0x04,0x12,0x09,0x14,0x02,
+0x00,0x02,0x20,0x10,0x04,0x22,0x18,0x06,0x24,0x32,0x24,0x40,0x52,0x41,0x13,0x08,
+0x12,0x20,0x12,0x09,0x14,0x10,0x22,0x24,0x18,0x26,0x10,0x00,0x12,0x0a,0x6c,0x30,
+0x04,0x02,0x06,0x15,0x13,0x48,0x02,0x10,0x04,0x11,0x14,0x00,0x22,0x20,0x04,0x10,
+0x22,0x18,0x02,0x10,0x00,0x20,0x22,0x18,0x02,0x12,0x20,0x04,0x12,0x44,0x18,0x02,
+0x12,0x22,0x10,0x20,0x28,0x02,0x10,0x20,0x10,0x20,0x14,0x22,0x18,0x12,0x00,0x22,
+0x00,0x14,0x62,0x10,0x02,0x14,0x14,0x20,0x10,0x02,0x00,0x44,0x32,0x00,0x48,0x16,
+0x14,0x20,0x02,0x22,0x34,0x62,0x38,0x04,0x02,0x02,0x44,0x10,0x34,0x62,0x50,0x24,
+0x26,0x34,0x44,0x16,0x08,0x02,0x04,0x02,0x04,0x04,0x0a,0x18,0x42,0x14,0x22,0x04,
+0x00,0x30,0x22,0x12,0x20,0x2c,0x0e,0x18,0x00,0x04,0x26,0x38,0x42,0x18,0x46,0x10,
+0x12,0x08,0x12,0x20,0x24,0x12,0x12,0x44,0x10,0x2c,0x12,0x02,0x14,0x40,0x26,0x14,
+0x02,0x00,0x08,0x20,0x32,0x10,0x42,0x0c,0x16,0x04,0x26,0x10,0x08,0x10,0x20,0x04,
+0x06,0x24,0x16,0x24,0x10,0x04,0x20,0x00,0x62,0x50,0x00,0x30,0x24,0x24,0x02,0x12,
+0x44,0x10,0x12,0x28,0x32,0x22,0x40,0x14,0x40,0x52,0x24,0x00,0x00,0x02,0x44,0x50,
+0x24,0x02,0x22,0x00,0x1d,0x14,0x0e,0x24,0x14,0x00,0x00,0x20,0x14,0x06,0x24,0x24,
+0x36,0x24,0x14,0x20,0x02,0x22,0x02,0x08,0x00,0x31,0x13,0x62,0x34,0x00,0x40,0x33,
+0x14,0x04,0x46,0x14,0x04,0x03,0x13,0x20,0x00,0x18,0x06,0x21,0x14,0x10,0x00,0x04,
+0x00,0x00,0x06,0x08,0x00,0x02,0x62,0x54,0x00,0x02,0x24,0x29,0x13,0x12,0x20,0x14,
+0x22,0x57,0x14,0x04,0x20,0x64,0x30,0x20,0x16,0x08,0x20,0x22,0x30,0x20,0x28,0x3a,
+0x0c,0x06,0x42,0x00,0x30,0x4c,0x10,0x06,0x14,0x42,0x00,0x10,0x00,0x20,0x00,0x00,
+0x30,0x40,0x00,0x54,0x60,0x12,0x42,0x08,0x12,0x00,0x08,0x16,0x60,0x12,0x10,0x00,
+0x28,0x12,0x04,0x06,0x24,0x12,0x20,0x28,0x32,0x02,0x62,0x38,0x02,0x20,0x30,0x44,
+0x02,0x28,0x12,0x02,0x00,0x20,0x32,0x20,0x18,0x42,0x14,0x00,0x02,0x22,0x34,0x40,
+0x14,0x02,0x10,0x40,0x30,0x20,0x30,0x48,0x06,0x02,0x08,0x06,0x18,0x42,0x04,0x36,
+0x40,0x14,0x22,0x34,0x40,0x06,0x04,0x04,0x10,0x20,0x00,0x02,0x04,0x02,0x04,0x02,
+0x16,0x48,0x10,0x24,0x00,0x30,0x42,0x04,0x00,0x12,0x27,0x14,0x28,0x72,0x28,0x00,
+0x62,0x30,0x10,0x20,0x54,0x40,0x46,0x04,0x00,0x34,0x22,0x02,0x00,0x04,0x36,0x44,
+0x28,0x00,0x0a,0x44,0x34,0x00,0x22,0x10,0x04,0x81,0x17,0x03,0x13,0x80,0x18,0x02,
+0x24,0x30,0x20,0x01,0x14,0x20,0x34,0x12,0x42,0x14,0x12,0x44,0x26,0x34,0x48,0x06,
+0x04,0x10,0x22,0x30,0x28,0x02,0x02,0x20,0x15,0x13,0x08,0x2a,0x30,0x44,0x13,0x14,
+0x40,0x14,0x32,0x44,0x05,0x13,0x02,0x16,0x3c,0x80,0x08,0x03,0x15,0x14,0x00,0x32,
+0x62,0x18,0x00,0x14,0x22,0x32,0x40,0x04,0x22,0x30,0x14,0x60,0x12,0x24,0x16,0x08,
+0x02,0x02,0x04,0x34,0x22,0x18,0x0a,0x08,0x22,0x00,0x00,0x44,0x34,0x02,0x22,0x00,
+0x34,0x02,0x24,0x20,0x12,0x14,0x46,0x08,0x02,0x10,0x02,0x28,0x10,0x02,0x04,0x10,
+0x22,0x02,0x00,0x18,0x22,0x14,0x20,0x14,0x46,0x10,0x28,0x36,0x20,0x18,0x26,0x04,
+0x04,0x26,0x34,0x20,0x00,0x10,0x00,0x44,0x02,0x12,0x24,0x14,0x36,0x40,0x04,0x00,
+0x00,0x00,0x12,0x4c,0x12,0x02,0x00,0x50,0x42,0x08,0x22,0x22,0x14,0x10,0x10,0x02,
+0x68,0x10,0x12,0x14,0x20,0x02,0x24,0x12,0x02,0x04,0x04,0x10,0x06,0x18,0x22,0x00,
+0x00,0x20,0x02,0x80,0x01,0x08,0x4e,0x34,0x28,0x10,0x46,0x30,0x21,0x14,0x04,0x00,
+0x02,0x00,0x25,0x13,0x56,0x48,0x00,0x06,0x18,0x20,0x02,0x04,0x40,0x34,0x06,0x00,
+0x10,0x24,0x00,0x00,0x28,0x0e,0x38,0x14,0x42,0x3a,0x4c,0x00,0x03,0x14,0x00,0x24,
+0x12,0x14,0x40,0x50,0x68,0x1a,0x0c,0x07,0x13,0x12,0x44,0x12,0x14,0x43,0x14,0x14,
+0x10,0x10,0x00,0x40,0x26,0x04,0x34,0x22,0x38,0x22,0x24,0x02,0x30,0x20,0x02,0x04,
+0x02,0x08,0x66,0x58,0x1a,0x68,0x32,0x80,0x00,0x08,0x4a,0x32,0x24,0x12,0x22,0x34,
+0x64,0x30,0x44,0x02,0x34,0x00,0x46,0x14,0x20,0x50,0x22,0x14,0x22,0x2c,0x02,0x00,
+0x10,0x12,0x24,0x20,0x06,0x10,0x20,0x0c,0x3a,0x48,0x00,0x10,0x42,0x14,0x32,0x20,
+0x00,0x44,0x30,0x10,0x40,0x20,0x10,0x02,0x14,0x20,0x02,0x14,0x22,0x02,0x34,0x04,
+0x22,0x20,0x20,0x00,0x14,0x00,0x04,0x0a,0x18,0x20,0x20,0x10,0x00,0x02,0x08,0x02,
+0x02,0x12,0x4c,0x10,0x06,0x04,0x20,0x06,0x14,0x0c,0x0a,0x44,0x54,0x22,0x20,0x32,
+0x04,0x00,0x12,0x44,0x00,0x00,0x00,0x20,0x00,0x10,0x06,0x14,0x00,0x14,0x68,0x16,
+0x26,0x14,0x04,0x20,0x00,0x10,0x20,0x14,0x02,0x00,0x24,0x32,0x46,0x38,0x60,0x38,
+0x0a,0x28,0x12,0x22,0x34,0x40,0x10,0x02,0x08,0x02,0x40,0x30,0x24,0x16,0x10,0x28,
+0x62,0x70,0x64,0x00,0x36,0x00,0x08,0x10,0x40,0x30,0x42,0x00,0x20,0x10,0x02,0x20,
+0x14,0x12,0x24,0x12,0x0c,0x2a,0x08,0x02,0x10,0x10,0x44,0x12,0x00,0x24,0x22,0x14,
+0x16,0x14,0x40,0x11,0x14,0x02,0x04,0x20,0x04,0x05,0x13,0x46,0x34,0x00,0x22,0x10,
+0x14,0x60,0x30,0x14,0x2a,0x04,0x04,0x26,0x30,0x08,0x44,0x16,0x08,0x00,0x22,0x12,
+0x04,0x10,0x44,0x06,0x04,0x30,0x02,0x22,0x19,0x14,0x60,0x32,0x08,0x36,0x65,0x13,
+0x10,0x22,0x00,0x00,0x38,0x22,0x00,0x00,0x04,0x2b,0x14,0x28,0x16,0x04,0x10,0x04,
+0x00,0x24,0x02,0x02,0x14,0x42,0x70,0x44,0x20,0x50,0x40,0x10,0x40,0x10,0x00,0x20,
+0x1a,0x4c,0x32,0x10,0x40,0x14,0x02,0x08,0x40,0x30,0x42,0x10,0x12,0x24,0x00,0x30,
+0x24,0x46,0x14,0x20,0x32,0x24,0x02,0x20,0x14,0x24,0x0a,0x80,0x03,0x08,0x6a,0x34,
+0x42,0x30,0x08,0x06,0x24,0x10,0x30,0x44,0x02,0x02,0x08,0x10,0x02,0x20,0x04,0x02,
+0x22,0x08,0x36,0x44,0x04,0x30,0x02,0x40,0x10,0x00,0x24,0x30,0x42,0x10,0x04,0x42,
+0x30,0x10,0x20,0x04,0x22,0x10,0x10,0x12,0x6c,0x12,0x22,0x30,0x40,0x14,0x20,0x02,
+0x30,0x24,0x24,0x26,0x10,0x14,0x20,0x00,0x00,0x12,0x20,0x12,0x14,0x20,0x02,0x24,
+0x28,0x16,0x08,0x16,0x62,0x34,0x20,0x00,0x02,0x04,0x10,0x20,0x22,0x30,0x28,0x02,
+0x06,0x08,0x04,0x26,0x30,0x24,0x14,0x20,0x02,0x20,0x10,0x04,0x00,0x12,0x26,0x08,
+0x42,0x10,0x10,0x04,0x02,0x24,0x00,0x02,0x20,0x30,0x24,0x02,0x04,0x16,0x44,0x04,
+0x02,0x00,0x14,0x00,0x26,0x04,0x24,0x12,0x02,0x14,0x00,0x05,0x14,0x06,0x24,0x02,
+0x20,0x15,0x13,0x08,0x02,0x2a,0x0c,0x02,0x22,0x30,0x28,0x06,0x34,0x64,0x06,0x14,
+0x00,0x10,0x40,0x30,0x24,0x06,0x10,0x44,0x06,0x18,0x10,0x22,0x60,0x10,0x14,0x06,
+0x08,0x06,0x14,0x42,0x10,0x28,0x12,0x00,0x00,0x00,0x04,0x32,0x60,0x30,0x46,0x19,
+0x14,0x00,0x02,0x24,0x10,0x44,0x12,0x22,0x34,0x42,0x19,0x13,0x02,0x22,0x80,0x05,
+0x08,0x80,0x27,0x1a,0x81,0x0d,0x08,0x14,0x80,0x09,0x04,0x14,0x30,0x04,0x04,0x04,
+0x3c,0x06,0x04,0x08,0x20,0x02,0x60,0x50,0x46,0x10,0x60,0x06,0x26,0x6a,0x02,0x80,
+0x08,0x03,0x06,0x46,0x0a,0x22,0x26,0x40,0x06,0x02,0x10,0x06,0x22,0x12,0x02,0x04,
+0x02,0x32,0x10,0x22,0x10,0x12,0x00,0x30,0x14,0x02,0x14,0x16,0x54,0x12,0x44,0x10,
+0x16,0x10,0x42,0x30,0x22,0x10,0x10,0x12,0x00,0x26,0x00,0x22,0x12,0x22,0x12,0x40,
+0x52,0x46,0x12,0x26,0x42,0x06,0x12,0x4a,0x22,0x00,0x26,0x02,0x02,0x10,0x80,0x00,
+0x09,0x44,0x20,0x06,0x00,0x02,0x02,0x22,0x20,0x80,0x09,0x07,0x80,0x0a,0x04,0x26,
+0x10,0x20,0x26,0x14,0x32,0x02,0x20,0x0a,0x08,0x12,0x04,0x06,0x2c,0x36,0x10,0x30,
+0x34,0x06,0x80,0x01,0x08,0x36,0x34,0x10,0x38,0x22,0x80,0x09,0x00,0x22,0x38,0x10,
+0x00,0x44,0x06,0x18,0x0e,0x14,0x20,0x22,0x04,0x20,0x32,0x80,0x08,0x01,0x30,0x20,
+0x06,0x20,0x00,0x66,0x54,0x22,0x42,0x24,0x0a,0x00,0x24,0x00,0x46,0x00,0x30,0x42,
+0x10,0x22,0x02,0x04,0x22,0x00,0x10,0x02,0x44,0x52,0x00,0x40,0x00,0x32,0x24,0x32,
+0x64,0x30,0x12,0x60,0x00,0x02,0x12,0x04,0x22,0x02,0x20,0x24,0x26,0x1a,0x20,0x22,
+0x60,0x20,0x02,0x20,0x06,0x22,0x44,0x06,0x02,0x40,0x10,0x22,0x26,0x24,0x02,0x26,
+0x00,0x24,0x20,0x02,0x1a,0x64,0x16,0x24,0x10,0x42,0x14,0x06,0x44,0x12,0x02,0x00,
+0x04,0x02,0x26,0x04,0x12,0x20,0x20,0x04,0x0e,0x24,0x00,0x20,0x42,0x32,0x26,0x22,
+0x14,0x60,0x32,0x66,0x04,0x42,0x50,0x46,0x24,0x06,0x24,0x06,0x02,0x24,0x46,0x08,
+0x0a,0x22,0x24,0x06,0x00,0x10,0x22,0x20,0x00,0x16,0x48,0x06,0x20,0x2e,0x80,0x08,
+0x13,0x80,0x16,0x07,0x6f,0x13,0x60,0x6a,0x00,0x22,0x02,0x66,0x14,0x22,0x16,0x60,
+0x38,0x2a,0x24,0x02,0x03,0x14,0x04,0x32,0x24,0x04,0x01,0x13,0x30,0x44,0x02,0x54,
+0x04,0x46,0x38,0x20,0x02,0x30,0x40,0x20,0x54,0x46,0x04,0x12,0x24,0x00,0x30,0x40,
+0x02,0x80,0x01,0x08,0x2e,0x1c,0x16,0x00,0x24,0x00,0x02,0x04,0x20,0x08,0x00,0x02,
+0x08,0x24,0x00,0x28,0x3a,0x08,0x04,0x24,0x00,0x06,0x20,0x38,0x64,0x10,0x04,0x00,
+0x12,0x28,0x02,0x04,0x04,0x24,0x00,0x28,0x31,0x13,0x20,0x08,0x06,0x14,0x20,0x04,
+0x28,0x02,0x04,0x10,0x20,0x24,0x14,0x02,0x04,0x24,0x04,0x16,0x28,0x14,0x40,0x10,
+0x20,0x04,0x42,0x38,0x00,0x80,0x04,0x0c,0x20,0x22,0x08,0x20,0x18,0x02,0x34,0x48,
+0x30,0x46,0x04,0x02,0x01,0x13,0x04,0x00,0x34,0x40,0x10,0x16,0x6c,0x30,0x42,0x28,
+0x36,0x10,0x18,0x42,0x00,0x14,0x20,0x00,0x44,0x50,0x22,0x24,0x30,0x04,0x20,0x04,
+0x16,0x48,0x06,0x18,0x20,0x04,0x06,0x38,0x04,0x22,0x04,0x34,0x12,0x20,0x24,0x02,
+0x44,0x34,0x02,0x10,0x24,0x32,0x04,0x00,0x20,0x00,0x14,0x12,0x24,0x00,0x04,0x12,
+0x44,0x03,0x13,0x34,0x0c,0x26,0x10,0x01,0x14,0x04,0x08,0x10,0x06,0x02,0x20,0x3c,
+0x20,0x00,0x14,0x02,0x02,0x04,0x24,0x30,0x20,0x34,0x40,0x12,0x05,0x13,0x02,0x18,
+0x00,0x06,0x08,0x00,0x30,0x40,0x02,0x14,0x20,0x34,0x12,0x40,0x04,0x04,0x00,0x00,
+0x00,0x14,0x16,0x44,0x3c,0x22,0x06,0x48,0x36,0x32,0x48,0x0c,0x16,0x02,0x08,0x00,
+0x12,0x24,0x04,0x02,0x10,0x19,0x13,0x22,0x32,0x00,0x68,0x32,0x20,0x18,0x16,0x08,
+0x06,0x00,0x28,0x10,0x00,0x00,0x00,0x02,0x14,0x24,0x20,0x34,0x02,0x08,0x06,0x02,
+0x04,0x08,0x02,0x00,0x10,0x04,0x00,0x02,0x24,0x14,0x00,0x20,0x10,0x30,0x20,0x00,
+0x02,0x44,0x52,0x02,0x0c,0x22,0x14,0x22,0x04,0x18,0x12,0x22,0x02,0x00,0x0c,0x06,
+0x18,0x00,0x22,0x12,0x04,0x24,0x30,0x20,0x60,0x34,0x02,0x02,0x1c,0x06,0x14,0x42,
+0x18,0x02,0x10,0x00,0x00,0x02,0x28,0x16,0x18,0x40,0x04,0x11,0x13,0x42,0x72,0x68,
+0x30,0x00,0x22,0x20,0x30,0x08,0x2a,0x38,0x44,0x20,0x50,0x42,0x10,0x08,0x02,0x12,
+0x10,0x00,0x40,0x3c,0x22,0x20,0x02,0x00,0x12,0x08,0x12,0x44,0x14,0x02,0x16,0x48,
+0x00,0x00,0x00,0x10,0x00,0x10,0x60,0x50,0x20,0x14,0x62,0x54,0x04,0x0a,0x08,0x10,
+0x68,0x32,0x02,0x04,0x40,0x56,0x28,0x22,0x30,0x20,0x04,0x08,0x06,0x24,0x32,0x60,
+0x04,0x10,0x19,0x13,0x2a,0x14,0x30,0x60,0x10,0x00,0x02,0x24,0x14,0x21,0x14,0x16,
+0x10,0x28,0x02,0x05,0x13,0x16,0x08,0x00,0x42,0x10,0x28,0x30,0x06,0x24,0x14,0x22,
+0x04,0x02,0x04,0x02,0x20,0x54,0x20,0x20,0x14,0x02,0x20,0x12,0x14,0x20,0x20,0x10,
+0x14,0x22,0x24,0x54,0x26,0x30,0x64,0x24,0x12,0x30,0x20,0x18,0x46,0x14,0x02,0x00,
+0x04,0x00,0x24,0x02,0x14,0x42,0x30,0x20,0x04,0x02,0x30,0x44,0x10,0x12,0x20,0x14,
+0x20,0x00,0x10,0x44,0x30,0x40,0x30,0x12,0x24,0x02,0x04,0x10,0x24,0x22,0x10,0x10,
+0x04,0x00,0x04,0x22,0x00,0x02,0x10,0x20,0x10,0x40,0x10,0x04,0x20,0x00,0x54,0x20,
+0x10,0x20,0x00,0x24,0x02,0x12,0x00,0x10,0x24,0x02,0x38,0x20,0x26,0x24,0x04,0x10,
+0x14,0x22,0x10,0x24,0x02,0x00,0x30,0x00,0x22,0x08,0x06,0x10,0x28,0x54,0x66,0x12,
+0x10,0x21,0x13,0x00,0x14,0x24,0x22,0x08,0x00,0x12,0x22,0x18,0x00,0x42,0x30,0x14,
+0x22,0x21,0x14,0x54,0x02,0x44,0x10,0x03,0x13,0x24,0x10,0x10,0x20,0x28,0x02,0x36,
+0x24,0x00,0x04,0x00,0x80,0x13,0x01,0x80,0x12,0x02,0x06,0x24,0x20,0x18,0x12,0x24,
+0x06,0x00,0x04,0x30,0x40,0x18,0x06,0x20,0x10,0x24,0x10,0x02,0x14,0x20,0x10,0x04,
+0x40,0x36,0x04,0x04,0x00,0x26,0x0c,0x02,0x10,0x00,0x10,0x24,0x02,0x14,0x03,0x14,
+0x24,0x10,0x22,0x04,0x03,0x13,0x3c,0x06,0x12,0x24,0x04,0x02,0x24,0x00,0x10,0x10,
+0x22,0x08,0x32,0x40,0x12,0x28,0x06,0x14,0x24,0x06,0x08,0x02,0x14,0x12,0x00,0x24,
+0x12,0x20,0x20,0x34,0x02,0x04,0x00,0x12,0x14,0x60,0x14,0x04,0x2a,0x14,0x22,0x18,
+0x12,0x24,0x08,0x12,0x22,0x00,0x12,0x34,0x46,0x14,0x24,0x04,0x10,0x60,0x10,0x32,
+0x28,0x16,0x48,0x56,0x08,0x06,0x04,0x24,0x04,0x36,0x00,0x48,0x3a,0x04,0x24,0x24,
+0x02,0x24,0x52,0x24,0x02,0x08,0x12,0x02,0x08,0x22,0x06,0x18,0x22,0x18,0x00,0x20,
+0x12,0x04,0x44,0x56,0x14,0x20,0x04,0x26,0x14,0x40,0x52,0x24,0x18,0x46,0x12,0x24,
+0x18,0x06,0x04,0x16,0x28,0x12,0x44,0x16,0x08,0x30,0x40,0x30,0x42,0x28,0x52,0x04,
+0x24,0x20,0x16,0x0c,0x16,0x14,0x22,0x20,0x14,0x22,0x02,0x18,0x10,0x20,0x02,0x04,
+0x40,0x50,0x20,0x12,0x28,0x32,0x41,0x13,0x14,0x20,0x00,0x30,0x23,0x14,0x08,0x12,
+0x22,0x24,0x00,0x30,0x42,0x04,0x34,0x02,0x04,0x10,0x00,0x02,0x64,0x30,0x02,0x18,
+0x22,0x14,0x22,0x00,0x34,0x20,0x02,0x22,0x34,0x44,0x04,0x12,0x12,0x44,0x02,0x00,
+0x10,0x28,0x10,0x12,0x14,0x24,0x42,0x32,0x20,0x34,0x46,0x08,0x10,0x18,0x42,0x00,
+0x12,0x20,0x04,0x30,0x04,0x46,0x14,0x10,0x24,0x02,0x00,0x00,0x12,0x10,0x2c,0x02,
+0x00,0x24,0x32,0x20,0x00,0x00,0x02,0x18,0x02,0x04,0x20,0x00,0x12,0x04,0x10,0x00,
+0x02,0x24,0x24,0x32,0x20,0x08,0x36,0x28,0x24,0x0a,0x04,0x04,0x02,0x20,0x10,0x34,
+0x02,0x40,0x10,0x20,0x18,0x32,0x64,0x32,0x22,0x04,0x00,0x02,0x08,0x00,0x12,0x08,
+0x02,0x00,0x22,0x18,0x40,0x12,0x10,0x10,0x20,0x20,0x14,0x00,0x02,0x00,0x08,0x06,
+0x00,0x30,0x44,0x18,0x06,0x14,0x22,0x10,0x20,0x04,0x00,0x20,0x10,0x00,0x06,0x0c,
+0x00,0x22,0x20,0x50,0x04,0x00,0x00,0x18,0x42,0x30,0x22,0x24,0x16,0x10,0x02,0x04,
+0x08,0x22,0x20,0x14,0x04,0x12,0x20,0x04,0x06,0x14,0x00,0x20,0x00,0x32,0x24,0x10,
+0x04,0x20,0x00,0x12,0x24,0x14,0x26,0x3c,0x22,0x20,0x32,0x04,0x24,0x02,0x14,0x20,
+0x10,0x20,0x10,0x14,0x66,0x14,0x10,0x10,0x44,0x02,0x00,0x22,0x04,0x14,0x14,0x00,
+0x00,0x06,0x00,0x14,0x02,0x24,0x02,0x44,0x31,0x14,0x04,0x02,0x10,0x04,0x41,0x13,
+0x00,0x10,0x00,0x22,0x14,0x10,0x04,0x36,0x64,0x18,0x0a,0x04,0x18,0x22,0x10,0x04,
+0x06,0x08,0x26,0x14,0x04,0x22,0x02,0x14,0x14,0x20,0x26,0x18,0x20,0x12,0x00,0x14,
+0x20,0x10,0x22,0x20,0x18,0x02,0x04,0x00,0x00,0x02,0x14,0x40,0x30,0x20,0x12,0x00,
+0x00,0x10,0x14,0x62,0x04,0x10,0x04,0x02,0x28,0x02,0x12,0x14,0x24,0x16,0x24,0x04,
+0x22,0x32,0x08,0x26,0x30,0x25,0x14,0x44,0x12,0x32,0x28,0x37,0x13,0x48,0x32,0x24,
+0x20,0x12,0x28,0x12,0x40,0x18,0x17,0x14,0x44,0x04,0x30,0x22,0x24,0x02,0x10,0x12,
+0x44,0x52,0x24,0x60,0x32,0x14,0x03,0x13,0x28,0x02,0x14,0x22,0x40,0x30,0x14,0x30,
+0x42,0x05,0x14,0x10,0x46,0x1c,0x0a,0x44,0x52,0x2c,0x20,0x12,0x14,0x22,0x02,0x24,
+0x00,0x34,0x60,0x02,0x30,0x04,0x12,0x28,0x10,0x20,0x06,0x00,0x08,0x00,0x22,0x04,
+0x32,0x24,0x00,0x22,0x00,0x34,0x20,0x02,0x00,0x10,0x30,0x44,0x00,0x20,0x02,0x04,
+0x14,0x26,0x34,0x24,0x40,0x16,0x44,0x50,0x10,0x24,0x12,0x44,0x12,0x20,0x04,0x20,
+0x10,0x02,0x00,0x04,0x10,0x42,0x18,0x2a,0x18,0x10,0x40,0x02,0x30,0x44,0x28,0x52,
+0x44,0x06,0x12,0x28,0x02,0x10,0x14,0x22,0x02,0x20,0x28,0x14,0x3a,0x22,0x0c,0x22,
+0x12,0x28,0x02,0x10,0x02,0x1c,0x26,0x02,0x28,0x12,0x64,0x30,0x0a,0x48,0x54,0x46,
+0x10,0x00,0x08,0x02,0x00,0x40,0x14,0x04,0x06,0x04,0x10,0x00,0x42,0x10,0x2c,0x06,
+0x72,0x60,0x10,0x40,0x04,0x20,0x50,0x00,0x00,0x40,0x50,0x60,0x32,0x20,0x04,0x10,
+0x00,0x02,0x20,0x04,0x04,0x12,0x20,0x00,0x04,0x24,0x12,0x04,0x42,0x50,0x24,0x16,
+0x42,0x18,0x22,0x00,0x00,0x10,0x20,0x23,0x14,0x14,0x10,0x20,0x14,0x02,0x14,0x20,
+0x12,0x24,0x13,0x13,0x24,0x46,0x58,0x20,0x10,0x06,0x20,0x0c,0x06,0x03,0x14,0x44,
+0x10,0x04,0x26,0x18,0x06,0x38,0x60,0x50,0x20,0x42,0x08,0x32,0x60,0x10,0x00,0x22,
+0x52,0x80,0x08,0x04,0x70,0x06,0x2c,0x00,0x02,0x02,0x1c,0x26,0x44,0x50,0x06,0x64,
+0x50,0x22,0x08,0x03,0x13,0x14,0x26,0x00,0x20,0x11,0x14,0x08,0x00,0x00,0x06,0x14,
+0x42,0x00,0x14,0x20,0x14,0x00,0x20,0x00,0x10,0x22,0x00,0x04,0x12,0x24,0x80,0x19,
+0x00,0x80,0x1a,0x00,0x20,0x32,0x00,0x00,0x02,0x28,0x00,0x80,0x21,0x00,0x81,0x20,
+0x03,0x13,0x24,0x20,
+};
 
 // EOF
@@ -0,0 +1,110 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef RAW_TRACE_HPP_
+#define RAW_TRACE_HPP_
+
+#include <scale_replay.hpp>
+#include <varint.hpp>
+
+// Decodes the compressed traces created by export.py. Each record holds the
+// deltas from the previous record in fixed point (weightScale units per kg and
+// tempScale units per C), zigzag encoded. The first byte of a record is:
+//
+//   0aaa bbbT  scale1 = aaa, scale2 = bbb (two channels)
+//   0aaa aaaT  scale1 = aaaaaa (one channel)
+//   1000 000T  followed by varint(scale1) [varint(scale2)]
+//
+// T is set when the temperature changed and is followed by varint(temp). The
+// noise on a stable keg is a few grams so almost all records are one byte.
+class SimulatedTrace : public ReplaySource {
+ private:
+  VarintStream _stream;
+  uint32_t _count;
+  uint32_t _index = 0;
+  int _channels;
+  int _column;
+  float _weightScale;
+  float _tempScale;
+  int32_t _last[3] = {0, 0, 0};
+
+  bool decode() {
+    uint8_t h;
+    int32_t d;
+
+    if (_index >= _count || !_stream.readByte(h)) return false;
+
+    if (!(h & 0x80)) {
+      if (_channels > 1) {
+        _last[0] += zigzagDecode((h >> 4) & 0x07);
+        _last[1] += zigzagDecode((h >> 1) & 0x07);
+      } else {
+        _last[0] += zigzagDecode((h >> 1) & 0x3f);
+      }
+    } else {
+      if (!_stream.readSigned(d)) return false;
+      _last[0] += d;
+
+      if (_channels > 1) {
+        if (!_stream.readSigned(d)) return false;
+        _last[1] += d;
+      }
+    }
+
+    if (h & 1) {
+      if (!_stream.readSigned(d)) return false;
+      _last[2] += d;
+    }
+
+    _index++;
+    return true;
+  }
+
+ public:
+  SimulatedTrace(const uint8_t* data, size_t size, uint32_t count,
+                 int channels, float weightScale, float tempScale,
+                 int column = 0)
+      : _stream(data, size),
+        _count(count),
+        _channels(channels),
+        _column(column < channels ? column : 0),
+        _weightScale(weightScale),
+        _tempScale(tempScale) {}
+
+  // Decodes the next record and returns the weight for the selected column
+  bool next(float& weight) override {
+    if (!decode()) return false;
+
+    weight = getWeight(_column);
+    return true;
+  }
+
+  bool isDone() { return _index >= _count; }
+  uint32_t getIndex() { return _index; }
+  float getWeight(int column) { return _last[column] / _weightScale; }
+  float getTemp() { return _last[2] / _tempScale; }
+};
+
+#endif  // RAW_TRACE_HPP_
+
+// EOF
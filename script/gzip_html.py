@@ -0,0 +1,32 @@
+Import("env")
+import gzip
+import os
+
+# Pages that are served by KegWebHandler, these are embedded as gzip files
+# so they can be sent with Content-Encoding: gzip without any processing.
+files = [
+    "calibration",
+    "beer",
+    "stability",
+    "graph",
+    "backup",
+    "dashboard",
+]
+
+dir = env.subst("$PROJECT_DIR") + "/html/"
+
+for f in files:
+    source = dir + f + ".min.htm"
+    target = source + ".gz"
+
+    if os.path.exists(target) and os.path.getmtime(target) >= os.path.getmtime(source):
+        continue
+
+    with open(source, "rb") as i:
+        data = i.read()
+
+    # Use a fixed timestamp so the output (and the ETag) only changes when the page does
+    with open(target, "wb") as o:
+        o.write(gzip.compress(data, compresslevel=9, mtime=0))
+
+    print("Compress file : " + source + " -> " + target + " (" + str(len(data)) + " -> " + str(os.path.getsize(target)) + " bytes)")
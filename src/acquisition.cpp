@@ -0,0 +1,204 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <acquisition.hpp>
+#include <capture.hpp>
+#include <kegwebhandler.hpp>
+#include <levels.hpp>
+#include <perfstats.hpp>
+#include <scale.hpp>
+#include <temp_mgr.hpp>
+
+void Acquisition::begin() {
+  // Readers should always get a valid snapshot, even before the first update
+  publish();
+
+#if defined(USE_ACQUISITION_TASK)
+  if (xTaskCreate(task, "acquisition", ACQUISITION_TASK_STACK, this,
+                  ACQUISITION_TASK_PRIORITY, &_task) == pdPASS) {
+    _running = true;
+    Log.notice(F("ACQ : Acquisition task started." CR));
+  } else {
+    Log.error(F("ACQ : Failed to start acquisition task, sampling in loop."
+                CR));
+  }
+#endif
+}
+
+#if defined(USE_ACQUISITION_TASK)
+void Acquisition::task(void* param) {
+  Acquisition* acq = static_cast<Acquisition*>(param);
+  uint32_t next = millis() + ACQUISITION_INTERVAL;
+
+  for (;;) {
+    myScale.loop(UnitIndex::U1);
+    myScale.loop(UnitIndex::U2);
+    myCapture.loop();
+
+    if (static_cast<int32_t>(millis() - next) >= 0) {
+      acq->sample();
+      next += ACQUISITION_INTERVAL;
+
+      // Skip the missed updates instead of running them back to back
+      if (static_cast<int32_t>(millis() - next) >= 0)
+        next = millis() + ACQUISITION_INTERVAL;
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(ACQUISITION_POLL));
+  }
+}
+#endif
+
+void Acquisition::sample() {
+  if (_clearStability.exchange(false)) {
+    myLevelDetection.getStability(UnitIndex::U1)->clear();
+    myLevelDetection.getStability(UnitIndex::U2)->clear();
+  }
+
+  // Read the scales, only once per update. During a capture all samples go to
+  // the capture file, so level detection is paused.
+  if (!myCapture.isActive()) {
+    float t = myTemp.getLastTempC();
+
+    PERF_BEGIN("loop-scale-read1");
+    myLevelDetection.update(UnitIndex::U1, myScale.read(UnitIndex::U1), t);
+    PERF_END("loop-scale-read1");
+    PERF_BEGIN("loop-scale-read2");
+    myLevelDetection.update(UnitIndex::U2, myScale.read(UnitIndex::U2), t);
+    PERF_END("loop-scale-read2");
+  }
+
+  publish();
+
+  Log.notice(
+      F("LOOP: Reading data raw1=%F,raw2=%F,stable1=%F, "
+        "stable2=%F,pour1=%F,"
+        "pour2=%F" CR),
+      myLevelDetection.getRawDetection(UnitIndex::U1)->getRawValue(),
+      myLevelDetection.getRawDetection(UnitIndex::U2)->getRawValue(),
+      myLevelDetection.getStatsDetection(UnitIndex::U1)->getStableValue(),
+      myLevelDetection.getStatsDetection(UnitIndex::U2)->getStableValue(),
+      myLevelDetection.getStatsDetection(UnitIndex::U1)->getPourValue(),
+      myLevelDetection.getStatsDetection(UnitIndex::U2)->getPourValue());
+}
+
+void Acquisition::publish() {
+  LevelSnapshot snap = {};
+
+  snap.sequence = myLevelDetection.getSequence();
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    TapSnapshot& t = snap.tap[idx];
+
+    t.connected = myScale.isConnected(idx);
+    t.hasStable = myLevelDetection.hasStableWeight(idx);
+    t.hasPour = myLevelDetection.hasPourWeight(idx);
+    t.statsStable =
+        myLevelDetection.hasStableWeight(idx, LevelDetectionType::STATS);
+    t.hasRawValue = myLevelDetection.getRawDetection(idx)->hasRawValue();
+    t.hasKalmanValue = myLevelDetection.getRawDetection(idx)->hasKalmanValue();
+    t.hasStatsValue = myLevelDetection.getStatsDetection(idx)->hasStableValue();
+    t.raw = myScale.readLastRaw(idx);
+    t.rawValue = myLevelDetection.getRawDetection(idx)->getRawValue();
+    t.averageValue = myLevelDetection.getRawDetection(idx)->getAverageValue();
+    t.kalmanValue = myLevelDetection.getRawDetection(idx)->getKalmanValue();
+    t.tempCorrValue = myLevelDetection.getRawDetection(idx)->getTempCorrValue();
+    t.slopeValue = myLevelDetection.getRawDetection(idx)->getSlopeValue();
+    t.statsValue = myLevelDetection.getStatsDetection(idx)->getStableValue();
+    t.statsAverage = myLevelDetection.getStatsDetection(idx)->ave();
+    t.statsMin = myLevelDetection.getStatsDetection(idx)->min();
+    t.statsMax = myLevelDetection.getStatsDetection(idx)->max();
+    t.totalWeight = myLevelDetection.getTotalWeight(idx);
+    t.totalRawWeight = myLevelDetection.getTotalRawWeight(idx);
+    t.totalStableWeight = myLevelDetection.getTotalStableWeight(idx);
+    t.beerWeight = myLevelDetection.getBeerWeight(idx);
+    t.beerVolume = myLevelDetection.getBeerVolume(idx);
+    t.beerStableVolume = myLevelDetection.getBeerStableVolume(idx);
+    t.stableGlasses = myLevelDetection.getNoStableGlasses(idx);
+    t.pourWeight = myLevelDetection.getPourWeight(idx);
+    t.pourVolume = myLevelDetection.getPourVolume(idx);
+    t.liveWeight =
+        myLevelDetection.getBeerWeight(idx, LevelDetectionType::RAW);
+    t.liveVolume =
+        myLevelDetection.getBeerVolume(idx, LevelDetectionType::RAW);
+    t.statsGlasses =
+        myLevelDetection.getNoGlasses(idx, LevelDetectionType::STATS);
+    t.statsPourVolume =
+        myLevelDetection.getPourVolume(idx, LevelDetectionType::STATS);
+    t.stableCount = myLevelDetection.getStableCount(idx);
+    t.pourCount = myLevelDetection.getPourCount(idx);
+    t.rejectedCount = myLevelDetection.getRejectedCount(idx);
+
+    Stability* stability = myLevelDetection.getStability(idx);
+    t.stability.count = stability->count();
+
+    if (t.stability.count > 1) {
+      t.stability.sum = stability->sum();
+      t.stability.min = stability->min();
+      t.stability.max = stability->max();
+      t.stability.average = stability->average();
+      t.stability.variance = stability->variance();
+      t.stability.popStdev = stability->popStdev();
+      t.stability.unbiasedStdev = stability->unbiasedStdev();
+    }
+
+    const LevelHistory& history = myLevelDetection.getHistory(idx);
+
+    if (history.getBuckets() != _historyBuckets[idx]) {
+      _historyBuckets[idx] = history.getBuckets();
+      _history[idx].write(history);
+    }
+  }
+
+  _snapshot.write(snap);
+}
+
+// Returns true when there was a new level update since the last call
+bool Acquisition::loop() {
+  LevelSnapshot snap;
+
+  if (!read(snap) || snap.sequence == _sequence) return false;
+
+  _sequence = snap.sequence;
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    const TapSnapshot& t = snap.tap[idx];
+
+    if (t.pourCount != _pourCount[idx]) {
+      _pourCount[idx] = t.pourCount;
+      myLevelDetection.pushPourUpdate(idx, t.beerStableVolume, t.pourVolume);
+      myWebHandler.sendPourEvent(idx, snap);
+    }
+
+    if (t.stableCount != _stableCount[idx]) {
+      _stableCount[idx] = t.stableCount;
+      myLevelDetection.pushKegUpdate(idx, t.beerStableVolume, t.pourVolume,
+                                     t.stableGlasses);
+      myWebHandler.sendStableEvent(idx, snap);
+    }
+  }
+
+  return true;
+}
+
+// EOF
@@ -0,0 +1,159 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_ACQUISITION_HPP_
+#define SRC_ACQUISITION_HPP_
+
+#include <Arduino.h>
+
+#include <levelhistory.hpp>
+#include <main.hpp>
+#include <snapshot.hpp>
+
+constexpr auto ACQUISITION_INTERVAL = 2000;    // ms between level updates
+constexpr auto ACQUISITION_POLL = 10;          // ms between scale polls
+constexpr auto ACQUISITION_TASK_STACK = 8192;  // bytes, capture file and log
+constexpr auto ACQUISITION_TASK_PRIORITY = 5;  // above loop() and async tcp
+
+// Statistics for the raw values used by the stability page
+struct StabilitySnapshot {
+  uint32_t count;
+  float sum;
+  float min;
+  float max;
+  float average;
+  float variance;
+  float popStdev;
+  float unbiasedStdev;
+};
+
+// Values for one tap from the last level update. Weights are in kg and
+// volumes in liters, same as the LevelDetection getters. The live and stats
+// values are what the display shows regardless of the configured detection.
+struct TapSnapshot {
+  bool connected;
+  bool hasStable;
+  bool hasPour;
+  bool statsStable;
+  bool hasRawValue;
+  bool hasKalmanValue;
+  bool hasStatsValue;
+  int32_t raw;
+  // Values from each stage of the level detection, used for the export
+  float rawValue;
+  float averageValue;
+  float kalmanValue;
+  float tempCorrValue;
+  float slopeValue;
+  float statsValue;
+  float statsAverage;
+  float statsMin;
+  float statsMax;
+  float totalWeight;
+  float totalRawWeight;
+  float totalStableWeight;
+  float beerWeight;
+  float beerVolume;
+  float beerStableVolume;
+  float stableGlasses;
+  float pourWeight;
+  float pourVolume;
+  float liveWeight;
+  float liveVolume;
+  float statsGlasses;
+  float statsPourVolume;
+  uint32_t stableCount;
+  uint32_t pourCount;
+  uint32_t rejectedCount;
+  StabilitySnapshot stability;
+};
+
+struct LevelSnapshot {
+  uint32_t sequence;
+  TapSnapshot tap[2];
+};
+
+// Reads the scales and updates the level detection. On ESP32 builds with
+// USE_ACQUISITION_TASK this runs in its own FreeRTOS task that owns Scale and
+// LevelDetection, so network and display work in loop() can not delay the
+// samples. Everything else reads the results from the snapshot and requests
+// changes with a schedule call that is handled before the next update. loop()
+// runs in the main loop and forwards new levels and pours to the push
+// targets, level log and web events.
+class Acquisition {
+ private:
+  Snapshot<LevelSnapshot> _snapshot;
+  Snapshot<LevelHistory> _history[2];  // Only written when a bucket closes
+  uint32_t _historyBuckets[2] = {0, 0};
+  std::atomic<bool> _clearStability;
+  uint32_t _sequence = 0;
+  uint32_t _stableCount[2] = {0, 0};
+  uint32_t _pourCount[2] = {0, 0};
+  bool _running = false;
+#if defined(USE_ACQUISITION_TASK)
+  TaskHandle_t _task = nullptr;
+#endif
+
+  Acquisition(const Acquisition&) = delete;
+  void operator=(const Acquisition&) = delete;
+
+  void publish();
+#if defined(USE_ACQUISITION_TASK)
+  static void task(void* param);
+#endif
+
+ public:
+  Acquisition() { _clearStability.store(false); }
+
+  void begin();
+  void sample();
+  bool loop();
+
+  bool isRunning() { return _running; }
+  bool read(LevelSnapshot& snap) { return _snapshot.read(snap); }
+
+  // The history is copied only when it has changed, use the version to check
+  bool readHistory(UnitIndex idx, LevelHistory& history) {
+    return _history[idx].read(history);
+  }
+  uint32_t getHistoryVersion(UnitIndex idx) {
+    return _history[idx].getVersion();
+  }
+
+  void scheduleStabilityClear() { _clearStability.store(true); }
+
+  // Smallest amount of free stack seen in the acquisition task, 0 when the
+  // task is not running.
+  uint32_t getStackFree() {
+#if defined(USE_ACQUISITION_TASK)
+    if (_task) return uxTaskGetStackHighWaterMark(_task);
+#endif
+    return 0;
+  }
+};
+
+extern Acquisition myAcquisition;
+
+#endif  // SRC_ACQUISITION_HPP_
+
+// EOF
@@ -27,8 +27,19 @@ SOFTWARE.
 #include <scale.hpp>
 #include <utils.hpp>
 
-void Brewspy::sendTapInformation(UnitIndex idx, float stableVol,
-                                 float pourVol) {
+String Brewspy::getKeyHeader(const char *key) {
+  String h;
+
+  if (strlen(key)) {
+    h = "Idempotency-Key: ";
+    h += key;
+  }
+
+  return h;
+}
+
+bool Brewspy::sendTapInformation(UnitIndex idx, float stableVol,
+                                 float pourVol, const char *key) {
   //
   // API: https://brew-spy.com/api/tap/keg/set
   // Descr: This method just sets all the keg related fields.
@@ -49,7 +60,7 @@ void Brewspy::sendTapInformation(UnitIndex idx, float stableVol,
   // **** Last pour - this is optional - use it if you wish to control the
   // amount of beer left yourself, otherwise you can use the api call below for
   // setting the last pour
-  if (strlen(myConfig.getBrewspyToken(idx)) == 0) return;
+  if (strlen(myConfig.getBrewspyToken(idx)) == 0) return true;
 
   DynamicJsonDocument doc(100);
 
@@ -69,10 +80,13 @@ void Brewspy::sendTapInformation(UnitIndex idx, float stableVol,
   EspSerial.print(out.c_str());
   EspSerial.print(CR);
   // #endif
-  _push->sendHttpPost(out, "https://brew-spy.com/api/tap/keg/set", "", "");
+  _push->sendHttpPost(out, "https://brew-spy.com/api/tap/keg/set",
+                      getKeyHeader(key).c_str(), "");
+  return _push->wasLastSuccessful();
 }
 
-void Brewspy::sendPourInformation(UnitIndex idx, float pourVol) {
+bool Brewspy::sendPourInformation(UnitIndex idx, float pourVol,
+                                  const char *key) {
   // API: https://brew-spy.com/api/tap/keg/pour
   // Descr: Sets the last pour field and subtracts the volume from the beer left
   // field Payload:
@@ -81,7 +95,7 @@ void Brewspy::sendPourInformation(UnitIndex idx, float pourVol) {
   //   unit: string,
   //   pour: number
   // }
-  if (strlen(myConfig.getBrewspyToken(idx)) == 0) return;
+  if (strlen(myConfig.getBrewspyToken(idx)) == 0) return true;
 
   DynamicJsonDocument doc(100);
 
@@ -98,7 +112,9 @@ void Brewspy::sendPourInformation(UnitIndex idx, float pourVol) {
   EspSerial.print(out.c_str());
   EspSerial.print(CR);
   // #endif
-  _push->sendHttpPost(out, "https://brew-spy.com/api/tap/keg/pour", "", "");
+  _push->sendHttpPost(out, "https://brew-spy.com/api/tap/keg/pour",
+                      getKeyHeader(key).c_str(), "");
+  return _push->wasLastSuccessful();
 }
 
 void Brewspy::clearKegInformation(UnitIndex idx) {
@@ -31,11 +31,16 @@ class Brewspy {
  protected:
   BasePush *_push;
 
+  String getKeyHeader(const char *key);
+
  public:
   explicit Brewspy(BasePush *push) { _push = push; }
 
-  void sendTapInformation(UnitIndex idx, float stableVol, float pourVol);
-  void sendPourInformation(UnitIndex idx, float pourVol);
+  // Returns false if the request failed, true when sent or not configured.
+  // The key is sent as Idempotency-Key so a replayed update can be detected.
+  bool sendTapInformation(UnitIndex idx, float stableVol, float pourVol,
+                          const char *key = "");
+  bool sendPourInformation(UnitIndex idx, float pourVol, const char *key = "");
   void clearKegInformation(UnitIndex idx);
   String getTapInformation(const String &token);
 };
@@ -0,0 +1,127 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_CALIBRATION_HPP_
+#define SRC_CALIBRATION_HPP_
+
+#include <math.h>
+#include <stdint.h>
+
+constexpr auto CALIBRATION_MAX_POINTS = 16;  // Including the zero point
+
+struct CalibrationPoint {
+  int32_t raw;   // Counts relative to the zero offset
+  float weight;  // kg
+};
+
+// Sorted table of reference weights used to convert raw load cell counts into
+// kg. The points are relative to the tare offset so the table stays valid when
+// the scale is reset to zero. The zero point is always part of the table and
+// values are interpolated linearly between the two closest points, outside the
+// table the first/last segment is extrapolated.
+class CalibrationTable {
+ private:
+  CalibrationPoint _points[CALIBRATION_MAX_POINTS];
+  int _size = 1;
+
+ public:
+  CalibrationTable() { clear(); }
+
+  void clear() {
+    _points[0] = {0, 0};
+    _size = 1;
+  }
+
+  int size() const { return _size; }
+  bool isActive() const { return _size > 1; }
+  const CalibrationPoint& get(int i) const { return _points[i]; }
+
+  // Add a point to the table, an existing point with the same weight or the
+  // same raw value is replaced. Returns false if the table is full.
+  bool add(int32_t raw, float weight) {
+    if (raw == 0 || weight <= 0) return false;
+
+    for (int i = 1; i < _size; i++) {
+      if (_points[i].raw == raw || fabs(_points[i].weight - weight) < 0.001) {
+        remove(i);
+        break;
+      }
+    }
+
+    if (_size >= CALIBRATION_MAX_POINTS) return false;
+
+    int i = _size;
+
+    while (i > 0 && _points[i - 1].raw > raw) {
+      _points[i] = _points[i - 1];
+      i--;
+    }
+
+    _points[i] = {raw, weight};
+    _size++;
+    return true;
+  }
+
+  bool remove(int i) {
+    if (i < 0 || i >= _size || _points[i].raw == 0) return false;
+
+    for (; i < _size - 1; i++) _points[i] = _points[i + 1];
+
+    _size--;
+    return true;
+  }
+
+  float toWeight(int32_t raw) const {
+    if (!isActive()) return NAN;
+
+    // Binary search for the segment, lo and hi will end up as neighbours and
+    // values outside the table will use the first or last segment.
+    int lo = 0, hi = _size - 1;
+
+    while (hi - lo > 1) {
+      int mid = (lo + hi) / 2;
+
+      if (raw < _points[mid].raw)
+        hi = mid;
+      else
+        lo = mid;
+    }
+
+    const CalibrationPoint& a = _points[lo];
+    const CalibrationPoint& b = _points[hi];
+    return a.weight + static_cast<float>(raw - a.raw) * (b.weight - a.weight) /
+                          static_cast<float>(b.raw - a.raw);
+  }
+
+  // Difference between the reference weight and what a single linear factor
+  // would give for this point, this is the error the table corrects.
+  float residual(int i, float factor) const {
+    if (factor == 0) return NAN;
+
+    return _points[i].weight - static_cast<float>(_points[i].raw) / factor;
+  }
+};
+
+#endif  // SRC_CALIBRATION_HPP_
+
+// EOF
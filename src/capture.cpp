@@ -0,0 +1,160 @@
+/*
+MIT License
+
+Copyright (c) 2021-22 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <capture.hpp>
+#include <kegconfig.hpp>
+#include <scale.hpp>
+#include <temp_mgr.hpp>
+#include <varint.hpp>
+
+static uint32_t getFreeSpace() {
+#if defined(ESP8266)
+  FSInfo fs;
+  LittleFS.info(fs);
+  return fs.totalBytes - fs.usedBytes;
+#else
+  return LittleFS.totalBytes() - LittleFS.usedBytes();
+#endif
+}
+
+template <typename T>
+static void writeValue(File& f, T v) {
+  f.write(reinterpret_cast<const uint8_t*>(&v), sizeof(v));
+}
+
+bool Capture::start(uint32_t duration) {
+  if (_active) stop();
+
+  if (duration == 0 || duration > CAPTURE_MAX_DURATION)
+    duration = CAPTURE_MAX_DURATION;
+
+  LittleFS.remove(CAPTURE_FILENAME);
+  uint32_t free = getFreeSpace();
+
+  if (free < CAPTURE_FS_RESERVE * 2) {
+    Log.error(F("CAPT: Not enough space on file system, %d bytes free." CR),
+              free);
+    return false;
+  }
+
+  _maxSize = free - CAPTURE_FS_RESERVE;
+  if (_maxSize > CAPTURE_MAX_SIZE) _maxSize = CAPTURE_MAX_SIZE;
+
+  _file = LittleFS.open(CAPTURE_FILENAME, "w");
+
+  if (!_file) {
+    Log.error(F("CAPT: Unable to create %s." CR), CAPTURE_FILENAME);
+    return false;
+  }
+
+  _file.write(reinterpret_cast<const uint8_t*>("KCAP"), 4);
+  writeValue<uint8_t>(_file, CAPTURE_VERSION);
+  writeValue<uint8_t>(_file, 0);
+  writeValue<uint16_t>(_file, 0);
+  writeValue<int32_t>(_file, myConfig.getScaleOffset(UnitIndex::U1));
+  writeValue<int32_t>(_file, myConfig.getScaleOffset(UnitIndex::U2));
+  writeValue<float>(_file, myConfig.getScaleFactor(UnitIndex::U1));
+  writeValue<float>(_file, myConfig.getScaleFactor(UnitIndex::U2));
+  writeValue<uint32_t>(_file, duration);
+
+  _size = _file.size();
+  _bufLen = 0;
+  _samples = 0;
+  _last[0] = _last[1] = _last[2] = 0;
+  _duration = duration;
+  _start = _lastRecord = millis();
+  _lastTemp = 0;
+  _hasTemp = false;
+  _active = true;
+
+  Log.notice(F("CAPT: Capture started for %d s, max %d bytes." CR), duration,
+             _maxSize);
+  return true;
+}
+
+void Capture::stop() {
+  if (!_active) return;
+
+  flush();
+  _file.close();
+  _active = false;
+
+  Log.notice(F("CAPT: Capture stopped, %d samples in %d bytes." CR), _samples,
+             _size);
+}
+
+void Capture::add(CaptureChannel ch, int32_t value) {
+  // Make sure there is room for a full record before encoding
+  if (_bufLen + VARINT_MAX_BYTES * 2 > sizeof(_buf)) flush();
+
+  uint32_t now = millis();
+  _bufLen += varintEncode(((now - _lastRecord) << 2) | ch, &_buf[_bufLen]);
+  _bufLen += varintEncode(zigzagEncode(value - _last[ch]), &_buf[_bufLen]);
+  _lastRecord = now;
+  _last[ch] = value;
+  _samples++;
+}
+
+void Capture::flush() {
+  if (!_bufLen) return;
+
+  _size += _file.write(&_buf[0], _bufLen);
+  _bufLen = 0;
+}
+
+void Capture::loop() {
+  if (_schedStop) {
+    _schedStop = false;
+    stop();
+  }
+
+  if (_schedStart) {
+    _schedStart = false;
+    start(_schedDuration);
+  }
+
+  if (!_active) return;
+
+  int32_t v;
+
+  // Drivers return false when no new conversion is ready so this never blocks
+  if (myScale.readSample(UnitIndex::U1, v)) add(CaptureChannel::Scale1, v);
+  if (myScale.readSample(UnitIndex::U2, v)) add(CaptureChannel::Scale2, v);
+
+  if (millis() - _lastTemp > CAPTURE_TEMP_INTERVAL) {
+    _lastTemp = millis();
+    float t = myTemp.getLastTempC();
+
+    if (!isnan(t)) {
+      int32_t c = static_cast<int32_t>(round(t * 100));
+      if (c != _last[CaptureChannel::TempC] || !_hasTemp) {
+        add(CaptureChannel::TempC, c);
+        _hasTemp = true;
+      }
+    }
+  }
+
+  if (millis() - _start > _duration * 1000 || getSize() >= _maxSize) stop();
+}
+
+// EOF
@@ -0,0 +1,99 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_CAPTURE_HPP_
+#define SRC_CAPTURE_HPP_
+
+#include <Arduino.h>
+
+#include <main.hpp>
+
+constexpr auto CAPTURE_FILENAME = "/capture.bin";
+constexpr auto CAPTURE_VERSION = 1;
+constexpr auto CAPTURE_MAX_DURATION = 3600;      // seconds
+constexpr auto CAPTURE_MAX_SIZE = 256 * 1024;    // bytes
+constexpr auto CAPTURE_FS_RESERVE = 32 * 1024;   // bytes left for config/logs
+constexpr auto CAPTURE_TEMP_INTERVAL = 1000;     // ms between temp checks
+
+enum CaptureChannel { Scale1 = 0, Scale2 = 1, TempC = 2 };
+
+// Records raw counts from both scales at the sensors native rate into a file
+// on LittleFS for offline analysis, raw/capture.py converts it into csv.
+//
+// File format (little endian):
+//   header: "KCAP", u8 version, 3 bytes padding, i32 offset1, i32 offset2,
+//           f32 factor1, f32 factor2, u32 max duration (s)
+//   record: varint((ms since previous record << 2) | channel)
+//           varint(zigzag(value - previous value on the same channel))
+// Temperature is stored as 1/100 C.
+class Capture {
+ private:
+  File _file;
+  bool _active = false;
+  uint32_t _start = 0;
+  uint32_t _duration = 0;
+  uint32_t _maxSize = 0;
+  uint32_t _lastRecord = 0;
+  uint32_t _lastTemp = 0;
+  bool _hasTemp = false;
+  uint32_t _samples = 0;
+  uint32_t _size = 0;
+  int32_t _last[3] = {0, 0, 0};
+  uint8_t _buf[256];
+  size_t _bufLen = 0;
+  bool _schedStart = false;
+  bool _schedStop = false;
+  uint32_t _schedDuration = 0;
+
+  Capture(const Capture&) = delete;
+  void operator=(const Capture&) = delete;
+
+  void add(CaptureChannel ch, int32_t value);
+  void flush();
+
+ public:
+  Capture() {}
+
+  bool start(uint32_t duration);
+  void stop();
+  void loop();
+
+  // File operations should not be done from the web callbacks
+  void scheduleStart(uint32_t duration) {
+    _schedDuration = duration;
+    _schedStart = true;
+  }
+  void scheduleStop() { _schedStop = true; }
+
+  bool isActive() { return _active; }
+  uint32_t getSamples() { return _samples; }
+  uint32_t getSize() { return _size + _bufLen; }
+  uint32_t getDuration() { return _duration; }
+  uint32_t getElapsed() { return _active ? (millis() - _start) / 1000 : 0; }
+};
+
+extern Capture myCapture;
+
+#endif  // SRC_CAPTURE_HPP_
+
+// EOF
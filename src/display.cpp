@@ -47,7 +47,35 @@ byte END_DIV_0_OF_1[8] = {B11110, B00011, B00001, B00001,
 byte END_DIV_1_OF_1[8] = {B11110, B00011, B11001, B11101,
                           B11101, B11001, B00011, B11110};  // Char thin 1/1
 
-Display::Display() {}
+constexpr auto HASH_BASIS = 2166136261UL;  // FNV-1a
+constexpr auto HASH_PRIME = 16777619UL;
+
+Display::Display() {
+  memset(&_lcdFrame[0][0][0], ' ', sizeof(_lcdFrame));
+  memset(&_lcdShown[0][0][0], 0xff, sizeof(_lcdShown));  // Nothing shown yet
+}
+
+void Display::addHash(UnitIndex idx, const char* data, size_t len) {
+  uint32_t h = _frameHash[idx];
+
+  for (size_t i = 0; i < len; i++) {
+    h ^= static_cast<uint8_t>(data[i]);
+    h *= HASH_PRIME;
+  }
+
+  _frameHash[idx] = h;
+}
+
+void Display::addHash(UnitIndex idx, int a, int b, int c, int d) {
+  const int v[4] = {a, b, c, d};
+  addHash(idx, reinterpret_cast<const char*>(&v[0]), sizeof(v));
+}
+
+void Display::writeLCD(UnitIndex idx, int x, int y, uint8_t c) {
+  if (x < 0 || x >= DISPLAY_LCD_COLS || y < 0 || y >= DISPLAY_LCD_ROWS) return;
+
+  _lcdFrame[idx][y][x] = c;
+}
 
 bool Display::checkInitialized(UnitIndex idx) {
   switch (_driver) {
@@ -71,6 +99,7 @@ void Display::setup() {
 
       _displayOLED[0] = new SH1106Wire(DISPLAY_ADR1, -1, -1);
       _displayOLED[1] = new SH1106Wire(DISPLAY_ADR2, -1, -1);
+      _text.reserve(DISPLAY_TEXT_MAX);
       _width[0] = 127;
       _width[1] = 127;
       _height[0] = 63;
@@ -138,6 +167,7 @@ void Display::setFont(UnitIndex idx, FontSize fs) {
   switch (_driver) {
     case DisplayDriverType::OLED_1306:
       _fontSize[idx] = fs;
+      addHash(idx, 'F', fs, 0, 0);
 
       switch (fs) {
         case FontSize::FONT_1:
@@ -163,25 +193,25 @@ void Display::setFont(UnitIndex idx, FontSize fs) {
   }
 }
 
-int Display::getTextWidth(UnitIndex idx, const String& text) {
+int Display::getTextWidth(UnitIndex idx, const char* text) {
   int w = 0;
 
   if (!checkInitialized(idx)) return -1;
 
   switch (_driver) {
     case DisplayDriverType::OLED_1306:
-      w = _displayOLED[idx]->getStringWidth(text);
+      w = _displayOLED[idx]->getStringWidth(text, strlen(text));
       break;
 
     case DisplayDriverType::LCD:
-      w = text.length();
+      w = strlen(text);
       break;
   }
 
   return w;
 }
 
-void Display::printPosition(UnitIndex idx, int x, int y, const String& text) {
+void Display::printPosition(UnitIndex idx, int x, int y, const char* text) {
   if (!checkInitialized(idx)) return;
 
   if (x < 0) {
@@ -191,19 +221,19 @@ void Display::printPosition(UnitIndex idx, int x, int y, const String& text) {
 
   switch (_driver) {
     case DisplayDriverType::OLED_1306:
-      _displayOLED[idx]->drawString(x, y, text);
+      _text = text;  // Copies into the existing buffer once it has grown
+      _displayOLED[idx]->drawString(x, y, _text);
+      addHash(idx, 'T', x, y, _fontSize[idx]);
+      addHash(idx, text, strlen(text));
       break;
 
     case DisplayDriverType::LCD:
-      if (y > (_height[idx] - 1)) return;
-
-      _displayLCD[idx]->setCursor(x, y);
-      _displayLCD[idx]->print(text);
+      for (int i = 0; text[i]; i++) writeLCD(idx, x + i, y, text[i]);
       break;
   }
 }
 
-void Display::printLine(UnitIndex idx, int l, const String& text) {
+void Display::printLine(UnitIndex idx, int l, const char* text) {
   if (!checkInitialized(idx)) return;
 
   switch (_driver) {
@@ -217,7 +247,7 @@ void Display::printLine(UnitIndex idx, int l, const String& text) {
   }
 }
 
-void Display::printLineCentered(UnitIndex idx, int l, const String& text) {
+void Display::printLineCentered(UnitIndex idx, int l, const char* text) {
   if (!checkInitialized(idx)) return;
 
   int w = getTextWidth(idx, text);
@@ -239,10 +269,11 @@ void Display::clear(UnitIndex idx) {
   switch (_driver) {
     case DisplayDriverType::OLED_1306:
       _displayOLED[idx]->clear();
+      _frameHash[idx] = HASH_BASIS;
       break;
 
     case DisplayDriverType::LCD:
-      _displayLCD[idx]->clear();
+      memset(&_lcdFrame[idx][0][0], ' ', sizeof(_lcdFrame[idx]));
       break;
   }
 }
@@ -250,14 +281,41 @@ void Display::clear(UnitIndex idx) {
 void Display::show(UnitIndex idx) {
   if (!checkInitialized(idx)) return;
 
+  bool changed = false;
+
   switch (_driver) {
     case DisplayDriverType::OLED_1306:
+      if (_frameHash[idx] == _shownHash[idx]) break;
+
       _displayOLED[idx]->display();
+      _shownHash[idx] = _frameHash[idx];
+      changed = true;
       break;
 
     case DisplayDriverType::LCD:
+      for (int y = 0; y < DISPLAY_LCD_ROWS; y++) {
+        int cursor = -1;  // Column where the next write ends up
+
+        for (int x = 0; x < DISPLAY_LCD_COLS; x++) {
+          uint8_t c = _lcdFrame[idx][y][x];
+
+          if (c == _lcdShown[idx][y][x]) continue;
+
+          if (cursor != x) _displayLCD[idx]->setCursor(x, y);
+
+          _displayLCD[idx]->write(c);
+          _lcdShown[idx][y][x] = c;
+          cursor = x + 1;
+          changed = true;
+        }
+      }
       break;
   }
+
+  if (changed)
+    _updates++;
+  else
+    _skipped++;
 }
 
 void Display::drawRect(UnitIndex idx, int x, int y, int w, int h) {
@@ -266,6 +324,7 @@ void Display::drawRect(UnitIndex idx, int x, int y, int w, int h) {
   switch (_driver) {
     case DisplayDriverType::OLED_1306:
       _displayOLED[idx]->drawRect(x, y, w, h);
+      addHash(idx, 'R', x, y, w * 1000 + h);
       break;
 
     case DisplayDriverType::LCD:
@@ -279,6 +338,7 @@ void Display::fillRect(UnitIndex idx, int x, int y, int w, int h) {
   switch (_driver) {
     case DisplayDriverType::OLED_1306:
       _displayOLED[idx]->fillRect(x, y, w, h);
+      addHash(idx, 'r', x, y, w * 1000 + h);
       break;
 
     case DisplayDriverType::LCD:
@@ -298,11 +358,10 @@ void Display::drawProgressBar(UnitIndex idx, int y, float percentage) {
       _displayOLED[idx]->drawRect(1, y + 1, _width[idx] - 2,
                                   _fontSize[idx] - 2);
       _displayOLED[idx]->fillRect(1, y + 1, col, _fontSize[idx] - 2);
+      addHash(idx, 'P', y, col, _fontSize[idx]);
       break;
 
     case DisplayDriverType::LCD:
-      _displayLCD[idx]->setCursor(0, y);
-
       // Each character displays 2 vertical bars, but the first and last
       // character displays only one. Map range (0 ~ 100) to range (0 ~
       // LCD_NB_COLUMNS * 2 - 2)
@@ -312,18 +371,18 @@ void Display::drawProgressBar(UnitIndex idx, int y, float percentage) {
       for (int i = 0; i < _width[idx]; ++i) {
         if (i == 0) {
           // Char 0 = empty start, Char 1 = full start
-          _displayLCD[idx]->write(col == 0 ? 0 : 1);
+          writeLCD(idx, i, y, col == 0 ? 0 : 1);
           col -= 1;  // First item only have one halv bar
         } else if (i == (_width[idx] - 1)) {
           // Char 5 = full end, Char 6 = empty end
-          _displayLCD[idx]->write(col > 0 ? 6 : 5);
+          writeLCD(idx, i, y, col > 0 ? 6 : 5);
         } else {
           if (col <= 0) {
             // Char 2 = empty middle
-            _displayLCD[idx]->write(2);
+            writeLCD(idx, i, y, 2);
           } else {
             // Char 3 = half middle, Char 4 = full middle
-            _displayLCD[idx]->write(col >= 2 ? 4 : 3);
+            writeLCD(idx, i, y, col >= 2 ? 4 : 3);
             col -= 2;  // One char equals to 1-2 indicators.
           }
         }
@@ -332,4 +391,25 @@ void Display::drawProgressBar(UnitIndex idx, int y, float percentage) {
   }
 }
 
+void Display::drawColumns(UnitIndex idx, int y, int h, const uint8_t* cols,
+                          int n) {
+  if (!checkInitialized(idx)) return;
+
+  switch (_driver) {
+    case DisplayDriverType::OLED_1306:
+      for (int x = 0; x < n; x++) {
+        if (!cols[x] || cols[x] > h) continue;
+
+        _displayOLED[idx]->drawVerticalLine(x, y + h - cols[x], cols[x]);
+      }
+
+      addHash(idx, 'C', y, h, n);
+      addHash(idx, reinterpret_cast<const char*>(cols), n);
+      break;
+
+    case DisplayDriverType::LCD:
+      break;
+  }
+}
+
 // EOF
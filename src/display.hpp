@@ -31,6 +31,10 @@ SOFTWARE.
 #include <kegconfig.hpp>
 #include <main.hpp>
 
+constexpr auto DISPLAY_LCD_COLS = 20;
+constexpr auto DISPLAY_LCD_ROWS = 4;
+constexpr auto DISPLAY_TEXT_MAX = 32;
+
 enum FontSize {  // Font options
   FONT_1 = 1,    // Support LCD
   FONT_10 = 10,  // Support OLED 6 lines
@@ -38,6 +42,11 @@ enum FontSize {  // Font options
   FONT_24 = 24   // Support OLED 3 lines
 };
 
+// Drawing only updates memory, show() sends it to the display when the
+// content has changed since the last show(). For the OLED a hash of all draw
+// calls since clear() is compared, the driver then only sends the pages that
+// differ from its back buffer. For the LCD the characters are kept in a frame
+// and only the cells that differ from what is on the display are written.
 class Display {
  private:
   SH1106Wire* _displayOLED[2] = {0, 0};
@@ -49,7 +58,18 @@ class Display {
   FontSize _fontSize[2] = {FontSize::FONT_10, FontSize::FONT_10};
   DisplayDriverType _driver = DisplayDriverType::OLED_1306;
 
+  uint32_t _frameHash[2] = {0, 0};
+  uint32_t _shownHash[2] = {0, 0};
+  uint8_t _lcdFrame[2][DISPLAY_LCD_ROWS][DISPLAY_LCD_COLS];
+  uint8_t _lcdShown[2][DISPLAY_LCD_ROWS][DISPLAY_LCD_COLS];
+  uint32_t _updates = 0;
+  uint32_t _skipped = 0;
+  String _text;  // The OLED driver only draws String, reused between calls
+
   bool checkInitialized(UnitIndex idx);
+  void addHash(UnitIndex idx, const char* data, size_t len);
+  void addHash(UnitIndex idx, int a, int b, int c, int d);
+  void writeLCD(UnitIndex idx, int x, int y, uint8_t c);
 
  public:
   Display();
@@ -58,19 +78,40 @@ class Display {
   void show(UnitIndex idx);
   void setFont(UnitIndex idx, FontSize fs);
   int getFontHeight(UnitIndex idx) { return _fontSize[idx]; }
-  int getTextWidth(UnitIndex idx, const String& text);
+  int getTextWidth(UnitIndex idx, const char* text);
+  int getTextWidth(UnitIndex idx, const String& text) {
+    return getTextWidth(idx, text.c_str());
+  }
 
   int getDisplayWidth(UnitIndex idx) { return _width[idx]; }
   int getDisplayHeight(UnitIndex idx) { return _height[idx]; }
 
-  void printPosition(UnitIndex index, int x, int y, const String& text);
-  void printLine(UnitIndex index, int l, const String& text);
-  void printLineCentered(UnitIndex index, int l, const String& text);
+  void printPosition(UnitIndex index, int x, int y, const char* text);
+  void printLine(UnitIndex index, int l, const char* text);
+  void printLineCentered(UnitIndex index, int l, const char* text);
+
+  void printPosition(UnitIndex index, int x, int y, const String& text) {
+    printPosition(index, x, y, text.c_str());
+  }
+  void printLine(UnitIndex index, int l, const String& text) {
+    printLine(index, l, text.c_str());
+  }
+  void printLineCentered(UnitIndex index, int l, const String& text) {
+    printLineCentered(index, l, text.c_str());
+  }
 
   void drawRect(UnitIndex idx, int x, int y, int w, int h);
   void fillRect(UnitIndex idx, int x, int y, int w, int h);
 
   void drawProgressBar(UnitIndex idx, int y, float percentage);
+
+  // Draws a bar graph with one column (pixels from the bottom) per x position
+  // in the area starting at y, columns higher than h are not drawn. Only
+  // supported on OLED.
+  void drawColumns(UnitIndex idx, int y, int h, const uint8_t* cols, int n);
+
+  uint32_t getUpdates() { return _updates; }
+  uint32_t getSkipped() { return _skipped; }
 };
 
 extern Display myDisplay;
@@ -21,9 +21,11 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
+#include <acquisition.hpp>
 #include <display.hpp>
 #include <displayout.hpp>
-#include <levels.hpp>
+#include <influxexport.hpp>
+#include <looptiming.hpp>
 
 constexpr auto DISPLAY_ITER_TIME = 4000;
 
@@ -71,11 +73,7 @@ void DisplayLayout::showStartupDevices(bool hasScale1, bool hasScale2,
   snprintf(&buf[0], sizeof(buf), "Temp : %s", hasTemp ? "Yes" : "No");
   myDisplay.printLine(UnitIndex::U1, 2, &buf[0]);
   snprintf(&buf[0], sizeof(buf), "Version: %s (%s)", CFG_APPVER,
-#if defined(ENABLE_INFLUX_DEBUG)
-           "Yes");
-#else
-           "No");
-#endif
+           myInflux.isEnabled() ? "Yes" : "No");
   myDisplay.printLine(UnitIndex::U1, 3, &buf[0]);
   myDisplay.show(UnitIndex::U1);
 }
@@ -150,20 +148,48 @@ void DisplayLayout::showDefault(UnitIndex idx, bool isScaleConnected,
   myDisplay.show(idx);
 }
 
+void DisplayLayout::drawSparkline(UnitIndex idx, int y, int h) {
+  float full = myConfig.getKegVolume(idx);
+  uint32_t version = myAcquisition.getHistoryVersion(idx);
+
+  // The history is only copied from the acquisition when a bucket has been
+  // closed, then only the new columns are calculated and the rest shifted.
+  if (version != _historyVersion[idx] ||
+      !_sparkline[idx].hasScale(full, h)) {
+    LevelHistory history;
+    myAcquisition.readHistory(idx, history);
+    _sparkline[idx].update(history, full, h);
+    _historyVersion[idx] = version;
+  }
+
+  myDisplay.drawColumns(idx, y, h, _sparkline[idx].getColumns(),
+                        LEVEL_HISTORY_POINTS);
+}
+
 void DisplayLayout::showGraph(UnitIndex idx, bool isScaleConnected,
                               float beerVolume, float pour) {
   myDisplay.clear(idx);
   myDisplay.setFont(idx, FontSize::FONT_16);
 
   myDisplay.printPosition(idx, -1, 0, getFormattedBeerName(idx));
-  myDisplay.printPosition(idx, -1, myDisplay.getFontHeight(idx) * 1,
-                          getFormattedPour(pour));
+
+  // Every third page on the OLED shows the level for the last 24 h
+  if (isScaleConnected && _iter == DisplayIterator::ShowPour &&
+      myConfig.getDisplayDriverType() == DisplayDriverType::OLED_1306) {
+    drawSparkline(idx, myDisplay.getFontHeight(idx) * 1,
+                  myDisplay.getFontHeight(idx) * 2);
+  } else {
+    myDisplay.printPosition(idx, -1, myDisplay.getFontHeight(idx) * 1,
+                            getFormattedPour(pour));
+
+    if (isScaleConnected)
+      myDisplay.printPosition(idx, -1, myDisplay.getFontHeight(idx) * 2,
+                              getFormattedBeerVolume(beerVolume));
+  }
 
   float keg = myConfig.getKegVolume(idx);
 
   if (isScaleConnected) {
-    myDisplay.printPosition(idx, -1, myDisplay.getFontHeight(idx) * 2,
-                            getFormattedBeerVolume(beerVolume));
     myDisplay.drawProgressBar(idx, myDisplay.getFontHeight(idx) * 3,
                               keg / beerVolume);
   } else {
@@ -272,23 +298,47 @@ void DisplayLayout::showHardwareStats(UnitIndex idx, bool isScaleConnected) {
   myDisplay.clear(idx);
   myDisplay.setFont(idx, FontSize::FONT_10);
 
-  if (isScaleConnected) {
-    snprintf(&_buf[0], sizeof(_buf), "Last wgt: %.3f",
-             myLevelDetection.getTotalWeight(idx));
+  // Every third page on the first display shows the main loop timing
+  if (idx == UnitIndex::U1 && _iter == DisplayIterator::ShowPour) {
+    snprintf(&_buf[0], sizeof(_buf), "Loop: %u ms",
+             static_cast<unsigned int>(myLoopTiming.getInterval()));
+    myDisplay.printLine(idx, 0, &_buf[0]);
+    snprintf(&_buf[0], sizeof(_buf), "Min/Max: %u/%u",
+             static_cast<unsigned int>(myLoopTiming.getMinInterval()),
+             static_cast<unsigned int>(myLoopTiming.getMaxInterval()));
+    myDisplay.printLine(idx, 1, &_buf[0]);
+    snprintf(&_buf[0], sizeof(_buf), "Overrun: %u/%u",
+             static_cast<unsigned int>(myLoopTiming.getOverruns()),
+             static_cast<unsigned int>(myLoopTiming.getTicks()));
+    myDisplay.printLine(idx, 2, &_buf[0]);
+    snprintf(&_buf[0], sizeof(_buf), "Lvl/Disp: %u/%u ms",
+             static_cast<unsigned int>(
+                 myLoopTiming.getPhaseLast(LoopPhase::PhaseLevel) / 1000),
+             static_cast<unsigned int>(
+                 myLoopTiming.getPhaseLast(LoopPhase::PhaseDisplay) / 1000));
+    myDisplay.printLine(idx, 3, &_buf[0]);
+    snprintf(&_buf[0], sizeof(_buf), "Web/Push: %u/%u ms",
+             static_cast<unsigned int>(
+                 myLoopTiming.getPhaseLast(LoopPhase::PhaseWeb) / 1000),
+             static_cast<unsigned int>(
+                 myLoopTiming.getPhaseLast(LoopPhase::PhasePush) / 1000));
+    myDisplay.printLine(idx, 4, &_buf[0]);
+  } else if (isScaleConnected) {
+    LevelSnapshot snap;
+    myAcquisition.read(snap);
+    const TapSnapshot& t = snap.tap[idx];
+
+    snprintf(&_buf[0], sizeof(_buf), "Last wgt: %.3f", t.totalWeight);
     myDisplay.printLine(idx, 0, &_buf[0]);
-    snprintf(&_buf[0], sizeof(_buf), "Stab wgt: %.3f",
-             myLevelDetection.getTotalStableWeight(idx));
+    snprintf(&_buf[0], sizeof(_buf), "Stab wgt: %.3f", t.totalStableWeight);
     myDisplay.printLine(idx, 1, &_buf[0]);
-    snprintf(&_buf[0], sizeof(_buf), "Ave  wgt: %.3f",
-             myLevelDetection.getStatsDetection(idx)->ave());
+    snprintf(&_buf[0], sizeof(_buf), "Ave  wgt: %.3f", t.statsAverage);
     myDisplay.printLine(idx, 2, &_buf[0]);
-    snprintf(&_buf[0], sizeof(_buf), "Min/Max: %.3f/%.3f",
-             myLevelDetection.getStatsDetection(idx)->min(),
-             myLevelDetection.getStatsDetection(idx)->max());
+    snprintf(&_buf[0], sizeof(_buf), "Min/Max: %.3f/%.3f", t.statsMin,
+             t.statsMax);
     myDisplay.printLine(idx, 3, &_buf[0]);
 
-    snprintf(&_buf[0], sizeof(_buf), "Raw  wgt: %.3f",
-             myLevelDetection.getTotalRawWeight(idx));
+    snprintf(&_buf[0], sizeof(_buf), "Raw  wgt: %.3f", t.totalRawWeight);
     myDisplay.printLine(idx, 4, &_buf[0]);
   }
 
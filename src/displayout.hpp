@@ -25,9 +25,9 @@ SOFTWARE.
 #define SRC_DISPLAYOUT_HPP_
 
 #include <kegconfig.hpp>
+#include <levelhistory.hpp>
 #include <main.hpp>
 #include <utils.hpp>
-#include <wificonnection.hpp>
 
 enum DisplayIterator {
   ShowWeight = 0,
@@ -36,75 +36,88 @@ enum DisplayIterator {
   ShowTemp = 3
 };
 
-extern WifiConnection myWifi;
+// Format descriptors for the texts shown on the displays, all of them are
+// rendered into the same fixed buffer so no heap is used while updating.
+constexpr auto DISPLAY_FMT_NAME = "%d:%s";
+constexpr auto DISPLAY_FMT_ABV = "%.1f%%";
+constexpr auto DISPLAY_FMT_BEER = "Beer %.*f %s";
+constexpr auto DISPLAY_FMT_GLASSES = "%.1f glasses";
+constexpr auto DISPLAY_FMT_POUR = "%.0f pour";
+constexpr auto DISPLAY_FMT_TEMP = "%.2f %c";
+constexpr auto DISPLAY_FMT_IP = "%u.%u.%u.%u";
 
 class DisplayLayout {
  private:
   DisplayIterator _iter = DisplayIterator::ShowWeight;
   uint32_t _loopMillis = 0;
   char _buf[30] = "";
+  LevelSparkline _sparkline[2];
+  uint32_t _historyVersion[2] = {0, 0};
 
-  String getFormattedBeerName(UnitIndex idx) {
-    snprintf(&_buf[0], sizeof(_buf), "%d:%s", idx + 1,
+  // The returned pointer is valid until the next getFormatted call
+  const char* getFormattedBeerName(UnitIndex idx) {
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_NAME, idx + 1,
              myConfig.getBeerName(idx));
-    return String(_buf);
+    return &_buf[0];
   }
 
-  String getFormattedBeerABV(UnitIndex idx) {
-    snprintf(&_buf[0], sizeof(_buf), "%.1f%%", myConfig.getBeerABV(idx));
-    return String(_buf);
+  const char* getFormattedBeerABV(UnitIndex idx) {
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_ABV,
+             myConfig.getBeerABV(idx));
+    return &_buf[0];
   }
 
-  String getFormattedBeerWeight(float beerWeight) {
-    convertFloatToString(beerWeight, &_buf[0], myConfig.getWeightPrecision());
-    String s(_buf);
-    s.trim();
-    s = "Beer " + s + " " + String(myConfig.getWeightUnit());
-    return s;
+  const char* getFormattedBeerWeight(float beerWeight) {
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_BEER,
+             myConfig.getWeightPrecision(), beerWeight,
+             myConfig.getWeightUnit());
+    return &_buf[0];
   }
 
-  String getFormattedBeerVolume(float beerVolume) {
-    convertFloatToString(beerVolume, &_buf[0], myConfig.getVolumePrecision());
-    String s(_buf);
-    s.trim();
-    s = "Beer " + s + " " + String(myConfig.getVolumeUnit());
-    return s;
+  const char* getFormattedBeerVolume(float beerVolume) {
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_BEER,
+             myConfig.getVolumePrecision(), beerVolume,
+             myConfig.getVolumeUnit());
+    return &_buf[0];
   }
 
-  String getFormattedGlasses(float glass) {
-    snprintf(&_buf[0], sizeof(_buf), "%.1f glasses", glass);
-    return String(_buf);
+  const char* getFormattedGlasses(float glass) {
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_GLASSES, glass);
+    return &_buf[0];
   }
 
-  String getFormattedPour(float pour) {
-    snprintf(&_buf[0], sizeof(_buf), "%.0f pour", pour * 100);
-    return String(_buf);
+  const char* getFormattedPour(float pour) {
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_POUR, pour * 100);
+    return &_buf[0];
   }
 
-  String getFormattedTemp(float tempC) {
-    if (isnan(tempC)) return String("No temperature");
+  const char* getFormattedTemp(float tempC) {
+    if (isnan(tempC)) return "No temperature";
 
     if (myConfig.getTempFormat() == 'F') tempC = convertCtoF(tempC);
 
-    convertFloatToString(tempC, &_buf[0], 2);
-    String s(_buf);
-    s.trim();
-    s += " " + String(myConfig.getTempFormat());
-    return s;
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_TEMP, tempC,
+             myConfig.getTempFormat());
+    return &_buf[0];
   }
 
-  String getFormattedStableLevel(bool stable) {
-    if (stable) return String("Stable level");
-
-    return String("Searching level");
+  const char* getFormattedStableLevel(bool stable) {
+    return stable ? "Stable level" : "Searching level";
   }
 
-  String getFormattedWifiName() { return myConfig.getWifiSSID(0); }
+  const char* getFormattedWifiName() { return myConfig.getWifiSSID(0); }
 
-  String getFormattedIP() { return myWifi.getIPAddress(); }
+  const char* getFormattedIP() {
+    IPAddress ip = WiFi.localIP();
+    snprintf(&_buf[0], sizeof(_buf), DISPLAY_FMT_IP, ip[0], ip[1], ip[2],
+             ip[3]);
+    return &_buf[0];
+  }
 
   void showDefault(UnitIndex idx, bool isScaleConnected, float beerWeight,
                    float glasses, float pour, float temp, bool stableLevel);
+  void drawSparkline(UnitIndex idx, int y, int h);
+
   void showGraph(UnitIndex idx, bool isScaleConnected, float beerVolume,
                  float pour);
   void showGraphOne(UnitIndex idx, bool isScaleConnected, float beerVolume,
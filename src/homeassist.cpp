@@ -24,6 +24,7 @@ SOFTWARE.
 #include <homeassist.hpp>
 #include <kegconfig.hpp>
 #include <log.hpp>
+#include <perfstats.hpp>
 #include <scale.hpp>
 #include <templating.hpp>
 #include <utils.hpp>
@@ -31,7 +32,9 @@ SOFTWARE.
 const char *volumeTemplate =
     "kegmon/${mdns}_volume${tap}/state:${volume}|"
     "kegmon/${mdns}_volume${tap}/"
-    "attr:{\"glasses\":${glasses}}|"
+    "attr:{\"glasses\":${glasses}}|";
+
+const char *volumeConfigTemplate =
     "homeassistant/sensor/${mdns}_volume${tap}/"
     "config:{\"device_class\":\"volume\",\"name\":\"${mdns}_volume${tap}\","
     "\"unit_of_measurement\":\"L\",\"state_topic\":\"kegmon/"
@@ -47,7 +50,9 @@ const char *beerTemplate =
     "kegmon/${mdns}_beer${tap}/"
     "attr:{\"abv\":${beer-abv},\"abv\":${beer-abv},\"ibu\":${beer-ibu},\"ebc\":"
     "${beer-"
-    "ebc}}|"
+    "ebc}}|";
+
+const char *beerConfigTemplate =
     "homeassistant/sensor/${mdns}_beer${tap}/config:"
     "{\"name\":\"${mdns}_beer${tap}\",\"state_topic\":\"kegmon/"
     "${mdns}_beer${tap}/state\",\"json_attributes_topic\":\"kegmon/"
@@ -57,8 +62,9 @@ const char *beerTemplate =
     "\"model\": \"kegmon\", \"manufacturer\": \"mp-se\", \"sw_version\": "
     "\"${sw-ver}\" } }|";
 
-const char *pourTemplate =
-    "kegmon/${mdns}_pour${tap}/state:${pour}|"
+const char *pourTemplate = "kegmon/${mdns}_pour${tap}/state:${pour}|";
+
+const char *pourConfigTemplate =
     "homeassistant/sensor/${mdns}_pour${tap}/config:"
     "{\"device_class\":\"volume\",\"name\":\"${mdns}_pour${tap}\",\"unit_of_"
     "measurement\":\"L\",\"state_topic\":\"kegmon/"
@@ -67,8 +73,13 @@ const char *pourTemplate =
     "\"model\": \"kegmon\", \"manufacturer\": \"mp-se\", \"sw_version\": "
     "\"${sw-ver}\" } }|";
 
-const char *tempTemplate =
-    "kegmon/${mdns}_temp/state:${temp}|"
+const char *tempTemplate = "kegmon/${mdns}_temp/state:${temp}|";
+
+const TemplateSlot volumeSlots[] = {{"${volume}", 3}, {"${glasses}", 1}};
+const TemplateSlot pourSlots[] = {{"${pour}", 3}};
+const TemplateSlot tempSlots[] = {{"${temp}", 2}};
+
+const char *tempConfigTemplate =
     "homeassistant/sensor/${mdns}_temp/config:"
     "{\"device_class\":\"temperature\",\"name\":\"${mdns}_temp\",\"unit_of_"
     "measurement\":\"${temp-format}\",\"state_topic\":\"kegmon/"
@@ -77,90 +88,154 @@ const char *tempTemplate =
     "\"model\": \"kegmon\", \"manufacturer\": \"mp-se\", \"sw_version\": "
     "\"${sw-ver}\" } }|";
 
-void HomeAssist::sendTempInformation(float tempC) {
-  if (!myConfig.hasTargetMqtt()) return;
-  if (isnan(tempC)) return;
+bool HomeAssist::publish(const char *out, bool discovery) {
+  size_t len = strlen(out);
 
-  TemplatingEngine tpl;
+  EspSerial.print(out);
+  EspSerial.print(CR);
+  _payload = out;  // Keeps the capacity between updates
+  _push->sendMqtt(_payload);
 
-  tpl.setVal("${mdns}", myConfig.getMDNS());
-  tpl.setVal("${sw-ver}", CFG_APPVER);
-  tpl.setVal("${id}", myConfig.getID());
+  if (discovery) {
+    _discoveryBytes += len;
+  } else {
+    _stateBytes += len;
+    _lastBytes += len;
+  }
 
-  // if (myConfig.isTempFormatC()) {
-  tpl.setVal("${temp}", tempC);
-  tpl.setVal("${temp-format}", "°C");
-  // } else {
-  //  tpl.setVal("${temp}", convertCtoF(tempC));
-  //  tpl.setVal("${temp-format}", "°F");
-  // }
+  return _push->wasLastSuccessful();
+}
 
-  const char *out = tpl.create(tempTemplate);
-  EspSerial.print(out);
-  EspSerial.print(CR);
-  String outStr(out);
-  _push->sendMqtt(outStr);
+bool HomeAssist::publishState(const MqttTemplate &tpl, const char *source,
+                              int tap, const TemplateSlot *slots, int count,
+                              const float *values) {
+  if (!tpl.isCompiled()) {
+    TemplatingEngine engine;
 
-  Log.notice(F("HA  : Sending temp information to HA, last %FC" CR), tempC);
+    engine.setVal("${mdns}", myConfig.getMDNS());
+    engine.setVal("${tap}", tap);
+
+    for (int i = 0; i < count; i++)
+      engine.setVal(slots[i].key, values[i], slots[i].decimals);
+
+    bool ok = publish(engine.create(source), false);
+    engine.freeMemory();
+    return ok;
+  }
+
+  PERF_BEGIN("push-ha-render");
+  int len = tpl.render(&_buf[0], sizeof(_buf), values);
+  PERF_END("push-ha-render");
 
-  tpl.freeMemory();
+  if (len < 0) {
+    Log.error(F("HA  : Update does not fit in the buffer." CR));
+    return true;  // Retrying will not help
+  }
+
+  return publish(&_buf[0], false);
 }
 
-void HomeAssist::sendTapInformation(UnitIndex idx, float stableVol,
-                                    float glasses) {
-  if (!myConfig.hasTargetMqtt()) return;
-
-  TemplatingEngine tpl;
-
-  tpl.setVal("${mdns}", myConfig.getMDNS());
-  tpl.setVal("${sw-ver}", CFG_APPVER);
-  tpl.setVal("${id}", myConfig.getID());
-  tpl.setVal("${volume}", stableVol, 3);
-  tpl.setVal("${glasses}", glasses, 1);
-  tpl.setVal("${tap}", static_cast<int>(idx) + 1);
-  tpl.setVal("${beer-name}", myConfig.getBeerName(idx));
-  tpl.setVal("${beer-abv}", myConfig.getBeerABV(idx));
-  tpl.setVal("${beer-ibu}", myConfig.getBeerIBU(idx));
-  tpl.setVal("${beer-ebc}", myConfig.getBeerEBC(idx));
-
-  const char *out = tpl.create(volumeTemplate);
-  EspSerial.print(out);
-  EspSerial.print(CR);
-  String outStr(out);
-  _push->sendMqtt(outStr);
+void HomeAssist::compile() {
+  TemplateVar vars[] = {{"${mdns}", myConfig.getMDNS()}, {"${tap}", "1"}};
+  bool ok = _tempTpl.compile(tempTemplate, &vars[0], 1, &tempSlots[0], 1);
 
-  Log.notice(F("HA  : Sending TAP information to HA, last %Fl [%d]" CR),
-             stableVol);
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    vars[1].value = idx == UnitIndex::U1 ? "1" : "2";
+    ok &= _volumeTpl[idx].compile(volumeTemplate, &vars[0], 2,
+                                  &volumeSlots[0], 2);
+    ok &= _pourTpl[idx].compile(pourTemplate, &vars[0], 2, &pourSlots[0], 1);
+  }
 
-  out = tpl.create(beerTemplate);
-  EspSerial.print(out);
-  EspSerial.print(CR);
-  outStr = out;
-  _push->sendMqtt(outStr);
+  // Tried again with the next update, until then the templating engine is
+  // used for the ones that failed
+  if (!ok) Log.error(F("HA  : Failed to compile mqtt templates." CR));
+
+  _compiled = ok;
+}
+
+// The broker keeps the retained config topics so this is only needed once,
+// if any part fails everything is sent again with the next update.
+bool HomeAssist::sendDiscovery() {
+  bool ok;
+
+  {
+    TemplatingEngine tpl;
+
+    tpl.setVal("${mdns}", myConfig.getMDNS());
+    tpl.setVal("${sw-ver}", CFG_APPVER);
+    tpl.setVal("${id}", myConfig.getID());
+    tpl.setVal("${temp-format}", "°C");
+    ok = publish(tpl.create(tempConfigTemplate), true);
+    tpl.freeMemory();
+  }
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    TemplatingEngine tpl;
+
+    tpl.setVal("${mdns}", myConfig.getMDNS());
+    tpl.setVal("${sw-ver}", CFG_APPVER);
+    tpl.setVal("${id}", myConfig.getID());
+    tpl.setVal("${tap}", static_cast<int>(idx) + 1);
+    tpl.setVal("${beer-name}", myConfig.getBeerName(idx));
+    tpl.setVal("${beer-abv}", myConfig.getBeerABV(idx));
+    tpl.setVal("${beer-ibu}", myConfig.getBeerIBU(idx));
+    tpl.setVal("${beer-ebc}", myConfig.getBeerEBC(idx));
+
+    ok = publish(tpl.create(volumeConfigTemplate), true) && ok;
+    ok = publish(tpl.create(pourConfigTemplate), true) && ok;
+    ok = publish(tpl.create(beerConfigTemplate), true) && ok;
+    ok = publish(tpl.create(beerTemplate), true) && ok;
+    tpl.freeMemory();
+  }
+
+  Log.notice(F("HA  : Published discovery information to HA." CR));
+  _discovery = ok;
+  return ok;
+}
+
+bool HomeAssist::sendTempInformation(float tempC) {
+  if (!myConfig.hasTargetMqtt()) return true;
+  if (isnan(tempC)) return true;
+  if (!_discovery && !sendDiscovery()) return false;
+  if (!_compiled) compile();
+
+  // if (!myConfig.isTempFormatC()) tempC = convertCtoF(tempC);
 
-  tpl.freeMemory();
+  _lastBytes = 0;
+  bool ok = publishState(_tempTpl, tempTemplate, 0, &tempSlots[0], 1, &tempC);
+
+  Log.notice(F("HA  : Sending temp information to HA, last %FC" CR), tempC);
+  return ok;
 }
 
-void HomeAssist::sendPourInformation(UnitIndex idx, float pourVol) {
-  if (!myConfig.hasTargetMqtt()) return;
+bool HomeAssist::sendTapInformation(UnitIndex idx, float stableVol,
+                                    float glasses) {
+  if (!myConfig.hasTargetMqtt()) return true;
+  if (!_discovery && !sendDiscovery()) return false;
+  if (!_compiled) compile();
 
-  TemplatingEngine tpl;
+  const float values[] = {stableVol, glasses};
 
-  tpl.setVal("${mdns}", myConfig.getMDNS());
-  tpl.setVal("${sw-ver}", CFG_APPVER);
-  tpl.setVal("${id}", myConfig.getID());
-  tpl.setVal("${pour}", pourVol, 3);
-  tpl.setVal("${tap}", static_cast<int>(idx) + 1);
+  _lastBytes = 0;
+  bool ok = publishState(_volumeTpl[idx], volumeTemplate, idx + 1,
+                         &volumeSlots[0], 2, &values[0]);
+
+  Log.notice(F("HA  : Sending TAP information to HA, last %Fl [%d]" CR),
+             stableVol, idx);
+  return ok;
+}
+
+bool HomeAssist::sendPourInformation(UnitIndex idx, float pourVol) {
+  if (!myConfig.hasTargetMqtt()) return true;
+  if (!_discovery && !sendDiscovery()) return false;
+  if (!_compiled) compile();
 
   Log.notice(F("HA  : Sending POUR information to HA, pour %Fl [%d]." CR),
              pourVol, idx);
 
-  const char *out = tpl.create(pourTemplate);
-  EspSerial.print(out);
-  EspSerial.print(CR);
-  String outStr(out);
-  _push->sendMqtt(outStr);
-  tpl.freeMemory();
+  _lastBytes = 0;
+  return publishState(_pourTpl[idx], pourTemplate, idx + 1, &pourSlots[0], 1,
+                      &pourVol);
 }
 
 // EOF
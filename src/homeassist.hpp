@@ -26,17 +26,48 @@ SOFTWARE.
 
 #include <basepush.hpp>
 #include <main.hpp>
+#include <mqtttemplate.hpp>
 
+// The discovery payloads (config topics) and the beer information are
+// published once, before the first update after boot or a change of the beer
+// configuration. Regular updates only publish the state and attr topics,
+// these templates are compiled once and rendered into a fixed buffer. A
+// template that can't be compiled is rendered with the templating engine.
 class HomeAssist {
  protected:
   BasePush *_push;
+  bool _discovery = false;
+  bool _compiled = false;
+  MqttTemplate _volumeTpl[2];
+  MqttTemplate _pourTpl[2];
+  MqttTemplate _tempTpl;
+  char _buf[MQTT_TEMPLATE_TEXT + 2 * MQTT_TEMPLATE_VALUE];
+  String _payload;
+  uint32_t _stateBytes = 0;
+  uint32_t _discoveryBytes = 0;
+  uint32_t _lastBytes = 0;
+
+  bool publish(const char *out, bool discovery);
+  bool publishState(const MqttTemplate &tpl, const char *source, int tap,
+                    const TemplateSlot *slots, int count, const float *values);
+  bool sendDiscovery();
+  void compile();
 
  public:
   explicit HomeAssist(BasePush *push) { _push = push; }
 
-  void sendTempInformation(float tempC);
-  void sendTapInformation(UnitIndex idx, float stableVol, float glasses);
-  void sendPourInformation(UnitIndex idx, float pourVol);
+  // Returns false if publishing failed, true when sent or not configured
+  bool sendTempInformation(float tempC);
+  bool sendTapInformation(UnitIndex idx, float stableVol, float glasses);
+  bool sendPourInformation(UnitIndex idx, float pourVol);
+
+  void requestDiscovery() {
+    _discovery = false;
+    _compiled = false;
+  }
+  uint32_t getStateBytes() const { return _stateBytes; }
+  uint32_t getDiscoveryBytes() const { return _discoveryBytes; }
+  uint32_t getLastBytes() const { return _lastBytes; }
 };
 
 #endif  // SRC_HOMEASSIST_HPP_
@@ -0,0 +1,174 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <influxexport.hpp>
+#include <kegconfig.hpp>
+#include <perfstats.hpp>
+
+// The target from the build flags is used when none is configured
+static bool useBuildTarget() {
+#if defined(PUSH_INFLUX_TARGET)
+  return !strlen(myConfig.getTargetInfluxDB2()) && strlen(PUSH_INFLUX_TARGET);
+#else
+  return false;
+#endif
+}
+
+bool InfluxExporter::isEnabled() {
+  return strlen(myConfig.getTargetInfluxDB2()) > 0 || useBuildTarget();
+}
+
+void InfluxExporter::add(const LevelSnapshot& snap, float tempC,
+                         float humidity) {
+  if (!isEnabled()) return;
+
+  PERF_BEGIN("influx-add");
+  time_t t = time(nullptr);
+  uint32_t ts = t > INFLUX_MIN_TIME ? static_cast<uint32_t>(t) : 0;
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    const TapSnapshot& tap = snap.tap[idx];
+
+    if (!tap.connected) continue;
+
+    _lines.beginLine("level");
+    _lines.tag("host", myConfig.getMDNS());
+    _lines.tag("device", myConfig.getID());
+    _lines.tag("tap", idx == UnitIndex::U1 ? "1" : "2");
+    _lines.fieldInt("raw", tap.raw);
+    _lines.field("level-raw", tap.rawValue);
+    _lines.field("level-average", tap.averageValue);
+    _lines.field("level-kalman", tap.kalmanValue);
+    _lines.field("level-temp", tap.tempCorrValue);
+    _lines.field("level-slope", tap.slopeValue, 5);
+    _lines.field("level-stats", tap.statsValue);
+    _lines.field("stable-weight", tap.totalStableWeight);
+    _lines.field("beer-volume", tap.beerVolume);
+    _lines.field("pour-volume", tap.pourVolume);
+    _lines.field("glasses", tap.stableGlasses, 1);
+    if (!_lines.endLine(ts)) _dropped++;
+  }
+
+  _lines.beginLine("temp");
+  _lines.tag("host", myConfig.getMDNS());
+  _lines.tag("device", myConfig.getID());
+  _lines.field("tempC", tempC, 2);
+  _lines.field("humidity", humidity, 1);
+
+  // A line without fields is skipped when there is no sensor
+  if (!_lines.endLine(ts) && (!isnan(tempC) || !isnan(humidity))) _dropped++;
+
+  if (!_ticks++) _first = millis();
+
+  // Without a timestamp the lines would get the same time on the server
+  if (!ts) _ticks = INFLUX_BATCH_TICKS;
+  PERF_END("influx-add");
+}
+
+bool InfluxExporter::isDue(uint32_t now) const {
+  if (!_lines.getLines()) return false;
+
+  return _ticks >= INFLUX_BATCH_TICKS ||
+         _lines.length() > INFLUX_BUFFER_SIZE * 3 / 4 ||
+         now - _first >= INFLUX_FLUSH_INTERVAL;
+}
+
+// Same request as the push library makes, v2 write api with the data in
+// line protocol and the time in ns.
+bool InfluxExporter::post(const char* target, const char* org,
+                          const char* bucket, const char* token) {
+  String url(target);
+  bool ok;
+
+  url += "/api/v2/write?org=";
+  url += org;
+  url += "&bucket=";
+  url += bucket;
+
+  ok = !strncmp(target, "https:", 6) ? _http.begin(_secureClient, url)
+                                     : _http.begin(_client, url);
+
+  if (!ok) {
+    Log.error(F("PUSH: Invalid influxdb url %s." CR), target);
+    return false;
+  }
+
+  String auth("Token ");
+  auth += token;
+  _http.addHeader("Authorization", auth);
+  _http.addHeader("Content-Type", "text/plain");
+
+  int code = _http.POST(
+      reinterpret_cast<uint8_t*>(const_cast<char*>(_lines.c_str())),
+      _lines.length());
+  _http.end();
+
+  if (code < 200 || code > 299) {
+    Log.error(F("PUSH: Influxdb returned %d." CR), code);
+    return false;
+  }
+
+  return true;
+}
+
+void InfluxExporter::loop() {
+  if (!isDue(millis())) return;
+
+  if (!WiFi.isConnected()) {
+    _dropped += _lines.getLines();
+    _lines.clear();
+    _ticks = 0;
+    return;
+  }
+
+  bool ok;
+
+  PERF_BEGIN("influx-post");
+#if defined(PUSH_INFLUX_TARGET)
+  if (useBuildTarget())
+    ok = post(PUSH_INFLUX_TARGET, PUSH_INFLUX_ORG, PUSH_INFLUX_BUCKET,
+              PUSH_INFLUX_TOKEN);
+  else
+#endif
+    ok = post(myConfig.getTargetInfluxDB2(), myConfig.getOrgInfluxDB2(),
+              myConfig.getBucketInfluxDB2(), myConfig.getTokenInfluxDB2());
+  PERF_END("influx-post");
+
+  if (ok) {
+    _posted += _lines.getLines();
+  } else {
+    _failed++;
+    _dropped += _lines.getLines();
+    Log.warning(F("PUSH: Failed to post %d lines to influxdb." CR),
+                _lines.getLines());
+  }
+
+#if LOG_LEVEL == 6
+  Log.verbose(F("PUSH: Posted %d lines (%d bytes) to influxdb." CR),
+              _lines.getLines(), _lines.length());
+#endif
+  _lines.clear();
+  _ticks = 0;
+}
+
+// EOF
@@ -0,0 +1,98 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_INFLUXEXPORT_HPP_
+#define SRC_INFLUXEXPORT_HPP_
+
+#if defined(ESP8266)
+#include <ESP8266HTTPClient.h>
+#else
+#include <HTTPClient.h>
+#endif
+#include <WiFiClientSecure.h>
+
+#include <acquisition.hpp>
+#include <lineprotocol.hpp>
+#include <main.hpp>
+
+#if defined(ESP8266)
+constexpr auto INFLUX_BUFFER_SIZE = 2048;
+#else
+constexpr auto INFLUX_BUFFER_SIZE = 4096;
+#endif
+constexpr auto INFLUX_BATCH_TICKS = 5;         // level updates per post
+constexpr auto INFLUX_FLUSH_INTERVAL = 30000;  // ms, post a partial batch
+constexpr auto INFLUX_MIN_TIME = 1600000000;   // Older means no time sync
+constexpr auto INFLUX_POST_TIMEOUT = 1000;     // ms, the post blocks the loop
+
+// Exports every level update (all detection stages per tap and the
+// temperature) to influxdb. add() only writes line protocol into a fixed
+// buffer, loop() posts the collected lines as one request when the batch is
+// complete, the buffer is getting full or the oldest line has waited too
+// long. Active when an influxdb target is configured or set with the
+// PUSH_INFLUX_* build flags. Dropped counts lines that were never posted.
+//
+// The post is sent from the buffer with a client of its own and a short
+// timeout, it blocks the main loop while it runs. On the ESP8266 the scales
+// are read in the main loop so the post is only started when the level task
+// is not due within the timeout, see taskInflux().
+class InfluxExporter {
+ private:
+  char _buf[INFLUX_BUFFER_SIZE];
+  LineProtocol _lines;
+  HTTPClient _http;
+  WiFiClient _client;
+  WiFiClientSecure _secureClient;
+  int _ticks = 0;
+  uint32_t _first = 0;  // ms when the oldest line was added
+  uint32_t _posted = 0;
+  uint32_t _failed = 0;
+  uint32_t _dropped = 0;
+
+  InfluxExporter(const InfluxExporter&) = delete;
+  void operator=(const InfluxExporter&) = delete;
+
+  bool isDue(uint32_t now) const;
+  bool post(const char* target, const char* org, const char* bucket,
+            const char* token);
+
+ public:
+  InfluxExporter() : _lines(&_buf[0], sizeof(_buf)) {
+    _http.setTimeout(INFLUX_POST_TIMEOUT);
+    _secureClient.setInsecure();
+  }
+
+  bool isEnabled();
+  void add(const LevelSnapshot& snap, float tempC, float humidity);
+  void loop();
+
+  uint32_t getPosted() const { return _posted; }
+  uint32_t getFailed() const { return _failed; }
+  uint32_t getDropped() const { return _dropped; }
+};
+
+extern InfluxExporter myInflux;
+
+#endif  // SRC_INFLUXEXPORT_HPP_
+
+// EOF
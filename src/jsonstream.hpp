@@ -0,0 +1,150 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_JSONSTREAM_HPP_
+#define SRC_JSONSTREAM_HPP_
+
+#include <Arduino.h>
+
+constexpr auto JSONSTREAM_MAX_DEPTH = 8;
+
+// Writes a JSON document directly to a Print target (web response, serial,
+// file) without building a document or string in memory first. Pass a null
+// key for values inside an array. Invalid floats (nan/inf) are written as
+// null since they are not valid JSON.
+class JsonStream {
+ private:
+  Print& _out;
+  uint8_t _depth = 0;
+  bool _first[JSONSTREAM_MAX_DEPTH];
+
+  void separator() {
+    if (_depth && !_first[_depth - 1]) _out.write(',');
+    if (_depth) _first[_depth - 1] = false;
+  }
+
+  void string(const char* s) {
+    _out.write('"');
+
+    for (; *s; s++) {
+      char c = *s;
+
+      if (c == '"' || c == '\\') {
+        _out.write('\\');
+        _out.write(c);
+      } else if (static_cast<uint8_t>(c) < 0x20) {
+        char esc[7];
+        snprintf(&esc[0], sizeof(esc), "\\u%04x", c);
+        _out.print(&esc[0]);
+      } else {
+        _out.write(c);
+      }
+    }
+
+    _out.write('"');
+  }
+
+  void key(const char* k) {
+    separator();
+
+    if (k) {
+      string(k);
+      _out.write(':');
+    }
+  }
+
+  void open(const char* k, char c) {
+    key(k);
+    _out.write(c);
+    if (_depth < JSONSTREAM_MAX_DEPTH) _first[_depth++] = true;
+  }
+
+  void close(char c) {
+    if (_depth) _depth--;
+    _out.write(c);
+  }
+
+ public:
+  explicit JsonStream(Print& out) : _out(out) {}
+
+  void beginObject(const char* k = 0) { open(k, '{'); }
+  void endObject() { close('}'); }
+  void beginArray(const char* k = 0) { open(k, '['); }
+  void endArray() { close(']'); }
+
+  void add(const char* k, const char* v) {
+    key(k);
+    string(v);
+  }
+  void add(const char* k, const String& v) { add(k, v.c_str()); }
+  void add(const char* k, bool v) {
+    key(k);
+    _out.print(v ? "true" : "false");
+  }
+  void add(const char* k, int v) { add(k, static_cast<long>(v)); }
+  void add(const char* k, unsigned int v) {
+    add(k, static_cast<unsigned long>(v));
+  }
+  void add(const char* k, long v) {
+    key(k);
+    _out.print(v);
+  }
+  void add(const char* k, unsigned long v) {
+    key(k);
+    _out.print(v);
+  }
+  void add(const char* k, float v, int decimals) {
+    key(k);
+
+    if (isnan(v) || isinf(v))
+      _out.print("null");
+    else
+      _out.print(v, decimals);
+  }
+};
+
+// Print target for small documents that writes into a fixed buffer, output
+// that does not fit is dropped. The content is always null terminated.
+template <size_t N>
+class JsonBuffer : public Print {
+ private:
+  char _buf[N];
+  size_t _len = 0;
+
+ public:
+  JsonBuffer() { _buf[0] = 0; }
+
+  size_t write(uint8_t c) override {
+    if (_len >= N - 1) return 0;
+    _buf[_len++] = c;
+    _buf[_len] = 0;
+    return 1;
+  }
+
+  const char* c_str() const { return &_buf[0]; }
+  size_t length() const { return _len; }
+};
+
+#endif  // SRC_JSONSTREAM_HPP_
+
+// EOF
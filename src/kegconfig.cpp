@@ -44,7 +44,8 @@ void KegConfig::createJson(DynamicJsonDocument& doc, bool skipSecrets) {
 
   doc[PARAM_DISPLAY_LAYOUT] = getDisplayLayoutTypeAsInt();
   doc[PARAM_TEMP_SENSOR] = getTempSensorTypeAsInt();
-  doc[PARAM_SCALE_SENSOR] = getScaleSensorTypeAsInt();
+  doc[PARAM_SCALE_SENSOR] = getScaleSensorTypeAsInt(UnitIndex::U1);
+  doc[PARAM_SCALE_SENSOR2] = getScaleSensorTypeAsInt(UnitIndex::U2);
   doc[PARAM_DISPLAY_DRIVER] = getDisplayDriverTypeAsInt();
   // doc[PARAM_LEVEL_DETECTION] = getLevelDetectionAsInt();
 
@@ -54,11 +55,27 @@ void KegConfig::createJson(DynamicJsonDocument& doc, bool skipSecrets) {
   doc[PARAM_BREWSPY_TOKEN1] = getBrewspyToken(UnitIndex::U1);
   doc[PARAM_BREWSPY_TOKEN2] = getBrewspyToken(UnitIndex::U2);
 
+  doc[PARAM_WEBHOOK_POST_TARGET] = getTargetHttpPost();
+  doc[PARAM_WEBHOOK_POST_HEADER1] = getHeader1HttpPost();
+  doc[PARAM_WEBHOOK_POST_HEADER2] = getHeader2HttpPost();
+  doc[PARAM_WEBHOOK_POST_FORMAT] = getFormatHttpPost();
+  doc[PARAM_WEBHOOK_GET_TARGET] = getTargetHttpGet();
+  doc[PARAM_WEBHOOK_GET_HEADER1] = getHeader1HttpGet();
+  doc[PARAM_WEBHOOK_GET_HEADER2] = getHeader2HttpGet();
+  doc[PARAM_WEBHOOK_GET_FORMAT] = getFormatHttpGet();
+
+  doc[PARAM_INFLUXDB2_TARGET] = getTargetInfluxDB2();
+  doc[PARAM_INFLUXDB2_ORG] = getOrgInfluxDB2();
+  doc[PARAM_INFLUXDB2_BUCKET] = getBucketInfluxDB2();
+  doc[PARAM_INFLUXDB2_TOKEN] = getTokenInfluxDB2();
+
   doc[PARAM_SCALE_TEMP_FORMULA1] =
       getScaleTempCompensationFormula(UnitIndex::U1);
   doc[PARAM_SCALE_FACTOR1] =
       serialized(String(getScaleFactor(UnitIndex::U1), 5));
   doc[PARAM_SCALE_OFFSET1] = getScaleOffset(UnitIndex::U1);
+  createJsonCalibration(doc.createNestedArray(PARAM_SCALE_CALIBRATION1),
+                        UnitIndex::U1);
   doc[PARAM_KEG_WEIGHT1] =
       serialized(String(convertOutgoingWeight(getKegWeight(UnitIndex::U1)),
                         getWeightPrecision()));
@@ -79,6 +96,8 @@ void KegConfig::createJson(DynamicJsonDocument& doc, bool skipSecrets) {
   doc[PARAM_SCALE_FACTOR2] =
       serialized(String(getScaleFactor(UnitIndex::U2), 5));
   doc[PARAM_SCALE_OFFSET2] = getScaleOffset(UnitIndex::U2);
+  createJsonCalibration(doc.createNestedArray(PARAM_SCALE_CALIBRATION2),
+                        UnitIndex::U2);
   doc[PARAM_KEG_WEIGHT2] =
       serialized(String(convertOutgoingWeight(getKegWeight(UnitIndex::U2)),
                         getWeightPrecision()));
@@ -127,6 +146,33 @@ void KegConfig::createJson(DynamicJsonDocument& doc, bool skipSecrets) {
   */
 }
 
+void KegConfig::createJsonCalibration(JsonArray arr, UnitIndex idx) {
+  const CalibrationTable& cal = getScaleCalibration(idx);
+
+  // The zero point is implicit and is not stored
+  for (int i = 0; i < cal.size(); i++) {
+    if (cal.get(i).raw == 0) continue;
+
+    JsonArray point = arr.createNestedArray();
+    point.add(cal.get(i).raw);
+    point.add(serialized(String(cal.get(i).weight, 3)));
+  }
+}
+
+void KegConfig::parseJsonCalibration(JsonArray arr, UnitIndex idx) {
+  _scaleCalibration[idx].clear();
+
+  for (JsonArray point : arr) {
+    if (!_scaleCalibration[idx].add(point[0].as<int32_t>(),
+                                    point[1].as<float>())) {
+      Log.error(F("CFG : Skipping invalid calibration point %l [%d]." CR),
+                point[0].as<int32_t>(), idx);
+    }
+  }
+
+  _saveNeeded = true;
+}
+
 void KegConfig::parseJson(DynamicJsonDocument& doc) {
   // Call base class functions
   parseJsonBase(doc);
@@ -148,12 +194,45 @@ void KegConfig::parseJson(DynamicJsonDocument& doc) {
   if (!doc[PARAM_BREWSPY_TOKEN2].isNull())
     setBrewspyToken(UnitIndex::U2, doc[PARAM_BREWSPY_TOKEN2]);
 
+  if (!doc[PARAM_WEBHOOK_POST_TARGET].isNull())
+    setTargetHttpPost(doc[PARAM_WEBHOOK_POST_TARGET]);
+  if (!doc[PARAM_WEBHOOK_POST_HEADER1].isNull())
+    setHeader1HttpPost(doc[PARAM_WEBHOOK_POST_HEADER1]);
+  if (!doc[PARAM_WEBHOOK_POST_HEADER2].isNull())
+    setHeader2HttpPost(doc[PARAM_WEBHOOK_POST_HEADER2]);
+  if (!doc[PARAM_WEBHOOK_POST_FORMAT].isNull())
+    setFormatHttpPost(doc[PARAM_WEBHOOK_POST_FORMAT]);
+  if (!doc[PARAM_WEBHOOK_GET_TARGET].isNull())
+    setTargetHttpGet(doc[PARAM_WEBHOOK_GET_TARGET]);
+  if (!doc[PARAM_WEBHOOK_GET_HEADER1].isNull())
+    setHeader1HttpGet(doc[PARAM_WEBHOOK_GET_HEADER1]);
+  if (!doc[PARAM_WEBHOOK_GET_HEADER2].isNull())
+    setHeader2HttpGet(doc[PARAM_WEBHOOK_GET_HEADER2]);
+  if (!doc[PARAM_WEBHOOK_GET_FORMAT].isNull())
+    setFormatHttpGet(doc[PARAM_WEBHOOK_GET_FORMAT]);
+
+  if (!doc[PARAM_INFLUXDB2_TARGET].isNull())
+    setTargetInfluxDB2(doc[PARAM_INFLUXDB2_TARGET]);
+  if (!doc[PARAM_INFLUXDB2_ORG].isNull())
+    setOrgInfluxDB2(doc[PARAM_INFLUXDB2_ORG]);
+  if (!doc[PARAM_INFLUXDB2_BUCKET].isNull())
+    setBucketInfluxDB2(doc[PARAM_INFLUXDB2_BUCKET]);
+  if (!doc[PARAM_INFLUXDB2_TOKEN].isNull())
+    setTokenInfluxDB2(doc[PARAM_INFLUXDB2_TOKEN]);
+
   if (!doc[PARAM_DISPLAY_LAYOUT].isNull())
     setDisplayLayoutType(doc[PARAM_DISPLAY_LAYOUT].as<int>());
   if (!doc[PARAM_TEMP_SENSOR].isNull())
     setTempSensorType(doc[PARAM_TEMP_SENSOR].as<int>());
-  if (!doc[PARAM_SCALE_SENSOR].isNull())
-    setScaleSensorType(doc[PARAM_SCALE_SENSOR].as<int>());
+  if (!doc[PARAM_SCALE_SENSOR].isNull()) {
+    setScaleSensorType(UnitIndex::U1, doc[PARAM_SCALE_SENSOR].as<int>());
+
+    // Older configurations only have one sensor type for both taps
+    if (doc[PARAM_SCALE_SENSOR2].isNull())
+      setScaleSensorType(UnitIndex::U2, doc[PARAM_SCALE_SENSOR].as<int>());
+  }
+  if (!doc[PARAM_SCALE_SENSOR2].isNull())
+    setScaleSensorType(UnitIndex::U2, doc[PARAM_SCALE_SENSOR2].as<int>());
   if (!doc[PARAM_DISPLAY_DRIVER].isNull())
     setDisplayDriverType(doc[PARAM_DISPLAY_DRIVER].as<int>());
 
@@ -167,6 +246,8 @@ void KegConfig::parseJson(DynamicJsonDocument& doc) {
     setScaleFactor(UnitIndex::U1, doc[PARAM_SCALE_FACTOR1].as<float>());
   if (!doc[PARAM_SCALE_OFFSET1].isNull())
     setScaleOffset(UnitIndex::U1, doc[PARAM_SCALE_OFFSET1].as<float>());
+  if (doc[PARAM_SCALE_CALIBRATION1].is<JsonArray>())
+    parseJsonCalibration(doc[PARAM_SCALE_CALIBRATION1], UnitIndex::U1);
   if (!doc[PARAM_KEG_WEIGHT1].isNull())
     setKegWeight(UnitIndex::U1,
                  convertIncomingWeight(doc[PARAM_KEG_WEIGHT1].as<float>()));
@@ -198,6 +279,8 @@ void KegConfig::parseJson(DynamicJsonDocument& doc) {
     setScaleFactor(UnitIndex::U2, doc[PARAM_SCALE_FACTOR2].as<float>());
   if (!doc[PARAM_SCALE_OFFSET2].isNull())
     setScaleOffset(UnitIndex::U2, doc[PARAM_SCALE_OFFSET2].as<float>());
+  if (doc[PARAM_SCALE_CALIBRATION2].is<JsonArray>())
+    parseJsonCalibration(doc[PARAM_SCALE_CALIBRATION2], UnitIndex::U2);
   if (!doc[PARAM_KEG_WEIGHT2].isNull())
     setKegWeight(UnitIndex::U2,
                  convertIncomingWeight(doc[PARAM_KEG_WEIGHT2].as<float>()));
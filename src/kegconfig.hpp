@@ -25,16 +25,30 @@ SOFTWARE.
 #define SRC_KEGCONFIG_HPP_
 
 #include <baseconfig.hpp>
+#include <calibration.hpp>
 #include <main.hpp>
 
 constexpr auto PARAM_BREWFATHER_USERKEY = "brewfather-userkey";
 constexpr auto PARAM_BREWFATHER_APIKEY = "brewfather-apikey";
 constexpr auto PARAM_BREWSPY_TOKEN1 = "brewspy-token1";
 constexpr auto PARAM_BREWSPY_TOKEN2 = "brewspy-token2";
+constexpr auto PARAM_WEBHOOK_POST_TARGET = "http-post-target";
+constexpr auto PARAM_WEBHOOK_POST_HEADER1 = "http-post-header1";
+constexpr auto PARAM_WEBHOOK_POST_HEADER2 = "http-post-header2";
+constexpr auto PARAM_WEBHOOK_POST_FORMAT = "http-post-format";
+constexpr auto PARAM_WEBHOOK_GET_TARGET = "http-get-target";
+constexpr auto PARAM_WEBHOOK_GET_HEADER1 = "http-get-header1";
+constexpr auto PARAM_WEBHOOK_GET_HEADER2 = "http-get-header2";
+constexpr auto PARAM_WEBHOOK_GET_FORMAT = "http-get-format";
+constexpr auto PARAM_INFLUXDB2_TARGET = "influxdb2-target";
+constexpr auto PARAM_INFLUXDB2_ORG = "influxdb2-org";
+constexpr auto PARAM_INFLUXDB2_BUCKET = "influxdb2-bucket";
+constexpr auto PARAM_INFLUXDB2_TOKEN = "influxdb2-token";
 constexpr auto PARAM_DISPLAY_LAYOUT = "display-layout";
 constexpr auto PARAM_TEMP_SENSOR = "temp-sensor";
 constexpr auto PARAM_DISPLAY_DRIVER = "display-driver";
-constexpr auto PARAM_SCALE_SENSOR = "scale-sensor";
+constexpr auto PARAM_SCALE_SENSOR = "scale-sensor";  // Tap 1 (or both taps)
+constexpr auto PARAM_SCALE_SENSOR2 = "scale-sensor2";
 constexpr auto PARAM_WEIGHT_UNIT = "weight-unit";
 constexpr auto PARAM_VOLUME_UNIT = "volume-unit";
 constexpr auto PARAM_KEG_WEIGHT1 = "keg-weight1";
@@ -57,6 +71,8 @@ constexpr auto PARAM_SCALE_FACTOR1 = "scale-factor1";
 constexpr auto PARAM_SCALE_FACTOR2 = "scale-factor2";
 constexpr auto PARAM_SCALE_OFFSET1 = "scale-offset1";
 constexpr auto PARAM_SCALE_OFFSET2 = "scale-offset2";
+constexpr auto PARAM_SCALE_CALIBRATION1 = "scale-calibration1";
+constexpr auto PARAM_SCALE_CALIBRATION2 = "scale-calibration2";
 constexpr auto PARAM_SCALE_TEMP_FORMULA1 = "scale-temp-formula1";
 constexpr auto PARAM_SCALE_TEMP_FORMULA2 = "scale-temp-formula2";
 constexpr auto PARAM_SCALE_DEVIATION_INCREASE = "scale-deviation-increase";
@@ -125,7 +141,7 @@ enum DisplayLayoutType {
   HardwareStats = 9
 };
 enum TempSensorType { SensorDHT22 = 0, SensorDS18B20 = 1, SensorBME280 = 2 };
-enum ScaleSensorType { ScaleHX711 = 0, ScaleNAU7802 = 1 };
+enum ScaleSensorType { ScaleHX711 = 0, ScaleNAU7802 = 1, ScaleReplay = 9 };
 enum DisplayDriverType { OLED_1306 = 0, LCD = 1 };
 
 float convertIncomingWeight(float w);
@@ -144,13 +160,29 @@ class KegConfig : public BaseConfig {
 
   String _brewspyToken[2] = {"", ""};
 
+  String _targetHttpPost = "";
+  String _header1HttpPost = "";
+  String _header2HttpPost = "";
+  String _formatHttpPost = "";
+  String _targetHttpGet = "";
+  String _header1HttpGet = "";
+  String _header2HttpGet = "";
+  String _formatHttpGet = "";
+
+  String _targetInfluxDb2 = "";
+  String _orgInfluxDb2 = "";
+  String _bucketInfluxDb2 = "";
+  String _tokenInfluxDb2 = "";
+
   DisplayLayoutType _displayLayout = DisplayLayoutType::Default;
   TempSensorType _tempSensor = TempSensorType::SensorDS18B20;
-  ScaleSensorType _scaleSensor = ScaleSensorType::ScaleHX711;
+  ScaleSensorType _scaleSensor[2] = {ScaleSensorType::ScaleHX711,
+                                     ScaleSensorType::ScaleHX711};
   DisplayDriverType _displayDriver = DisplayDriverType::OLED_1306;
 
   float _scaleFactor[2] = {0, 0};
   int32_t _scaleOffset[2] = {0, 0};
+  CalibrationTable _scaleCalibration[2];
   float _kegWeight[2] = {4, 4};          // Weight in kg
   float _kegVolume[2] = {19, 19};        // Weight in liters
   float _glassVolume[2] = {0.40, 0.40};  // Volume in liters
@@ -174,6 +206,9 @@ class KegConfig : public BaseConfig {
   float _kalmanNoise = 0.01;
   */
 
+  void createJsonCalibration(JsonArray arr, UnitIndex idx);
+  void parseJsonCalibration(JsonArray arr, UnitIndex idx);
+
  public:
   KegConfig(String baseMDNS, String fileName);
 
@@ -277,6 +312,20 @@ class KegConfig : public BaseConfig {
     _saveNeeded = true;
   }
 
+  const CalibrationTable& getScaleCalibration(UnitIndex idx) {
+    return _scaleCalibration[idx];
+  }
+  bool addScaleCalibrationPoint(UnitIndex idx, int32_t raw, float weight) {
+    if (!_scaleCalibration[idx].add(raw, weight)) return false;
+
+    _saveNeeded = true;
+    return true;
+  }
+  void clearScaleCalibration(UnitIndex idx) {
+    _scaleCalibration[idx].clear();
+    _saveNeeded = true;
+  }
+
   DisplayLayoutType getDisplayLayoutType() { return _displayLayout; }
   int getDisplayLayoutTypeAsInt() { return _displayLayout; }
   void setDisplayLayoutType(DisplayLayoutType d) {
@@ -299,14 +348,16 @@ class KegConfig : public BaseConfig {
     _saveNeeded = true;
   }
 
-  ScaleSensorType getScaleSensorType() { return _scaleSensor; }
-  int getScaleSensorTypeAsInt() { return _scaleSensor; }
-  void setScaleSensorType(ScaleSensorType t) {
-    _scaleSensor = t;
+  ScaleSensorType getScaleSensorType(UnitIndex idx) {
+    return _scaleSensor[idx];
+  }
+  int getScaleSensorTypeAsInt(UnitIndex idx) { return _scaleSensor[idx]; }
+  void setScaleSensorType(UnitIndex idx, ScaleSensorType t) {
+    _scaleSensor[idx] = t;
     _saveNeeded = true;
   }
-  void setScaleSensorType(int t) {
-    _scaleSensor = (ScaleSensorType)t;
+  void setScaleSensorType(UnitIndex idx, int t) {
+    _scaleSensor[idx] = (ScaleSensorType)t;
     _saveNeeded = true;
   }
 
@@ -408,30 +459,72 @@ class KegConfig : public BaseConfig {
     _saveNeeded = true;
   }
 
-  // These settings are used for debugging and checking stability of the scales.
-  // Only influx is used for now
-  const char* getTargetHttpPost() { return ""; }
-  void setTargetHttpPost(String target) {}
-  const char* getHeader1HttpPost() { return ""; }
-  void setHeader1HttpPost(String header) {}
-  const char* getHeader2HttpPost() { return ""; }
-  void setHeader2HttpPost(String header) {}
-
-  const char* getTargetHttpGet() { return ""; }
-  void setTargetHttpGet(String target) {}
-  const char* getHeader1HttpGet() { return ""; }
-  void setHeader1HttpGet(String header) {}
-  const char* getHeader2HttpGet() { return ""; }
-  void setHeader2HttpGet(String header) {}
-
-  const char* getTargetInfluxDB2() { return ""; }
-  void setTargetInfluxDB2(String target) {}
-  const char* getOrgInfluxDB2() { return ""; }
-  void setOrgInfluxDB2(String org) {}
-  const char* getBucketInfluxDB2() { return ""; }
-  void setBucketInfluxDB2(String bucket) {}
-  const char* getTokenInfluxDB2() { return ""; }
-  void setTokenInfluxDB2(String token) {}
+  // Http targets get keg and pour updates, see Webhook. An empty format uses
+  // the default one.
+  const char* getTargetHttpPost() { return _targetHttpPost.c_str(); }
+  void setTargetHttpPost(String target) {
+    _targetHttpPost = target;
+    _saveNeeded = true;
+  }
+  const char* getHeader1HttpPost() { return _header1HttpPost.c_str(); }
+  void setHeader1HttpPost(String header) {
+    _header1HttpPost = header;
+    _saveNeeded = true;
+  }
+  const char* getHeader2HttpPost() { return _header2HttpPost.c_str(); }
+  void setHeader2HttpPost(String header) {
+    _header2HttpPost = header;
+    _saveNeeded = true;
+  }
+  const char* getFormatHttpPost() { return _formatHttpPost.c_str(); }
+  void setFormatHttpPost(String format) {
+    _formatHttpPost = format;
+    _saveNeeded = true;
+  }
+
+  const char* getTargetHttpGet() { return _targetHttpGet.c_str(); }
+  void setTargetHttpGet(String target) {
+    _targetHttpGet = target;
+    _saveNeeded = true;
+  }
+  const char* getHeader1HttpGet() { return _header1HttpGet.c_str(); }
+  void setHeader1HttpGet(String header) {
+    _header1HttpGet = header;
+    _saveNeeded = true;
+  }
+  const char* getHeader2HttpGet() { return _header2HttpGet.c_str(); }
+  void setHeader2HttpGet(String header) {
+    _header2HttpGet = header;
+    _saveNeeded = true;
+  }
+  const char* getFormatHttpGet() { return _formatHttpGet.c_str(); }
+  void setFormatHttpGet(String format) {
+    _formatHttpGet = format;
+    _saveNeeded = true;
+  }
+
+  // Influx is used for exporting the level detection data, see InfluxExporter
+
+  const char* getTargetInfluxDB2() { return _targetInfluxDb2.c_str(); }
+  void setTargetInfluxDB2(String target) {
+    _targetInfluxDb2 = target;
+    _saveNeeded = true;
+  }
+  const char* getOrgInfluxDB2() { return _orgInfluxDb2.c_str(); }
+  void setOrgInfluxDB2(String org) {
+    _orgInfluxDb2 = org;
+    _saveNeeded = true;
+  }
+  const char* getBucketInfluxDB2() { return _bucketInfluxDb2.c_str(); }
+  void setBucketInfluxDB2(String bucket) {
+    _bucketInfluxDb2 = bucket;
+    _saveNeeded = true;
+  }
+  const char* getTokenInfluxDB2() { return _tokenInfluxDb2.c_str(); }
+  void setTokenInfluxDB2(String token) {
+    _tokenInfluxDb2 = token;
+    _saveNeeded = true;
+  }
 
   // Hardware related methods
   int getPinDisplayData() { return _pins._displayData; }
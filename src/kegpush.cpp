@@ -23,30 +23,257 @@ SOFTWARE.
  */
 #include <kegpush.hpp>
 #include <log.hpp>
+#include <perfstats.hpp>
 #include <scale.hpp>
 #include <utils.hpp>
 
+static PolicyChannel getChannel(const PushItem& item) {
+  if (item.type == PushType::PushTemp) return PolicyChannel::ChannelTemp;
+  return item.idx == UnitIndex::U1 ? PolicyChannel::ChannelKeg1
+                                   : PolicyChannel::ChannelKeg2;
+}
+
+static float getPolicyValue(const PushItem& item) {
+  return item.type == PushType::PushTemp ? item.tempC : item.stableVol;
+}
+
 void KegPushHandler::pushTempInformation(float tempC, bool isLoop) {
   if (isnan(tempC)) return;
 
-  _ha->sendTempInformation(tempC);
+  PushItem item = {};
+  item.type = PushType::PushTemp;
+  item.tempC = tempC;
+  enqueue(item, isLoop);
 }
 
 void KegPushHandler::pushPourInformation(UnitIndex idx, float pourVol,
                                          bool isLoop) {
-  if (!isLoop)  // Limit calls to brewspy
-    _brewspy->sendPourInformation(idx, pourVol);
-
-  _ha->sendPourInformation(idx, pourVol);
+  PushItem item = {};
+  item.type = PushType::PushPour;
+  item.idx = idx;
+  item.pourVol = pourVol;
+  enqueue(item, isLoop);
 }
 
 void KegPushHandler::pushKegInformation(UnitIndex idx, float stableVol,
                                         float pourVol, float glasses,
                                         bool isLoop) {
-  if (!isLoop)  // Limit calls to brewspy
-    _brewspy->sendTapInformation(idx, stableVol, pourVol);
+  PushItem item = {};
+  item.type = PushType::PushKeg;
+  item.idx = idx;
+  item.stableVol = stableVol;
+  item.pourVol = pourVol;
+  item.glasses = glasses;
+  enqueue(item, isLoop);
+}
+
+void KegPushHandler::enqueue(PushItem& item, bool isLoop) {
+  uint32_t now = millis();
+  item.queued = now;
+
+  // Limit calls to brewspy, the regular updates from the loop and the
+  // temperature are only sent to mqtt and are not worth keeping if they fail.
+  if (!isLoop && item.type != PushType::PushTemp &&
+      strlen(myConfig.getBrewspyToken(item.idx)))
+    item.targets |= 1 << PushTarget::TargetBrewspy;
+  if (myConfig.hasTargetMqtt())
+    item.targets |= 1 << PushTarget::TargetHomeAssist;
+
+  if (!isLoop && item.type != PushType::PushTemp) {
+    if (strlen(myConfig.getTargetHttpPost()))
+      item.targets |= 1 << PushTarget::TargetHttpPost;
+    if (strlen(myConfig.getTargetHttpGet()))
+      item.targets |= 1 << PushTarget::TargetHttpGet;
+  }
+
+  item.persist = !isLoop && item.type != PushType::PushTemp;
+
+  if (item.type != PushType::PushPour) {
+    PolicyChannel c = getChannel(item);
+
+    for (int t = 0; t < PUSHQUEUE_TARGETS; t++) {
+      if (!(item.targets & (1 << t))) continue;
+
+      // Kept for changes that are held back and for the heartbeat
+      _latest[t][c] = item;
+      _latest[t][c].targets = 1 << t;
+
+      if (!_policy[t].offer(c, getPolicyValue(item), now))
+        item.targets &= ~(1 << t);
+    }
+  }
+
+  submit(item);
+}
+
+void KegPushHandler::submit(PushItem& item) {
+  if (!item.targets) return;
+
+  if (item.persist) {
+    item.boot = _boot;
+    item.seq = ++_seq;
+
+    // Keep the order for the targets that have older updates waiting
+    PushItem stored = item;
+    stored.targets = 0;
+
+    for (int t = 0; t < PUSHQUEUE_TARGETS; t++) {
+      bool waiting = _outbox.hasTarget(static_cast<PushTarget>(t));
+
+      if ((item.targets & (1 << t)) && (!WiFi.isConnected() || waiting))
+        stored.targets |= 1 << t;
+    }
+
+    if (stored.targets) {
+      _outbox.append(stored);
+      item.targets &= ~stored.targets;
+      if (!item.targets) return;
+    }
+  }
+
+  PushItem dropped;
+
+  if (_queue.add(item, &dropped) && dropped.persist) _outbox.append(dropped);
+}
+
+void KegPushHandler::store(PushTarget target, const PushItem& item) {
+  PushItem p = item;
+  p.targets = 1 << target;
+  _outbox.append(p);
+}
+
+void KegPushHandler::loop() {
+  uint32_t now = millis();
+
+  if (WiFi.isConnected() && _outbox.size()) {
+    for (int t = 0; t < PUSHQUEUE_TARGETS; t++) {
+      if (static_cast<int32_t>(now - _outboxNext[t]) >= 0)
+        replay(static_cast<PushTarget>(t), now);
+    }
+  }
+
+  // Changes held back by the publish policy and heartbeats
+  for (int t = 0; t < PUSHQUEUE_TARGETS; t++) {
+    for (int i = 0; i < POLICY_CHANNELS; i++) {
+      PolicyChannel c = static_cast<PolicyChannel>(i);
+
+      if (!_policy[t].isDue(c, now)) continue;
+
+      PushItem item = _latest[t][c];
+      item.persist = item.persist && _policy[t].isPending(c);
+      item.queued = now;
+      _policy[t].markSent(c, getPolicyValue(item), now);
+      submit(item);
+    }
+  }
+
+  _queue.drain(
+      now,
+      [this](PushTarget target, const PushItem& item) {
+        // The network was lost after the update was queued
+        if (item.persist && !WiFi.isConnected()) {
+          store(target, item);
+          return PushResult::PushSent;
+        }
+
+        return send(target, item);
+      },
+      [this](PushTarget target, const PushItem& item) {
+        if (item.persist) store(target, item);
+      });
+}
+
+// Sends the oldest update in the outbox for the target, one update per call
+// to follow the rate limit of the target. Failed updates are retried with a
+// growing delay and dropped for the target after too many attempts, or right
+// away when the target rejects them.
+void KegPushHandler::replay(PushTarget target, uint32_t now) {
+  PushItem item;
+  int pos = _outbox.find(target, item);
+
+  if (pos < 0) return;
+
+  uint8_t& attempts = item.attempts[target];
+  PushResult result = send(target, item);
+
+  if (result == PushResult::PushSent) {
+    item.targets &= ~(1 << target);
+    _replayed++;
+    _outboxNext[target] = now + _queue.getTarget(target).interval;
+    Log.notice(F("PUSH: Replayed update %d to target %d from outbox." CR),
+               item.seq, target);
+  } else if (result == PushResult::PushRejected ||
+             ++attempts >= PUSH_OUTBOX_MAX_ATTEMPTS) {
+    item.targets &= ~(1 << target);
+    _givenUp++;
+    _outboxNext[target] = now;
+    Log.warning(F("PUSH: Dropped update %d for target %d after %d attempts."
+                  CR),
+                item.seq, target, attempts);
+  } else {
+    uint32_t retry = PUSH_OUTBOX_RETRY << (attempts < 6 ? attempts - 1 : 5);
+    _outboxNext[target] = now + (retry < PUSH_OUTBOX_RETRY_MAX
+                                     ? retry
+                                     : PUSH_OUTBOX_RETRY_MAX);
+  }
+
+  _outbox.update(pos, item);
+}
+
+PushResult KegPushHandler::send(PushTarget target, const PushItem& item) {
+  // Fail fast, the item is retried with backoff when the wifi is back
+  if (!WiFi.isConnected()) return PushResult::PushFailed;
+
+  bool ok = false;
+  char key[20] = "";
+
+  if (item.persist)
+    snprintf(&key[0], sizeof(key), "%08x-%u", static_cast<unsigned>(item.boot),
+             static_cast<unsigned>(item.seq));
+
+  if (target == PushTarget::TargetHttpPost ||
+      target == PushTarget::TargetHttpGet) {
+    PERF_BEGIN("push-webhook");
+    PushResult result = _webhook->send(target, item, &key[0]);
+    PERF_END("push-webhook");
+
+    if (result == PushResult::PushRejected) return result;
+
+    ok = result == PushResult::PushSent;
+  } else {
+    switch (item.type) {
+      case PushType::PushTemp:
+        PERF_BEGIN("push-temp");
+        ok = _ha->sendTempInformation(item.tempC);
+        PERF_END("push-temp");
+        break;
+
+      case PushType::PushPour:
+        PERF_BEGIN("push-pour");
+        if (target == PushTarget::TargetBrewspy)
+          ok = _brewspy->sendPourInformation(item.idx, item.pourVol, &key[0]);
+        else
+          ok = _ha->sendPourInformation(item.idx, item.pourVol);
+        PERF_END("push-pour");
+        break;
+
+      case PushType::PushKeg:
+        PERF_BEGIN("push-keg");
+        if (target == PushTarget::TargetBrewspy)
+          ok = _brewspy->sendTapInformation(item.idx, item.stableVol,
+                                            item.pourVol, &key[0]);
+        else
+          ok = _ha->sendTapInformation(item.idx, item.stableVol, item.glasses);
+        PERF_END("push-keg");
+        break;
+    }
+  }
+
+  if (!ok)
+    Log.warning(F("PUSH: Failed to send to target %d, %d queued." CR), target,
+                _queue.getDepth());
 
-  _ha->sendTapInformation(idx, stableVol, glasses);
+  return ok ? PushResult::PushSent : PushResult::PushFailed;
 }
 
 // EOF
@@ -28,18 +28,89 @@ SOFTWARE.
 #include <brewspy.hpp>
 #include <homeassist.hpp>
 #include <kegconfig.hpp>
+#include <outbox.hpp>
+#include <publishpolicy.hpp>
+#include <pushqueue.hpp>
+#include <webhook.hpp>
 
+constexpr auto PUSH_BREWSPY_INTERVAL = 5000;    // ms between brewspy requests
+constexpr auto PUSH_HA_INTERVAL = 500;          // ms between mqtt updates
+constexpr auto PUSH_WEBHOOK_INTERVAL = 1000;    // ms between http requests
+constexpr auto PUSH_OUTBOX_RETRY = 30000;       // ms after a failed replay
+constexpr auto PUSH_OUTBOX_RETRY_MAX = 900000;  // ms, max of the doubling retry
+constexpr auto PUSH_OUTBOX_MAX_ATTEMPTS = 10;   // per update and target
+
+// Publish policy per target, volume in liters and temperature in C
+constexpr PublishLimits PUSH_BREWSPY_KEG = {0.05, 60000, 0};
+constexpr PublishLimits PUSH_HA_KEG = {0.05, 5000, 600000};
+constexpr PublishLimits PUSH_HA_TEMP = {0.2, 60000, 600000};
+constexpr PublishLimits PUSH_WEBHOOK_KEG = {0.05, 5000, 600000};
+
+// The push* methods only add the update to the queue, loop() does the actual
+// sending so the network calls are done outside the level detection. Keg levels
+// and temperature follow the publish policy of each target, pours are always
+// sent right away. Pours and new levels that can not be delivered are kept in
+// the outbox on flash and replayed in order when the network is back. Each
+// target is replayed on its own, while the outbox has updates for a target new
+// ones for that target are added after them. An update that a target keeps
+// refusing is dropped for that target after PUSH_OUTBOX_MAX_ATTEMPTS.
 class KegPushHandler : public BasePush {
  private:
   Brewspy* _brewspy = NULL;
   HomeAssist* _ha = NULL;
+  Webhook* _webhook = NULL;
+  PushQueue _queue;
+  PublishPolicy _policy[PUSHQUEUE_TARGETS];
+  PushItem _latest[PUSHQUEUE_TARGETS][POLICY_CHANNELS] = {};
+  Outbox _outbox;
+  uint32_t _boot;
+  uint32_t _seq = 0;
+  uint32_t _outboxNext[PUSHQUEUE_TARGETS] = {0};
+  uint32_t _replayed = 0;
+  uint32_t _givenUp = 0;
+
+  void enqueue(PushItem& item, bool isLoop);
+  void submit(PushItem& item);
+  void store(PushTarget target, const PushItem& item);
+  void replay(PushTarget target, uint32_t now);
+  PushResult send(PushTarget target, const PushItem& item);
 
  public:
   explicit KegPushHandler(KegConfig* config) : BasePush(config) {
     _brewspy = new Brewspy(this);
     _ha = new HomeAssist(this);
+    _webhook = new Webhook();
+    _queue.setRateLimit(PushTarget::TargetBrewspy, PUSH_BREWSPY_INTERVAL);
+    _queue.setRateLimit(PushTarget::TargetHomeAssist, PUSH_HA_INTERVAL);
+    _policy[PushTarget::TargetBrewspy].setLimits(PolicyChannel::ChannelKeg1,
+                                                 PUSH_BREWSPY_KEG);
+    _policy[PushTarget::TargetBrewspy].setLimits(PolicyChannel::ChannelKeg2,
+                                                 PUSH_BREWSPY_KEG);
+    _policy[PushTarget::TargetHomeAssist].setLimits(PolicyChannel::ChannelKeg1,
+                                                    PUSH_HA_KEG);
+    _policy[PushTarget::TargetHomeAssist].setLimits(PolicyChannel::ChannelKeg2,
+                                                    PUSH_HA_KEG);
+    _policy[PushTarget::TargetHomeAssist].setLimits(PolicyChannel::ChannelTemp,
+                                                    PUSH_HA_TEMP);
+
+    for (PushTarget t :
+         {PushTarget::TargetHttpPost, PushTarget::TargetHttpGet}) {
+      _queue.setRateLimit(t, PUSH_WEBHOOK_INTERVAL);
+      _policy[t].setLimits(PolicyChannel::ChannelKeg1, PUSH_WEBHOOK_KEG);
+      _policy[t].setLimits(PolicyChannel::ChannelKeg2, PUSH_WEBHOOK_KEG);
+    }
+    _boot = ESP_RANDOM();
   }
 
+  void loop();
+  const PushQueue& getQueue() { return _queue; }
+  const PublishPolicy& getPolicy(PushTarget t) { return _policy[t]; }
+  int getOutboxSize() { return _outbox.size(); }
+  uint32_t getOutboxDropped() { return _outbox.getDropped() + _givenUp; }
+  uint32_t getOutboxReplayed() { return _replayed; }
+  const HomeAssist* getHomeAssist() { return _ha; }
+  void requestDiscovery() { _ha->requestDiscovery(); }
+
   String requestTapInfoFromBrewspy(String& token) {
     return _brewspy->getTapInformation(token);
   }
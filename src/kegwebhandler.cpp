@@ -21,14 +21,23 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
+#include <acquisition.hpp>
+#include <capture.hpp>
+#include <display.hpp>
+#include <influxexport.hpp>
 #include <kegpush.hpp>
 #include <kegwebhandler.hpp>
 #include <levels.hpp>
+#include <looptiming.hpp>
 #include <main.hpp>
+#include <perfstats.hpp>
 #include <scale.hpp>
+#include <scheduler.hpp>
 #include <temp_mgr.hpp>
 #include <utils.hpp>
 
+constexpr auto EVENTS_BUFFER_SIZE = 250;
+
 // Configuration or api params
 constexpr auto PARAM_APP_VER = "app-ver";
 constexpr auto PARAM_APP_BUILD = "app-build";
@@ -58,16 +67,29 @@ constexpr auto PARAM_LAST_POUR_WEIGHT1 = "last-pour-weight1";
 constexpr auto PARAM_LAST_POUR_WEIGHT2 = "last-pour-weight2";
 constexpr auto PARAM_LAST_POUR_VOLUME1 = "last-pour-volume1";
 constexpr auto PARAM_LAST_POUR_VOLUME2 = "last-pour-volume2";
+constexpr auto PARAM_SCALE_CONNECTS1 = "scale-connects1";
+constexpr auto PARAM_SCALE_CONNECTS2 = "scale-connects2";
+constexpr auto PARAM_SCALE_DISCONNECTS1 = "scale-disconnects1";
+constexpr auto PARAM_SCALE_DISCONNECTS2 = "scale-disconnects2";
+constexpr auto PARAM_CAPTURE_ACTIVE = "capture-active";
+constexpr auto PARAM_CAPTURE_DURATION = "duration";
+constexpr auto PARAM_CAPTURE_ELAPSED = "elapsed";
+constexpr auto PARAM_CAPTURE_SAMPLES = "samples";
+constexpr auto PARAM_CAPTURE_SIZE = "size";
+constexpr auto PARAM_CALIBRATION_RAW = "raw";
+constexpr auto PARAM_CALIBRATION_RESIDUAL = "residual";
 
 #if defined(USE_ASYNC_WEB)
 KegWebHandler::KegWebHandler(KegConfig* config)
-    : BaseAsyncWebHandler(config, JSON_BUFFER) {
+    : BaseAsyncWebHandler(config, JSON_BUFFER), _events("/api/events") {
   _config = config;
+  _bootId = ESP_RANDOM();
 }
 #else
 KegWebHandler::KegWebHandler(KegConfig* config)
     : BaseWebHandler(config, JSON_BUFFER) {
   _config = config;
+  _bootId = ESP_RANDOM();
 }
 #endif
 
@@ -82,18 +104,56 @@ void KegWebHandler::setupWebHandlers() {
   BaseWebHandler::setupWebHandlers();
 #endif
 
+#if defined(ESP8266)
+  setupGzipHtm(_calibrationHtm, gCalibrateHtmData, gCalibrateHtmSize);
+  setupGzipHtm(_beerHtm, gBeerHtmData, gBeerHtmSize);
+  setupGzipHtm(_stabilityHtm, gStabilityHtmData, gStabilityHtmSize);
+  setupGzipHtm(_graphHtm, gGraphHtmData, gGraphHtmSize);
+  setupGzipHtm(_backupHtm, gBackupHtmData, gBackupHtmSize);
+  setupGzipHtm(_dashboardHtm, gDashboardHtmData, gDashboardHtmSize);
+#else
+  setupGzipHtm(_calibrationHtm, calibrationHtmStart,
+               calibrationHtmEnd - calibrationHtmStart);
+  setupGzipHtm(_beerHtm, beerHtmStart, beerHtmEnd - beerHtmStart);
+  setupGzipHtm(_stabilityHtm, stabilityHtmStart,
+               stabilityHtmEnd - stabilityHtmStart);
+  setupGzipHtm(_graphHtm, graphHtmStart, graphHtmEnd - graphHtmStart);
+  setupGzipHtm(_backupHtm, backupHtmStart, backupHtmEnd - backupHtmStart);
+  setupGzipHtm(_dashboardHtm, dashboardHtmStart,
+               dashboardHtmEnd - dashboardHtmStart);
+#endif
+
+#if defined(USE_ASYNC_WEB)
+  _server->addHandler(&_events);
+#else
+  // The sync server only keeps the request headers that are asked for
+  const char* headers[] = {"If-None-Match"};
+  _server->collectHeaders(headers, 1);
+#endif
+
   // Note! For the async implementation the order matters
   _server->serveStatic("/levels2", LittleFS, LEVELS_FILENAME2);
   _server->serveStatic("/levels", LittleFS, LEVELS_FILENAME);
   _server->serveStatic("/startup", LittleFS, STARTUP_FILENAME);
+  _server->serveStatic("/capture", LittleFS, CAPTURE_FILENAME);
   WS_BIND_URL("/api/reset", HTTP_GET, &KegWebHandler::webReset);
   WS_BIND_URL("/api/scale/tare", HTTP_GET, &KegWebHandler::webScaleTare);
   WS_BIND_URL("/api/scale/factor", HTTP_GET, &KegWebHandler::webScaleFactor);
+  WS_BIND_URL("/api/scale/point/clear", HTTP_GET,
+              &KegWebHandler::webScalePointClear);
+  WS_BIND_URL("/api/scale/point", HTTP_GET, &KegWebHandler::webScalePoint);
   WS_BIND_URL("/api/scale", HTTP_GET, &KegWebHandler::webScale);
+  WS_BIND_URL("/api/capture/start", HTTP_GET,
+              &KegWebHandler::webCaptureStart);
+  WS_BIND_URL("/api/capture/stop", HTTP_GET, &KegWebHandler::webCaptureStop);
+  WS_BIND_URL("/api/capture", HTTP_GET, &KegWebHandler::webCapture);
   WS_BIND_URL("/api/stability/clear", HTTP_GET,
               &KegWebHandler::webStabilityClear);
   WS_BIND_URL("/api/stability", HTTP_GET, &KegWebHandler::webStability);
   WS_BIND_URL("/api/status", HTTP_GET, &KegWebHandler::webStatus);
+  WS_BIND_URL("/metrics", HTTP_GET, &KegWebHandler::webMetrics);
+  WS_BIND_URL("/api/perf/clear", HTTP_GET, &KegWebHandler::webPerfClear);
+  WS_BIND_URL("/api/perf", HTTP_GET, &KegWebHandler::webPerf);
   WS_BIND_URL("/calibration.htm", HTTP_GET, &KegWebHandler::webCalibrateHtm);
   WS_BIND_URL("/beer.htm", HTTP_GET, &KegWebHandler::webBeerHtm);
   WS_BIND_URL("/stability.htm", HTTP_GET, &KegWebHandler::webStabilityHtm);
@@ -105,6 +165,60 @@ void KegWebHandler::setupWebHandlers() {
   WS_BIND_URL("/dashboard", HTTP_GET, &KegWebHandler::webDashboardHtm);
 }
 
+void KegWebHandler::setupGzipHtm(GzipHtm& htm, const uint8_t* data,
+                                 size_t size) {
+  // FNV-1a hash of the compressed page, it only changes when the page does
+  uint32_t hash = 2166136261UL;
+
+  for (size_t i = 0; i < size; i++) {
+    hash ^= pgm_read_byte(data + i);
+    hash *= 16777619UL;
+  }
+
+  htm.data = data;
+  htm.size = size;
+  snprintf(&htm.etag[0], sizeof(htm.etag), "\"%08x\"",
+           static_cast<unsigned int>(hash));
+
+#if LOG_LEVEL == 6
+  Log.verbose(F("WEB : Embedded page %d bytes, etag %s." CR), size,
+              &htm.etag[0]);
+#endif
+}
+
+#if defined(USE_ASYNC_WEB)
+void KegWebHandler::sendGzipHtm(AsyncWebServerRequest* request,
+                                const GzipHtm& htm) {
+  AsyncWebServerResponse* response;
+
+  if (request->hasHeader("If-None-Match") &&
+      request->getHeader("If-None-Match")->value() == htm.etag) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse_P(200, "text/html", htm.data, htm.size);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+
+  response->addHeader("ETag", htm.etag);
+  response->addHeader("Cache-Control", HTM_CACHE_CONTROL);
+  request->send(response);
+}
+#else
+void KegWebHandler::sendGzipHtm(const GzipHtm& htm) {
+  _server->sendHeader("ETag", htm.etag);
+  _server->sendHeader("Cache-Control", HTM_CACHE_CONTROL);
+
+  if (_server->header("If-None-Match") == htm.etag) {
+    _server->send(304);
+    return;
+  }
+
+  _server->sendHeader("Content-Encoding", "gzip");
+  _server->send_P(200, "text/html", reinterpret_cast<const char*>(htm.data),
+                  htm.size);
+}
+#endif
+
 void KegWebHandler::webHandleLogsClear(WS_PARAM) {
   String id = WS_REQ_ARG(PARAM_ID);
   Log.notice(F("WEB : webServer callback for /api/logs/clear." CR));
@@ -131,17 +245,28 @@ void KegWebHandler::webHandleBrewspy(WS_PARAM) {
 void KegWebHandler::webScale(WS_PARAM) {
   Log.notice(F("WEB : webServer callback /api/scale." CR));
 
-  DynamicJsonDocument doc(500);
-  populateScaleJson(doc);
-
-  doc[PARAM_WEIGHT_UNIT] = myConfig.getWeightUnit();
-  doc[PARAM_VOLUME_UNIT] = myConfig.getVolumeUnit();
+  LevelSnapshot snap;
+  myAcquisition.read(snap);
+
+  WS_SEND_JSON_BEGIN();
+  json.beginObject();
+  populateScaleJson(json, snap);
+  populateCalibrationJson(json, PARAM_SCALE_CALIBRATION1, UnitIndex::U1);
+  populateCalibrationJson(json, PARAM_SCALE_CALIBRATION2, UnitIndex::U2);
+  json.add(PARAM_SCALE_CONNECTS1, myScale.getConnectCount(UnitIndex::U1));
+  json.add(PARAM_SCALE_CONNECTS2, myScale.getConnectCount(UnitIndex::U2));
+  json.add(PARAM_SCALE_DISCONNECTS1,
+           myScale.getDisconnectCount(UnitIndex::U1));
+  json.add(PARAM_SCALE_DISCONNECTS2,
+           myScale.getDisconnectCount(UnitIndex::U2));
+  json.add(PARAM_WEIGHT_UNIT, myConfig.getWeightUnit());
+  json.add(PARAM_VOLUME_UNIT, myConfig.getVolumeUnit());
+  json.endObject();
+  WS_SEND_JSON_END();
 
-  String out;
-  out.reserve(500);
-  serializeJson(doc, out);
-  doc.clear();
-  WS_SEND(200, "application/json", out.c_str());
+#if LOG_LEVEL == 6
+  printHeap("WEB :");
+#endif
 }
 
 void KegWebHandler::webScaleTare(WS_PARAM) {
@@ -177,146 +302,791 @@ void KegWebHandler::webScaleFactor(WS_PARAM) {
   WS_SEND(200, "text/plain", "");
 }
 
-void KegWebHandler::populateScaleJson(DynamicJsonDocument& doc) {
-  // This will return the raw weight so that that we get the actual values.
-  doc[PARAM_SCALE_FACTOR1] = myConfig.getScaleFactor(UnitIndex::U1);
-  doc[PARAM_SCALE_FACTOR2] = myConfig.getScaleFactor(UnitIndex::U2);
-  if (myScale.isConnected(UnitIndex::U1)) {
-    doc[PARAM_SCALE_WEIGHT1] = serialized(
-        String(convertOutgoingWeight(
-                   myLevelDetection.getTotalRawWeight(UnitIndex::U1)),
-               myConfig.getWeightPrecision()));
-    doc[PARAM_SCALE_RAW1] = myScale.readLastRaw(UnitIndex::U1);
-    doc[PARAM_SCALE_OFFSET1] = myConfig.getScaleOffset(UnitIndex::U1);
-    doc[PARAM_BEER_WEIGHT1] = serialized(String(
-        convertOutgoingWeight(myLevelDetection.getBeerWeight(UnitIndex::U1)),
-        myConfig.getWeightPrecision()));
-    doc[PARAM_BEER_VOLUME1] = serialized(String(
-        convertOutgoingVolume(myLevelDetection.getBeerVolume(UnitIndex::U1)),
-        myConfig.getVolumePrecision()));
-  }
-
-  if (myScale.isConnected(UnitIndex::U2)) {
-    doc[PARAM_SCALE_WEIGHT2] = serialized(
-        String(convertOutgoingWeight(
-                   myLevelDetection.getTotalRawWeight(UnitIndex::U2)),
-               myConfig.getWeightPrecision()));
-    doc[PARAM_SCALE_RAW2] = myScale.readLastRaw(UnitIndex::U2);
-    doc[PARAM_SCALE_OFFSET2] = myConfig.getScaleOffset(UnitIndex::U2);
-    doc[PARAM_BEER_WEIGHT2] = serialized(String(
-        convertOutgoingWeight(myLevelDetection.getBeerWeight(UnitIndex::U2)),
-        myConfig.getWeightPrecision()));
-    doc[PARAM_BEER_VOLUME2] = serialized(String(
-        convertOutgoingVolume(myLevelDetection.getBeerVolume(UnitIndex::U2)),
-        myConfig.getVolumePrecision()));
-  }
-
-  if (myLevelDetection.hasStableWeight(UnitIndex::U1)) {
-    doc[PARAM_SCALE_STABLE_WEIGHT1] = serialized(
-        String(convertOutgoingWeight(
-                   myLevelDetection.getTotalStableWeight(UnitIndex::U1)),
-               myConfig.getWeightPrecision()));
-  }
-
-  if (myLevelDetection.hasStableWeight(UnitIndex::U2)) {
-    doc[PARAM_SCALE_STABLE_WEIGHT2] = serialized(
-        String(convertOutgoingWeight(
-                   myLevelDetection.getTotalStableWeight(UnitIndex::U2)),
-               myConfig.getWeightPrecision()));
-  }
-
-  if (myLevelDetection.hasPourWeight(UnitIndex::U1)) {
-    doc[PARAM_LAST_POUR_WEIGHT1] = serialized(String(
-        convertOutgoingWeight(myLevelDetection.getPourWeight(UnitIndex::U1)),
-        myConfig.getWeightPrecision()));
-    doc[PARAM_LAST_POUR_VOLUME1] = serialized(String(
-        convertOutgoingVolume(myLevelDetection.getPourVolume(UnitIndex::U1)),
-        myConfig.getVolumePrecision()));
-  }
-
-  if (myLevelDetection.hasPourWeight(UnitIndex::U2)) {
-    doc[PARAM_LAST_POUR_WEIGHT2] = serialized(String(
-        convertOutgoingWeight(myLevelDetection.getPourWeight(UnitIndex::U2)),
-        myConfig.getWeightPrecision()));
-    doc[PARAM_LAST_POUR_VOLUME2] = serialized(String(
-        convertOutgoingVolume(myLevelDetection.getPourVolume(UnitIndex::U2)),
-        myConfig.getVolumePrecision()));
+void KegWebHandler::webCapture(WS_PARAM) {
+  Log.notice(F("WEB : webServer callback /api/capture." CR));
+
+  DynamicJsonDocument doc(200);
+  doc[PARAM_CAPTURE_ACTIVE] = myCapture.isActive();
+  doc[PARAM_CAPTURE_DURATION] = myCapture.getDuration();
+  doc[PARAM_CAPTURE_ELAPSED] = myCapture.getElapsed();
+  doc[PARAM_CAPTURE_SAMPLES] = myCapture.getSamples();
+  doc[PARAM_CAPTURE_SIZE] = myCapture.getSize();
+
+  String out;
+  out.reserve(200);
+  serializeJson(doc, out);
+  doc.clear();
+  WS_SEND(200, "application/json", out.c_str());
+}
+
+void KegWebHandler::webCaptureStart(WS_PARAM) {
+  uint32_t duration = WS_REQ_ARG(PARAM_CAPTURE_DURATION).toInt();
+  Log.notice(F("WEB : webServer callback /api/capture/start, %d s." CR),
+             duration);
+
+  myCapture.scheduleStart(duration);
+  WS_SEND(200, "text/plain", "");
+}
+
+void KegWebHandler::webCaptureStop(WS_PARAM) {
+  Log.notice(F("WEB : webServer callback /api/capture/stop." CR));
+
+  myCapture.scheduleStop();
+  WS_SEND(200, "text/plain", "");
+}
+
+void KegWebHandler::webScalePoint(WS_PARAM) {
+  float weight = convertIncomingWeight(WS_REQ_ARG(PARAM_WEIGHT).toFloat());
+  UnitIndex idx;
+
+  // Request will contain 1 or 2, but we need 0 or 1 for indexing.
+  if (WS_REQ_ARG(PARAM_SCALE).toInt() == 1)
+    idx = UnitIndex::U1;
+  else
+    idx = UnitIndex::U2;
+
+  Log.notice(
+      F("WEB : webServer callback /api/scale/point, weight=%Fkg [%d]." CR),
+      weight, idx);
+
+  if (weight <= 0) {
+    WS_SEND(400, "text/plain", "Invalid weight.");
+    return;
   }
 
-#if LOG_LEVEL == 6
-  serializeJson(doc, Serial);
-  EspSerial.print(CR);
-#endif
+  myScale.scheduleAddCalibrationPoint(idx, weight);
+  WS_SEND(200, "text/plain", "");
 }
 
-void KegWebHandler::webStatus(WS_PARAM) {
-  Log.notice(F("WEB : webServer callback /api/status." CR));
+void KegWebHandler::webScalePointClear(WS_PARAM) {
+  UnitIndex idx;
 
-  DynamicJsonDocument doc(1000);
-  populateScaleJson(doc);
+  // Request will contain 1 or 2, but we need 0 or 1 for indexing.
+  if (WS_REQ_ARG(PARAM_SCALE).toInt() == 1)
+    idx = UnitIndex::U1;
+  else
+    idx = UnitIndex::U2;
 
-  doc[PARAM_MDNS] = myConfig.getMDNS();
-  doc[PARAM_ID] = myConfig.getID();
-  doc[PARAM_SSID] = myConfig.getWifiSSID(0);
+  Log.notice(F("WEB : webServer callback /api/scale/point/clear [%d]." CR),
+             idx);
+
+  myScale.scheduleClearCalibration(idx);
+  WS_SEND(200, "text/plain", "");
+}
+
+void KegWebHandler::populateCalibrationJson(JsonStream& json, const char* key,
+                                            UnitIndex idx) {
+  const CalibrationTable& cal = myConfig.getScaleCalibration(idx);
+  float factor = myConfig.getScaleFactor(idx);
+
+  json.beginArray(key);
+
+  // The residual is the deviation from the linear factor at each reference
+  // weight, i.e. the non linearity that the table compensates for.
+  for (int i = 0; i < cal.size(); i++) {
+    json.beginObject();
+    json.add(PARAM_CALIBRATION_RAW, cal.get(i).raw);
+    json.add(PARAM_WEIGHT, convertOutgoingWeight(cal.get(i).weight),
+             myConfig.getWeightPrecision());
+    float r = cal.residual(i, factor);
+
+    if (!isnan(r))
+      json.add(PARAM_CALIBRATION_RESIDUAL, convertOutgoingWeight(r), 3);
+    json.endObject();
+  }
+
+  json.endArray();
+}
+
+void KegWebHandler::populateScaleJson(JsonStream& json,
+                                      const LevelSnapshot& snap) {
+  // This will return the raw weight so that that we get the actual values.
+  json.add(PARAM_SCALE_FACTOR1, myConfig.getScaleFactor(UnitIndex::U1), 4);
+  json.add(PARAM_SCALE_FACTOR2, myConfig.getScaleFactor(UnitIndex::U2), 4);
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    bool u1 = idx == UnitIndex::U1;
+    const TapSnapshot& t = snap.tap[idx];
+
+    if (t.connected) {
+      json.add(u1 ? PARAM_SCALE_WEIGHT1 : PARAM_SCALE_WEIGHT2,
+               convertOutgoingWeight(t.totalRawWeight),
+               myConfig.getWeightPrecision());
+      json.add(u1 ? PARAM_SCALE_RAW1 : PARAM_SCALE_RAW2, t.raw);
+      json.add(u1 ? PARAM_SCALE_OFFSET1 : PARAM_SCALE_OFFSET2,
+               myConfig.getScaleOffset(idx));
+      json.add(u1 ? PARAM_BEER_WEIGHT1 : PARAM_BEER_WEIGHT2,
+               convertOutgoingWeight(t.beerWeight),
+               myConfig.getWeightPrecision());
+      json.add(u1 ? PARAM_BEER_VOLUME1 : PARAM_BEER_VOLUME2,
+               convertOutgoingVolume(t.beerVolume),
+               myConfig.getVolumePrecision());
+    }
+  }
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    const TapSnapshot& t = snap.tap[idx];
+
+    if (t.hasStable) {
+      json.add(idx == UnitIndex::U1 ? PARAM_SCALE_STABLE_WEIGHT1
+                                    : PARAM_SCALE_STABLE_WEIGHT2,
+               convertOutgoingWeight(t.totalStableWeight),
+               myConfig.getWeightPrecision());
+    }
+  }
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    bool u1 = idx == UnitIndex::U1;
+    const TapSnapshot& t = snap.tap[idx];
+
+    if (t.hasPour) {
+      json.add(u1 ? PARAM_LAST_POUR_WEIGHT1 : PARAM_LAST_POUR_WEIGHT2,
+               convertOutgoingWeight(t.pourWeight),
+               myConfig.getWeightPrecision());
+      json.add(u1 ? PARAM_LAST_POUR_VOLUME1 : PARAM_LAST_POUR_VOLUME2,
+               convertOutgoingVolume(t.pourVolume),
+               myConfig.getVolumePrecision());
+    }
+  }
+}
+
+void KegWebHandler::populateStatusJson(JsonStream& json,
+                                       const LevelSnapshot& snap) {
+  json.beginObject();
+  populateScaleJson(json, snap);
+
+  json.add(PARAM_MDNS, myConfig.getMDNS());
+  json.add(PARAM_ID, myConfig.getID());
+  json.add(PARAM_SSID, myConfig.getWifiSSID(0));
 #if defined(ESP8266) && defined(USE_ASYNC_WEB)
-  doc[PARAM_PLATFORM] = "esp8266 async";
+  json.add(PARAM_PLATFORM, "esp8266 async");
 #elif defined(ESP8266)
-  doc[PARAM_PLATFORM] = "esp8266";
+  json.add(PARAM_PLATFORM, "esp8266");
 #elif defined(ESP32S2) && defined(USE_ASYNC_WEB)
-  doc[PARAM_PLATFORM] = "esp32s2 async";
+  json.add(PARAM_PLATFORM, "esp32s2 async");
 #elif defined(ESP32S2)
-  doc[PARAM_PLATFORM] = "esp32s2";
+  json.add(PARAM_PLATFORM, "esp32s2");
 #endif
-  doc[PARAM_APP_VER] = CFG_APPVER;
-  doc[PARAM_APP_BUILD] = CFG_GITREV;
-  doc[PARAM_WEIGHT_UNIT] = myConfig.getWeightUnit();
-  doc[PARAM_VOLUME_UNIT] = myConfig.getVolumeUnit();
-  doc[PARAM_TEMP_FORMAT] = String(myConfig.getTempFormat());
+  json.add(PARAM_APP_VER, CFG_APPVER);
+  json.add(PARAM_APP_BUILD, CFG_GITREV);
+  json.add(PARAM_WEIGHT_UNIT, myConfig.getWeightUnit());
+  json.add(PARAM_VOLUME_UNIT, myConfig.getVolumeUnit());
+  char tempFormat[2] = {myConfig.getTempFormat(), 0};
+  json.add(PARAM_TEMP_FORMAT, &tempFormat[0]);
 
   // For this we use the last value read from the scale to avoid having to much
-  // communication. The value will be updated regulary second in the main loop.
-  if (myLevelDetection.hasStableWeight(UnitIndex::U1)) {
-    doc[PARAM_GLASS1] = serialized(
-        String(myLevelDetection.getNoStableGlasses(UnitIndex::U1), 1));
+  // communication. The value will be updated regulary by the acquisition.
+  if (snap.tap[UnitIndex::U1].hasStable) {
+    json.add(PARAM_GLASS1, snap.tap[UnitIndex::U1].stableGlasses, 1);
   }
-  if (myLevelDetection.hasStableWeight(UnitIndex::U2)) {
-    doc[PARAM_GLASS2] = serialized(
-        String(myLevelDetection.getNoStableGlasses(UnitIndex::U2), 1));
+  if (snap.tap[UnitIndex::U2].hasStable) {
+    json.add(PARAM_GLASS2, snap.tap[UnitIndex::U2].stableGlasses, 1);
   }
 
-  doc[PARAM_KEG_VOLUME1] =
-      convertOutgoingVolume(myConfig.getKegVolume(UnitIndex::U1));
-  doc[PARAM_KEG_VOLUME2] =
-      convertOutgoingVolume(myConfig.getKegVolume(UnitIndex::U2));
+  json.add(PARAM_KEG_VOLUME1,
+           convertOutgoingVolume(myConfig.getKegVolume(UnitIndex::U1)),
+           myConfig.getVolumePrecision());
+  json.add(PARAM_KEG_VOLUME2,
+           convertOutgoingVolume(myConfig.getKegVolume(UnitIndex::U2)),
+           myConfig.getVolumePrecision());
 
   float f = myTemp.getLastTempC();
 
   if (!isnan(f)) {
-    doc[PARAM_TEMP] = serialized(String(convertOutgoingTemperature(f), 2));
+    json.add(PARAM_TEMP, convertOutgoingTemperature(f), 2);
   }
 
   float h = myTemp.getLastHumidity();
 
   if (!isnan(h)) {
-    doc[PARAM_HUMIDITY] = serialized(String(h, 2));
+    json.add(PARAM_HUMIDITY, h, 2);
   }
 
   float p = myTemp.getLastPressure();
 
   if (!isnan(p)) {
-    doc[PARAM_PRESSURE] = serialized(String(p, 2));
+    json.add(PARAM_PRESSURE, p, 2);
   }
 
+  json.endObject();
+}
+
+void KegWebHandler::webStatus(WS_PARAM) {
+  Log.notice(F("WEB : webServer callback /api/status." CR));
+
+  // The status only changes when the levels are updated so the response is
+  // built once per update and then shared by all clients polling it.
+  LevelSnapshot snap;
+  myAcquisition.read(snap);
+  uint32_t sequence = snap.sequence;
+
+  if (!_statusCache.length() || sequence != _statusSequence) {
+    _statusCache = "";
+    _statusCache.reserve(1000);
+    JsonStream json(_statusCache);
+    populateStatusJson(json, snap);
+    _statusSequence = sequence;
+    snprintf(&_statusETag[0], sizeof(_statusETag), "\"%08x-%x\"",
+             static_cast<unsigned int>(_bootId),
+             static_cast<unsigned int>(sequence));
+  }
+
+#if defined(USE_ASYNC_WEB)
+  AsyncWebServerResponse* response;
+
+  if (request->hasHeader("If-None-Match") &&
+      request->getHeader("If-None-Match")->value() == _statusETag) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse(200, "application/json", _statusCache);
+  }
+
+  response->addHeader("Access-Control-Allow-Origin", "*");
+  response->addHeader("ETag", _statusETag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+#else
+  _server->enableCORS(true);
+  _server->sendHeader("ETag", _statusETag);
+  _server->sendHeader("Cache-Control", "no-cache");
+
+  if (_server->header("If-None-Match") == _statusETag)
+    _server->send(304);
+  else
+    _server->send(200, "application/json", _statusCache);
+#endif
+
 #if LOG_LEVEL == 6
-  serializeJson(doc, Serial);
-  EspSerial.print(CR);
+  printHeap("WEB :");
 #endif
+}
 
-  String out;
-  out.reserve(1000);
-  serializeJson(doc, out);
-  doc.clear();
-  WS_SEND(200, "application/json", out.c_str());
+// Only the values that has changed are sent, the keys are the same as in
+// /api/status so the client can merge them into the last status.
+void KegWebHandler::sendStableEvent(UnitIndex idx, const LevelSnapshot& snap) {
+#if defined(USE_ASYNC_WEB)
+  if (!_events.count()) return;
+
+  const TapSnapshot& t = snap.tap[idx];
+  bool u1 = idx == UnitIndex::U1;
+  JsonBuffer<EVENTS_BUFFER_SIZE> buf;
+  JsonStream json(buf);
+
+  json.beginObject();
+  json.add(u1 ? PARAM_SCALE_STABLE_WEIGHT1 : PARAM_SCALE_STABLE_WEIGHT2,
+           convertOutgoingWeight(t.totalStableWeight),
+           myConfig.getWeightPrecision());
+  json.add(u1 ? PARAM_BEER_WEIGHT1 : PARAM_BEER_WEIGHT2,
+           convertOutgoingWeight(t.beerWeight), myConfig.getWeightPrecision());
+  json.add(u1 ? PARAM_BEER_VOLUME1 : PARAM_BEER_VOLUME2,
+           convertOutgoingVolume(t.beerVolume), myConfig.getVolumePrecision());
+  json.add(u1 ? PARAM_GLASS1 : PARAM_GLASS2, t.stableGlasses, 1);
+  json.endObject();
+  _events.send(buf.c_str(), "stable", snap.sequence);
+#endif
+}
+
+void KegWebHandler::sendPourEvent(UnitIndex idx, const LevelSnapshot& snap) {
+#if defined(USE_ASYNC_WEB)
+  if (!_events.count()) return;
+
+  const TapSnapshot& t = snap.tap[idx];
+  bool u1 = idx == UnitIndex::U1;
+  JsonBuffer<EVENTS_BUFFER_SIZE> buf;
+  JsonStream json(buf);
+
+  json.beginObject();
+  json.add(u1 ? PARAM_LAST_POUR_WEIGHT1 : PARAM_LAST_POUR_WEIGHT2,
+           convertOutgoingWeight(t.pourWeight), myConfig.getWeightPrecision());
+  json.add(u1 ? PARAM_LAST_POUR_VOLUME1 : PARAM_LAST_POUR_VOLUME2,
+           convertOutgoingVolume(t.pourVolume), myConfig.getVolumePrecision());
+  json.endObject();
+  _events.send(buf.c_str(), "pour", snap.sequence);
+#endif
+}
+
+void KegWebHandler::sendHeartbeatEvent() {
+#if defined(USE_ASYNC_WEB)
+  if (!_events.count()) return;
+
+  LevelSnapshot snap;
+  myAcquisition.read(snap);
+
+  JsonBuffer<EVENTS_BUFFER_SIZE> buf;
+  JsonStream json(buf);
+
+  // The heartbeat carries the current (non stable) values so the live
+  // weights are updated even when no new level is detected.
+  json.beginObject();
+
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    bool u1 = idx == UnitIndex::U1;
+    const TapSnapshot& t = snap.tap[idx];
+
+    if (t.connected) {
+      json.add(u1 ? PARAM_SCALE_WEIGHT1 : PARAM_SCALE_WEIGHT2,
+               convertOutgoingWeight(t.totalRawWeight),
+               myConfig.getWeightPrecision());
+      json.add(u1 ? PARAM_BEER_WEIGHT1 : PARAM_BEER_WEIGHT2,
+               convertOutgoingWeight(t.beerWeight),
+               myConfig.getWeightPrecision());
+      json.add(u1 ? PARAM_BEER_VOLUME1 : PARAM_BEER_VOLUME2,
+               convertOutgoingVolume(t.beerVolume),
+               myConfig.getVolumePrecision());
+    }
+  }
+
+  float f = myTemp.getLastTempC();
+
+  if (!isnan(f)) {
+    json.add(PARAM_TEMP, convertOutgoingTemperature(f), 2);
+  }
+
+  json.endObject();
+  _events.send(buf.c_str(), "heartbeat", snap.sequence);
+#endif
+}
+
+// Helpers for the prometheus text format
+static void metricHeader(Print& out, const char* name, const char* type,
+                         const char* help) {
+  out.print("# HELP ");
+  out.print(name);
+  out.print(' ');
+  out.print(help);
+  out.print("\n# TYPE ");
+  out.print(name);
+  out.print(' ');
+  out.print(type);
+  out.print('\n');
+}
+
+static void metricValue(Print& out, float v, int decimals) {
+  if (isnan(v))
+    out.print("NaN");
+  else
+    out.print(v, decimals);
+  out.print('\n');
+}
+
+static void metricTap(Print& out, const char* name, UnitIndex idx, float v,
+                      int decimals) {
+  out.print(name);
+  out.print(idx == UnitIndex::U1 ? "{tap=\"1\"} " : "{tap=\"2\"} ");
+  metricValue(out, v, decimals);
+}
+
+static void metricTap(Print& out, const char* name, UnitIndex idx,
+                      uint32_t v) {
+  out.print(name);
+  out.print(idx == UnitIndex::U1 ? "{tap=\"1\"} " : "{tap=\"2\"} ");
+  out.print(v);
+  out.print('\n');
+}
+
+static void metricTarget(Print& out, const char* name, PushTarget t,
+                         uint32_t v) {
+  const char* labels[PUSHQUEUE_TARGETS] = {
+      "{target=\"brewspy\"} ", "{target=\"mqtt\"} ",
+      "{target=\"http-post\"} ", "{target=\"http-get\"} "};
+
+  out.print(name);
+  out.print(labels[t]);
+  out.print(v);
+  out.print('\n');
+}
+
+void KegWebHandler::populateMetrics(Print& out) {
+  constexpr auto WEIGHT = "kegmon_scale_weight_kg";
+  constexpr auto KALMAN = "kegmon_kalman_weight_kg";
+  constexpr auto STABLE = "kegmon_stable_weight_kg";
+  constexpr auto POUR = "kegmon_pour_volume_liters";
+  constexpr auto GLASSES = "kegmon_glasses";
+  constexpr auto POURS = "kegmon_pours_total";
+  constexpr auto REJECTED = "kegmon_rejected_samples_total";
+  constexpr auto CONNECTS = "kegmon_scale_connects_total";
+  constexpr auto DISCONNECTS = "kegmon_scale_disconnects_total";
+  constexpr auto DURATION = "kegmon_duration_seconds";
+  constexpr auto QUEUE_DEPTH = "kegmon_push_queue_depth";
+  constexpr auto QUEUE_MAX = "kegmon_push_queue_max_depth";
+  constexpr auto QUEUE_DROPPED = "kegmon_push_queue_dropped_total";
+  constexpr auto PUSH_SENT = "kegmon_push_sent_total";
+  constexpr auto PUSH_FAILED = "kegmon_push_failed_total";
+  constexpr auto PUSH_DROPPED = "kegmon_push_dropped_total";
+  constexpr auto OUTBOX_DEPTH = "kegmon_outbox_depth";
+  constexpr auto OUTBOX_REPLAYED = "kegmon_outbox_replayed_total";
+  constexpr auto OUTBOX_DROPPED = "kegmon_outbox_dropped_total";
+  constexpr auto MQTT_BYTES = "kegmon_mqtt_bytes_total";
+  constexpr auto INFLUX_LINES = "kegmon_influx_lines_total";
+  constexpr auto INFLUX_FAILED = "kegmon_influx_failed_total";
+  constexpr auto INFLUX_DROPPED = "kegmon_influx_dropped_total";
+  constexpr auto DISPLAY_UPDATES = "kegmon_display_updates_total";
+  constexpr auto DISPLAY_SKIPPED = "kegmon_display_skipped_total";
+  constexpr auto PUSH_SUPPRESSED = "kegmon_push_suppressed_total";
+  constexpr auto PUSH_COALESCED = "kegmon_push_coalesced_total";
+  constexpr auto MQTT_LAST = "kegmon_mqtt_last_update_bytes";
+
+  LevelSnapshot snap;
+  myAcquisition.read(snap);
+
+  // Values are always in kg, liters and celsius independent of the
+  // configured units.
+  metricHeader(out, WEIGHT, "gauge", "Last weight read from the scale.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, WEIGHT, idx, snap.tap[idx].totalRawWeight, 3);
+
+  metricHeader(out, KALMAN, "gauge", "Kalman filtered weight.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, KALMAN, idx, snap.tap[idx].kalmanValue, 3);
+
+  metricHeader(out, STABLE, "gauge", "Last stable weight.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, STABLE, idx, snap.tap[idx].statsValue, 3);
+
+  metricHeader(out, POUR, "gauge", "Volume of the last pour.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, POUR, idx, snap.tap[idx].statsPourVolume, 3);
+
+  metricHeader(out, GLASSES, "gauge", "Glasses left in the keg.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, GLASSES, idx, snap.tap[idx].stableGlasses, 1);
+
+  metricHeader(out, POURS, "counter", "Detected pours.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, POURS, idx, snap.tap[idx].pourCount);
+
+  metricHeader(out, REJECTED, "counter", "Samples rejected as invalid.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, REJECTED, idx, snap.tap[idx].rejectedCount);
+
+  metricHeader(out, CONNECTS, "counter", "Times the scale was detected.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, CONNECTS, idx, myScale.getConnectCount(idx));
+
+  metricHeader(out, DISCONNECTS, "counter", "Times the scale was lost.");
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2})
+    metricTap(out, DISCONNECTS, idx, myScale.getDisconnectCount(idx));
+
+  const PushQueue& queue = myPush.getQueue();
+
+  metricHeader(out, QUEUE_DEPTH, "gauge", "Updates waiting to be pushed.");
+  out.print(QUEUE_DEPTH);
+  out.print(' ');
+  out.print(queue.getDepth());
+  out.print('\n');
+
+  metricHeader(out, QUEUE_MAX, "gauge", "Highest push queue depth.");
+  out.print(QUEUE_MAX);
+  out.print(' ');
+  out.print(queue.getMaxDepth());
+  out.print('\n');
+
+  metricHeader(out, QUEUE_DROPPED, "counter", "Updates lost, queue full.");
+  out.print(QUEUE_DROPPED);
+  out.print(' ');
+  out.print(queue.getDropped());
+  out.print('\n');
+
+  metricHeader(out, PUSH_SENT, "counter", "Updates sent per target.");
+  for (int i = 0; i < PUSHQUEUE_TARGETS; i++) {
+    PushTarget t = static_cast<PushTarget>(i);
+    metricTarget(out, PUSH_SENT, t, queue.getTarget(t).sent);
+  }
+
+  metricHeader(out, PUSH_FAILED, "counter", "Failed attempts per target.");
+  for (int i = 0; i < PUSHQUEUE_TARGETS; i++) {
+    PushTarget t = static_cast<PushTarget>(i);
+    metricTarget(out, PUSH_FAILED, t, queue.getTarget(t).failed);
+  }
+
+  metricHeader(out, PUSH_DROPPED, "counter", "Updates given up per target.");
+  for (int i = 0; i < PUSHQUEUE_TARGETS; i++) {
+    PushTarget t = static_cast<PushTarget>(i);
+    metricTarget(out, PUSH_DROPPED, t, queue.getTarget(t).dropped);
+  }
+
+  metricHeader(out, PUSH_SUPPRESSED, "counter", "Updates without change.");
+  for (int i = 0; i < PUSHQUEUE_TARGETS; i++) {
+    PushTarget t = static_cast<PushTarget>(i);
+    metricTarget(out, PUSH_SUPPRESSED, t, myPush.getPolicy(t).getSuppressed());
+  }
+
+  metricHeader(out, PUSH_COALESCED, "counter", "Updates replaced by newer.");
+  for (int i = 0; i < PUSHQUEUE_TARGETS; i++) {
+    PushTarget t = static_cast<PushTarget>(i);
+    metricTarget(out, PUSH_COALESCED, t, myPush.getPolicy(t).getCoalesced());
+  }
+
+  metricHeader(out, OUTBOX_DEPTH, "gauge", "Updates stored in the outbox.");
+  out.print(OUTBOX_DEPTH);
+  out.print(' ');
+  out.print(myPush.getOutboxSize());
+  out.print('\n');
+
+  metricHeader(out, OUTBOX_REPLAYED, "counter", "Updates sent from outbox.");
+  out.print(OUTBOX_REPLAYED);
+  out.print(' ');
+  out.print(myPush.getOutboxReplayed());
+  out.print('\n');
+
+  metricHeader(out, OUTBOX_DROPPED, "counter", "Updates lost, outbox full.");
+  out.print(OUTBOX_DROPPED);
+  out.print(' ');
+  out.print(myPush.getOutboxDropped());
+  out.print('\n');
+
+  const HomeAssist* ha = myPush.getHomeAssist();
+
+  metricHeader(out, MQTT_BYTES, "counter", "Bytes published to mqtt.");
+  out.print(MQTT_BYTES);
+  out.print("{type=\"state\"} ");
+  out.print(ha->getStateBytes());
+  out.print('\n');
+  out.print(MQTT_BYTES);
+  out.print("{type=\"discovery\"} ");
+  out.print(ha->getDiscoveryBytes());
+  out.print('\n');
+
+  metricHeader(out, MQTT_LAST, "gauge", "Bytes in the last mqtt update.");
+  out.print(MQTT_LAST);
+  out.print(' ');
+  out.print(ha->getLastBytes());
+  out.print('\n');
+
+  metricHeader(out, INFLUX_LINES, "counter", "Lines posted to influxdb.");
+  out.print(INFLUX_LINES);
+  out.print(' ');
+  out.print(myInflux.getPosted());
+  out.print('\n');
+
+  metricHeader(out, INFLUX_FAILED, "counter", "Failed influxdb posts.");
+  out.print(INFLUX_FAILED);
+  out.print(' ');
+  out.print(myInflux.getFailed());
+  out.print('\n');
+
+  metricHeader(out, INFLUX_DROPPED, "counter", "Lines not posted to influxdb.");
+  out.print(INFLUX_DROPPED);
+  out.print(' ');
+  out.print(myInflux.getDropped());
+  out.print('\n');
+
+  metricHeader(out, DISPLAY_UPDATES, "counter", "Display updates sent.");
+  out.print(DISPLAY_UPDATES);
+  out.print(' ');
+  out.print(myDisplay.getUpdates());
+  out.print('\n');
+
+  metricHeader(out, DISPLAY_SKIPPED, "counter", "Display updates unchanged.");
+  out.print(DISPLAY_SKIPPED);
+  out.print(' ');
+  out.print(myDisplay.getSkipped());
+  out.print('\n');
+
+  float f = myTemp.getLastTempC();
+
+  if (!isnan(f)) {
+    metricHeader(out, "kegmon_temperature_celsius", "gauge",
+                 "Last temperature.");
+    out.print("kegmon_temperature_celsius ");
+    metricValue(out, f, 2);
+  }
+
+  metricHeader(out, "kegmon_temperature_timeouts_total", "counter",
+               "Temperature conversions without a result.");
+  out.print("kegmon_temperature_timeouts_total ");
+  out.print(myTemp.getTimeouts());
+  out.print('\n');
+
+  metricHeader(out, "kegmon_heap_free_bytes", "gauge", "Free heap.");
+  out.print("kegmon_heap_free_bytes ");
+  out.print(ESP.getFreeHeap());
+  out.print('\n');
+
+#if defined(ESP8266)
+  metricHeader(out, "kegmon_heap_fragmentation_percent", "gauge",
+               "Heap fragmentation.");
+  out.print("kegmon_heap_fragmentation_percent ");
+  out.print(ESP.getHeapFragmentation());
+  out.print('\n');
+#endif
+
+#if defined(USE_ACQUISITION_TASK)
+  metricHeader(out, "kegmon_acquisition_stack_free_bytes", "gauge",
+               "Smallest free stack seen in the acquisition task.");
+  out.print("kegmon_acquisition_stack_free_bytes ");
+  out.print(myAcquisition.getStackFree());
+  out.print('\n');
+#endif
+
+  metricHeader(out, "kegmon_uptime_seconds", "gauge", "Time since start.");
+  out.print("kegmon_uptime_seconds ");
+  out.print(millis() / 1000);
+  out.print('\n');
+
+  // Execution time of the PERF_BEGIN/PERF_END markers
+  metricHeader(out, DURATION, "histogram", "Execution time per marker.");
+
+  for (int i = 0; i < myPerfStats.size(); i++) {
+    PerfMarker m = myPerfStats.get(i);
+    uint32_t cumulative = 0;
+
+    for (int b = 0; b < PERFSTATS_BUCKETS; b++) {
+      cumulative += m.buckets[b];
+      out.print(DURATION);
+      out.print("_bucket{marker=\"");
+      out.print(m.name);
+      out.print("\",le=\"");
+
+      if (b < PERFSTATS_BUCKETS - 1)
+        out.print(PerfStats::getBucketLimit(b) / 1000000.0, 4);
+      else
+        out.print("+Inf");
+
+      out.print("\"} ");
+      out.print(cumulative);
+      out.print('\n');
+    }
+
+    out.print(DURATION);
+    out.print("_sum{marker=\"");
+    out.print(m.name);
+    out.print("\"} ");
+    out.print(static_cast<double>(m.sum) / 1000000.0, 6);
+    out.print('\n');
+    out.print(DURATION);
+    out.print("_count{marker=\"");
+    out.print(m.name);
+    out.print("\"} ");
+    out.print(m.count);
+    out.print('\n');
+  }
+}
+
+void KegWebHandler::webMetrics(WS_PARAM) {
+  Log.notice(F("WEB : webServer callback /metrics." CR));
+
+  WS_SEND_STREAM_BEGIN("text/plain; version=0.0.4");
+  populateMetrics(WS_STREAM);
+  WS_SEND_STREAM_END();
+}
+
+void KegWebHandler::webPerf(WS_PARAM) {
+  Log.notice(F("WEB : webServer callback /api/perf." CR));
+
+  constexpr auto PARAM_PERF_MARKERS = "markers";
+  constexpr auto PARAM_PERF_NAME = "name";
+  constexpr auto PARAM_PERF_COUNT = "count";
+  constexpr auto PARAM_PERF_SAMPLES = "samples";
+  constexpr auto PARAM_PERF_MIN = "min";
+  constexpr auto PARAM_PERF_MAX = "max";
+  constexpr auto PARAM_PERF_MEAN = "mean";
+  constexpr auto PARAM_PERF_P99 = "p99";
+  constexpr auto PARAM_PERF_LOOP = "loop";
+  constexpr auto PARAM_PERF_LOOP_TARGET = "target";
+  constexpr auto PARAM_PERF_LOOP_INTERVAL = "interval";
+  constexpr auto PARAM_PERF_LOOP_TICKS = "ticks";
+  constexpr auto PARAM_PERF_LOOP_OVERRUNS = "overruns";
+  constexpr auto PARAM_PERF_LOOP_LATE = "late";
+  constexpr auto PARAM_PERF_LOOP_LIMIT = "limit";
+  constexpr auto PARAM_PERF_LOOP_PHASES = "phases";
+  constexpr auto PARAM_PERF_LOOP_LAST = "last";
+  constexpr auto PARAM_PERF_TASKS = "tasks";
+  constexpr auto PARAM_PERF_TASK_PERIOD = "period";
+  constexpr auto PARAM_PERF_TASK_DEADLINE = "deadline";
+  constexpr auto PARAM_PERF_TASK_PRIORITY = "priority";
+  constexpr auto PARAM_PERF_TASK_RUNS = "runs";
+  constexpr auto PARAM_PERF_TASK_MISSES = "misses";
+  constexpr auto PARAM_PERF_TASK_SKIPS = "skips";
+  constexpr auto PARAM_PERF_TASK_MAX_LATE = "max-late";
+
+  // Times are in us, min/max/mean/p99 are for the last samples (window) and
+  // count is the total number of calls since start or last clear.
+  WS_SEND_JSON_BEGIN();
+  json.beginObject();
+  json.add(PARAM_PERF_SAMPLES, PERFSTATS_WINDOW);
+  json.beginArray(PARAM_PERF_MARKERS);
+
+  for (int i = 0; i < myPerfStats.size(); i++) {
+    PerfSummary sum = myPerfStats.getSummary(i);
+    PerfMarker m = myPerfStats.get(i);
+
+    json.beginObject();
+    json.add(PARAM_PERF_NAME, m.name);
+    json.add(PARAM_PERF_COUNT, m.count);
+    json.add(PARAM_PERF_SAMPLES, sum.samples);
+    json.add(PARAM_PERF_MIN, sum.min);
+    json.add(PARAM_PERF_MAX, sum.max);
+    json.add(PARAM_PERF_MEAN, sum.mean);
+    json.add(PARAM_PERF_P99, sum.p99);
+    json.endObject();
+  }
+
+  json.endArray();
+
+  // Main loop, intervals in ms and phase times in us
+  json.beginObject(PARAM_PERF_LOOP);
+  json.add(PARAM_PERF_LOOP_TARGET, myLoopTiming.getTarget());
+  json.add(PARAM_PERF_LOOP_INTERVAL, myLoopTiming.getInterval());
+  json.add(PARAM_PERF_MIN, myLoopTiming.getMinInterval());
+  json.add(PARAM_PERF_MAX, myLoopTiming.getMaxInterval());
+  json.add(PARAM_PERF_LOOP_TICKS, myLoopTiming.getTicks());
+  json.add(PARAM_PERF_LOOP_OVERRUNS, myLoopTiming.getOverruns());
+  json.beginArray(PARAM_PERF_LOOP_LATE);
+
+  for (int b = 0; b < LOOPTIMING_BUCKETS; b++) {
+    json.beginObject();
+    if (b < LOOPTIMING_BUCKETS - 1)
+      json.add(PARAM_PERF_LOOP_LIMIT, LoopTiming::getBucketLimit(b));
+    json.add(PARAM_PERF_COUNT, myLoopTiming.getBucket(b));
+    json.endObject();
+  }
+
+  json.endArray();
+  json.beginArray(PARAM_PERF_LOOP_PHASES);
+
+  for (int p = 0; p < LOOPTIMING_PHASES; p++) {
+    json.beginObject();
+    json.add(PARAM_PERF_NAME, LoopTiming::getPhaseName(p));
+    json.add(PARAM_PERF_LOOP_LAST, myLoopTiming.getPhaseLast(p));
+    json.add(PARAM_PERF_MAX, myLoopTiming.getPhaseMax(p));
+    json.endObject();
+  }
+
+  json.endArray();
+  json.endObject();
+
+  // Scheduled tasks, period/deadline/late in ms and execution time in us
+  json.beginArray(PARAM_PERF_TASKS);
+
+  for (int i = 0; i < myScheduler.size(); i++) {
+    const SchedulerTask& t = myScheduler.get(i);
+
+    json.beginObject();
+    json.add(PARAM_PERF_NAME, t.name);
+    json.add(PARAM_PERF_TASK_PERIOD, t.period);
+    json.add(PARAM_PERF_TASK_DEADLINE, t.deadline);
+    json.add(PARAM_PERF_TASK_PRIORITY, static_cast<unsigned int>(t.priority));
+    json.add(PARAM_PERF_TASK_RUNS, t.runs);
+    json.add(PARAM_PERF_TASK_MISSES, t.misses);
+    json.add(PARAM_PERF_TASK_SKIPS, t.skips);
+    json.add(PARAM_PERF_TASK_MAX_LATE, t.maxLate);
+    json.add(PARAM_PERF_LOOP_LAST, t.exec);
+    json.add(PARAM_PERF_MAX, t.maxExec);
+    json.endObject();
+  }
+
+  json.endArray();
+  json.endObject();
+  WS_SEND_JSON_END();
+}
+
+void KegWebHandler::webPerfClear(WS_PARAM) {
+  Log.notice(F("WEB : webServer callback /api/perf/clear." CR));
+  myPerfStats.clear();
+  myLoopTiming.clear();
+  myScheduler.clear();
+  WS_SEND(200, "application/json", "{}");
 }
 
 void KegWebHandler::webStability(WS_PARAM) {
@@ -338,34 +1108,43 @@ void KegWebHandler::webStability(WS_PARAM) {
   constexpr auto PARAM_STABILITY_POPDEV2 = "stability-popdev2";
   constexpr auto PARAM_STABILITY_UBIASDEV1 = "stability-ubiasdev1";
   constexpr auto PARAM_STABILITY_UBIASDEV2 = "stability-ubiasdev2";
-
-  DynamicJsonDocument doc(800);
-
-  Stability* stability1 = myLevelDetection.getStability(UnitIndex::U1);
-  Stability* stability2 = myLevelDetection.getStability(UnitIndex::U2);
-
-  doc[PARAM_WEIGHT_UNIT] = myConfig.getWeightUnit();
-
-  if (stability1->count() > 1) {
-    doc[PARAM_STABILITY_COUNT1] = stability1->count();
-    doc[PARAM_STABILITY_SUM1] = stability1->sum();
-    doc[PARAM_STABILITY_MIN1] = stability1->min();
-    doc[PARAM_STABILITY_MAX1] = stability1->max();
-    doc[PARAM_STABILITY_AVE1] = stability1->average();
-    doc[PARAM_STABILITY_VAR1] = stability1->variance();
-    doc[PARAM_STABILITY_POPDEV1] = stability1->popStdev();
-    doc[PARAM_STABILITY_UBIASDEV1] = stability1->unbiasedStdev();
+  constexpr auto STABILITY_DECIMALS = 6;
+
+  WS_SEND_JSON_BEGIN();
+  json.beginObject();
+
+  LevelSnapshot snap;
+  myAcquisition.read(snap);
+
+  const StabilitySnapshot& stability1 = snap.tap[UnitIndex::U1].stability;
+  const StabilitySnapshot& stability2 = snap.tap[UnitIndex::U2].stability;
+
+  json.add(PARAM_WEIGHT_UNIT, myConfig.getWeightUnit());
+
+  if (stability1.count > 1) {
+    json.add(PARAM_STABILITY_COUNT1, stability1.count);
+    json.add(PARAM_STABILITY_SUM1, stability1.sum, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_MIN1, stability1.min, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_MAX1, stability1.max, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_AVE1, stability1.average, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_VAR1, stability1.variance, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_POPDEV1, stability1.popStdev,
+             STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_UBIASDEV1, stability1.unbiasedStdev,
+             STABILITY_DECIMALS);
   }
 
-  if (stability2->count() > 1) {
-    doc[PARAM_STABILITY_COUNT2] = stability2->count();
-    doc[PARAM_STABILITY_SUM2] = stability2->sum();
-    doc[PARAM_STABILITY_MIN2] = stability2->min();
-    doc[PARAM_STABILITY_MAX2] = stability2->max();
-    doc[PARAM_STABILITY_AVE2] = stability2->average();
-    doc[PARAM_STABILITY_VAR2] = stability2->variance();
-    doc[PARAM_STABILITY_POPDEV2] = stability2->popStdev();
-    doc[PARAM_STABILITY_UBIASDEV2] = stability2->unbiasedStdev();
+  if (stability2.count > 1) {
+    json.add(PARAM_STABILITY_COUNT2, stability2.count);
+    json.add(PARAM_STABILITY_SUM2, stability2.sum, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_MIN2, stability2.min, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_MAX2, stability2.max, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_AVE2, stability2.average, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_VAR2, stability2.variance, STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_POPDEV2, stability2.popStdev,
+             STABILITY_DECIMALS);
+    json.add(PARAM_STABILITY_UBIASDEV2, stability2.unbiasedStdev,
+             STABILITY_DECIMALS);
   }
 
   constexpr auto PARAM_LEVEL_RAW1 = "level-raw1";
@@ -375,48 +1154,41 @@ void KegWebHandler::webStability(WS_PARAM) {
   constexpr auto PARAM_LEVEL_STATISTIC1 = "level-stable1";
   constexpr auto PARAM_LEVEL_STATISTIC2 = "level-stable2";
 
-  if (myLevelDetection.getRawDetection(UnitIndex::U1)->hasRawValue())
-    doc[PARAM_LEVEL_RAW1] =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getRawValue();
-  if (myLevelDetection.getRawDetection(UnitIndex::U1)->hasKalmanValue())
-    doc[PARAM_LEVEL_KALMAN1] =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getKalmanValue();
-  if (myLevelDetection.getStatsDetection(UnitIndex::U1)->hasStableValue())
-    doc[PARAM_LEVEL_STATISTIC1] =
-        myLevelDetection.getStatsDetection(UnitIndex::U1)->getStableValue();
-
-  if (myLevelDetection.getRawDetection(UnitIndex::U2)->hasRawValue())
-    doc[PARAM_LEVEL_RAW2] =
-        myLevelDetection.getRawDetection(UnitIndex::U2)->getRawValue();
-  if (myLevelDetection.getRawDetection(UnitIndex::U2)->hasKalmanValue())
-    doc[PARAM_LEVEL_KALMAN2] =
-        myLevelDetection.getRawDetection(UnitIndex::U2)->getKalmanValue();
-  if (myLevelDetection.getStatsDetection(UnitIndex::U2)->hasStableValue())
-    doc[PARAM_LEVEL_STATISTIC2] =
-        myLevelDetection.getStatsDetection(UnitIndex::U2)->getStableValue();
+  const TapSnapshot& t1 = snap.tap[UnitIndex::U1];
+  const TapSnapshot& t2 = snap.tap[UnitIndex::U2];
+
+  if (t1.hasRawValue)
+    json.add(PARAM_LEVEL_RAW1, t1.rawValue, STABILITY_DECIMALS);
+  if (t1.hasKalmanValue)
+    json.add(PARAM_LEVEL_KALMAN1, t1.kalmanValue, STABILITY_DECIMALS);
+  if (t1.hasStatsValue)
+    json.add(PARAM_LEVEL_STATISTIC1, t1.statsValue, STABILITY_DECIMALS);
+
+  if (t2.hasRawValue)
+    json.add(PARAM_LEVEL_RAW2, t2.rawValue, STABILITY_DECIMALS);
+  if (t2.hasKalmanValue)
+    json.add(PARAM_LEVEL_KALMAN2, t2.kalmanValue, STABILITY_DECIMALS);
+  if (t2.hasStatsValue)
+    json.add(PARAM_LEVEL_STATISTIC2, t2.statsValue, STABILITY_DECIMALS);
 
   float f = myTemp.getLastTempC();
 
   if (!isnan(f)) {
-    doc[PARAM_TEMP] = convertOutgoingTemperature(f);
+    json.add(PARAM_TEMP, convertOutgoingTemperature(f), 2);
   }
 
   float h = myTemp.getLastHumidity();
 
   if (!isnan(h)) {
-    doc[PARAM_HUMIDITY] = h;
+    json.add(PARAM_HUMIDITY, h, 2);
   }
 
+  json.endObject();
+  WS_SEND_JSON_END();
+
 #if LOG_LEVEL == 6
-  serializeJson(doc, Serial);
-  EspSerial.print(CR);
+  printHeap("WEB :");
 #endif
-
-  String out;
-  out.reserve(800);
-  serializeJson(doc, out);
-  doc.clear();
-  WS_SEND(200, "application/json", out.c_str());
 }
 
 void KegWebHandler::webReset(WS_PARAM) {
@@ -436,8 +1208,8 @@ void KegWebHandler::webReset(WS_PARAM) {
 void KegWebHandler::webStabilityClear(WS_PARAM) {
   Log.notice(F("WEB : webServer callback /api/stability/clear." CR));
 
-  myLevelDetection.getStability(UnitIndex::U1)->clear();
-  myLevelDetection.getStability(UnitIndex::U2)->clear();
+  // Cleared by the acquisition before the next level update
+  myAcquisition.scheduleStabilityClear();
   WS_SEND(200, "application/json", "{}");
 }
 
@@ -476,6 +1248,7 @@ void KegWebHandler::webHandleBeerWrite(WS_PARAM) {
 
   _webConfig->parseJson(doc);
   _webConfig->saveFile();
+  myPush.requestDiscovery();  // Beer name and details are part of it
 
   String path = "/beer.htm";
 
@@ -47,6 +47,10 @@ SOFTWARE.
 #include <basewebhandler.hpp>
 #endif
 
+#include <StreamString.h>
+
+#include <acquisition.hpp>
+#include <jsonstream.hpp>
 #include <kegconfig.hpp>
 
 #if defined(ESP8266)
@@ -59,23 +63,24 @@ INCBIN_EXTERN(BackupHtm);
 INCBIN_EXTERN(DashboardHtm);
 #else
 extern const uint8_t calibrationHtmStart[] asm(
-    "_binary_html_calibration_min_htm_start");
+    "_binary_html_calibration_min_htm_gz_start");
 extern const uint8_t calibrationHtmEnd[] asm(
-    "_binary_html_calibration_min_htm_end");
-extern const uint8_t beerHtmStart[] asm("_binary_html_beer_min_htm_start");
-extern const uint8_t beerHtmEnd[] asm("_binary_html_beer_min_htm_end");
+    "_binary_html_calibration_min_htm_gz_end");
+extern const uint8_t beerHtmStart[] asm("_binary_html_beer_min_htm_gz_start");
+extern const uint8_t beerHtmEnd[] asm("_binary_html_beer_min_htm_gz_end");
 extern const uint8_t stabilityHtmStart[] asm(
-    "_binary_html_stability_min_htm_start");
+    "_binary_html_stability_min_htm_gz_start");
 extern const uint8_t stabilityHtmEnd[] asm(
-    "_binary_html_stability_min_htm_end");
-extern const uint8_t graphHtmStart[] asm("_binary_html_graph_min_htm_start");
-extern const uint8_t graphHtmEnd[] asm("_binary_html_graph_min_htm_end");
-extern const uint8_t backupHtmStart[] asm("_binary_html_backup_min_htm_start");
-extern const uint8_t backupHtmEnd[] asm("_binary_html_backup_min_htm_end");
+    "_binary_html_stability_min_htm_gz_end");
+extern const uint8_t graphHtmStart[] asm("_binary_html_graph_min_htm_gz_start");
+extern const uint8_t graphHtmEnd[] asm("_binary_html_graph_min_htm_gz_end");
+extern const uint8_t backupHtmStart[] asm(
+    "_binary_html_backup_min_htm_gz_start");
+extern const uint8_t backupHtmEnd[] asm("_binary_html_backup_min_htm_gz_end");
 extern const uint8_t dashboardHtmStart[] asm(
-    "_binary_html_dashboard_min_htm_start");
+    "_binary_html_dashboard_min_htm_gz_start");
 extern const uint8_t dashboardHtmEnd[] asm(
-    "_binary_html_dashboard_min_htm_end");
+    "_binary_html_dashboard_min_htm_gz_end");
 #endif
 
 #if defined(USE_ASYNC_WEB)
@@ -84,6 +89,7 @@ extern const uint8_t dashboardHtmEnd[] asm(
 #define WS_PARAM AsyncWebServerRequest* request
 #define WS_SEND_STATIC(ptr, size) \
   request->send_P(200, "text/html", (const uint8_t*)ptr, size)
+#define WS_SEND_GZIP(htm) sendGzipHtm(request, htm)
 #define WS_REQ_ARG(key) request->arg(key)
 #define WS_REQ_ARG_NAME(idx) request->argName(idx)
 #define WS_REQ_ARG_CNT() request->args()
@@ -92,12 +98,22 @@ extern const uint8_t dashboardHtmEnd[] asm(
   AsyncWebServerResponse* response = request->beginResponse(code, type, text); \
   response->addHeader("Access-Control-Allow-Origin", "*");                     \
   request->send(response);
+#define WS_SEND_STREAM_BEGIN(type)                                         \
+  AsyncResponseStream* response = request->beginResponseStream(type); \
+  response->addHeader("Access-Control-Allow-Origin", "*")
+#define WS_SEND_STREAM_END() request->send(response)
+#define WS_STREAM (*response)
+#define WS_SEND_JSON_BEGIN()                  \
+  WS_SEND_STREAM_BEGIN("application/json"); \
+  JsonStream json(WS_STREAM)
+#define WS_SEND_JSON_END() WS_SEND_STREAM_END()
 #else
 #define WS_BIND_URL(url, http, func) \
   _server->on(url, http, std::bind(func, this))
 #define WS_PARAM
 #define WS_SEND_STATIC(ptr, size) \
   _server->send_P(200, "text/html", (const char*)ptr, size)
+#define WS_SEND_GZIP(htm) sendGzipHtm(htm)
 #define WS_REQ_ARG(key) _server->arg(key)
 #define WS_REQ_ARG_NAME(idx) _server->argName(idx)
 #define WS_REQ_ARG_CNT() _server->args()
@@ -105,8 +121,65 @@ extern const uint8_t dashboardHtmEnd[] asm(
 #define WS_SEND(code, type, text) \
   _server->enableCORS(true);      \
   _server->send(code, type, text)
+#define WS_SEND_STREAM_BEGIN(type) \
+  ChunkedResponse response(_server, 200, type)
+#define WS_SEND_STREAM_END() response.end()
+#define WS_STREAM response
+#define WS_SEND_JSON_BEGIN()                  \
+  WS_SEND_STREAM_BEGIN("application/json"); \
+  JsonStream json(WS_STREAM)
+#define WS_SEND_JSON_END() WS_SEND_STREAM_END()
+
+#if defined(ESP8266)
+using WebServerType = ESP8266WebServer;
+#else
+using WebServerType = WebServer;
 #endif
 
+// Sends the output as a chunked response through a small buffer so the
+// response can be written directly without knowing the length up front.
+class ChunkedResponse : public Print {
+ private:
+  WebServerType* _server;
+  char _buf[256];
+  size_t _len = 0;
+
+  void sendChunk() {
+    if (_len) _server->sendContent(&_buf[0], _len);
+    _len = 0;
+  }
+
+ public:
+  ChunkedResponse(WebServerType* server, int code, const char* type)
+      : _server(server) {
+    _server->enableCORS(true);
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(code, type, "");
+  }
+
+  size_t write(uint8_t c) override {
+    if (_len >= sizeof(_buf)) sendChunk();
+    _buf[_len++] = c;
+    return 1;
+  }
+
+  void end() {
+    sendChunk();
+    _server->sendContent("");
+  }
+};
+#endif
+
+// Pages are always revalidated with the ETag so an update is picked up
+constexpr auto HTM_CACHE_CONTROL = "no-cache";
+
+// Embedded page that is stored gzip compressed in flash
+struct GzipHtm {
+  const uint8_t* data = 0;
+  size_t size = 0;
+  char etag[11] = "";  // Quoted 32 bit hash of the content
+};
+
 class KegWebHandler :
 #if defined(USE_ASYNC_WEB)
     public BaseAsyncWebHandler
@@ -119,10 +192,22 @@ class KegWebHandler :
 
   void setupWebHandlers();
   void setupAsyncWebHandlers();
-  void populateScaleJson(DynamicJsonDocument& doc);
+  void populateScaleJson(JsonStream& json, const LevelSnapshot& snap);
+  void populateStatusJson(JsonStream& json, const LevelSnapshot& snap);
+  void populateMetrics(Print& out);
+  void webMetrics(WS_PARAM);
+  void webPerf(WS_PARAM);
+  void webPerfClear(WS_PARAM);
   void webScale(WS_PARAM);
   void webScaleTare(WS_PARAM);
   void webScaleFactor(WS_PARAM);
+  void webScalePoint(WS_PARAM);
+  void webCapture(WS_PARAM);
+  void webCaptureStart(WS_PARAM);
+  void webCaptureStop(WS_PARAM);
+  void webScalePointClear(WS_PARAM);
+  void populateCalibrationJson(JsonStream& json, const char* key,
+                               UnitIndex idx);
   void webConfigGet(WS_PARAM);
   void webConfigPost(WS_PARAM);
   void webStatus(WS_PARAM);
@@ -133,53 +218,45 @@ class KegWebHandler :
   void webHandleBrewspy(WS_PARAM);
   void webHandleLogsClear(WS_PARAM);
 
-#if defined(ESP8266)
-  void webCalibrateHtm(WS_PARAM) {
-    WS_SEND_STATIC(gCalibrateHtmData, gCalibrateHtmSize);
-  }
-  void webBeerHtm(WS_PARAM) { WS_SEND_STATIC(gBeerHtmData, gBeerHtmSize); }
-  void webStabilityHtm(WS_PARAM) {
-    WS_SEND_STATIC(gStabilityHtmData, gStabilityHtmSize);
-  }
-  void webGraphHtm(WS_PARAM) { WS_SEND_STATIC(gGraphHtmData, gGraphHtmSize); }
-  void webBackupHtm(WS_PARAM) {
-    WS_SEND_STATIC(gBackupHtmData, gBackupHtmSize);
-  }
-  void webDashboardHtm(WS_PARAM) {
-    WS_SEND_STATIC(gDashboardHtmData, gDashboardHtmSize);
-  }
+#if defined(USE_ASYNC_WEB)
+  AsyncEventSource _events;
+#endif
+
+  // Cached /api/status response, rebuilt when the levels are updated. The
+  // boot id makes sure that an etag from before a restart is not reused.
+  StreamString _statusCache;
+  uint32_t _statusSequence = 0;
+  uint32_t _bootId = 0;
+  char _statusETag[20] = "";
+
+  GzipHtm _calibrationHtm;
+  GzipHtm _beerHtm;
+  GzipHtm _stabilityHtm;
+  GzipHtm _graphHtm;
+  GzipHtm _backupHtm;
+  GzipHtm _dashboardHtm;
+
+  void setupGzipHtm(GzipHtm& htm, const uint8_t* data, size_t size);
+#if defined(USE_ASYNC_WEB)
+  void sendGzipHtm(AsyncWebServerRequest* request, const GzipHtm& htm);
 #else
-  void webCalibrateHtm(WS_PARAM) {
-    WS_SEND_STATIC(
-        (const char*)calibrationHtmStart,
-        strlen(reinterpret_cast<const char*>(&calibrationHtmStart[0])));
-  }
-  void webBeerHtm(WS_PARAM) {
-    WS_SEND_STATIC((const char*)beerHtmStart,
-                   strlen(reinterpret_cast<const char*>(&beerHtmStart[0])));
-  }
-  void webStabilityHtm(WS_PARAM) {
-    WS_SEND_STATIC(
-        (const char*)stabilityHtmStart,
-        strlen(reinterpret_cast<const char*>(&stabilityHtmStart[0])));
-  }
-  void webGraphHtm(WS_PARAM) {
-    WS_SEND_STATIC((const char*)graphHtmStart,
-                   strlen(reinterpret_cast<const char*>(&graphHtmStart[0])));
-  }
-  void webBackupHtm(WS_PARAM) {
-    WS_SEND_STATIC((const char*)backupHtmStart,
-                   strlen(reinterpret_cast<const char*>(&backupHtmStart[0])));
-  }
-  void webDashboardHtm(WS_PARAM) {
-    WS_SEND_STATIC(
-        (const char*)dashboardHtmStart,
-        strlen(reinterpret_cast<const char*>(&dashboardHtmStart[0])));
-  }
+  void sendGzipHtm(const GzipHtm& htm);
 #endif
 
+  void webCalibrateHtm(WS_PARAM) { WS_SEND_GZIP(_calibrationHtm); }
+  void webBeerHtm(WS_PARAM) { WS_SEND_GZIP(_beerHtm); }
+  void webStabilityHtm(WS_PARAM) { WS_SEND_GZIP(_stabilityHtm); }
+  void webGraphHtm(WS_PARAM) { WS_SEND_GZIP(_graphHtm); }
+  void webBackupHtm(WS_PARAM) { WS_SEND_GZIP(_backupHtm); }
+  void webDashboardHtm(WS_PARAM) { WS_SEND_GZIP(_dashboardHtm); }
+
  public:
   explicit KegWebHandler(KegConfig* config);
+
+  // Push changes to clients subscribed to /api/events (async server only)
+  void sendStableEvent(UnitIndex idx, const LevelSnapshot& snap);
+  void sendPourEvent(UnitIndex idx, const LevelSnapshot& snap);
+  void sendHeartbeatEvent();
 };
 
 #endif  // SRC_KEGWEBHANDLER_HPP_
@@ -0,0 +1,172 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_LEVELHISTORY_HPP_
+#define SRC_LEVELHISTORY_HPP_
+
+#include <main.hpp>
+
+constexpr auto LEVEL_HISTORY_POINTS = 128;  // One per display column
+constexpr uint32_t LEVEL_HISTORY_SPAN = 24ul * 60 * 60 * 1000;  // ms
+constexpr uint32_t LEVEL_HISTORY_BUCKET =
+    LEVEL_HISTORY_SPAN / LEVEL_HISTORY_POINTS;  // ms
+constexpr uint16_t LEVEL_HISTORY_EMPTY = 0xffff;
+
+// Downsampled stable levels for one tap, the last stable volume seen within a
+// bucket is stored as ml in a ring buffer. A bucket without a stable reading
+// repeats the previous level, buckets before the first reading are empty.
+class LevelHistory {
+ private:
+  uint16_t _points[LEVEL_HISTORY_POINTS];
+  int _head = 0;  // Slot for the next closed bucket
+  uint32_t _buckets = 0;
+  uint32_t _bucketStart = 0;
+  bool _started = false;
+  uint16_t _current = LEVEL_HISTORY_EMPTY;
+
+  void close() {
+    _points[_head] = _current;
+    _head = (_head + 1) % LEVEL_HISTORY_POINTS;
+    _buckets++;
+  }
+
+ public:
+  LevelHistory() { clear(); }
+
+  void clear() {
+    for (int i = 0; i < LEVEL_HISTORY_POINTS; i++)
+      _points[i] = LEVEL_HISTORY_EMPTY;
+    _head = 0;
+    _buckets = 0;
+    _started = false;
+    _current = LEVEL_HISTORY_EMPTY;
+  }
+
+  // Closes the buckets that have ended, returns the number closed
+  int tick(uint32_t now) {
+    if (!_started) return 0;
+
+    int closed = 0;
+
+    while (now - _bucketStart >= LEVEL_HISTORY_BUCKET) {
+      close();
+      _bucketStart += LEVEL_HISTORY_BUCKET;
+
+      // After a long gap the whole history has been replaced
+      if (++closed >= LEVEL_HISTORY_POINTS) {
+        _bucketStart = now;
+        break;
+      }
+    }
+
+    return closed;
+  }
+
+  // Records a stable level (liters), returns the number of buckets closed
+  int add(uint32_t now, float liters) {
+    if (!_started) {
+      _started = true;
+      _bucketStart = now;
+    }
+
+    int closed = tick(now);
+
+    if (isnan(liters) || liters < 0) liters = 0;
+    float ml = liters * 1000 + 0.5;
+    _current = ml < LEVEL_HISTORY_EMPTY ? static_cast<uint16_t>(ml)
+                                        : LEVEL_HISTORY_EMPTY - 1;
+    return closed;
+  }
+
+  // Number of closed buckets since start, used to detect new points
+  uint32_t getBuckets() const { return _buckets; }
+
+  // Index 0 is the oldest and LEVEL_HISTORY_POINTS-1 the latest closed
+  // bucket, returns NAN for an empty point.
+  float get(int i) const {
+    uint16_t v = _points[(_head + i) % LEVEL_HISTORY_POINTS];
+    return v == LEVEL_HISTORY_EMPTY ? NAN : v / 1000.0;
+  }
+};
+
+constexpr uint8_t LEVEL_SPARKLINE_EMPTY = 0xff;
+
+// Column heights (pixels) for drawing a level history. When new buckets
+// have been closed the columns are shifted and only the new ones are
+// calculated, everything is recalculated when the scale or height changes.
+class LevelSparkline {
+ private:
+  uint8_t _cols[LEVEL_HISTORY_POINTS];
+  uint32_t _buckets = 0;
+  float _full = 0;
+  int _height = 0;
+
+  uint8_t column(const LevelHistory& history, int i) const {
+    float v = history.get(i);
+
+    if (isnan(v)) return LEVEL_SPARKLINE_EMPTY;
+
+    int h = static_cast<int>(v / _full * _height + 0.5);
+    return h < 0 ? 0 : (h > _height ? _height : h);
+  }
+
+ public:
+  LevelSparkline() {
+    for (int i = 0; i < LEVEL_HISTORY_POINTS; i++)
+      _cols[i] = LEVEL_SPARKLINE_EMPTY;
+  }
+
+  // Full is the level (liters) that gives a column of height pixels,
+  // returns the number of columns that were calculated.
+  int update(const LevelHistory& history, float full, int height) {
+    if (full <= 0 || height <= 0 || height >= LEVEL_SPARKLINE_EMPTY) return 0;
+
+    uint32_t n = history.getBuckets() - _buckets;
+
+    if (full != _full || height != _height) n = LEVEL_HISTORY_POINTS;
+    if (n > LEVEL_HISTORY_POINTS) n = LEVEL_HISTORY_POINTS;
+
+    _full = full;
+    _height = height;
+    _buckets = history.getBuckets();
+
+    if (!n) return 0;
+
+    memmove(&_cols[0], &_cols[n], LEVEL_HISTORY_POINTS - n);
+
+    for (int i = LEVEL_HISTORY_POINTS - n; i < LEVEL_HISTORY_POINTS; i++)
+      _cols[i] = column(history, i);
+
+    return n;
+  }
+
+  bool hasScale(float full, int height) const {
+    return full == _full && height == _height;
+  }
+
+  const uint8_t* getColumns() const { return &_cols[0]; }
+};
+
+#endif  // SRC_LEVELHISTORY_HPP_
+
+// EOF
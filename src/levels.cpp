@@ -23,7 +23,7 @@ SOFTWARE.
  */
 #include <kegpush.hpp>
 #include <levels.hpp>
-#include <perf.hpp>
+#include <perfstats.hpp>
 #include <scale.hpp>
 #include <temp_mgr.hpp>
 
@@ -41,8 +41,12 @@ LevelDetection::LevelDetection() {
 }
 
 void LevelDetection::update(UnitIndex idx, float raw, float temp) {
+  _sequence++;
+
   if (isnan(raw)) {
     Log.notice(F("LVL : No valid value read [%d]." CR), idx);
+    _invalid[idx]++;
+    _history[idx].tick(millis());
     return;
   }
 
@@ -68,14 +72,17 @@ void LevelDetection::update(UnitIndex idx, float raw, float temp) {
   float stats = getStatsDetection(idx)->processValue(
       raw, getRawDetection(idx)->getKalmanValue());
 
-  if (getStatsDetection(idx)->newPourValue())
-    pushPourUpdate(idx, getBeerStableVolume(idx), getPourVolume(idx));
-
-  if (getStatsDetection(idx)->newStableValue())
-    pushKegUpdate(idx, getBeerStableVolume(idx), getPourVolume(idx),
-                  getNoStableGlasses(idx));
+  // Push and logging is done by the caller when the counters change so this
+  // can run outside the main loop.
+  if (getStatsDetection(idx)->newPourValue()) _pours[idx]++;
+  if (getStatsDetection(idx)->newStableValue()) _stables[idx]++;
   PERF_END("level-filter-stats");
 
+  if (hasStableWeight(idx))
+    _history[idx].add(millis(), getBeerStableVolume(idx));
+  else
+    _history[idx].tick(millis());
+
   Log.verbose(F("LVL : raw=%F, ave=%F, temp=%F, stat=%F, slope=%F [%d]." CR),
               raw, average, tempCorr, stats, slope, idx);
 }
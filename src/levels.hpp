@@ -27,6 +27,7 @@ SOFTWARE.
 #include <Arduino.h>
 
 #include <kegconfig.hpp>
+#include <levelhistory.hpp>
 #include <levelraw.hpp>
 #include <levelstatistic.hpp>
 #include <stability.hpp>
@@ -41,26 +42,49 @@ class LevelDetection {
   Stability _stability[2];
   RawLevelDetection* _rawLevel[2] = {0, 0};
   StatsLevelDetection* _statsLevel[2] = {0, 0};
+  LevelHistory _history[2];
+  uint32_t _sequence = 0;
+  uint32_t _pours[2] = {0, 0};
+  uint32_t _stables[2] = {0, 0};
+  uint32_t _invalid[2] = {0, 0};
 
   LevelDetection(const LevelDetection&) = delete;
   void operator=(const LevelDetection&) = delete;
 
   void logLevels(float kegVolume1, float kegVolume2, float pourVolume1,
                  float pourVolume2);
-  void pushKegUpdate(UnitIndex idx, float stableVol, float pourVol,
-                     float glasses);
-  void pushPourUpdate(UnitIndex idx, float stableVol, float pourVol);
 
  public:
   LevelDetection();
   void update(UnitIndex idx, float raw, float temp);
 
+  // Sends the new level or pour to the push targets and the level log, called
+  // when getStableCount() or getPourCount() has changed.
+  void pushKegUpdate(UnitIndex idx, float stableVol, float pourVol,
+                     float glasses);
+  void pushPourUpdate(UnitIndex idx, float stableVol, float pourVol);
+
+  // Changes every time update() is called, used to detect new data
+  uint32_t getSequence() { return _sequence; }
+
+  // Counters since startup, samples are rejected when the scale returns an
+  // invalid value or when raw and filtered values differs too much.
+  uint32_t getPourCount(UnitIndex idx) { return _pours[idx]; }
+  uint32_t getStableCount(UnitIndex idx) { return _stables[idx]; }
+  uint32_t getRejectedCount(UnitIndex idx) {
+    return _invalid[idx] + _statsLevel[idx]->getRejectedCount();
+  }
+
   Stability* getStability(UnitIndex idx) { return &_stability[idx]; }
   RawLevelDetection* getRawDetection(UnitIndex idx) { return _rawLevel[idx]; }
   StatsLevelDetection* getStatsDetection(UnitIndex idx) {
     return _statsLevel[idx];
   }
 
+  // Stable beer volume over the last 24 h, other tasks use the copy from
+  // Acquisition::readHistory()
+  const LevelHistory& getHistory(UnitIndex idx) { return _history[idx]; }
+
   // Return values based on the chosen algoritm
   bool hasStableWeight(UnitIndex idx,
                        LevelDetectionType type = myConfig.getLevelDetection());
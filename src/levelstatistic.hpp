@@ -38,6 +38,7 @@ class StatsLevelDetection {
   float _pour = NAN;
   bool _newPour = false;
   bool _newStable = false;
+  uint32_t _rejected = 0;
 
   StatsLevelDetection(const StatsLevelDetection &) = delete;
   void operator=(const StatsLevelDetection &) = delete;
@@ -56,6 +57,7 @@ class StatsLevelDetection {
     Log.notice(F("LVL : Raw and Kalman values differ to much %F, not yet "
                  "stable value [%d]." CR),
                delta, _idx);
+    _rejected++;
     return false;
   }
 
@@ -138,6 +140,7 @@ class StatsLevelDetection {
 
   bool newPourValue() { return _newPour; }
   bool newStableValue() { return _newStable; }
+  uint32_t getRejectedCount() { return _rejected; }
 
   void clear() { _statistic.clear(); }
   float min() { return _statistic.minimum(); }
@@ -0,0 +1,143 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_LINEPROTOCOL_HPP_
+#define SRC_LINEPROTOCOL_HPP_
+
+#include <main.hpp>
+
+// Writes influxdb line protocol into a buffer owned by the caller so many
+// lines can be collected and posted as one request. A line that does not fit
+// is removed again, the lines before it are kept. Fields with NaN values are
+// skipped since influx can not store them.
+class LineProtocol {
+ private:
+  char* _buf;
+  size_t _size;
+  size_t _len = 0;
+  size_t _lineStart = 0;
+  int _lines = 0;
+  int _fields = 0;
+  bool _overflow = false;
+
+  void append(const char* s, size_t n) {
+    if (_overflow || _len + n >= _size) {
+      _overflow = true;
+      return;
+    }
+
+    memcpy(_buf + _len, s, n);
+    _len += n;
+    _buf[_len] = 0;
+  }
+
+  void append(const char* s) { append(s, strlen(s)); }
+
+  // Spaces, commas and equal signs need a backslash in tag values
+  void appendEscaped(const char* s) {
+    for (; *s; s++) {
+      if (*s == ' ' || *s == ',' || *s == '=') append("\\", 1);
+      append(s, 1);
+    }
+  }
+
+ public:
+  LineProtocol(char* buf, size_t size) : _buf(buf), _size(size) {
+    if (_size) _buf[0] = 0;
+  }
+
+  void beginLine(const char* measurement) {
+    _lineStart = _len;
+    _fields = 0;
+    _overflow = false;
+    append(measurement);
+  }
+
+  void tag(const char* key, const char* value) {
+    append(",");
+    append(key);
+    append("=");
+    appendEscaped(value);
+  }
+
+  void field(const char* key, float value, int decimals = 3) {
+    if (isnan(value)) return;
+
+    char buf[24];
+    int n = snprintf(&buf[0], sizeof(buf), "%.*f", decimals, value);
+
+    if (n < 0 || n >= static_cast<int>(sizeof(buf))) return;
+
+    append(_fields++ ? "," : " ");
+    append(key);
+    append("=");
+    append(&buf[0], n);
+  }
+
+  void fieldInt(const char* key, int32_t value) {
+    char buf[16];
+    int n = snprintf(&buf[0], sizeof(buf), "%di", static_cast<int>(value));
+
+    append(_fields++ ? "," : " ");
+    append(key);
+    append("=");
+    append(&buf[0], n);
+  }
+
+  // Timestamp in seconds, 0 leaves it to the server. Returns false if the line
+  // did not fit or had no fields, it is then removed.
+  bool endLine(uint32_t timestamp = 0) {
+    if (timestamp) {
+      char buf[24];
+      snprintf(&buf[0], sizeof(buf), " %u000000000",
+               static_cast<unsigned>(timestamp));
+      append(&buf[0]);
+    }
+
+    append("\n");
+
+    if (_overflow || !_fields) {
+      _len = _lineStart;
+      if (_size) _buf[_len] = 0;
+      return false;
+    }
+
+    _lines++;
+    return true;
+  }
+
+  void clear() {
+    _len = 0;
+    _lineStart = 0;
+    _lines = 0;
+    if (_size) _buf[0] = 0;
+  }
+
+  const char* c_str() const { return _buf; }
+  size_t length() const { return _len; }
+  int getLines() const { return _lines; }
+};
+
+#endif  // SRC_LINEPROTOCOL_HPP_
+
+// EOF
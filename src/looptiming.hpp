@@ -0,0 +1,143 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_LOOPTIMING_HPP_
+#define SRC_LOOPTIMING_HPP_
+
+#include <Arduino.h>
+
+enum LoopPhase {
+  PhaseWeb = 0,
+  PhaseWifi = 1,
+  PhaseScale = 2,
+  PhaseTemp = 3,
+  PhaseLevel = 4,
+  PhaseDisplay = 5,
+  PhasePush = 6
+};
+
+constexpr auto LOOPTIMING_PHASES = 7;
+constexpr auto LOOPTIMING_BUCKETS = 8;
+
+// Measures the actual interval between the main loop ticks and the time spent
+// in each part of the loop. The interval histogram counts how late each tick
+// was compared to the target, a tick that is more than 10% late is counted as
+// an overrun. Phase times are summed over a tick period so the work done
+// outside the tick (web, wifi, scale) is included.
+class LoopTiming {
+ private:
+  uint32_t _target;
+  uint32_t _lastTick = 0;
+  bool _started = false;
+  uint32_t _interval = 0;
+  uint32_t _minInterval = UINT32_MAX;
+  uint32_t _maxInterval = 0;
+  uint32_t _ticks = 0;
+  uint32_t _overruns = 0;
+  uint32_t _buckets[LOOPTIMING_BUCKETS] = {0};
+
+  LoopPhase _phase = LoopPhase::PhaseWeb;
+  uint32_t _phaseStart = 0;
+  uint32_t _phaseSum[LOOPTIMING_PHASES] = {0};   // us, current tick
+  uint32_t _phaseLast[LOOPTIMING_PHASES] = {0};  // us, last tick
+  uint32_t _phaseMax[LOOPTIMING_PHASES] = {0};   // us
+
+ public:
+  explicit LoopTiming(uint32_t target) { _target = target; }
+
+  // Upper limit for each bucket in ms late, the last bucket has no limit
+  static uint32_t getBucketLimit(int b) {
+    static const uint32_t limits[LOOPTIMING_BUCKETS - 1] = {10,  25,  50, 100,
+                                                            250, 500, 1000};
+    return b < LOOPTIMING_BUCKETS - 1 ? limits[b] : UINT32_MAX;
+  }
+
+  static const char* getPhaseName(int p) {
+    static const char* names[LOOPTIMING_PHASES] = {
+        "web", "wifi", "scale", "temp", "level", "display", "push"};
+    return names[p];
+  }
+
+  void beginPhase(LoopPhase p) {
+    _phase = p;
+    _phaseStart = micros();
+  }
+
+  void endPhase() { recordPhase(_phase, micros() - _phaseStart); }
+
+  void recordPhase(LoopPhase p, uint32_t us) { _phaseSum[p] += us; }
+
+  // Called at the start of each tick with the current time in ms
+  void tick(uint32_t now) {
+    if (_started) {
+      _interval = now - _lastTick;
+      _ticks++;
+
+      if (_interval < _minInterval) _minInterval = _interval;
+      if (_interval > _maxInterval) _maxInterval = _interval;
+
+      uint32_t late = _interval > _target ? _interval - _target : 0;
+      int b = 0;
+
+      while (b < LOOPTIMING_BUCKETS - 1 && late > getBucketLimit(b)) b++;
+
+      _buckets[b]++;
+      if (late > _target / 10) _overruns++;
+
+      for (int p = 0; p < LOOPTIMING_PHASES; p++) {
+        _phaseLast[p] = _phaseSum[p];
+        if (_phaseSum[p] > _phaseMax[p]) _phaseMax[p] = _phaseSum[p];
+      }
+    }
+
+    for (int p = 0; p < LOOPTIMING_PHASES; p++) _phaseSum[p] = 0;
+    _lastTick = now;
+    _started = true;
+  }
+
+  void clear() {
+    _minInterval = UINT32_MAX;
+    _maxInterval = 0;
+    _ticks = 0;
+    _overruns = 0;
+
+    for (int b = 0; b < LOOPTIMING_BUCKETS; b++) _buckets[b] = 0;
+    for (int p = 0; p < LOOPTIMING_PHASES; p++) _phaseMax[p] = 0;
+  }
+
+  uint32_t getTarget() const { return _target; }
+  uint32_t getInterval() const { return _interval; }
+  uint32_t getMinInterval() const { return _ticks ? _minInterval : 0; }
+  uint32_t getMaxInterval() const { return _maxInterval; }
+  uint32_t getTicks() const { return _ticks; }
+  uint32_t getOverruns() const { return _overruns; }
+  uint32_t getBucket(int b) const { return _buckets[b]; }
+  uint32_t getPhaseLast(int p) const { return _phaseLast[p]; }
+  uint32_t getPhaseMax(int p) const { return _phaseMax[p]; }
+};
+
+extern LoopTiming myLoopTiming;
+
+#endif  // SRC_LOOPTIMING_HPP_
+
+// EOF
@@ -21,15 +21,20 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
+#include <acquisition.hpp>
+#include <capture.hpp>
 #include <display.hpp>
 #include <displayout.hpp>
+#include <influxexport.hpp>
 #include <kegconfig.hpp>
 #include <kegpush.hpp>
 #include <kegwebhandler.hpp>
+#include <looptiming.hpp>
 #include <main.hpp>
 #include <ota.hpp>
-#include <perf.hpp>
+#include <perfstats.hpp>
 #include <scale.hpp>
+#include <scheduler.hpp>
 #include <serialws.hpp>
 #include <temp_mgr.hpp>
 #include <utils.hpp>
@@ -52,20 +57,33 @@ KegWebHandler myWebHandler(&myConfig);
 KegPushHandler myPush(&myConfig);
 Display myDisplay;
 Scale myScale;
+Capture myCapture;
 LevelDetection myLevelDetection;
 TempSensorManager myTemp;
 #if defined(USE_ASYNC_WEB)
 SerialWebSocket mySerialWebSocket;
 #endif
 DisplayLayout myDisplayLayout;
+Acquisition myAcquisition;
+InfluxExporter myInflux;
 
 const int loopInterval = 2000;
-int loopCounter = 0;
-uint32_t loopMillis = 0;
+LoopTiming myLoopTiming(loopInterval);
+Scheduler myScheduler;
+int levelTask = -1;
 
 void scanI2C(int sda, int scl);
 void logStartup();
 void checkCoreDump();
+void taskLevel();
+void taskDisplay();
+void taskTemp();
+void taskTempReset();
+void taskReconnect();
+void taskPush();
+void taskPushQueue();
+void taskInflux();
+void taskHeap();
 
 void setup() {
 #if defined(PERF_ENABLE)
@@ -175,213 +193,142 @@ void setup() {
   myTemp.read();
   // logStartup();
   delay(3000);
+
+  myAcquisition.begin();
+
+  // Tasks with the same priority run in order of due time, level detection
+  // has the highest priority so a slow push does not delay the scale samples.
+  // Deadlines are in ms after the task is due.
+  levelTask = myScheduler.add("level", taskLevel, loopInterval, 0, 500);
+  myScheduler.add("display", taskDisplay, loopInterval, 1, 1000);
+  myScheduler.add("temp", taskTemp, 250, 2, 2000);
+  myScheduler.add("reconnect", taskReconnect, 5000, 3);
+  myScheduler.add("temp-reset", taskTempReset, 20000, 4);
+  myScheduler.add("push", taskPush, 10000, 5, 10000);
+  myScheduler.add("push-queue", taskPushQueue, 250, 5);
+  myScheduler.add("influx", taskInflux, 1000, 6);
+  myScheduler.add("heap", taskHeap, 20000, 6);
+  myScheduler.start(millis());
 }
 
 void loop() {
-  if (!myWifi.isConnected()) myWifi.connect();
+  myLoopTiming.beginPhase(LoopPhase::PhaseWifi);
+  myWifi.loop();
+  myLoopTiming.endPhase();
 
+  myLoopTiming.beginPhase(LoopPhase::PhaseWeb);
   myWebHandler.loop();
-  myWifi.loop();
 #if defined(USE_ASYNC_WEB)
   mySerialWebSocket.loop();
 #endif
-  myScale.loop(UnitIndex::U1);
-  myScale.loop(UnitIndex::U2);
-
-  if (abs((int32_t)(millis() - loopMillis)) >
-      loopInterval) {  // 2 seconds loop interval
-    loopMillis = millis();
-    loopCounter++;
-
-    // Send updates to push targets at regular intervals (300 seconds / 5min)
-    if (!(loopCounter % 300)) {
-      myPush.pushTempInformation(myTemp.getLastTempC(), true);
-
-      if (myLevelDetection.hasStableWeight(UnitIndex::U1))
-        myPush.pushKegInformation(
-            UnitIndex::U1, myLevelDetection.getBeerStableVolume(UnitIndex::U1),
-            myLevelDetection.getPourVolume(UnitIndex::U1),
-            myLevelDetection.getNoStableGlasses(UnitIndex::U1), true);
-
-      if (myLevelDetection.hasStableWeight(UnitIndex::U2))
-        myPush.pushKegInformation(
-            UnitIndex::U2, myLevelDetection.getBeerStableVolume(UnitIndex::U2),
-            myLevelDetection.getPourVolume(UnitIndex::U2),
-            myLevelDetection.getNoStableGlasses(UnitIndex::U2), true);
-    }
+  myLoopTiming.endPhase();
+
+  // The acquisition task polls the scales itself when it is running
+  if (!myAcquisition.isRunning()) {
+    myLoopTiming.beginPhase(LoopPhase::PhaseScale);
+    myScale.loop(UnitIndex::U1);
+    myScale.loop(UnitIndex::U2);
+    myCapture.loop();
+    myLoopTiming.endPhase();
+  }
 
-    // Try to reconnect to scales if they are missing (60 seconds)
-    if (!(loopCounter % 30)) {
-      if (!myScale.isConnected(UnitIndex::U1) ||
-          !myScale.isConnected(UnitIndex::U2)) {
-        myScale.setup();  // Try to reconnect to scale
-      }
-    }
+  myScheduler.run(millis());
+}
 
-    // Try to reconnect to scales if they are missing (60 seconds)
-    if (!(loopCounter % 10)) {
-      printHeap("Loop:");
-    }
+void taskLevel() {
+  myLoopTiming.tick(millis());
 
-    // The temp sensor should not be read too often. Reading every 10 seconds.
-    if (!(loopCounter % 5)) {
-      myTemp.read();
-    }
+  myLoopTiming.beginPhase(LoopPhase::PhaseLevel);
+  if (!myAcquisition.isRunning()) myAcquisition.sample();
+  bool updated = myAcquisition.loop();
+  myLoopTiming.endPhase();
 
-    // Check if the temp sensor exist and try to reinitialize
-    if (!(loopCounter % 10)) {
-      if (!myTemp.hasSensor()) {
-        myTemp.reset();
-        myTemp.setup();
-      }
-    }
+  if (!updated || !myInflux.isEnabled()) return;
 
-    // printHeap("Loop:");
-
-    // Read the scales, only once per loop
-    float t = myTemp.getLastTempC();
-
-    PERF_BEGIN("loop-scale-read1");
-    myLevelDetection.update(UnitIndex::U1, myScale.read(UnitIndex::U1), t);
-    PERF_END("loop-scale-read1");
-    PERF_BEGIN("loop-scale-read2");
-    myLevelDetection.update(UnitIndex::U2, myScale.read(UnitIndex::U2), t);
-    PERF_END("loop-scale-read2");
-
-    // Update screens
-    PERF_BEGIN("loop-display-default");
-    myDisplayLayout.loop();
-    myDisplayLayout.showCurrent(
-        UnitIndex::U1, myScale.isConnected(UnitIndex::U1),
-        myLevelDetection.getBeerWeight(UnitIndex::U1, LevelDetectionType::RAW),
-        myLevelDetection.getBeerVolume(UnitIndex::U1, LevelDetectionType::RAW),
-        myLevelDetection.getNoGlasses(UnitIndex::U1, LevelDetectionType::STATS),
-        myLevelDetection.getPourVolume(UnitIndex::U1,
-                                       LevelDetectionType::STATS),
-        myTemp.getLastTempC(),
-        myLevelDetection.hasStableWeight(UnitIndex::U1,
-                                         LevelDetectionType::STATS));
-    myDisplayLayout.showCurrent(
-        UnitIndex::U2, myScale.isConnected(UnitIndex::U2),
-        myLevelDetection.getBeerWeight(UnitIndex::U2, LevelDetectionType::RAW),
-        myLevelDetection.getBeerVolume(UnitIndex::U2, LevelDetectionType::RAW),
-        myLevelDetection.getNoGlasses(UnitIndex::U2, LevelDetectionType::STATS),
-        myLevelDetection.getPourVolume(UnitIndex::U2,
-                                       LevelDetectionType::STATS),
-        myTemp.getLastTempC(),
-        myLevelDetection.hasStableWeight(UnitIndex::U2,
-                                         LevelDetectionType::STATS));
-    PERF_END("loop-display-default");
-    PERF_PUSH();
-
-    /*Log.notice(
-        F("LOOP: Reading data raw1=%F,raw2=%F,kalman1=%F,kalman2=%F,stab1=%F, "
-          "stab2=%F,ave1=%F,ave2=%F,min1=%F,min2=%F,max1=%F,max2=%F,pour1=%F,"
-          "pour2=%F" CR),
-        myScale.getTotalRawWeight(UnitIndex::U1),
-        myScale.getTotalRawWeight(UnitIndex::U2),
-        myScale.getTotalWeight(UnitIndex::U1),
-        myScale.getTotalWeight(UnitIndex::U2),
-        myScale.getTotalStableWeight(UnitIndex::U1),
-        myScale.getTotalStableWeight(UnitIndex::U2),
-        myScale.getStatsDetection(UnitIndex::U1)->ave(),
-        myScale.getStatsDetection(UnitIndex::U2)->ave(),
-        myScale.getStatsDetection(UnitIndex::U1)->min(),
-        myScale.getStatsDetection(UnitIndex::U2)->min(),
-        myScale.getStatsDetection(UnitIndex::U1)->max(),
-        myScale.getStatsDetection(UnitIndex::U2)->max(),
-        myScale.getPourWeight(UnitIndex::U1),
-        myScale.getPourWeight(UnitIndex::U2));*/
-    Log.notice(
-        F("LOOP: Reading data raw1=%F,raw2=%F,stable1=%F, "
-          "stable2=%F,pour1=%F,"
-          "pour2=%F" CR),
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getRawValue(),
-        myLevelDetection.getRawDetection(UnitIndex::U2)->getRawValue(),
-        myLevelDetection.getStatsDetection(UnitIndex::U1)->getStableValue(),
-        myLevelDetection.getStatsDetection(UnitIndex::U2)->getStableValue(),
-        myLevelDetection.getStatsDetection(UnitIndex::U1)->getPourValue(),
-        myLevelDetection.getStatsDetection(UnitIndex::U2)->getPourValue());
-
-#if defined(ENABLE_INFLUX_DEBUG)
-    // This part is used to send data to an influxdb in order to get data on
-    // scale stability/drift over time.
-    char buf[250];
-
-    float raw1 = myLevelDetection.getRawDetection(UnitIndex::U1)->getRawValue();
-    float raw2 = myLevelDetection.getRawDetection(UnitIndex::U2)->getRawValue();
-    float stb1 =
-        myLevelDetection.getStatsDetection(UnitIndex::U1)->getStableValue();
-    float stb2 =
-        myLevelDetection.getStatsDetection(UnitIndex::U2)->getStableValue();
-
-    String s;
-    snprintf(&buf[0], sizeof(buf),
-             "debug,host=%s,device=%s "
-             "level-raw1=%f,"
-             "level-raw2=%f",
-             myConfig.getMDNS(), myConfig.getID(), isnan(raw1) ? 0 : raw1,
-             isnan(raw2) ? 0 : raw2);
-    s = &buf[0];
-
-    float ave1 =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getAverageValue();
-    float ave2 =
-        myLevelDetection.getRawDetection(UnitIndex::U2)->getAverageValue();
-
-    snprintf(&buf[0], sizeof(buf), ",level-average1=%f,level-average2=%f",
-             isnan(ave1) ? 0 : ave1, isnan(ave2) ? 0 : ave2);
-    s += &buf[0];
-
-    float kal1 =
-        myLevelDetection.getRawDetection(UnitIndex::U1)->getKalmanValue();
-    float kal2 =
-        myLevelDetection.getRawDetection(UnitIndex::U2)->getKalmanValue();
-
-    snprintf(&buf[0], sizeof(buf), ",level-kalman1=%f,level-kalman2=%f",
-             isnan(kal1) ? 0 : kal1, isnan(kal2) ? 0 : kal2);
-    s += &buf[0];
-
-    float stats1 =
-        myLevelDetection.getStatsDetection(UnitIndex::U1)->getStableValue();
-    float stats2 =
-        myLevelDetection.getStatsDetection(UnitIndex::U2)->getStableValue();
-
-    snprintf(&buf[0], sizeof(buf), ",level-stats1=%f,level-stats2=%f",
-
-             isnan(stats1) ? 0 : stats1, isnan(stats2) ? 0 : stats2);
-    s += &buf[0];
-
-    if (!isnan(myTemp.getLastTempC())) {
-      snprintf(&buf[0], sizeof(buf), ",tempC=%f,tempF=%f",
-               myTemp.getLastTempC(), myTemp.getLastTempF());
-      s = s + &buf[0];
-    }
+  // Only formats the lines, they are posted by the influx task
+  LevelSnapshot snap;
+  myAcquisition.read(snap);
+  myInflux.add(snap, myTemp.getLastTempC(), myTemp.getLastHumidity());
+}
 
-    if (!isnan(myTemp.getLastHumidity())) {
-      snprintf(&buf[0], sizeof(buf), ",humidity=%f", myTemp.getLastHumidity());
-      s = s + &buf[0];
-    }
+void taskDisplay() {
+  LevelSnapshot snap;
+  myAcquisition.read(snap);
 
-    if (!isnan(stb1)) {
-      snprintf(&buf[0], sizeof(buf), ",stable1=%f", stb1);
-      s = s + &buf[0];
-    }
+  myLoopTiming.beginPhase(LoopPhase::PhaseDisplay);
+  PERF_BEGIN("loop-display-default");
+  myDisplayLayout.loop();
 
-    if (!isnan(stb2)) {
-      snprintf(&buf[0], sizeof(buf), ",stable2=%f", stb2);
-      s = s + &buf[0];
-    }
+  for (UnitIndex idx : {UnitIndex::U1, UnitIndex::U2}) {
+    const TapSnapshot& t = snap.tap[idx];
 
-#if LOG_LEVEL == 6
-    Log.verbose(F("LOOP: %s" CR), s.c_str());
-#endif
-    myPush.sendInfluxDb2(s, PUSH_INFLUX_TARGET, PUSH_INFLUX_ORG,
-                         PUSH_INFLUX_BUCKET, PUSH_INFLUX_TOKEN);
-#endif  // ENABLE_INFLUX_DEBUG
+    myDisplayLayout.showCurrent(idx, t.connected, t.liveWeight, t.liveVolume,
+                                t.statsGlasses, t.statsPourVolume,
+                                myTemp.getLastTempC(), t.statsStable);
   }
+
+  PERF_END("loop-display-default");
+  myLoopTiming.endPhase();
+  PERF_PUSH();
+}
+
+// The temp manager starts a conversion every 10 s and picks up the result on
+// a later run, so the loop never waits for the sensor.
+void taskTemp() {
+  myLoopTiming.beginPhase(LoopPhase::PhaseTemp);
+  bool updated = myTemp.loop();
+  myLoopTiming.endPhase();
+
+  if (updated) myWebHandler.sendHeartbeatEvent();
+}
+
+// Check if the temp sensor exist and try to reinitialize
+void taskTempReset() {
+  if (!myTemp.hasSensor()) {
+    myLoopTiming.beginPhase(LoopPhase::PhaseTemp);
+    myTemp.reset();
+    myTemp.setup();
+    myLoopTiming.endPhase();
+  }
+}
+
+void taskReconnect() {
+  myLoopTiming.beginPhase(LoopPhase::PhaseWifi);
+  if (!myWifi.isConnected()) myWifi.connect();
+  myLoopTiming.endPhase();
+}
+
+// Offer the temperature to the push targets, the publish policy decides if
+// it is sent. Keg levels are offered when a new level is found and repeated
+// by the policy heartbeat.
+void taskPush() {
+  myLoopTiming.beginPhase(LoopPhase::PhasePush);
+  myPush.pushTempInformation(myTemp.getLastTempC(), true);
+  myLoopTiming.endPhase();
+}
+
+// Sends the queued updates, the queue handles rate limits and retries
+void taskPushQueue() {
+  myLoopTiming.beginPhase(LoopPhase::PhasePush);
+  myPush.loop();
+  myLoopTiming.endPhase();
 }
 
+// Posts the collected influx lines when a batch is ready
+void taskInflux() {
+#if !defined(USE_ACQUISITION_TASK)
+  // The post blocks the loop that reads the scales, don't delay the level
+  if (myScheduler.getTimeToDue(levelTask, millis()) < INFLUX_POST_TIMEOUT)
+    return;
+#endif
+
+  myLoopTiming.beginPhase(LoopPhase::PhasePush);
+  myInflux.loop();
+  myLoopTiming.endPhase();
+}
+
+void taskHeap() { printHeap("Loop:"); }
+
 void scanI2C(int sda, int scl) {
   byte error, address;
   int n = 0;
@@ -37,13 +37,24 @@ constexpr auto STARTUP_FILENAME = "/startup.log";
 constexpr auto DISPLAY_ADR1 = 0x3c;
 constexpr auto DISPLAY_ADR2 = 0x3d;
 
-constexpr auto JSON_BUFFER = 3000;
+// Worst case for parsing the config with every field at its max length in
+// the UI (ArduinoJson 6, 16 bytes per slot, parsed strings are copied):
+//   ~80 members * 16 B                                          ~1300 B
+//   keys, ~80 * 16 chars                                        ~1300 B
+//   strings: formats 2*400, urls and headers 7*120, tokens and
+//   keys 4*80, influx 50+50+100, mqtt 80+30+30, wifi 2*(32+64),
+//   beer names, formulas and ota url                            ~3100 B
+//   calibration 2 * 15 points * 3 slots * 16 B                  ~1450 B
+// = ~7150 B, rounded up for the base config fields.
+constexpr auto JSON_BUFFER = 8000;
 
 #if defined(ESP8266)
 #define ESP_RESET ESP.reset
+#define ESP_RANDOM ESP.random
 constexpr auto PIN_LED = 2;
 #elif defined(ESP32S2)
 #define ESP_RESET ESP.restart
+#define ESP_RANDOM esp_random
 constexpr auto PIN_LED = BUILTIN_LED;
 #else
 #error "Undefined target platform"
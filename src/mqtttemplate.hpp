@@ -0,0 +1,170 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_MQTTTEMPLATE_HPP_
+#define SRC_MQTTTEMPLATE_HPP_
+
+#include <main.hpp>
+
+constexpr auto MQTT_TEMPLATE_TEXT = 160;    // Constant text after expansion
+constexpr auto MQTT_TEMPLATE_SEGMENTS = 4;  // Max dynamic values + 1
+constexpr auto MQTT_TEMPLATE_VALUE = 16;    // Max length of a formatted value
+
+// Value that is fixed for the lifetime of the template, e.g. ${mdns}
+struct TemplateVar {
+  const char* key;
+  const char* value;
+};
+
+// Value that is formatted each time the template is rendered, e.g. ${volume}
+struct TemplateSlot {
+  const char* key;
+  uint8_t decimals;
+};
+
+// Template that is parsed once into constant text segments, each followed by
+// a dynamic slot. Rendering copies the segments and formats the slot values
+// into a buffer owned by the caller, no memory is allocated. Keys that are
+// not known are kept as text, like the templating engine does.
+class MqttTemplate {
+ private:
+  struct Segment {
+    uint16_t end;  // End of the segment in _text
+    int8_t slot;   // Slot that follows the segment, -1 for none
+  };
+
+  char _text[MQTT_TEMPLATE_TEXT];
+  Segment _segment[MQTT_TEMPLATE_SEGMENTS];
+  int _segments = 0;
+  uint8_t _decimals[MQTT_TEMPLATE_SEGMENTS];
+
+  bool append(int& len, const char* s, int n) {
+    if (len + n >= MQTT_TEMPLATE_TEXT) return false;
+    memcpy(&_text[len], s, n);
+    len += n;
+    return true;
+  }
+
+  static bool match(const char* key, int n, const char* name) {
+    return strlen(name) == static_cast<size_t>(n) && !strncmp(key, name, n);
+  }
+
+ public:
+  MqttTemplate() { _text[0] = 0; }
+
+  // Returns false if the template does not fit, it is then left empty
+  bool compile(const char* tpl, const TemplateVar* vars, int varCount,
+               const TemplateSlot* slots, int slotCount) {
+    int len = 0;
+    _segments = 0;
+
+    while (*tpl) {
+      const char* end = *tpl == '$' && tpl[1] == '{' ? strchr(tpl, '}') : 0;
+
+      if (!end) {
+        if (!append(len, tpl, 1)) break;
+        tpl++;
+        continue;
+      }
+
+      int n = end - tpl + 1;
+      int i = 0;
+
+      while (i < varCount && !match(tpl, n, vars[i].key)) i++;
+
+      if (i < varCount) {
+        if (!append(len, vars[i].value, strlen(vars[i].value))) break;
+        tpl += n;
+        continue;
+      }
+
+      i = 0;
+
+      while (i < slotCount && !match(tpl, n, slots[i].key)) i++;
+
+      if (i < slotCount) {
+        if (_segments >= MQTT_TEMPLATE_SEGMENTS - 1) break;
+        _segment[_segments].end = len;
+        _segment[_segments].slot = i;
+        _decimals[_segments] = slots[i].decimals;
+        _segments++;
+      } else if (!append(len, tpl, n)) {
+        break;
+      }
+
+      tpl += n;
+    }
+
+    if (*tpl) {
+      _segments = 0;
+      _text[0] = 0;
+      return false;
+    }
+
+    _segment[_segments].end = len;
+    _segment[_segments].slot = -1;
+    _segments++;
+    _text[len] = 0;
+    return true;
+  }
+
+  // Values are given in the same order as the slots to compile(). Returns the
+  // length of the output or -1 if it did not fit in the buffer.
+  int render(char* out, size_t size, const float* values) const {
+    size_t len = 0;
+    size_t start = 0;
+
+    if (!size) return -1;
+
+    for (int i = 0; i < _segments; i++) {
+      size_t n = _segment[i].end - start;
+
+      if (len + n >= size) return -1;
+
+      memcpy(out + len, &_text[start], n);
+      len += n;
+      start = _segment[i].end;
+
+      if (_segment[i].slot < 0) continue;
+
+      char buf[MQTT_TEMPLATE_VALUE];
+      int v = snprintf(&buf[0], sizeof(buf), "%.*f", _decimals[i],
+                       values[_segment[i].slot]);
+
+      if (v < 0 || v >= static_cast<int>(sizeof(buf)) || len + v >= size)
+        return -1;
+
+      memcpy(out + len, &buf[0], v);
+      len += v;
+    }
+
+    out[len] = 0;
+    return len;
+  }
+
+  bool isCompiled() const { return _segments > 0; }
+};
+
+#endif  // SRC_MQTTTEMPLATE_HPP_
+
+// EOF
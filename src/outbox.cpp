@@ -0,0 +1,274 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <outbox.hpp>
+
+static size_t getOffset(int record) {
+  return OUTBOX_HEADER_SIZE + record * OUTBOX_RECORD_SIZE;
+}
+
+static bool readRecord(File& f, int record, PushItem& item) {
+  uint8_t buf[OUTBOX_RECORD_SIZE];
+
+  if (!f.seek(getOffset(record)) ||
+      f.read(&buf[0], sizeof(buf)) != sizeof(buf))
+    return false;
+
+  Outbox::decode(&buf[0], item);
+  return true;
+}
+
+static bool writeRecord(File& f, int record, const PushItem& item) {
+  uint8_t buf[OUTBOX_RECORD_SIZE];
+
+  Outbox::encode(item, &buf[0]);
+  return f.seek(getOffset(record)) &&
+         f.write(&buf[0], sizeof(buf)) == sizeof(buf);
+}
+
+static File createOutbox(const char* fname) {
+  File f = LittleFS.open(fname, "w");
+
+  if (f) {
+    const uint8_t header[OUTBOX_HEADER_SIZE] = {'K', 'O', 'B', 'X',
+                                                OUTBOX_VERSION, 0, 0, 0};
+    f.write(&header[0], sizeof(header));
+  }
+
+  return f;
+}
+
+void Outbox::encode(const PushItem& item, uint8_t* buf) {
+  memset(buf, 0, OUTBOX_RECORD_SIZE);
+  memcpy(&buf[0], &item.boot, 4);
+  memcpy(&buf[4], &item.seq, 4);
+  buf[8] = static_cast<uint8_t>(item.type);
+  buf[9] = static_cast<uint8_t>(item.idx);
+  buf[10] = item.targets;
+  memcpy(&buf[12], &item.stableVol, 4);
+  memcpy(&buf[16], &item.pourVol, 4);
+  memcpy(&buf[20], &item.glasses, 4);
+  memcpy(&buf[24], &item.attempts[0], PUSHQUEUE_TARGETS);
+}
+
+void Outbox::decode(const uint8_t* buf, PushItem& item) {
+  item = {};
+  memcpy(&item.boot, &buf[0], 4);
+  memcpy(&item.seq, &buf[4], 4);
+  item.type = static_cast<PushType>(buf[8]);
+  item.idx = static_cast<UnitIndex>(buf[9]);
+  item.targets = buf[10];
+  memcpy(&item.stableVol, &buf[12], 4);
+  memcpy(&item.pourVol, &buf[16], 4);
+  memcpy(&item.glasses, &buf[20], 4);
+  memcpy(&item.attempts[0], &buf[24], PUSHQUEUE_TARGETS);
+  item.persist = true;
+  item.queued = millis();
+}
+
+void Outbox::count(const PushItem& item, int n) {
+  for (int t = 0; t < PUSHQUEUE_TARGETS; t++)
+    if (item.targets & (1 << t)) _targets[t] += n;
+}
+
+void Outbox::load() {
+  _count = 0;
+  _head = 0;
+  for (int t = 0; t < PUSHQUEUE_TARGETS; t++) _targets[t] = 0;
+
+  if (!LittleFS.exists(OUTBOX_FILENAME)) return;
+
+  File f = LittleFS.open(OUTBOX_FILENAME, "r");
+  uint8_t header[OUTBOX_HEADER_SIZE];
+
+  if (!f || f.read(&header[0], sizeof(header)) != sizeof(header) ||
+      memcmp(&header[0], "KOBX", 4) || header[4] != OUTBOX_VERSION) {
+    Log.error(F("PUSH: Outbox file is not valid, removing it." CR));
+    f.close();
+    LittleFS.remove(OUTBOX_FILENAME);
+    return;
+  }
+
+  int records = (f.size() - OUTBOX_HEADER_SIZE) / OUTBOX_RECORD_SIZE;
+  _head = header[6] | (header[7] << 8);
+
+  if (_head > records) _head = records;
+
+  PushItem item;
+
+  while (_head + _count < records && readRecord(f, _head + _count, item)) {
+    count(item, 1);
+    _count++;
+  }
+
+  f.close();
+
+  if (_count)
+    Log.notice(F("PUSH: %d updates waiting in outbox." CR), _count);
+  else
+    clear();
+}
+
+bool Outbox::writeHead() {
+  File f = LittleFS.open(OUTBOX_FILENAME, "r+");
+
+  if (!f) return false;
+
+  const uint8_t head[2] = {static_cast<uint8_t>(_head & 0xff),
+                           static_cast<uint8_t>(_head >> 8)};
+  bool ok = f.seek(6) && f.write(&head[0], sizeof(head)) == sizeof(head);
+  f.close();
+  return ok;
+}
+
+// Copies the records in use to a new file
+bool Outbox::compact() {
+  File in = LittleFS.open(OUTBOX_FILENAME, "r");
+  File out = createOutbox(OUTBOX_TMP_FILENAME);
+
+  if (!in || !out) {
+    Log.error(F("PUSH: Unable to compact outbox." CR));
+    return writeHead();
+  }
+
+  PushItem item;
+
+  for (int i = 0; i < _count && readRecord(in, _head + i, item); i++)
+    writeRecord(out, i, item);
+
+  in.close();
+  out.close();
+  LittleFS.remove(OUTBOX_FILENAME);
+  LittleFS.rename(OUTBOX_TMP_FILENAME, OUTBOX_FILENAME);
+  _head = 0;
+  return true;
+}
+
+bool Outbox::append(const PushItem& item) {
+  if (size() >= OUTBOX_MAX_RECORDS) {
+    pop();
+    _dropped++;
+  }
+
+  File f = _count ? LittleFS.open(OUTBOX_FILENAME, "a")
+                  : createOutbox(OUTBOX_FILENAME);
+
+  if (!f) {
+    Log.error(F("PUSH: Unable to write to outbox." CR));
+    _dropped++;
+    return false;
+  }
+
+  uint8_t buf[OUTBOX_RECORD_SIZE];
+  encode(item, &buf[0]);
+  f.write(&buf[0], sizeof(buf));
+  f.close();
+  count(item, 1);
+  _count++;
+
+#if LOG_LEVEL == 6
+  Log.verbose(F("PUSH: Added update %d to outbox, %d waiting." CR), item.seq,
+              _count);
+#endif
+  return true;
+}
+
+bool Outbox::get(int i, PushItem& item) {
+  if (i < 0 || i >= size()) return false;
+
+  File f = LittleFS.open(OUTBOX_FILENAME, "r");
+
+  if (!f) return false;
+
+  bool ok = readRecord(f, _head + i, item);
+  f.close();
+  return ok;
+}
+
+int Outbox::find(PushTarget t, PushItem& item) {
+  if (!hasTarget(t)) return -1;
+
+  File f = LittleFS.open(OUTBOX_FILENAME, "r");
+
+  if (!f) return -1;
+
+  for (int i = 0; i < _count && readRecord(f, _head + i, item); i++) {
+    if (item.targets & (1 << t)) {
+      f.close();
+      return i;
+    }
+  }
+
+  f.close();
+  return -1;
+}
+
+bool Outbox::update(int i, const PushItem& item) {
+  if (i < 0 || i >= size()) return false;
+
+  File f = LittleFS.open(OUTBOX_FILENAME, "r+");
+  PushItem old;
+
+  if (!f || !readRecord(f, _head + i, old) ||
+      !writeRecord(f, _head + i, item)) {
+    Log.error(F("PUSH: Unable to update outbox." CR));
+    f.close();
+    return false;
+  }
+
+  f.close();
+  count(old, -1);
+  count(item, 1);
+
+  // Remove the records at the head that all targets are done with
+  while (_count && get(0, old) && !old.targets) pop();
+
+  return true;
+}
+
+// Removes the oldest update by moving the head
+bool Outbox::pop() {
+  PushItem item;
+
+  if (!get(0, item)) return false;
+
+  count(item, -1);
+  _head++;
+  _count--;
+
+  if (!_count) {
+    clear();
+    return true;
+  }
+
+  return _head >= OUTBOX_MAX_RECORDS ? compact() : writeHead();
+}
+
+void Outbox::clear() {
+  LittleFS.remove(OUTBOX_FILENAME);
+  _count = 0;
+  _head = 0;
+  for (int t = 0; t < PUSHQUEUE_TARGETS; t++) _targets[t] = 0;
+}
+
+// EOF
@@ -0,0 +1,96 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_OUTBOX_HPP_
+#define SRC_OUTBOX_HPP_
+
+#include <main.hpp>
+#include <pushqueue.hpp>
+
+constexpr auto OUTBOX_FILENAME = "/outbox.bin";
+constexpr auto OUTBOX_TMP_FILENAME = "/outbox.tmp";
+constexpr auto OUTBOX_VERSION = 2;
+constexpr auto OUTBOX_MAX_RECORDS = 100;
+constexpr auto OUTBOX_HEADER_SIZE = 8;
+constexpr auto OUTBOX_RECORD_SIZE = 28;
+
+// Pour and level updates that could not be delivered, stored on LittleFS so
+// they survive a restart and replayed oldest first when the network is back.
+// Each target is replayed on its own, a record is removed when all targets
+// are done with it. Removing the oldest record only moves the head in the
+// header, the file is compacted when the head has passed the max number of
+// records or removed when it's empty.
+//
+// File format (little endian):
+//   header: "KOBX", u8 version, u8 padding, u16 head (first record in use)
+//   record: u32 boot, u32 sequence, u8 type, u8 tap, u8 targets, u8 padding,
+//           f32 stable volume, f32 pour volume, f32 glasses,
+//           u8 failed attempts per target (4)
+// Boot and sequence form the idempotency key for the update.
+class Outbox {
+ private:
+  int _count = -1;  // Records in use, read from the file on first use
+  int _head = 0;    // Position of the oldest record in the file
+  int _targets[PUSHQUEUE_TARGETS] = {0};  // Records waiting per target
+  uint32_t _dropped = 0;
+
+  Outbox(const Outbox&) = delete;
+  void operator=(const Outbox&) = delete;
+
+  void load();
+  void count(const PushItem& item, int n);
+  bool writeHead();
+  bool compact();
+
+ public:
+  Outbox() {}
+
+  static void encode(const PushItem& item, uint8_t* buf);
+  static void decode(const uint8_t* buf, PushItem& item);
+
+  // Drops the oldest record when full
+  bool append(const PushItem& item);
+  bool peek(PushItem& item) { return get(0, item); }
+  bool get(int i, PushItem& item);
+
+  // Returns the position of the oldest record for the target, -1 if none
+  int find(PushTarget t, PushItem& item);
+
+  // Saves the targets and attempts that are left for a record, done records
+  // at the head are removed.
+  bool update(int i, const PushItem& item);
+  bool updateFirst(const PushItem& item) { return update(0, item); }
+  bool pop();
+  void clear();
+
+  int size() {
+    if (_count < 0) load();
+    return _count;
+  }
+  bool hasTarget(PushTarget t) { return size() && _targets[t]; }
+  uint32_t getDropped() { return _dropped; }
+};
+
+#endif  // SRC_OUTBOX_HPP_
+
+// EOF
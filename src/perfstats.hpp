@@ -0,0 +1,255 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_PERFSTATS_HPP_
+#define SRC_PERFSTATS_HPP_
+
+#include <Arduino.h>
+
+// The table is static RAM that is always used, about 200 bytes per marker
+// with a window of 32 samples. The ESP8266 has 26 markers and little RAM to
+// spare so it gets a smaller table and window.
+#if defined(ESP8266)
+constexpr auto PERFSTATS_MAX_MARKERS = 28;
+constexpr auto PERFSTATS_WINDOW = 16;  // Last samples kept per marker
+#else
+constexpr auto PERFSTATS_MAX_MARKERS = 32;
+constexpr auto PERFSTATS_WINDOW = 32;
+#endif
+constexpr auto PERFSTATS_BUCKETS = 10;
+constexpr int8_t PERFSTATS_UNRESOLVED = -2;  // Marker id not looked up yet
+
+struct PerfMarker {
+  const char* name = 0;
+  uint32_t start = 0;
+  uint8_t depth = 0;  // Begin calls without an end
+  uint32_t count = 0;
+  uint64_t sum = 0;                           // us
+  uint32_t buckets[PERFSTATS_BUCKETS] = {0};  // Not cumulative
+  uint32_t window[PERFSTATS_WINDOW] = {0};    // us, ring buffer
+  uint8_t next = 0;
+  uint8_t samples = 0;
+};
+
+// Statistics over the samples in the window, all values in us
+struct PerfSummary {
+  uint32_t samples = 0;
+  uint32_t min = 0;
+  uint32_t max = 0;
+  uint32_t mean = 0;
+  uint32_t p99 = 0;
+};
+
+// Collects execution times for the PERF_BEGIN/PERF_END markers in a fixed
+// table so the data is always available on the device, independent of the
+// influx push enabled with PERF_ENABLE. Each marker keeps a latency histogram
+// with fixed buckets and a window with the latest samples, recording a value
+// is a few additions and the window statistics are only calculated when asked
+// for.
+//
+// Markers are referenced by their index in the table, the PERF macros look up
+// the name once and cache the index per call site. When the same marker is
+// started again before it has ended (nested or from another task) the time
+// is measured from the first begin to the last end.
+class PerfStats {
+ private:
+  PerfMarker _markers[PERFSTATS_MAX_MARKERS];
+  int _size = 0;
+#if defined(ESP32)
+  portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+  // Markers are used from the loop, the acquisition task and the web server
+  // task on ESP32. The lock is only held while the table is updated.
+  void lock() {
+#if defined(ESP32)
+    portENTER_CRITICAL(&_lock);
+#endif
+  }
+
+  void unlock() {
+#if defined(ESP32)
+    portEXIT_CRITICAL(&_lock);
+#endif
+  }
+
+  int findLocked(const char* name) {
+    // Markers are string literals so the pointer is normally enough
+    for (int i = 0; i < _size; i++)
+      if (_markers[i].name == name) return i;
+
+    for (int i = 0; i < _size; i++)
+      if (!strcmp(_markers[i].name, name)) return i;
+
+    if (_size >= PERFSTATS_MAX_MARKERS) return -1;
+
+    _markers[_size].name = name;
+    return _size++;
+  }
+
+  void add(PerfMarker& m, uint32_t us) {
+    int b = 0;
+
+    while (b < PERFSTATS_BUCKETS - 1 && us > getBucketLimit(b)) b++;
+
+    m.buckets[b]++;
+    m.count++;
+    m.sum += us;
+
+    m.window[m.next] = us;
+    m.next = (m.next + 1) % PERFSTATS_WINDOW;
+    if (m.samples < PERFSTATS_WINDOW) m.samples++;
+  }
+
+ public:
+  // Returns the index for the marker, it's added if not found. Returns -1
+  // when the table is full.
+  int find(const char* name) {
+    lock();
+    int id = findLocked(name);
+    unlock();
+    return id;
+  }
+
+  // Upper bound of each bucket in us, the last bucket has no limit (+Inf)
+  static uint32_t getBucketLimit(int b) {
+    static const uint32_t limits[PERFSTATS_BUCKETS - 1] = {
+        100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000};
+    return b < PERFSTATS_BUCKETS - 1 ? limits[b] : UINT32_MAX;
+  }
+
+  void begin(int id) {
+    if (id < 0) return;
+
+    uint32_t now = micros();
+    lock();
+    PerfMarker& m = _markers[id];
+    if (!m.depth++) m.start = now;
+    unlock();
+  }
+
+  void end(int id) {
+    if (id < 0) return;
+
+    uint32_t now = micros();
+    lock();
+    PerfMarker& m = _markers[id];
+    if (m.depth && !--m.depth) add(m, now - m.start);
+    unlock();
+  }
+
+  void record(const char* name, uint32_t us) {
+    lock();
+    int id = findLocked(name);
+    if (id >= 0) add(_markers[id], us);
+    unlock();
+  }
+
+  PerfSummary getSummary(int i) {
+    PerfSummary s;
+    uint32_t window[PERFSTATS_WINDOW];
+    uint32_t sorted[PERFSTATS_WINDOW];
+    uint64_t sum = 0;
+
+    lock();
+    int samples = _markers[i].samples;
+    memcpy(&window[0], &_markers[i].window[0], sizeof(window));
+    unlock();
+
+    if (!samples) return s;
+
+    // Insertion sort, the window is small
+    for (int j = 0; j < samples; j++) {
+      uint32_t v = window[j];
+      int k = j;
+
+      while (k > 0 && sorted[k - 1] > v) {
+        sorted[k] = sorted[k - 1];
+        k--;
+      }
+
+      sorted[k] = v;
+      sum += v;
+    }
+
+    s.samples = samples;
+    s.min = sorted[0];
+    s.max = sorted[samples - 1];
+    s.mean = sum / samples;
+    s.p99 = sorted[(samples * 99 + 99) / 100 - 1];
+    return s;
+  }
+
+  void clear() {
+    lock();
+
+    for (int i = 0; i < _size; i++) {
+      const char* name = _markers[i].name;
+      uint8_t depth = _markers[i].depth;
+      _markers[i] = PerfMarker();
+      _markers[i].name = name;
+      _markers[i].depth = depth;
+    }
+
+    unlock();
+  }
+
+  int size() const { return _size; }
+
+  // Returns a copy so the values are consistent
+  PerfMarker get(int i) {
+    lock();
+    PerfMarker m = _markers[i];
+    unlock();
+    return m;
+  }
+};
+
+extern PerfStats myPerfStats;
+
+// The id is resolved on the first call and then kept by the caller
+void perfBegin(const char* name, int8_t& id);
+void perfEnd(const char* name, int8_t& id);
+
+// Route the framework markers through the local statistics, the framework
+// implementation is still called from perfBegin()/perfEnd(). Each call site
+// keeps the marker index in a static so the name is only looked up once.
+#if !defined(PERFSTATS_NO_MACROS)
+#include <perf.hpp>
+#undef PERF_BEGIN
+#undef PERF_END
+#define PERF_BEGIN(s)                            \
+  do {                                           \
+    static int8_t perfId = PERFSTATS_UNRESOLVED; \
+    perfBegin(s, perfId);                        \
+  } while (0)
+#define PERF_END(s)                              \
+  do {                                           \
+    static int8_t perfId = PERFSTATS_UNRESOLVED; \
+    perfEnd(s, perfId);                          \
+  } while (0)
+#endif
+
+#endif  // SRC_PERFSTATS_HPP_
+
+// EOF
@@ -0,0 +1,124 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_PUBLISHPOLICY_HPP_
+#define SRC_PUBLISHPOLICY_HPP_
+
+#include <main.hpp>
+
+enum PolicyChannel { ChannelKeg1 = 0, ChannelKeg2 = 1, ChannelTemp = 2 };
+
+constexpr auto POLICY_CHANNELS = 3;
+
+struct PublishLimits {
+  float minDelta;        // Smaller changes are not published
+  uint32_t minInterval;  // ms, changes that come faster are coalesced
+  uint32_t heartbeat;    // ms, republish an unchanged value, 0 = never
+};
+
+// Decides when a value (keg level per tap or temperature) is published to a
+// target. Changes below the minimum delta are suppressed, changes that come
+// before the minimum interval are held back and only the latest is published
+// when the interval has passed. An unchanged value is published again after
+// the heartbeat time so the target knows the device is alive.
+class PublishPolicy {
+ private:
+  struct ChannelState {
+    bool sent;
+    bool pending;   // A change is waiting for the interval to pass
+    float value;    // Last published value
+    uint32_t last;  // ms
+  };
+
+  PublishLimits _limits[POLICY_CHANNELS];
+  ChannelState _state[POLICY_CHANNELS];
+  uint32_t _suppressed = 0;
+  uint32_t _coalesced = 0;
+
+ public:
+  PublishPolicy() {
+    for (int c = 0; c < POLICY_CHANNELS; c++) {
+      _limits[c] = {};
+      _state[c] = {};
+    }
+  }
+
+  void setLimits(PolicyChannel c, const PublishLimits& limits) {
+    _limits[c] = limits;
+  }
+
+  // Returns true if the value should be published now, it is then recorded
+  // as sent.
+  bool offer(PolicyChannel c, float value, uint32_t now) {
+    ChannelState& s = _state[c];
+    const PublishLimits& l = _limits[c];
+    uint32_t age = now - s.last;
+
+    if (s.sent) {
+      bool changed = fabs(value - s.value) >= l.minDelta;
+
+      if (!changed && !(l.heartbeat && age >= l.heartbeat)) {
+        s.pending = false;
+        _suppressed++;
+        return false;
+      }
+
+      if (age < l.minInterval) {
+        if (s.pending) _coalesced++;
+        s.pending = true;
+        return false;
+      }
+    }
+
+    markSent(c, value, now);
+    return true;
+  }
+
+  // True when a held back change can be sent or the heartbeat time has
+  // passed.
+  bool isDue(PolicyChannel c, uint32_t now) const {
+    const ChannelState& s = _state[c];
+    const PublishLimits& l = _limits[c];
+    uint32_t age = now - s.last;
+
+    if (s.pending) return age >= l.minInterval;
+    return s.sent && l.heartbeat && age >= l.heartbeat;
+  }
+
+  bool isPending(PolicyChannel c) const { return _state[c].pending; }
+
+  void markSent(PolicyChannel c, float value, uint32_t now) {
+    ChannelState& s = _state[c];
+    s.sent = true;
+    s.pending = false;
+    s.value = value;
+    s.last = now;
+  }
+
+  uint32_t getSuppressed() const { return _suppressed; }
+  uint32_t getCoalesced() const { return _coalesced; }
+};
+
+#endif  // SRC_PUBLISHPOLICY_HPP_
+
+// EOF
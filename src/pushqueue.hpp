@@ -0,0 +1,212 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_PUSHQUEUE_HPP_
+#define SRC_PUSHQUEUE_HPP_
+
+#include <main.hpp>
+
+enum PushTarget {
+  TargetBrewspy = 0,
+  TargetHomeAssist = 1,
+  TargetHttpPost = 2,
+  TargetHttpGet = 3
+};
+enum PushType { PushTemp = 0, PushPour = 1, PushKeg = 2 };
+// A rejected item is done with but counted as failed, sending it again would
+// fail the same way
+enum PushResult { PushFailed = 0, PushSent = 1, PushRejected = 2 };
+
+constexpr auto PUSHQUEUE_TARGETS = 4;
+constexpr auto PUSHQUEUE_SIZE = 16;
+constexpr auto PUSHQUEUE_BACKOFF_MIN = 5000;    // ms
+constexpr auto PUSHQUEUE_BACKOFF_MAX = 300000;  // ms
+constexpr auto PUSHQUEUE_MAX_ATTEMPTS = 10;     // per item and target
+
+struct PushItem {
+  PushType type;
+  UnitIndex idx;
+  uint8_t targets;  // Bit per target that has not received the item yet
+  float tempC;
+  float stableVol;
+  float pourVol;
+  float glasses;
+  uint32_t queued;  // ms
+  bool persist;     // Kept in the outbox if it can not be delivered
+  uint32_t boot;    // Boot id and sequence are used as idempotency key
+  uint32_t seq;
+  uint8_t attempts[PUSHQUEUE_TARGETS];  // Failed replays from the outbox
+};
+
+struct PushTargetState {
+  uint32_t interval;  // ms, minimum time between two sends (rate limit)
+  uint32_t next;      // ms, earliest time for the next send
+  uint32_t failures;  // in a row, used for the backoff
+  uint32_t sent;
+  uint32_t failed;
+  uint32_t dropped;
+};
+
+// Bounded queue between the level detection and the push targets. Adding
+// never blocks, the items are sent from the main loop by drain() with at most
+// one item per target and call. Each target has its own rate limit and
+// exponential backoff after a failure so a target that is down does not
+// delay the others. Newer temperature and keg levels replace the ones that are
+// still waiting and are moved last, pours are always sent one by one. When
+// the queue is full the oldest item is dropped, items that are dropped or
+// given up are handed back to the caller so they can be stored elsewhere.
+class PushQueue {
+ private:
+  PushItem _items[PUSHQUEUE_SIZE];
+  int _count = 0;
+  PushTargetState _targets[PUSHQUEUE_TARGETS];
+  uint32_t _added = 0;
+  uint32_t _dropped = 0;
+  int _maxDepth = 0;
+
+  void remove(int i) {
+    for (int j = i; j < _count - 1; j++) _items[j] = _items[j + 1];
+    _count--;
+  }
+
+ public:
+  PushQueue() {
+    for (int t = 0; t < PUSHQUEUE_TARGETS; t++) _targets[t] = {};
+  }
+
+  void setRateLimit(PushTarget t, uint32_t interval) {
+    _targets[t].interval = interval;
+  }
+
+  // Returns true if the oldest item was dropped to make room, it is then
+  // copied to dropped (if set).
+  bool add(const PushItem& item, PushItem* dropped = nullptr) {
+    if (!item.targets) return false;
+
+    PushItem added = item;
+    _added++;
+
+    // The replaced item is removed and the new one is added last, a keg level
+    // includes the pours before it so it must not be sent before them.
+    if (item.type != PushType::PushPour) {
+      for (int i = 0; i < _count; i++) {
+        const PushItem& p = _items[i];
+
+        if (p.type == item.type &&
+            (item.type == PushType::PushTemp || p.idx == item.idx)) {
+          added.targets |= p.targets;
+          added.persist = added.persist || p.persist;
+          remove(i);
+          break;
+        }
+      }
+    }
+
+    bool full = _count == PUSHQUEUE_SIZE;
+
+    if (full) {
+      if (dropped) *dropped = _items[0];
+      remove(0);
+      _dropped++;
+    }
+
+    _items[_count++] = added;
+    if (_count > _maxDepth) _maxDepth = _count;
+    return full;
+  }
+
+  template <typename F>
+  int drain(uint32_t now, F send) {
+    return drain(now, send, [](PushTarget, const PushItem&) {});
+  }
+
+  // Sends the oldest item for each target that is allowed to send. The
+  // sender is called as send(PushTarget, const PushItem&) and returns true or
+  // a PushResult, giveUp is called the same way when an item has failed too
+  // many times. Returns the number of send attempts.
+  template <typename F, typename G>
+  int drain(uint32_t now, F send, G giveUp) {
+    int attempts = 0;
+
+    for (int t = 0; t < PUSHQUEUE_TARGETS; t++) {
+      PushTargetState& st = _targets[t];
+      uint8_t bit = 1 << t;
+      int i = 0;
+
+      if (static_cast<int32_t>(now - st.next) < 0) continue;
+
+      while (i < _count && !(_items[i].targets & bit)) i++;
+
+      if (i == _count) continue;
+
+      attempts++;
+
+      int result = send(static_cast<PushTarget>(t), _items[i]);
+
+      if (result == PushResult::PushSent) {
+        _items[i].targets &= ~bit;
+        st.sent++;
+        st.failures = 0;
+        st.next = now + st.interval;
+      } else if (result == PushResult::PushRejected) {
+        _items[i].targets &= ~bit;
+        st.failed++;
+        st.failures = 0;
+        st.next = now + st.interval;
+      } else {
+        st.failed++;
+        st.failures++;
+
+        // 5, 10, 20, 40 ... seconds up to the max
+        uint32_t backoff = st.failures < 16
+                               ? PUSHQUEUE_BACKOFF_MIN << (st.failures - 1)
+                               : PUSHQUEUE_BACKOFF_MAX;
+        if (backoff > PUSHQUEUE_BACKOFF_MAX) backoff = PUSHQUEUE_BACKOFF_MAX;
+
+        st.next = now + backoff;
+
+        // Give up on this item so the target is not blocked for ever
+        if (st.failures >= PUSHQUEUE_MAX_ATTEMPTS) {
+          giveUp(static_cast<PushTarget>(t), _items[i]);
+          _items[i].targets &= ~bit;
+          st.dropped++;
+          st.failures = 0;
+        }
+      }
+
+      if (!_items[i].targets) remove(i);
+    }
+
+    return attempts;
+  }
+
+  int getDepth() const { return _count; }
+  int getMaxDepth() const { return _maxDepth; }
+  uint32_t getAdded() const { return _added; }
+  uint32_t getDropped() const { return _dropped; }
+  const PushTargetState& getTarget(PushTarget t) const { return _targets[t]; }
+};
+
+#endif  // SRC_PUSHQUEUE_HPP_
+
+// EOF
@@ -26,13 +26,13 @@ SOFTWARE.
 
 INCBIN(IndexHtm, "html/index.min.htm");
 INCBIN(ConfigHtm, "html/config.min.htm");
-INCBIN(CalibrateHtm, "html/calibration.min.htm");
+INCBIN(CalibrateHtm, "html/calibration.min.htm.gz");
 INCBIN(AboutHtm, "html/about.min.htm");
 INCBIN(UploadHtm, "html/upload.min.htm");
-INCBIN(BeerHtm, "html/beer.min.htm");
-INCBIN(StabilityHtm, "html/stability.min.htm");
-INCBIN(GraphHtm, "html/graph.min.htm");
-INCBIN(BackupHtm, "html/backup.min.htm");
-INCBIN(DashboardHtm, "html/dashboard.min.htm");
+INCBIN(BeerHtm, "html/beer.min.htm.gz");
+INCBIN(StabilityHtm, "html/stability.min.htm.gz");
+INCBIN(GraphHtm, "html/graph.min.htm.gz");
+INCBIN(BackupHtm, "html/backup.min.htm.gz");
+INCBIN(DashboardHtm, "html/dashboard.min.htm.gz");
 
 // EOF
@@ -22,10 +22,145 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
 #include <kegpush.hpp>
-#include <perf.hpp>
+#include <perfstats.hpp>
 #include <scale.hpp>
+#include <scale_hx711.hpp>
+#include <scale_nau7802.hpp>
+#include <scale_replay.hpp>
+
+ScaleDriver* Scale::createDriver(ScaleSensorType type) {
+  switch (type) {
+    case ScaleSensorType::ScaleHX711:
+      return new ScaleDriverHX711();
+    case ScaleSensorType::ScaleNAU7802:
+      return new ScaleDriverNAU7802();
+    case ScaleSensorType::ScaleReplay:
+      return new ScaleDriverReplay();
+  }
+
+  return 0;
+}
+
+bool Scale::checkDriver(UnitIndex idx) {
+  ScaleSensorType type = myConfig.getScaleSensorType(idx);
+
+  // The driver is only created once, unless the sensor type has been changed
+  // in the configuration.
+  if (_driver[idx] && _driver[idx]->getType() == type) return true;
+
+  _driver[idx].reset(createDriver(type));
+  _probe[idx] = Probe();
+
+  if (!_driver[idx]) {
+    Log.error(F("SCAL: Unable to create scale driver type %d [%d]." CR), type,
+              idx);
+    return false;
+  }
+
+  _driver[idx]->begin(idx);
+  return true;
+}
+
+void Scale::setup(bool force) {
+  for (int i = 0; i < 2; i++) {
+    UnitIndex idx = static_cast<UnitIndex>(i);
+
+    if (!checkDriver(idx)) continue;
+
+    if (_driver[idx]->isConnected() && !force) continue;
+
+    // Give the sensors some time to respond at startup so the devices are
+    // shown correctly, after this missing scales are detected in loop().
+    uint32_t start = millis();
+
+    while (!_driver[idx]->probe() && millis() - start < SCALE_PROBE_STARTUP)
+      delay(10);
+
+    connect(idx);
+  }
+}
+
+void Scale::setDriver(UnitIndex idx, ScaleDriver* driver) {
+  _driver[idx].reset(driver);
+  _probe[idx] = Probe();
+
+  if (_driver[idx]) {
+    _driver[idx]->begin(idx);
+    connect(idx);
+  }
+}
+
+bool Scale::connect(UnitIndex idx) {
+  uint32_t now = millis();
+  _probe[idx].lastProbe = now;
+
+  if (!_driver[idx]->setup(myConfig.getScaleOffset(idx))) {
+    _probe[idx].failed = true;
+    _probe[idx].lastFailed = now;
+    return false;
+  }
+
+  _probe[idx].failed = false;
+  _probe[idx].lastSeen = now;
+  _probe[idx].connects++;
+  setScaleFactor(idx);
+  Log.notice(F("SCAL: %s scale connected [%d]." CR), _driver[idx]->getName(),
+             idx);
+  return true;
+}
+
+void Scale::disconnected(UnitIndex idx) {
+  _driver[idx]->disconnect();
+  _probe[idx].disconnects++;
+  Log.notice(F("SCAL: %s scale disconnected [%d]." CR),
+             _driver[idx]->getName(), idx);
+}
+
+void Scale::probe(UnitIndex idx) {
+  uint32_t now = millis();
+
+  if (now - _probe[idx].lastProbe < SCALE_PROBE_INTERVAL) return;
+
+  _probe[idx].lastProbe = now;
+
+  if (!checkDriver(idx)) return;
+
+  bool present = _driver[idx]->probe();
+
+  if (present) _probe[idx].lastSeen = now;
+
+  if (_driver[idx]->isConnected()) {
+    if (now - _probe[idx].lastSeen > SCALE_PROBE_TIMEOUT) disconnected(idx);
+  } else if (present) {
+    // Don't retry a sensor that fails setup on every probe
+    if (_probe[idx].failed && now - _probe[idx].lastFailed < SCALE_PROBE_RETRY)
+      return;
+
+    connect(idx);
+  }
+}
+
+bool Scale::readSample(UnitIndex idx, int32_t& value) {
+  if (!isConnected(idx) || !_driver[idx]->readSample(value)) return false;
+
+  _probe[idx].lastSeen = millis();
+  return true;
+}
+
+void Scale::setScaleFactor(UnitIndex idx) {
+  if (!isConnected(idx)) return;
+
+  float fs = myConfig.getScaleFactor(idx);
+
+  if (fs == 0.0) fs = 1.0;
+
+  _driver[idx]->setScaleFactor(
+      fs);  // apply the saved scale factor so we get valid results
+}
 
 void Scale::loop(UnitIndex idx) {
+  probe(idx);
+
   if (_sched[idx].tare) {
 #if LOG_LEVEL == 6
     Log.verbose(F("SCAL: Tare triggered [%d]." CR), idx);
@@ -43,6 +178,199 @@ void Scale::loop(UnitIndex idx) {
     readRaw(idx);
     _sched[idx].findFactor = false;
   }
+
+  if (_sched[idx].addPoint) {
+#if LOG_LEVEL == 6
+    Log.verbose(F("SCAL: Add calibration point triggered [%d]." CR), idx);
+#endif
+    addCalibrationPoint(idx, _sched[idx].pointWeight);
+    _sched[idx].addPoint = false;
+  }
+
+  if (_sched[idx].clearPoints) {
+#if LOG_LEVEL == 6
+    Log.verbose(F("SCAL: Clear calibration triggered [%d]." CR), idx);
+#endif
+    clearCalibration(idx);
+    _sched[idx].clearPoints = false;
+  }
+}
+
+float Scale::read(UnitIndex idx, bool skipValidation) {
+#if defined(DEBUG_LINK_SCALES)
+  idx = UnitIndex::U1;
+#endif
+
+#if LOG_LEVEL == 6
+  Log.verbose(F("SCAL: Reading scale for [%d]." CR), idx);
+#endif
+
+  const CalibrationTable& cal = myConfig.getScaleCalibration(idx);
+
+  if ((myConfig.getScaleFactor(idx) == 0 && !cal.isActive()) ||
+      myConfig.getScaleOffset(idx) == 0) {  // Not initialized, just return zero
+    Log.verbose(F("SCAL: Scale not initialized [%d]." CR), idx);
+    return 0;
+  }
+
+  if (!isConnected(idx)) return 0;
+
+  PERF_BEGIN("scale-read");
+  float raw;
+
+  // With a calibration table the counts are converted by interpolating between
+  // the reference weights instead of using the linear factor.
+  if (cal.isActive()) {
+    int32_t l = _driver[idx]->readRaw(myConfig.getScaleReadCount());
+    raw = cal.toWeight(l - myConfig.getScaleOffset(idx));
+  } else {
+    raw = _driver[idx]->read(myConfig.getScaleReadCount());
+  }
+
+  if (!_driver[idx]->isConnected()) {
+    disconnected(idx);
+    PERF_END("scale-read");
+    return NAN;
+  }
+
+  _probe[idx].lastSeen = millis();
+
+#if LOG_LEVEL == 6
+  Log.verbose(F("SCAL: %s Reading weight=%F [%d]" CR),
+              _driver[idx]->getName(), raw, idx);
+#endif
+
+  if (!skipValidation) {
+    // If the value is higher/lower than 100 kb/lbs then the reading is proably
+    // wrong, just ignore the reading
+    if (raw > 100) {
+      Log.error(F("SCAL: %s Ignoring value since it's higher than 100kg, %F "
+                  "[%d]." CR),
+                _driver[idx]->getName(), raw, idx);
+      PERF_END("scale-read");
+      return NAN;
+    }
+
+    if (raw < -100) {
+      Log.error(F("SCAL: %s Ignoring value since it's less than -100kg %F "
+                  "[%d]." CR),
+                _driver[idx]->getName(), raw, idx);
+      PERF_END("scale-read");
+      return NAN;
+    }
+  }
+
+  PERF_END("scale-read");
+  return raw;
+}
+
+int32_t Scale::readRaw(UnitIndex idx) {
+#if defined(DEBUG_LINK_SCALES)
+  idx = UnitIndex::U1;
+#endif
+#if LOG_LEVEL == 6
+  Log.verbose(F("SCAL: Reading raw scale for [%d]." CR), idx);
+#endif
+  if (!isConnected(idx)) return 0;
+
+  PERF_BEGIN("scale-readraw");
+  int32_t l = _driver[idx]->readRaw(
+      myConfig.getScaleReadCountCalibration());  // get the raw value without
+                                                 // applying scaling factor
+
+  if (!_driver[idx]->isConnected()) {
+    disconnected(idx);
+    PERF_END("scale-readraw");
+    return 0;
+  }
+
+  _lastRaw[idx] = l;
+#if LOG_LEVEL == 6
+  Log.verbose(F("SCAL: %s Reading scale raw weight=%d [%d]" CR),
+              _driver[idx]->getName(), l, idx);
+#endif
+  PERF_END("scale-readraw");
+  return l;
+}
+
+void Scale::tare(UnitIndex idx) {
+  if (!isConnected(idx)) return;
+
+  Log.notice(
+      F("SCAL: %s set scale to zero, prepare for calibration %d [%d]." CR),
+      _driver[idx]->getName(), myConfig.getScaleReadCountCalibration(), idx);
+
+  int32_t l = _driver[idx]->tare(myConfig.getScaleReadCountCalibration());
+
+  if (!_driver[idx]->isConnected()) {
+    disconnected(idx);
+    return;
+  }
+
+  Log.verbose(F("SCAL: %s New scale offset found %l [%d]." CR),
+              _driver[idx]->getName(), l, idx);
+  myConfig.setScaleOffset(idx, l);
+  myConfig.saveFile();
+}
+
+void Scale::findFactor(UnitIndex idx, float weight) {
+  if (!isConnected(idx)) return;
+
+  float f =
+      _driver[idx]->findFactor(weight, myConfig.getScaleReadCountCalibration());
+
+  if (!_driver[idx]->isConnected()) {
+    disconnected(idx);
+    return;
+  }
+
+  myConfig.setScaleFactor(idx, f);
+  myConfig.saveFile();  // save the factor to file
+
+  setScaleFactor(idx);  // apply the factor after it has been saved
+  read(idx, true);
+}
+
+void Scale::addCalibrationPoint(UnitIndex idx, float weight) {
+  if (!isConnected(idx)) return;
+
+  if (myConfig.getScaleOffset(idx) == 0) {
+    Log.error(F("SCAL: Scale needs to be tared before adding calibration "
+                "points [%d]." CR),
+              idx);
+    return;
+  }
+
+  int32_t l = readRaw(idx);
+
+  if (!isConnected(idx)) return;
+
+  l -= myConfig.getScaleOffset(idx);
+
+  if (!myConfig.addScaleCalibrationPoint(idx, l, weight)) {
+    Log.error(F("SCAL: Unable to add calibration point %l=%Fkg [%d]." CR), l,
+              weight, idx);
+    return;
+  }
+
+  Log.notice(F("SCAL: %s Added calibration point %l=%Fkg, %d points [%d]." CR),
+             _driver[idx]->getName(), l, weight,
+             myConfig.getScaleCalibration(idx).size(), idx);
+
+  // Without a linear factor we use the first point so the residuals have
+  // something to compare with.
+  if (myConfig.getScaleFactor(idx) == 0) {
+    myConfig.setScaleFactor(idx, static_cast<float>(l) / weight);
+    setScaleFactor(idx);
+  }
+
+  myConfig.saveFile();
+}
+
+void Scale::clearCalibration(UnitIndex idx) {
+  myConfig.clearScaleCalibration(idx);
+  myConfig.saveFile();
+  Log.notice(F("SCAL: Cleared calibration points [%d]." CR), idx);
 }
 
 // EOF
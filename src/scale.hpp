@@ -24,15 +24,20 @@ SOFTWARE.
 #ifndef SRC_SCALE_HPP_
 #define SRC_SCALE_HPP_
 
-#include <HX711.h>
-#include <SparkFun_Qwiic_Scale_NAU7802_Arduino_Library.h>
+#include <memory>
 
 #include <kegconfig.hpp>
 #include <levels.hpp>
 #include <main.hpp>
+#include <scale_base.hpp>
 
 // #define DEBUG_LINK_SCALES  // For test rig to use one scale for both...
 
+constexpr auto SCALE_PROBE_INTERVAL = 50;    // ms between presence checks
+constexpr auto SCALE_PROBE_TIMEOUT = 2000;   // ms without response = removed
+constexpr auto SCALE_PROBE_RETRY = 10000;    // ms after a failed setup
+constexpr auto SCALE_PROBE_STARTUP = 500;    // ms to wait for sensors at boot
+
 class Scale {
  private:
   class Schedule {
@@ -40,91 +45,84 @@ class Scale {
     bool tare = false;
     bool findFactor = false;
     float factorWeight = 0;
+    bool addPoint = false;
+    float pointWeight = 0;
+    bool clearPoints = false;
+  };
+
+  // State for detecting when scales are attached or removed. The drivers are
+  // only created when the sensor type changes, plugging a scale in or out just
+  // changes the state of the existing driver.
+  class Probe {
+   public:
+    uint32_t lastProbe = 0;
+    uint32_t lastSeen = 0;
+    uint32_t lastFailed = 0;
+    bool failed = false;
+    uint32_t connects = 0;
+    uint32_t disconnects = 0;
   };
 
-  HX711* _hxScale[2] = {0, 0};
-  NAU7802* _nauScale[2] = {0, 0};
+  std::unique_ptr<ScaleDriver> _driver[2];
 
   Schedule _sched[2];
+  Probe _probe[2];
   int32_t _lastRaw[2] = {0, 0};
 
   Scale(const Scale&) = delete;
   void operator=(const Scale&) = delete;
 
-  void tare(UnitIndex idx) {
-    switch (myConfig.getScaleSensorType()) {
-      case ScaleSensorType::ScaleHX711:
-        tareHX711(idx);
-        break;
-      case ScaleNAU7802:
-        tareNAU7802(idx);
-        break;
-    }
-  }
-  void findFactor(UnitIndex idx, float weight) {
-    switch (myConfig.getScaleSensorType()) {
-      case ScaleHX711:
-        findFactorHX711(idx, weight);
-        break;
-      case ScaleSensorType::ScaleNAU7802:
-        findFactorNAU7802(idx, weight);
-        break;
-    }
-  }
-  int32_t readRaw(UnitIndex idx) {
-    if (myConfig.getScaleSensorType() == ScaleSensorType::ScaleHX711)
-      return readRawHX711(idx);
-    else
-      return readRawNAU7802(idx);
-  }
-
-  void setupHX711(bool force);
-  void setupNAU7802(bool force);
-  void setScaleFactorHX711(UnitIndex idx);
-  void setScaleFactorNAU7802(UnitIndex idx);
-  void tareHX711(UnitIndex idx);
-  void tareNAU7802(UnitIndex idx);
-  void findFactorHX711(UnitIndex idx, float weight);
-  void findFactorNAU7802(UnitIndex idx, float weight);
-  float readHX711(UnitIndex idx, bool skipValidation);
-  float readNAU7802(UnitIndex idx, bool skipValidation);
-  int32_t readRawHX711(UnitIndex idx);
-  int32_t readRawNAU7802(UnitIndex idx);
+  ScaleDriver* createDriver(ScaleSensorType type);
+  bool checkDriver(UnitIndex idx);
+  bool connect(UnitIndex idx);
+  void disconnected(UnitIndex idx);
+  void probe(UnitIndex idx);
+  void setScaleFactor(UnitIndex idx);
+  void tare(UnitIndex idx);
+  void findFactor(UnitIndex idx, float weight);
+  void addCalibrationPoint(UnitIndex idx, float weight);
+  void clearCalibration(UnitIndex idx);
+  int32_t readRaw(UnitIndex idx);
 
  public:
   Scale() {}
 
-  void setup(bool force = false) {
-    switch (myConfig.getScaleSensorType()) {
-      case ScaleSensorType::ScaleHX711:
-        setupHX711(force);
-        break;
-      case ScaleSensorType::ScaleNAU7802:
-        setupNAU7802(force);
-        break;
-    }
-  }
+  void setup(bool force = false);
   void loop(UnitIndex idx);
   void scheduleTare(UnitIndex idx) { _sched[idx].tare = true; }
   void scheduleFindFactor(UnitIndex idx, float weight) {
     _sched[idx].findFactor = true;
     _sched[idx].factorWeight = weight;
   }
+  void scheduleAddCalibrationPoint(UnitIndex idx, float weight) {
+    _sched[idx].addPoint = true;
+    _sched[idx].pointWeight = weight;
+  }
+  void scheduleClearCalibration(UnitIndex idx) {
+    _sched[idx].clearPoints = true;
+  }
   int32_t readLastRaw(UnitIndex idx) { return _lastRaw[idx]; }
+  uint32_t getConnectCount(UnitIndex idx) { return _probe[idx].connects; }
+  uint32_t getDisconnectCount(UnitIndex idx) {
+    return _probe[idx].disconnects;
+  }
+
+  // Replace the driver for a tap, the scale takes ownership of the object.
+  // Used by the simulator to inject a replay driver.
+  void setDriver(UnitIndex idx, ScaleDriver* driver);
+  ScaleDriver* getDriver(UnitIndex idx) { return _driver[idx].get(); }
 
 #if defined(DEBUG_LINK_SCALES)
   bool isConnected(UnitIndex idx) { return true; }
 #else
   bool isConnected(UnitIndex idx) {
-    return _hxScale[idx] != 0 || _nauScale[idx] != 0 ? true : false;
+    return _driver[idx] && _driver[idx]->isConnected();
   }
 #endif
-  float read(UnitIndex idx, bool skipValidation = false) {
-    if (myConfig.getScaleSensorType() == ScaleSensorType::ScaleHX711)
-      return readHX711(idx, skipValidation);
-    else
-      return readNAU7802(idx, skipValidation);
-  }
+  float read(UnitIndex idx, bool skipValidation = false);
+  // A successful sample also counts as the scale being seen, the samples
+  // use up the conversions that probe() looks for.
+  bool readSample(UnitIndex idx, int32_t& value);
 };
 
 extern Scale myScale;
@@ -0,0 +1,66 @@
+/*
+MIT License
+
+Copyright (c) 2023 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_SCALE_BASE_HPP_
+#define SRC_SCALE_BASE_HPP_
+
+#include <Arduino.h>
+
+#include <kegconfig.hpp>
+#include <main.hpp>
+
+// Interface for the load cell AD converters. One driver instance is created per
+// tap when the scales are setup so each tap can use a different type of sensor.
+class ScaleDriver {
+ public:
+  ScaleDriver() = default;
+  virtual ~ScaleDriver() = default;
+
+  virtual ScaleSensorType getType() = 0;
+  virtual const char* getName() = 0;
+
+  // Configure pins / bus, called once when the driver is created. Must not
+  // wait for the sensor.
+  virtual void begin(UnitIndex idx) = 0;
+  // Fast presence check (data ready line or I2C ACK) that is called frequently
+  // from the main loop, must not block.
+  virtual bool probe() = 0;
+  // Initialize the sensor once it's present, returns true if it responded.
+  virtual bool setup(int32_t offset) = 0;
+  virtual void disconnect() = 0;
+  virtual bool isConnected() = 0;
+
+  virtual void setScaleFactor(float factor) = 0;
+  virtual int32_t tare(int readCount) = 0;  // Returns the new zero offset
+  virtual float findFactor(float weight,
+                           int readCount) = 0;  // Returns the new factor
+
+  virtual float read(int readCount) = 0;  // Weight with factor applied
+  virtual int32_t readRaw(int readCount) = 0;  // Counts without factor
+  // Single conversion if one is ready, returns false without waiting if not.
+  virtual bool readSample(int32_t& value) = 0;
+};
+
+#endif  // SRC_SCALE_BASE_HPP_
+
+// EOF
@@ -21,171 +21,103 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
-#include <kegpush.hpp>
-#include <perf.hpp>
-#include <scale.hpp>
+#include <log.hpp>
+#include <scale_hx711.hpp>
 
-void Scale::setupHX711(bool force) {
-  if (!_hxScale[0] || force) {
-    if (_hxScale[0]) delete _hxScale[0];
+// The HX711 runs at 10 SPS so a new value should be ready within 100 ms.
+constexpr auto HX711_READY_TIMEOUT = 200;
 
-#if LOG_LEVEL == 6
-    Log.verbose(F("SCAL: HX711 initializing scale [0], using offset %l." CR),
-                myConfig.getScaleOffset(UnitIndex::U1));
-#endif
-    _hxScale[0] = new HX711();
-    Log.notice(F("SCAL: Initializing HX711 bus #1 on pins Data=%d,Clock=%d" CR),
-               myConfig.getPinScale1Data(), myConfig.getPinScale1Clock());
-    _hxScale[0]->begin(myConfig.getPinScale1Data(),
-                       myConfig.getPinScale1Clock());
-    _hxScale[0]->set_offset(myConfig.getScaleOffset(UnitIndex::U1));
-
-    if (_hxScale[0]->wait_ready_timeout(500)) {
-      Log.notice(F("SCAL: HX711 scale [0] found." CR));
-      _hxScale[0]->get_units(1);
-    } else {
-      Log.error(
-          F("SCAL: HX711 scale [0] not responding, disabling interface." CR));
-      delete _hxScale[0];
-      _hxScale[0] = 0;
-    }
-  }
+void ScaleDriverHX711::begin(UnitIndex idx) {
+  _idx = idx;
 
-  if (!_hxScale[1] || force) {
-    if (_hxScale[1]) delete _hxScale[1];
+  int data = idx == UnitIndex::U1 ? myConfig.getPinScale1Data()
+                                  : myConfig.getPinScale2Data();
+  int clock = idx == UnitIndex::U1 ? myConfig.getPinScale1Clock()
+                                   : myConfig.getPinScale2Clock();
 
+  Log.notice(
+      F("SCAL: Initializing HX711 bus #%d on pins Data=%d,Clock=%d" CR),
+      idx + 1, data, clock);
+  _hx.begin(data, clock);
+}
+
+bool ScaleDriverHX711::setup(int32_t offset) {
 #if LOG_LEVEL == 6
-    Log.verbose(F("SCAL: HX711 initializing [1], using offset %l." CR),
-                myConfig.getScaleOffset(UnitIndex::U2));
+  Log.verbose(F("SCAL: HX711 initializing scale [%d], using offset %l." CR),
+              _idx, offset);
 #endif
-    _hxScale[1] = new HX711();
-    Log.notice(F("SCAL: Initializing HX711 bus #2 on pins Data=%d,Clock=%d" CR),
-               myConfig.getPinScale2Data(), myConfig.getPinScale2Clock());
-    _hxScale[1]->begin(myConfig.getPinScale2Data(),
-                       myConfig.getPinScale2Clock());
-    _hxScale[1]->set_offset(myConfig.getScaleOffset(UnitIndex::U2));
-
-    if (_hxScale[1]->wait_ready_timeout(500)) {
-      Log.notice(F("SCAL: HX711 scale [1] found." CR));
-      _hxScale[1]->get_units(1);
-    } else {
-      Log.error(
-          F("SCAL: HX711 scale [1] not responding, disabling interface." CR));
-      delete _hxScale[1];
-      _hxScale[1] = 0;
-    }
+  _hx.set_offset(offset);
+
+  if (_hx.wait_ready_timeout(HX711_READY_TIMEOUT)) {
+    Log.notice(F("SCAL: HX711 scale [%d] found." CR), _idx);
+    _hx.read();
+    _connected = true;
+  } else {
+    Log.error(
+        F("SCAL: HX711 scale [%d] not responding, disabling interface." CR),
+        _idx);
+    _connected = false;
   }
 
-  setScaleFactorHX711(UnitIndex::U1);
-  setScaleFactorHX711(UnitIndex::U2);
+  return _connected;
 }
 
-void Scale::setScaleFactorHX711(UnitIndex idx) {
-  if (!_hxScale[idx]) return;
-
-  float fs = myConfig.getScaleFactor(idx);
+// The library waits forever for the data line, so if the scale is unplugged
+// while reading the loop would hang. Check each sample with a timeout instead.
+bool ScaleDriverHX711::readAverage(int readCount, int32_t& value) {
+  int64_t sum = 0;
 
-  if (fs == 0.0) fs = 1.0;
+  if (readCount < 1) readCount = 1;
 
-  _hxScale[idx]->set_scale(fs);
-}
-
-float Scale::readHX711(UnitIndex idx, bool skipValidation) {
-#if defined(DEBUG_LINK_SCALES)
-  idx = UnitIndex::U1;
-#endif
-
-#if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: HX711 reading scale for [%d]." CR), idx);
-#endif
+  for (int i = 0; i < readCount; i++) {
+    if (!_hx.wait_ready_timeout(HX711_READY_TIMEOUT)) {
+      Log.error(F("SCAL: HX711 scale [%d] stopped responding." CR), _idx);
+      _connected = false;
+      return false;
+    }
 
-  if (myConfig.getScaleFactor(idx) == 0 ||
-      myConfig.getScaleOffset(idx) == 0) {  // Not initialized, just return zero
-    Log.verbose(F("SCAL: HX711 scale not initialized [%d]." CR), idx);
-    return 0;
+    sum += _hx.read();
   }
 
-  if (!_hxScale[idx]) return 0;
-
-  PERF_BEGIN("scale-read");
-  float raw = _hxScale[idx]->get_units(myConfig.getScaleReadCount());
-#if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: HX711 Reading weight=%F [%d]" CR), raw, idx);
-#endif
+  value = static_cast<int32_t>(sum / readCount);
+  return true;
+}
 
-  if (!skipValidation) {
-    // If the value is higher/lower than 100 kb/lbs then the reading is proably
-    // wrong, just ignore the reading
-    if (raw > 100) {
-      Log.error(F("SCAL: HX711 Ignoring value since it's higher than 100kg, %F "
-                  "[%d]." CR),
-                raw, idx);
-      PERF_END("scale-read");
-      return NAN;
-    }
+float ScaleDriverHX711::read(int readCount) {
+  int32_t l;
 
-    if (raw < -100) {
-      Log.error(F("SCAL: HX711 Ignoring value since it's less than -100kg %F "
-                  "[%d]." CR),
-                raw, idx);
-      PERF_END("scale-read");
-      return NAN;
-    }
-  }
+  if (!readAverage(readCount, l)) return NAN;
 
-  PERF_END("scale-read");
-  return raw;
+  return static_cast<float>(l - _hx.get_offset()) / _hx.get_scale();
 }
 
-void Scale::tareHX711(UnitIndex idx) {
-  if (!_hxScale[idx]) return;
+int32_t ScaleDriverHX711::readRaw(int readCount) {
+  int32_t l;
 
-  Log.notice(
-      F("SCAL: HX711 set scale to zero, prepare for calibration %d [%d]." CR),
-      myConfig.getScaleReadCountCalibration(), idx);
-
-  _hxScale[idx]->set_scale(1.0);
-  _hxScale[idx]->tare(myConfig.getScaleReadCountCalibration());
-  int32_t l = _hxScale[idx]->get_offset();
-  Log.verbose(F("SCAL: HX711 New scale offset found %l [%d]." CR), l, idx);
-  myConfig.setScaleOffset(idx, l);
-  myConfig.saveFile();
-}
+  if (!readAverage(readCount, l)) return 0;
 
-int32_t Scale::readRawHX711(UnitIndex idx) {
-#if defined(DEBUG_LINK_SCALES)
-  idx = UnitIndex::U1;
-#endif
-#if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: HX711 Reading raw scale for [%d]." CR), idx);
-#endif
-  if (!_hxScale[idx]) return 0;
-  PERF_BEGIN("scale-readraw");
-  int32_t l = _hxScale[idx]->read_average(
-      myConfig.getScaleReadCountCalibration());  // get the raw value without
-                                                 // applying scaling factor
-  _lastRaw[idx] = l;
-#if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: HX711 Reading scale raw weight=%d [%d]" CR), l, idx);
-#endif
-  PERF_END("scale-readraw");
   return l;
 }
 
-void Scale::findFactorHX711(UnitIndex idx, float weight) {
-  if (!_hxScale[idx]) return;
+int32_t ScaleDriverHX711::tare(int readCount) {
+  int32_t l;
 
-  float l = _hxScale[idx]->get_units(myConfig.getScaleReadCountCalibration());
-  float f = l / weight;
-  Log.notice(
-      F("SCAL: HX711 Detecting factor for weight %F, raw %l %F [%d]." CR),
-      weight, l, f, idx);
+  if (readAverage(readCount, l)) _hx.set_offset(l);
+
+  return _hx.get_offset();
+}
+
+float ScaleDriverHX711::findFactor(float weight, int readCount) {
+  int32_t l;
 
-  myConfig.setScaleFactor(idx, f);
-  myConfig.saveFile();  // save the factor to file
+  // Use the value without any scale factor applied so the result does not
+  // depend on a previous calibration.
+  if (!readAverage(readCount, l)) return NAN;
 
-  setScaleFactorHX711(idx);  // apply the factor after it has been saved
-  readHX711(idx, true);
+  float f = static_cast<float>(l - _hx.get_offset()) / weight;
+  Log.notice(F("SCAL: HX711 Detecting factor for weight %F, raw %l %F [%d]." CR),
+             weight, l - _hx.get_offset(), f, _idx);
+  return f;
 }
 
 // EOF
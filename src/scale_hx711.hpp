@@ -0,0 +1,68 @@
+/*
+MIT License
+
+Copyright (c) 2023 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_SCALE_HX711_HPP_
+#define SRC_SCALE_HX711_HPP_
+
+#include <HX711.h>
+
+#include <scale_base.hpp>
+
+class ScaleDriverHX711 : public ScaleDriver {
+ private:
+  HX711 _hx;
+  UnitIndex _idx = UnitIndex::U1;
+  bool _connected = false;
+
+  bool readAverage(int readCount, int32_t& value);
+
+ public:
+  ScaleDriverHX711() {}
+
+  ScaleSensorType getType() override { return ScaleSensorType::ScaleHX711; }
+  const char* getName() override { return "HX711"; }
+
+  void begin(UnitIndex idx) override;
+  // Data line is pulled high when no HX711 is attached and low when a new
+  // value is ready, so this is just a digitalRead.
+  bool probe() override { return _hx.is_ready(); }
+  bool setup(int32_t offset) override;
+  void disconnect() override { _connected = false; }
+  bool isConnected() override { return _connected; }
+
+  void setScaleFactor(float factor) override { _hx.set_scale(factor); }
+  int32_t tare(int readCount) override;
+  float findFactor(float weight, int readCount) override;
+
+  float read(int readCount) override;
+  int32_t readRaw(int readCount) override;
+  bool readSample(int32_t& value) override {
+    if (!_hx.is_ready()) return false;
+    value = _hx.read();
+    return true;
+  }
+};
+
+#endif  // SRC_SCALE_HX711_HPP_
+
+// EOF
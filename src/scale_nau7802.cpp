@@ -21,190 +21,111 @@ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
-#include <kegpush.hpp>
-#include <perf.hpp>
-#include <scale.hpp>
+#include <log.hpp>
+#include <scale_nau7802.hpp>
 
 // NOTE! Since the esp8266 only suppors one I2C bus we need a different hardware
 // design with a multiplexer to support multiple NAU on that platform. ESP32
 // however supports two I2C busses so that is the prefered platform is NAU is to
 // be used.
 
-void Scale::setupNAU7802(bool force) {
-  if (!_nauScale[0] || force) {
-    if (_nauScale[0]) delete _nauScale[0];
-
-#if LOG_LEVEL == 6
-    Log.verbose(F("SCAL: NAU7802 initializing scale [0]." CR));
-#endif
-    _nauScale[0] = new NAU7802();
-    _nauScale[0]->begin(Wire);
-
-    if (_nauScale[0]->isConnected()) {
-      Log.notice(F("SCAL: NAU7802 scale [0] found." CR));
-      _nauScale[0]->setZeroOffset(myConfig.getScaleOffset(UnitIndex::U1));
-      _nauScale[0]->setSampleRate(NAU7802_SPS_320);
-      // _nauScale[0]->setLDO(NAU7802_LDO_3V3);
-      // _nauScale[0]->setGain(NAU7802_GAIN_128);
-      // _nauScale[0]->setChannel(NAU7802_CHANNEL_1);
-      _nauScale[0]->calibrateAFE();
-    } else {
-      Log.error(
-          F("SCAL: NAU7802 scale [0] not responding, disabling interface." CR));
-      delete _nauScale[0];
-      _nauScale[0] = 0;
-    }
-  }
-
-  if (!_nauScale[1] || force) {
-    if (_nauScale[1]) delete _nauScale[1];
+void ScaleDriverNAU7802::begin(UnitIndex idx) {
+  _idx = idx;
 
+  if (idx == UnitIndex::U1) {
+    _wire = &Wire;
+  } else {
 #if defined(ESP8266)
     Log.error(
         F("SCAL: NAU7802 scale [1] cannot be used on ESP8266 since only one "
           "I2C bus is supported in Arduino. Use an ESP32S2 instead." CR));
+    _wire = 0;
 #else
-#if LOG_LEVEL == 6
-    Log.verbose(F("SCAL: NAU7802 initializing [1], using offset %l." CR),
-                myConfig.getScaleOffset(UnitIndex::U2));
-#endif
-    _nauScale[1] = new NAU7802();
-
     Log.notice(F("SCAL: Initializing I2C bus #2 on pins SDA=%d,SCL=%d" CR),
                myConfig.getPinScale2Data(), myConfig.getPinScale2Clock());
     Wire1.setPins(myConfig.getPinScale2Data(), myConfig.getPinScale2Clock());
     Wire1.begin();
-    _nauScale[1]->begin(Wire1);
-
-    if (_nauScale[1]->isConnected()) {
-      Log.notice(F("SCAL: NAU7802 scale [1] found." CR));
-      _nauScale[1]->setZeroOffset(myConfig.getScaleOffset(UnitIndex::U2));
-      _nauScale[1]->setSampleRate(NAU7802_SPS_320);
-      // _nauScale[1]->setLDO(NAU7802_LDO_3V3);
-      // _nauScale[1]->setGain(NAU7802_GAIN_128);
-      // _nauScale[1]->setChannel(NAU7802_CHANNEL_1);
-      _nauScale[1]->calibrateAFE();
-    } else {
-      Log.error(
-          F("SCAL: NAU7802 scale [1] not responding, disabling interface." CR));
-      delete _nauScale[1];
-      _nauScale[1] = 0;
-      Wire1.end();
-    }
+    _wire = &Wire1;
 #endif
   }
-
-  setScaleFactorNAU7802(UnitIndex::U1);
-  setScaleFactorNAU7802(UnitIndex::U2);
 }
 
-void Scale::setScaleFactorNAU7802(UnitIndex idx) {
-  if (!_nauScale[idx]) return;
-
-  float fs = myConfig.getScaleFactor(idx);
+bool ScaleDriverNAU7802::probe() {
+  if (!_wire) return false;
 
-  if (fs == 0.0) fs = 1.0;
-
-  _nauScale[idx]->setCalibrationFactor(
-      fs);  // apply the saved scale factor so we get valid results
+  _wire->beginTransmission(NAU7802_I2C_ADR);
+  return _wire->endTransmission() == 0;
 }
 
-float Scale::readNAU7802(UnitIndex idx, bool skipValidation) {
-#if defined(DEBUG_LINK_SCALES)
-  idx = UnitIndex::U1;
-#endif
+bool ScaleDriverNAU7802::setup(int32_t offset) {
+  _connected = false;
+
+  if (!_wire) return false;
 
 #if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: NAU7802 reading scale for [%d]." CR), idx);
+  Log.verbose(F("SCAL: NAU7802 initializing scale [%d], using offset %l." CR),
+              _idx, offset);
 #endif
 
-  if (myConfig.getScaleFactor(idx) == 0 ||
-      myConfig.getScaleOffset(idx) == 0) {  // Not initialized, just return zero
-    Log.verbose(F("SCAL: NAU7802 scale not initialized [%d]." CR), idx);
-    return 0;
+  if (_nau.begin(*_wire)) {
+    Log.notice(F("SCAL: NAU7802 scale [%d] found." CR), _idx);
+    _nau.setZeroOffset(offset);
+    _nau.setSampleRate(NAU7802_SPS_320);
+    // _nau.setLDO(NAU7802_LDO_3V3);
+    // _nau.setGain(NAU7802_GAIN_128);
+    // _nau.setChannel(NAU7802_CHANNEL_1);
+    _nau.calibrateAFE();
+    _connected = true;
+  } else {
+    Log.error(
+        F("SCAL: NAU7802 scale [%d] not responding, disabling interface." CR),
+        _idx);
   }
 
-  if (!_nauScale[idx]) return 0;
-
-  PERF_BEGIN("scale-read");
-  float raw = _nauScale[idx]->getWeight(true);  // default is 8 reads
-#if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: NAU7802 Reading weight=%F [%d]" CR), raw, idx);
-#endif
+  return _connected;
+}
 
-  if (!skipValidation) {
-    // If the value is higher/lower than 100 kb/lbs then the reading is proably
-    // wrong, just ignore the reading
-    if (raw > 100) {
-      Log.error(
-          F("SCAL: NAU7802 Ignoring value since it's higher than 100kg, %F "
-            "[%d]." CR),
-          raw, idx);
-      PERF_END("scale-read");
-      return NAN;
-    }
-
-    if (raw < -100) {
-      Log.error(F("SCAL: NAU7802 Ignoring value since it's less than -100kg %F "
-                  "[%d]." CR),
-                raw, idx);
-      PERF_END("scale-read");
-      return NAN;
-    }
+// The library returns zero when a read times out so we check that the device
+// still answers after each read.
+bool ScaleDriverNAU7802::checkConnected() {
+  if (!probe()) {
+    Log.error(F("SCAL: NAU7802 scale [%d] stopped responding." CR), _idx);
+    _connected = false;
   }
 
-  PERF_END("scale-read");
-  return raw;
+  return _connected;
 }
 
-void Scale::tareNAU7802(UnitIndex idx) {
-  if (!_nauScale[idx]) return;
-
-  Log.notice(
-      F("SCAL: NAU7802 set scale to zero, prepare for calibration [%d]." CR),
-      idx);
-
-  _nauScale[idx]->calculateZeroOffset();  // Default is 8 reads
-  int32_t l = _nauScale[idx]->getZeroOffset();
-  Log.verbose(F("SCAL: NAU7802 New scale offset found %l [%d]." CR), l, idx);
-  myConfig.setScaleOffset(idx, l);
-  myConfig.saveFile();
+float ScaleDriverNAU7802::read(int readCount) {
+  float f = _nau.getWeight(true);  // default is 8 reads
+  return checkConnected() ? f : NAN;
 }
 
-int32_t Scale::readRawNAU7802(UnitIndex idx) {
-#if defined(DEBUG_LINK_SCALES)
-  idx = UnitIndex::U1;
-#endif
-#if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: NAU7802 Reading raw scale for [%d]." CR), idx);
-#endif
-  if (!_nauScale[idx]) return 0;
-  PERF_BEGIN("scale-readraw");
-  while (!_nauScale[idx]->available()) {
-    delay(1);
-  }
-  int32_t l = _nauScale[idx]->getReading();
-  _lastRaw[idx] = l;
-#if LOG_LEVEL == 6
-  Log.verbose(F("SCAL: NAU7802 Reading scale raw weight=%d [%d]" CR), l, idx);
-#endif
-  PERF_END("scale-readraw");
-  return l;
+int32_t ScaleDriverNAU7802::tare(int readCount) {
+  int32_t l = _nau.getZeroOffset();
+  _nau.calculateZeroOffset();  // Default is 8 reads
+
+  if (!checkConnected()) _nau.setZeroOffset(l);
+
+  return _nau.getZeroOffset();
 }
 
-void Scale::findFactorNAU7802(UnitIndex idx, float weight) {
-  if (!_nauScale[idx]) return;
+float ScaleDriverNAU7802::findFactor(float weight, int readCount) {
+  _nau.calculateCalibrationFactor(weight, readCount);
+
+  if (!checkConnected()) return NAN;
 
-  _nauScale[idx]->calculateCalibrationFactor(
-      weight, myConfig.getScaleReadCountCalibration());
-  float f = _nauScale[idx]->getCalibrationFactor();
+  float f = _nau.getCalibrationFactor();
   Log.notice(
       F("SCAL: NAU7802 Detecting factor for weight %F, factor %F [%d]." CR),
-      weight, f, idx);
+      weight, f, _idx);
+  return f;
+}
 
-  myConfig.setScaleFactor(idx, f);
-  myConfig.saveFile();
-  readNAU7802(idx, true);
+int32_t ScaleDriverNAU7802::readRaw(int readCount) {
+  // Averaged since this is also the read path when a calibration table is used
+  int32_t l = _nau.getAverage(readCount);
+  return checkConnected() ? l : 0;
 }
 
 // EOF
@@ -0,0 +1,71 @@
+/*
+MIT License
+
+Copyright (c) 2023 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_SCALE_NAU7802_HPP_
+#define SRC_SCALE_NAU7802_HPP_
+
+#include <SparkFun_Qwiic_Scale_NAU7802_Arduino_Library.h>
+
+#include <scale_base.hpp>
+
+constexpr uint8_t NAU7802_I2C_ADR = 0x2A;
+
+class ScaleDriverNAU7802 : public ScaleDriver {
+ private:
+  NAU7802 _nau;
+  TwoWire* _wire = 0;
+  UnitIndex _idx = UnitIndex::U1;
+  bool _connected = false;
+
+  bool checkConnected();
+
+ public:
+  ScaleDriverNAU7802() {}
+
+  ScaleSensorType getType() override { return ScaleSensorType::ScaleNAU7802; }
+  const char* getName() override { return "NAU7802"; }
+
+  void begin(UnitIndex idx) override;
+  bool probe() override;
+  bool setup(int32_t offset) override;
+  void disconnect() override { _connected = false; }
+  bool isConnected() override { return _connected; }
+
+  void setScaleFactor(float factor) override {
+    _nau.setCalibrationFactor(factor);
+  }
+  int32_t tare(int readCount) override;
+  float findFactor(float weight, int readCount) override;
+
+  float read(int readCount) override;
+  int32_t readRaw(int readCount) override;
+  bool readSample(int32_t& value) override {
+    if (!_nau.available()) return false;
+    value = _nau.getReading();
+    return true;
+  }
+};
+
+#endif  // SRC_SCALE_NAU7802_HPP_
+
+// EOF
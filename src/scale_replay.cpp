@@ -0,0 +1,98 @@
+/*
+MIT License
+
+Copyright (c) 2023 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <log.hpp>
+#include <scale_replay.hpp>
+
+void ScaleDriverReplay::setTrace(const float* trace, size_t size,
+                                 size_t stride, bool loop) {
+  _source = 0;
+  _trace = trace;
+  _size = size;
+  _stride = stride < 1 ? 1 : stride;
+  _loop = loop;
+  _pos = 0;
+}
+
+void ScaleDriverReplay::setSource(ReplaySource* source) {
+  _source = source;
+  _sourceDone = false;
+  _trace = 0;
+  _size = 0;
+  _pos = 0;
+}
+
+bool ScaleDriverReplay::setup(int32_t offset) {
+  _offset = offset;
+  _pos = 0;
+
+  if (_source)
+    Log.notice(F("SCAL: Replay scale [%d] using decoded trace." CR), _idx);
+  else if (isConnected())
+    Log.notice(F("SCAL: Replay scale [%d] using %d recorded values." CR),
+               _idx, _size);
+  else
+    Log.error(F("SCAL: Replay scale [%d] has no trace loaded." CR), _idx);
+
+  return isConnected();
+}
+
+float ScaleDriverReplay::next() {
+  if (!isConnected()) return NAN;
+
+  if (_source) {
+    float v;
+
+    if (_sourceDone || !_source->next(v)) {
+      _sourceDone = true;
+      return NAN;
+    }
+
+    _pos++;
+    return v;
+  }
+
+  if (_pos >= _size) {
+    if (!_loop) return NAN;
+    _pos = 0;
+  }
+
+  float v = pgm_read_float(&_trace[_pos * _stride]);
+  _pos++;
+  return v;
+}
+
+int32_t ScaleDriverReplay::readRaw(int readCount) {
+  int32_t l;
+  return readSample(l) ? l : 0;
+}
+
+bool ScaleDriverReplay::readSample(int32_t& value) {
+  float v = next();
+
+  if (isnan(v)) return false;
+  value = static_cast<int32_t>(v * _factor) + _offset;
+  return true;
+}
+
+// EOF
@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2023 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_SCALE_REPLAY_HPP_
+#define SRC_SCALE_REPLAY_HPP_
+
+#include <scale_base.hpp>
+
+// Provides recorded weights (kg) to the replay driver, used for traces that are
+// stored in a compressed format and decoded while running.
+class ReplaySource {
+ public:
+  virtual ~ReplaySource() = default;
+  virtual bool next(float& weight) = 0;  // Returns false at end of trace
+};
+
+// Replays a recorded trace of weights (kg) instead of reading a sensor. Used by
+// the simulator so the full acquisition path (scale -> level detection) can be
+// run and measured without any hardware attached. The trace can be a float
+// array in PROGMEM, a column in a larger record (stride = floats per record),
+// or a ReplaySource that decodes the values.
+class ScaleDriverReplay : public ScaleDriver {
+ private:
+  ReplaySource* _source = 0;
+  bool _sourceDone = false;
+  const float* _trace = 0;
+  size_t _size = 0;
+  size_t _stride = 1;
+  size_t _pos = 0;
+  bool _loop = false;
+  UnitIndex _idx = UnitIndex::U1;
+  float _factor = 1.0;
+  int32_t _offset = 0;
+
+  float next();
+
+ public:
+  ScaleDriverReplay() {}
+  ScaleDriverReplay(const float* trace, size_t size, size_t stride = 1,
+                    bool loop = false) {
+    setTrace(trace, size, stride, loop);
+  }
+  explicit ScaleDriverReplay(ReplaySource* source) { setSource(source); }
+
+  void setTrace(const float* trace, size_t size, size_t stride = 1,
+                bool loop = false);
+  void setSource(ReplaySource* source);
+  size_t getPosition() { return _pos; }
+  bool isDone() {
+    return _source ? _sourceDone : !_loop && _pos >= _size;
+  }
+
+  ScaleSensorType getType() override { return ScaleSensorType::ScaleReplay; }
+  const char* getName() override { return "Replay"; }
+
+  void begin(UnitIndex idx) override { _idx = idx; }
+  bool probe() override { return isConnected(); }
+  bool setup(int32_t offset) override;
+  void disconnect() override {}
+  bool isConnected() override {
+    return _source != 0 || (_trace != 0 && _size > 0);
+  }
+
+  // The trace is already in kg so calibration is a no-op, the factor is only
+  // used to create raw counts.
+  void setScaleFactor(float factor) override { _factor = factor; }
+  int32_t tare(int readCount) override { return _offset; }
+  float findFactor(float weight, int readCount) override { return _factor; }
+
+  float read(int readCount) override { return next(); }
+  int32_t readRaw(int readCount) override;
+  bool readSample(int32_t& value) override;
+};
+
+#endif  // SRC_SCALE_REPLAY_HPP_
+
+// EOF
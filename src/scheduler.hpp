@@ -0,0 +1,138 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_SCHEDULER_HPP_
+#define SRC_SCHEDULER_HPP_
+
+#include <Arduino.h>
+
+constexpr auto SCHEDULER_MAX_TASKS = 10;
+
+typedef void (*SchedulerFunc)();
+
+struct SchedulerTask {
+  const char* name;
+  SchedulerFunc func;
+  uint32_t period;    // ms
+  uint32_t deadline;  // ms, allowed delay after the task is due
+  uint8_t priority;   // 0 is the most urgent
+  uint32_t due;
+
+  uint32_t runs;
+  uint32_t misses;   // started later than the deadline
+  uint32_t skips;    // periods that was skipped since the task was too late
+  uint32_t late;     // ms, last start delay
+  uint32_t maxLate;  // ms
+  uint32_t exec;     // us, last execution time
+  uint32_t maxExec;  // us
+};
+
+// Cooperative scheduler for the periodic work in the main loop. Each call to
+// run() executes at most one task, the due task with the highest priority
+// (lowest value) and the oldest due time. The rest of loop() (web, wifi and
+// scale polling) is serviced between every task so one slow task only delays
+// the others by its own execution time. A task that falls more than one
+// period behind skips the missed periods instead of running several times in
+// a row.
+class Scheduler {
+ private:
+  SchedulerTask _tasks[SCHEDULER_MAX_TASKS];
+  int _count = 0;
+
+ public:
+  // Returns the task index or -1 if there is no room. A deadline of 0 uses
+  // the period.
+  int add(const char* name, SchedulerFunc func, uint32_t period,
+          uint8_t priority, uint32_t deadline = 0) {
+    if (_count >= SCHEDULER_MAX_TASKS) return -1;
+
+    SchedulerTask& t = _tasks[_count];
+    t = SchedulerTask();
+    t.name = name;
+    t.func = func;
+    t.period = period;
+    t.deadline = deadline ? deadline : period;
+    t.priority = priority;
+    return _count++;
+  }
+
+  // Each task is first due one period after now
+  void start(uint32_t now) {
+    for (int i = 0; i < _count; i++) _tasks[i].due = now + _tasks[i].period;
+  }
+
+  // Returns true if a task was executed
+  bool run(uint32_t now) {
+    int next = -1;
+
+    for (int i = 0; i < _count; i++) {
+      const SchedulerTask& t = _tasks[i];
+
+      if (static_cast<int32_t>(now - t.due) < 0) continue;
+
+      if (next < 0 || t.priority < _tasks[next].priority ||
+          (t.priority == _tasks[next].priority &&
+           static_cast<int32_t>(t.due - _tasks[next].due) < 0))
+        next = i;
+    }
+
+    if (next < 0) return false;
+
+    SchedulerTask& t = _tasks[next];
+    t.late = now - t.due;
+    if (t.late > t.maxLate) t.maxLate = t.late;
+    if (t.late > t.deadline) t.misses++;
+
+    uint32_t periods = t.late / t.period;
+    t.skips += periods;
+    t.due += (periods + 1) * t.period;
+
+    uint32_t start = micros();
+    t.func();
+    t.exec = micros() - start;
+    if (t.exec > t.maxExec) t.maxExec = t.exec;
+    t.runs++;
+    return true;
+  }
+
+  void clear() {
+    for (int i = 0; i < _count; i++) {
+      SchedulerTask& t = _tasks[i];
+      t.runs = t.misses = t.skips = t.maxLate = t.maxExec = 0;
+    }
+  }
+
+  int size() const { return _count; }
+  const SchedulerTask& get(int i) const { return _tasks[i]; }
+
+  // ms until the task is due, negative when it's late
+  int32_t getTimeToDue(int i, uint32_t now) const {
+    return static_cast<int32_t>(_tasks[i].due - now);
+  }
+};
+
+extern Scheduler myScheduler;
+
+#endif  // SRC_SCHEDULER_HPP_
+
+// EOF
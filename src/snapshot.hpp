@@ -0,0 +1,100 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_SNAPSHOT_HPP_
+#define SRC_SNAPSHOT_HPP_
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <cstring>
+
+// Lock free exchange of a value from one writer task to any number of reader
+// tasks (sequence lock). The writer never waits, a reader that overlaps with a
+// write retries until it gets a consistent copy. The value is stored as atomic
+// words so there is no data race even while the copy is torn, T must be
+// trivially copyable.
+template <typename T>
+class Snapshot {
+ private:
+  static constexpr size_t WORDS = (sizeof(T) + 3) / 4;
+
+  std::atomic<uint32_t> _sequence;
+  std::atomic<uint32_t> _data[WORDS];
+
+ public:
+  Snapshot() {
+    _sequence.store(0);
+    for (size_t i = 0; i < WORDS; i++) _data[i].store(0);
+  }
+
+  // Must only be called from one task
+  void write(const T& value) {
+    uint32_t buf[WORDS] = {0};
+    memcpy(&buf[0], &value, sizeof(T));
+
+    uint32_t seq = _sequence.load(std::memory_order_relaxed);
+    _sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t i = 0; i < WORDS; i++)
+      _data[i].store(buf[i], std::memory_order_relaxed);
+
+    _sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  // Returns false if nothing has been written yet
+  bool read(T& value) const {
+    uint32_t buf[WORDS];
+    uint32_t seq;
+
+    for (;;) {
+      seq = _sequence.load(std::memory_order_acquire);
+
+      // A write is in progress, give the writer a chance to finish in case it
+      // runs with a lower priority than the reader.
+      if (seq & 1) {
+        delay(1);
+        continue;
+      }
+
+      for (size_t i = 0; i < WORDS; i++)
+        buf[i] = _data[i].load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (_sequence.load(std::memory_order_relaxed) == seq) break;
+    }
+
+    memcpy(&value, &buf[0], sizeof(T));
+    return seq != 0;
+  }
+
+  // Number of writes so far
+  uint32_t getVersion() const {
+    return _sequence.load(std::memory_order_acquire) / 2;
+  }
+};
+
+#endif  // SRC_SNAPSHOT_HPP_
+
+// EOF
@@ -36,12 +36,17 @@ bool operator==(const TempReading& lhs, const TempReading& rhs);
 
 constexpr TempReading TEMP_READING_FAILED = {NAN, NAN, NAN};
 
+// A reading is done in steps so the caller never waits for the sensor,
+// request() starts a measurement and read() returns the result once
+// isReady() is true. Sensors that measure continuously use the defaults.
 class TempSensorBase {
  public:
   TempSensorBase() = default;
 
   virtual void setup() = 0;
   virtual bool hasSensor() = 0;
+  virtual void request() {}
+  virtual bool isReady() { return true; }
   virtual TempReading read() = 0;
 };
 
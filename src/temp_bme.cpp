@@ -45,6 +45,8 @@ void TempSensorBME::setup() {
   _hasSensor = false;
 }
 
+// The BME280 is used in normal mode where it measures continuously, read()
+// only fetches the latest result so request() and isReady() are not needed.
 TempReading TempSensorBME::read() {
   if (!_status) return TEMP_READING_FAILED;
 
@@ -42,6 +42,13 @@ void TempSensorDHT::setup() {
   }
 }
 
+// The DHT22 sends the result of the previous measurement during the transfer
+// (a few ms) so there is nothing to wait for. The transfer is done here and
+// read() uses the values the library keeps for 2 s.
+void TempSensorDHT::request() {
+  if (_dht) _dht->read(true);
+}
+
 TempReading TempSensorDHT::read() {
   if (!_dht) return TEMP_READING_FAILED;
 
@@ -38,6 +38,7 @@ class TempSensorDHT : public TempSensorBase {
 
   void setup() override;
   bool hasSensor() override { return _hasSensor; }
+  void request() override;
   TempReading read() override;
 };
 
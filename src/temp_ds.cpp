@@ -26,6 +26,10 @@ SOFTWARE.
 #include <temp_ds.hpp>
 #include <utils.hpp>
 
+// Conversion time at 12 bit resolution, with parasite power the sensor
+// can't report when it's done so the result is read after this time.
+constexpr auto TEMP_DS_CONVERSION_TIME = 750;  // ms
+
 TempSensorDS::~TempSensorDS() {
   if (_oneWire) delete _oneWire;
   if (_dallas) delete _dallas;
@@ -36,19 +40,35 @@ void TempSensorDS::setup() {
   _dallas = new DallasTemperature(_oneWire);
   _dallas->setResolution(12);
   _dallas->begin();
+  _dallas->setWaitForConversion(false);
   if (_dallas->getDS18Count())
     _hasSensor = true;
   else
     _hasSensor = false;
 }
 
+void TempSensorDS::request() {
+  if (!_dallas || !_dallas->getDS18Count()) return;
+
+  _dallas->requestTemperatures();  // Returns directly, the sensor converts
+  _requested = millis();
+}
+
+bool TempSensorDS::isReady() {
+  if (!_dallas || !_dallas->getDS18Count()) return true;
+
+  if (_dallas->isParasitePowerMode())
+    return millis() - _requested >= TEMP_DS_CONVERSION_TIME;
+
+  return _dallas->isConversionComplete();
+}
+
 TempReading TempSensorDS::read() {
   TempReading reading = TEMP_READING_FAILED;
 
   if (!_dallas) return reading;
 
   if (_dallas->getDS18Count()) {
-    _dallas->requestTemperatures();
     reading.temperature = _dallas->getTempCByIndex(0);
     reading.humidity = NAN;
     reading.pressure = NAN;
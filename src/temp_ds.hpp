@@ -34,6 +34,7 @@ class TempSensorDS : public TempSensorBase {
   OneWire* _oneWire = 0;
   DallasTemperature* _dallas = 0;
   bool _hasSensor = false;
+  uint32_t _requested = 0;
 
  public:
   TempSensorDS() {}
@@ -41,6 +42,8 @@ class TempSensorDS : public TempSensorBase {
 
   void setup() override;
   bool hasSensor() override { return _hasSensor; }
+  void request() override;
+  bool isReady() override;
   TempReading read() override;
 };
 
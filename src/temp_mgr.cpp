@@ -22,6 +22,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
  */
 #include <kegconfig.hpp>
+#include <perfstats.hpp>
 #include <temp_bme.hpp>
 #include <temp_dht.hpp>
 #include <temp_ds.hpp>
@@ -63,6 +64,9 @@ void TempSensorManager::setup() {
       return;
   }
 
+  _converting = false;
+  _requested = false;
+
   if (_sensor) {
     _sensor->setup();
   } else {
@@ -85,7 +89,54 @@ void TempSensorManager::reset() {
 void TempSensorManager::read() {
   if (!_sensor) return;
 
+  _sensor->request();
+  _requestMillis = millis();
+  _requested = true;
+
+  while (!_sensor->isReady() &&
+         millis() - _requestMillis < TEMP_CONVERSION_TIMEOUT)
+    delay(10);
+
   _last = _sensor->read();
+  _converting = false;
+}
+
+bool TempSensorManager::loop(uint32_t now) {
+  if (!_sensor) return false;
+
+  if (!_converting) {
+    if (_requested && now - _requestMillis < TEMP_READ_INTERVAL) return false;
+
+    PERF_BEGIN("temp-request");
+    _sensor->request();
+    PERF_END("temp-request");
+    _requestMillis = now;
+    _requested = true;
+    _converting = true;
+  }
+
+  return complete(now);
+}
+
+bool TempSensorManager::complete(uint32_t now) {
+  if (_sensor->isReady()) {
+    PERF_BEGIN("temp-read");
+    _last = _sensor->read();
+    PERF_END("temp-read");
+    _converting = false;
+    return true;
+  }
+
+  if (now - _requestMillis >= TEMP_CONVERSION_TIMEOUT) {
+    Log.warning(F("TEMP: No result from sensor within %d ms." CR),
+                TEMP_CONVERSION_TIMEOUT);
+    _last = TEMP_READING_FAILED;
+    _timeouts++;
+    _converting = false;
+    return true;
+  }
+
+  return false;
 }
 
 // EOF
@@ -27,10 +27,19 @@ SOFTWARE.
 #include <temp_base.hpp>
 #include <utils.hpp>
 
+constexpr auto TEMP_READ_INTERVAL = 10000;     // ms
+constexpr auto TEMP_CONVERSION_TIMEOUT = 2000;  // ms
+
 class TempSensorManager {
  private:
   std::unique_ptr<TempSensorBase> _sensor;
   TempReading _last = TEMP_READING_FAILED;
+  bool _converting = false;
+  bool _requested = false;
+  uint32_t _requestMillis = 0;
+  uint32_t _timeouts = 0;
+
+  bool complete(uint32_t now);
 
  public:
   TempSensorManager() {}
@@ -39,8 +48,19 @@ class TempSensorManager {
   TempSensorManager& operator=(const TempSensorManager&);
   void setup();
   void reset();
+
+  // Takes over the sensor without powering it up, used by the tests
+  void setSensor(TempSensorBase* sensor) { _sensor.reset(sensor); }
+
+  // Blocks until the sensor has a result, only used during startup
   void read();
 
+  // Starts a measurement every TEMP_READ_INTERVAL and picks up the result on
+  // a later call when the sensor is done, returns true when a new reading
+  // (or a failed one after a timeout) is available.
+  bool loop() { return loop(millis()); }
+  bool loop(uint32_t now);
+
   bool hasTemp() { return !isnan(_last.temperature); }
   bool hasHumidity() { return !isnan(_last.humidity); }
   bool hasPressure() { return !isnan(_last.pressure); }
@@ -53,6 +73,7 @@ class TempSensorManager {
 
   float getLastHumidity() { return _last.humidity; }
   float getLastPressure() { return _last.pressure; }
+  uint32_t getTimeouts() { return _timeouts; }
 };
 
 extern TempSensorManager myTemp;
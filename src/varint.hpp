@@ -0,0 +1,111 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_VARINT_HPP_
+#define SRC_VARINT_HPP_
+
+#include <Arduino.h>
+
+// Helpers for the compact binary formats (raw capture files and simulator
+// traces). Values are stored as deltas, zigzag encoded so small negative
+// numbers stay small, and written as LEB128 varints (7 bits per byte).
+
+constexpr auto VARINT_MAX_BYTES = 5;  // Max size of an encoded 32 bit value
+
+inline uint32_t zigzagEncode(int32_t v) {
+  return (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31);
+}
+
+inline int32_t zigzagDecode(uint32_t v) {
+  return static_cast<int32_t>(v >> 1) ^ -static_cast<int32_t>(v & 1);
+}
+
+// Writes the value to buf (at least VARINT_MAX_BYTES), returns bytes used.
+inline size_t varintEncode(uint32_t v, uint8_t* buf) {
+  size_t n = 0;
+
+  while (v >= 0x80) {
+    buf[n++] = static_cast<uint8_t>(v | 0x80);
+    v >>= 7;
+  }
+
+  buf[n++] = static_cast<uint8_t>(v);
+  return n;
+}
+
+// Streaming reader for varints stored in flash (PROGMEM) or RAM, only keeps the
+// current position so any size of data can be decoded.
+class VarintStream {
+ private:
+  const uint8_t* _data;
+  size_t _size;
+  size_t _pos = 0;
+  bool _progmem;
+
+  uint8_t get() {
+    return _progmem ? pgm_read_byte(&_data[_pos++]) : _data[_pos++];
+  }
+
+ public:
+  VarintStream(const uint8_t* data, size_t size, bool progmem = true)
+      : _data(data), _size(size), _progmem(progmem) {}
+
+  size_t getPosition() { return _pos; }
+  bool isEnd() { return _pos >= _size; }
+  void rewind() { _pos = 0; }
+
+  bool readByte(uint8_t& b) {
+    if (_pos >= _size) return false;
+
+    b = get();
+    return true;
+  }
+
+  bool read(uint32_t& v) {
+    v = 0;
+
+    for (int shift = 0; shift < VARINT_MAX_BYTES * 7; shift += 7) {
+      if (_pos >= _size) return false;
+
+      uint8_t b = get();
+      v |= static_cast<uint32_t>(b & 0x7f) << shift;
+
+      if (!(b & 0x80)) return true;
+    }
+
+    return false;  // Corrupt data, too many bytes
+  }
+
+  bool readSigned(int32_t& v) {
+    uint32_t u;
+
+    if (!read(u)) return false;
+
+    v = zigzagDecode(u);
+    return true;
+  }
+};
+
+#endif  // SRC_VARINT_HPP_
+
+// EOF
@@ -0,0 +1,152 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <kegconfig.hpp>
+#include <log.hpp>
+#include <temp_mgr.hpp>
+#include <webhook.hpp>
+
+Webhook::Webhook() {
+  _http.setReuse(true);
+  _http.setTimeout(WEBHOOK_TIMEOUT);
+  _secureClient.setInsecure();
+  _body[0] = 0;
+}
+
+bool Webhook::begin(const char* url) {
+  size_t len = WebhookFormat::originLength(url);
+
+  if (_origin.length() != len || strncmp(_origin.c_str(), url, len)) {
+    _http.end();
+    _client.stop();
+    _secureClient.stop();
+    _origin = url;
+    _origin.remove(len);
+  }
+
+  if (!strncmp(url, "https:", 6)) return _http.begin(_secureClient, url);
+
+  return _http.begin(_client, url);
+}
+
+void Webhook::addHeader(const char* header) {
+  char name[WEBHOOK_HEADER_SIZE], value[WEBHOOK_HEADER_SIZE];
+
+  if (!strlen(header)) return;
+
+  if (!WebhookFormat::parseHeader(header, &name[0], sizeof(name), &value[0],
+                                  sizeof(value))) {
+    Log.warning(F("PUSH: Skipping invalid webhook header %s." CR), header);
+    return;
+  }
+
+  _http.addHeader(&name[0], &value[0]);
+}
+
+PushResult Webhook::send(PushTarget target, const PushItem& item,
+                         const char* key) {
+  bool isPost = target == PushTarget::TargetHttpPost;
+  const char* url =
+      isPost ? myConfig.getTargetHttpPost() : myConfig.getTargetHttpGet();
+  const char* format =
+      isPost ? myConfig.getFormatHttpPost() : myConfig.getFormatHttpGet();
+
+  if (!strlen(url)) return PushResult::PushSent;
+  if (!strlen(format))
+    format = isPost ? WEBHOOK_POST_FORMAT : WEBHOOK_GET_FORMAT;
+
+  char tap[4], stable[16], pour[16], glasses[16], keg[16], temp[16], abv[16];
+  float tempC = myTemp.getLastTempC();
+
+  snprintf(&tap[0], sizeof(tap), "%d", static_cast<int>(item.idx) + 1);
+  snprintf(&stable[0], sizeof(stable), "%.3f", item.stableVol);
+  snprintf(&pour[0], sizeof(pour), "%.3f", item.pourVol);
+  snprintf(&glasses[0], sizeof(glasses), "%.1f", item.glasses);
+  snprintf(&keg[0], sizeof(keg), "%.3f", myConfig.getKegVolume(item.idx));
+  snprintf(&temp[0], sizeof(temp), "%.2f", isnan(tempC) ? 0 : tempC);
+  snprintf(&abv[0], sizeof(abv), "%.2f", myConfig.getBeerABV(item.idx));
+
+  const TemplateVar vars[] = {
+      {"${mdns}", myConfig.getMDNS()},
+      {"${id}", myConfig.getID()},
+      {"${event}", item.type == PushType::PushPour ? "pour" : "keg"},
+      {"${tap}", &tap[0]},
+      {"${stable-volume}", &stable[0]},
+      {"${pour-volume}", &pour[0]},
+      {"${glasses}", &glasses[0]},
+      {"${keg-volume}", &keg[0]},
+      {"${temp}", &temp[0]},
+      {"${beer-name}", myConfig.getBeerName(item.idx)},
+      {"${beer-abv}", &abv[0]},
+  };
+
+  WebhookEncoding enc =
+      isPost ? WebhookEncoding::WebhookJson : WebhookEncoding::WebhookUrl;
+  int count = sizeof(vars) / sizeof(vars[0]);
+
+  if (WebhookFormat::render(&_body[0], sizeof(_body), format, &vars[0], count,
+                            enc) < 0) {
+    Log.error(F("PUSH: Webhook format is too long [%d]." CR), item.idx);
+    return PushResult::PushRejected;
+  }
+
+  String targetUrl(url);
+  int code;
+
+  if (!isPost) targetUrl += &_body[0];
+
+  Log.notice(F("PUSH: Sending %s to webhook %s [%d]." CR),
+             isPost ? "POST" : "GET", url, item.idx);
+
+  if (!begin(targetUrl.c_str())) {
+    Log.error(F("PUSH: Invalid webhook url %s." CR), url);
+    return PushResult::PushRejected;
+  }
+
+  if (strlen(key)) _http.addHeader("Idempotency-Key", key);
+
+  if (isPost) {
+    _http.addHeader("Content-Type", "application/json");
+    addHeader(myConfig.getHeader1HttpPost());
+    addHeader(myConfig.getHeader2HttpPost());
+    code = _http.POST(reinterpret_cast<uint8_t*>(&_body[0]), strlen(_body));
+  } else {
+    addHeader(myConfig.getHeader1HttpGet());
+    addHeader(myConfig.getHeader2HttpGet());
+    code = _http.GET();
+  }
+
+  _http.end();
+
+  if (code >= 200 && code <= 299) return PushResult::PushSent;
+
+  Log.error(F("PUSH: Webhook returned %d." CR), code);
+
+  // Timeouts and rate limits are retried, other client errors are not
+  if (code >= 400 && code <= 499 && code != 408 && code != 429)
+    return PushResult::PushRejected;
+
+  return PushResult::PushFailed;
+}
+
+// EOF
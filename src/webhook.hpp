@@ -0,0 +1,81 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_WEBHOOK_HPP_
+#define SRC_WEBHOOK_HPP_
+
+#if defined(ESP8266)
+#include <ESP8266HTTPClient.h>
+#else
+#include <HTTPClient.h>
+#endif
+#include <WiFiClientSecure.h>
+
+#include <main.hpp>
+#include <pushqueue.hpp>
+#include <webhookformat.hpp>
+
+constexpr auto WEBHOOK_TIMEOUT = 5000;  // ms
+constexpr auto WEBHOOK_BODY_SIZE = 512;
+constexpr auto WEBHOOK_HEADER_SIZE = 120;
+
+// Default formats when none is configured, see Webhook for the keys
+constexpr auto WEBHOOK_POST_FORMAT =
+    "{\"name\":\"${mdns}\",\"id\":\"${id}\",\"event\":\"${event}\","
+    "\"tap\":${tap},\"volume\":${stable-volume},\"pour\":${pour-volume},"
+    "\"glasses\":${glasses},\"keg-volume\":${keg-volume},\"temp\":${temp},"
+    "\"beer\":\"${beer-name}\",\"abv\":${beer-abv}}";
+constexpr auto WEBHOOK_GET_FORMAT =
+    "name=${mdns}&event=${event}&tap=${tap}&volume=${stable-volume}"
+    "&pour=${pour-volume}&glasses=${glasses}";
+
+// Sends keg and pour updates to a user defined http target. The body (POST)
+// or query string (GET) is created from a format with these keys: ${mdns},
+// ${id}, ${event} (keg or pour), ${tap}, ${stable-volume}, ${pour-volume},
+// ${glasses}, ${keg-volume}, ${temp}, ${beer-name}, ${beer-abv}. The
+// connection is kept open between requests when the server allows it, and
+// closed when the next request goes to another host since the http client
+// would reuse it without checking the host.
+class Webhook {
+ private:
+  HTTPClient _http;
+  WiFiClient _client;
+  WiFiClientSecure _secureClient;
+  char _body[WEBHOOK_BODY_SIZE];
+  String _origin;  // Scheme, host and port of the open connection
+
+  bool begin(const char* url);
+  void addHeader(const char* header);
+
+ public:
+  Webhook();
+
+  // Sent when delivered or not configured, rejected when the update or the
+  // url is not accepted (4xx other than 408 and 429) and retrying won't help.
+  PushResult send(PushTarget target, const PushItem& item,
+                  const char* key = "");
+};
+
+#endif  // SRC_WEBHOOK_HPP_
+
+// EOF
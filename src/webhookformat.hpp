@@ -0,0 +1,155 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#ifndef SRC_WEBHOOKFORMAT_HPP_
+#define SRC_WEBHOOKFORMAT_HPP_
+
+#include <main.hpp>
+#include <mqtttemplate.hpp>
+
+enum WebhookEncoding { WebhookJson = 0, WebhookUrl = 1 };
+
+// Renders the webhook formats and parses the configured headers into buffers
+// owned by the caller. Values are escaped for where they end up, JSON strings
+// for POST and the query string for GET, so a beer name with a quote or an
+// ampersand can not break the request. Keys that are not known are kept as
+// text, like the templating engine does.
+class WebhookFormat {
+ private:
+  static bool append(char* out, size_t size, size_t& len, const char* s,
+                     size_t n) {
+    if (len + n >= size) return false;
+    memcpy(out + len, s, n);
+    len += n;
+    return true;
+  }
+
+  static bool isSpace(char c) { return c == ' ' || c == '\t'; }
+
+  // Copies the text between start and end without the surrounding spaces
+  static bool copyTrimmed(char* out, size_t size, const char* start,
+                          const char* end) {
+    while (start < end && isSpace(*start)) start++;
+    while (end > start && isSpace(*(end - 1))) end--;
+
+    size_t n = end - start;
+
+    if (n >= size) return false;
+
+    memcpy(out, start, n);
+    out[n] = 0;
+    return true;
+  }
+
+ public:
+  // Appends the value escaped, returns false if it did not fit
+  static bool escape(char* out, size_t size, size_t& len, const char* value,
+                     WebhookEncoding enc) {
+    static const char hex[] = "0123456789ABCDEF";
+
+    for (const char* s = value; *s; s++) {
+      uint8_t c = static_cast<uint8_t>(*s);
+      char buf[7];
+      size_t n = 1;
+
+      buf[0] = *s;
+
+      if (enc == WebhookEncoding::WebhookUrl) {
+        if (!isalnum(c) && c != '-' && c != '_' && c != '.' && c != '~') {
+          buf[0] = '%';
+          buf[1] = hex[c >> 4];
+          buf[2] = hex[c & 0xf];
+          n = 3;
+        }
+      } else if (c == '"' || c == '\\') {
+        buf[0] = '\\';
+        buf[1] = *s;
+        n = 2;
+      } else if (c < 0x20) {
+        n = snprintf(&buf[0], sizeof(buf), "\\u%04x", c);
+      }
+
+      if (!append(out, size, len, &buf[0], n)) return false;
+    }
+
+    return true;
+  }
+
+  // Returns the length of the output or -1 if it did not fit in the buffer
+  static int render(char* out, size_t size, const char* format,
+                    const TemplateVar* vars, int varCount,
+                    WebhookEncoding enc) {
+    size_t len = 0;
+
+    if (!size) return -1;
+
+    while (*format) {
+      const char* end =
+          *format == '$' && format[1] == '{' ? strchr(format, '}') : 0;
+      size_t n = end ? end - format + 1 : 1;
+      int i = 0;
+
+      while (end && i < varCount &&
+             (strlen(vars[i].key) != n || strncmp(format, vars[i].key, n)))
+        i++;
+
+      bool ok = end && i < varCount
+                    ? escape(out, size, len, vars[i].value, enc)
+                    : append(out, size, len, format, n);
+
+      if (!ok) {
+        out[0] = 0;
+        return -1;
+      }
+
+      format += n;
+    }
+
+    out[len] = 0;
+    return len;
+  }
+
+  // Length of the scheme, host and port at the start of the url
+  static size_t originLength(const char* url) {
+    const char* host = strstr(url, "://");
+
+    host = host ? host + 3 : url;
+    return host - url + strcspn(host, "/?#");
+  }
+
+  // Headers are configured as "Name: value", both parts are trimmed. Returns
+  // false if there is no name or a part does not fit.
+  static bool parseHeader(const char* header, char* name, size_t nameSize,
+                          char* value, size_t valueSize) {
+    const char* sep = strchr(header, ':');
+
+    if (!sep || !copyTrimmed(name, nameSize, header, sep) || !strlen(name))
+      return false;
+
+    return copyTrimmed(value, valueSize, sep + 1, sep + strlen(sep));
+  }
+};
+
+#endif  // SRC_WEBHOOKFORMAT_HPP_
+
+// EOF
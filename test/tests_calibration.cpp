@@ -0,0 +1,72 @@
+/*
+MIT License
+
+Copyright (c) 2022 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <calibration.hpp>
+
+test(calibration_table) {
+  CalibrationTable cal;
+
+  // Only the zero point, no conversion possible
+  assertEqual(cal.size(), 1);
+  assertEqual(cal.isActive(), false);
+  assertTrue(isnan(cal.toWeight(1000)));
+
+  // Points are kept sorted on raw value
+  assertTrue(cal.add(25000, 25.0));
+  assertTrue(cal.add(2000, 2.0));
+  assertEqual(cal.size(), 3);
+  assertEqual(cal.get(0).raw, 0);
+  assertEqual(cal.get(1).raw, 2000);
+  assertEqual(cal.get(2).raw, 25000);
+
+  // Interpolation within and extrapolation outside the table
+  assertNear(cal.toWeight(0), 0.0, 0.0001);
+  assertNear(cal.toWeight(1000), 1.0, 0.0001);
+  assertNear(cal.toWeight(2000), 2.0, 0.0001);
+  assertNear(cal.toWeight(13500), 13.5, 0.0001);
+  assertNear(cal.toWeight(30000), 30.0, 0.0001);
+  assertNear(cal.toWeight(-1000), -1.0, 0.0001);
+
+  // Same weight replaces the point, non linear segment above 2 kg
+  assertTrue(cal.add(25460, 25.0));
+  assertEqual(cal.size(), 3);
+  assertNear(cal.toWeight(25460), 25.0, 0.0001);
+  assertNear(cal.toWeight(13730), 13.5, 0.0001);
+  assertNear(cal.residual(2, 1000.0), -0.46, 0.0001);
+
+  // Invalid points and a full table
+  assertFalse(cal.add(0, 10.0));
+  assertFalse(cal.add(1000, 0));
+
+  for (int i = 3; i < CALIBRATION_MAX_POINTS; i++)
+    assertTrue(cal.add(i * 100000, i * 100.0));
+
+  assertEqual(cal.size(), CALIBRATION_MAX_POINTS);
+  assertFalse(cal.add(5000000, 5000.0));
+
+  cal.clear();
+  assertEqual(cal.size(), 1);
+}
+
+// EOF
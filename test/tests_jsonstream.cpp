@@ -0,0 +1,80 @@
+/*
+MIT License
+
+Copyright (c) 2022 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <StreamString.h>
+
+#include <jsonstream.hpp>
+
+test(jsonstream_object) {
+  StreamString out;
+  JsonStream json(out);
+
+  json.beginObject();
+  json.add("int", -5);
+  json.add("uint", static_cast<uint32_t>(7));
+  json.add("float", 1.5f, 2);
+  json.add("nan", static_cast<float>(NAN), 2);
+  json.add("bool", true);
+  json.add("text", "a\"b\\c");
+  json.beginArray("list");
+  json.beginObject();
+  json.add("raw", static_cast<int32_t>(1000));
+  json.endObject();
+  json.add(0, 3);
+  json.endArray();
+  json.endObject();
+
+  assertEqual(out.c_str(),
+              "{\"int\":-5,\"uint\":7,\"float\":1.50,\"nan\":null,"
+              "\"bool\":true,\"text\":\"a\\\"b\\\\c\","
+              "\"list\":[{\"raw\":1000},3]}");
+}
+
+test(jsonstream_empty) {
+  StreamString out;
+  JsonStream json(out);
+
+  json.beginObject();
+  json.beginArray("list");
+  json.endArray();
+  json.endObject();
+
+  assertEqual(out.c_str(), "{\"list\":[]}");
+}
+
+test(jsonstream_buffer) {
+  JsonBuffer<16> out;
+  JsonStream json(out);
+
+  json.beginObject();
+  json.add("a", 1);
+  json.endObject();
+  assertEqual(out.c_str(), "{\"a\":1}");
+
+  // Output that does not fit is dropped
+  json.add("long-key-name", 12345);
+  assertEqual(out.length(), static_cast<size_t>(15));
+}
+
+// EOF
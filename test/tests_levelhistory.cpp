@@ -0,0 +1,79 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <levelhistory.hpp>
+
+test(levelhistory_buckets) {
+  LevelHistory history;
+
+  assertEqual(history.tick(LEVEL_HISTORY_BUCKET * 3), 0);
+  assertTrue(isnan(history.get(LEVEL_HISTORY_POINTS - 1)));
+
+  assertEqual(history.add(1000, 19.0), 0);
+  assertEqual(history.add(2000, 18.5), 0);
+  assertEqual(history.add(1000 + LEVEL_HISTORY_BUCKET, 18.0), 1);
+  assertEqual(history.getBuckets(), static_cast<uint32_t>(1));
+  assertNear(history.get(LEVEL_HISTORY_POINTS - 1), 18.5, 0.001);
+  assertTrue(isnan(history.get(LEVEL_HISTORY_POINTS - 2)));
+
+  // Buckets without a stable level repeats the last one
+  assertEqual(history.tick(1000 + LEVEL_HISTORY_BUCKET * 4), 3);
+  assertNear(history.get(LEVEL_HISTORY_POINTS - 1), 18.0, 0.001);
+  assertNear(history.get(LEVEL_HISTORY_POINTS - 3), 18.0, 0.001);
+  assertNear(history.get(LEVEL_HISTORY_POINTS - 4), 18.5, 0.001);
+
+  // A gap longer than the history replaces all points
+  assertEqual(history.add(LEVEL_HISTORY_SPAN * 3, 10.0),
+              LEVEL_HISTORY_POINTS);
+  assertNear(history.get(0), 18.0, 0.001);
+  assertEqual(history.add(LEVEL_HISTORY_SPAN * 3 + LEVEL_HISTORY_BUCKET, 9.0),
+              1);
+  assertNear(history.get(LEVEL_HISTORY_POINTS - 1), 10.0, 0.001);
+}
+
+test(levelhistory_sparkline) {
+  LevelHistory history;
+  LevelSparkline spark;
+
+  history.add(0, 10.0);
+  history.tick(LEVEL_HISTORY_BUCKET);
+  assertEqual(spark.update(history, 20.0, 32), LEVEL_HISTORY_POINTS);
+  assertEqual(spark.getColumns()[LEVEL_HISTORY_POINTS - 1], 16);
+  assertEqual(spark.getColumns()[LEVEL_HISTORY_POINTS - 2],
+              LEVEL_SPARKLINE_EMPTY);
+  assertEqual(spark.update(history, 20.0, 32), 0);
+
+  // Only the new column is calculated, the rest are shifted
+  history.add(LEVEL_HISTORY_BUCKET + 1, 25.0);
+  history.tick(LEVEL_HISTORY_BUCKET * 2);
+  assertEqual(spark.update(history, 20.0, 32), 1);
+  assertEqual(spark.getColumns()[LEVEL_HISTORY_POINTS - 1], 32);
+  assertEqual(spark.getColumns()[LEVEL_HISTORY_POINTS - 2], 16);
+
+  // Changing the scale recalculates all columns
+  assertEqual(spark.update(history, 40.0, 32), LEVEL_HISTORY_POINTS);
+  assertEqual(spark.getColumns()[LEVEL_HISTORY_POINTS - 2], 8);
+}
+
+// EOF
@@ -0,0 +1,72 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <lineprotocol.hpp>
+
+test(lineprotocol_lines) {
+  char buf[200];
+  LineProtocol lp(&buf[0], sizeof(buf));
+
+  lp.beginLine("level");
+  lp.tag("host", "keg mon");
+  lp.tag("tap", "1");
+  lp.fieldInt("raw", -1234);
+  lp.field("kalman", 10.5, 2);
+  lp.field("stable", NAN);
+  assertTrue(lp.endLine(1700000000));
+
+  // No fields gives no line
+  lp.beginLine("temp");
+  lp.field("tempC", NAN);
+  assertFalse(lp.endLine());
+
+  assertEqual(lp.c_str(),
+              "level,host=keg\\ mon,tap=1 raw=-1234i,kalman=10.50 "
+              "1700000000000000000\n");
+  assertEqual(lp.getLines(), 1);
+}
+
+test(lineprotocol_overflow) {
+  char buf[40];
+  LineProtocol lp(&buf[0], sizeof(buf));
+
+  lp.beginLine("temp");
+  lp.field("t", 4.0, 1);
+  assertTrue(lp.endLine());
+
+  // Does not fit, the first line is kept
+  lp.beginLine("level");
+  lp.field("volume", 12.0);
+  lp.field("weight", 14.0);
+  assertFalse(lp.endLine());
+
+  assertEqual(lp.c_str(), "temp t=4.0\n");
+  assertEqual(lp.length(), static_cast<size_t>(11));
+
+  lp.clear();
+  assertEqual(lp.length(), static_cast<size_t>(0));
+  assertEqual(lp.getLines(), 0);
+}
+
+// EOF
@@ -0,0 +1,76 @@
+/*
+MIT License
+
+Copyright (c) 2022 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <looptiming.hpp>
+
+test(looptiming_interval) {
+  LoopTiming timing(2000);
+
+  // First tick only sets the start time
+  timing.tick(1000);
+  assertEqual(timing.getTicks(), static_cast<uint32_t>(0));
+
+  timing.tick(3005);  // 5 ms late
+  timing.tick(5100);  // 95 ms late
+  timing.tick(7400);  // 300 ms late, overrun
+
+  assertEqual(timing.getTicks(), static_cast<uint32_t>(3));
+  assertEqual(timing.getInterval(), static_cast<uint32_t>(2300));
+  assertEqual(timing.getMinInterval(), static_cast<uint32_t>(2005));
+  assertEqual(timing.getMaxInterval(), static_cast<uint32_t>(2300));
+  assertEqual(timing.getOverruns(), static_cast<uint32_t>(1));
+  assertEqual(timing.getBucket(0), static_cast<uint32_t>(1));  // <= 10 ms
+  assertEqual(timing.getBucket(3), static_cast<uint32_t>(1));  // <= 100 ms
+  assertEqual(timing.getBucket(5), static_cast<uint32_t>(1));  // <= 500 ms
+
+  timing.clear();
+  assertEqual(timing.getTicks(), static_cast<uint32_t>(0));
+  assertEqual(timing.getMinInterval(), static_cast<uint32_t>(0));
+}
+
+test(looptiming_phases) {
+  LoopTiming timing(2000);
+
+  timing.tick(0);
+  timing.recordPhase(LoopPhase::PhaseWeb, 100);
+  timing.recordPhase(LoopPhase::PhaseWeb, 150);
+  timing.recordPhase(LoopPhase::PhaseLevel, 40000);
+  timing.tick(2000);
+
+  // Phase times are summed over the tick
+  assertEqual(timing.getPhaseLast(LoopPhase::PhaseWeb),
+              static_cast<uint32_t>(250));
+  assertEqual(timing.getPhaseLast(LoopPhase::PhaseLevel),
+              static_cast<uint32_t>(40000));
+
+  timing.recordPhase(LoopPhase::PhaseLevel, 1000);
+  timing.tick(4000);
+  assertEqual(timing.getPhaseLast(LoopPhase::PhaseLevel),
+              static_cast<uint32_t>(1000));
+  assertEqual(timing.getPhaseMax(LoopPhase::PhaseLevel),
+              static_cast<uint32_t>(40000));
+  assertEqual(timing.getPhaseName(LoopPhase::PhaseDisplay), "display");
+}
+
+// EOF
@@ -0,0 +1,63 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <mqtttemplate.hpp>
+
+static const TemplateVar testVars[] = {{"${mdns}", "kegmon"}, {"${tap}", "1"}};
+static const TemplateSlot testSlots[] = {{"${volume}", 3}, {"${glasses}", 1}};
+
+test(mqtttemplate_render) {
+  MqttTemplate tpl;
+  char out[120];
+  const float values[] = {12.5, 31.0};
+
+  assertTrue(tpl.compile("kegmon/${mdns}_volume${tap}/state:${volume}|"
+                         "kegmon/${mdns}_volume${tap}/attr:"
+                         "{\"glasses\":${glasses}}|${unknown}",
+                         &testVars[0], 2, &testSlots[0], 2));
+
+  int len = tpl.render(&out[0], sizeof(out), &values[0]);
+  const char* expected =
+      "kegmon/kegmon_volume1/state:12.500|"
+      "kegmon/kegmon_volume1/attr:{\"glasses\":31.0}|${unknown}";
+  assertEqual(&out[0], expected);
+  assertEqual(len, static_cast<int>(strlen(expected)));
+}
+
+test(mqtttemplate_limits) {
+  MqttTemplate tpl;
+  char out[20];
+  const float values[] = {12.5};
+
+  assertTrue(tpl.compile("kegmon/${mdns}/state:${volume}|", &testVars[0], 2,
+                         &testSlots[0], 2));
+  assertEqual(tpl.render(&out[0], sizeof(out), &values[0]), -1);
+
+  // More dynamic values than segments
+  assertFalse(tpl.compile("${volume}${volume}${volume}${volume}${volume}",
+                          &testVars[0], 2, &testSlots[0], 2));
+  assertFalse(tpl.isCompiled());
+}
+
+// EOF
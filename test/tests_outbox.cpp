@@ -0,0 +1,161 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <outbox.hpp>
+
+static PushItem makeOutboxItem(uint32_t seq, uint8_t targets) {
+  PushItem item = {};
+  item.boot = 7;
+  item.seq = seq;
+  item.type = PushType::PushPour;
+  item.idx = UnitIndex::U2;
+  item.targets = targets;
+  item.stableVol = 9.5;
+  item.pourVol = 0.4;
+  item.glasses = 24;
+  item.attempts[PushTarget::TargetHttpPost] = 3;
+  return item;
+}
+
+static void resetOutbox(Outbox& outbox) {
+  LittleFS.begin();
+  outbox.clear();
+}
+
+test(outbox_record_format) {
+  uint8_t buf[OUTBOX_RECORD_SIZE];
+  PushItem item = makeOutboxItem(0x01020304, 0x05), read;
+
+  Outbox::encode(item, &buf[0]);
+  assertEqual(buf[0], 7);
+  assertEqual(buf[4], 0x04);
+  assertEqual(buf[7], 0x01);
+  assertEqual(buf[8], static_cast<uint8_t>(PushType::PushPour));
+  assertEqual(buf[9], static_cast<uint8_t>(UnitIndex::U2));
+  assertEqual(buf[10], 0x05);
+  assertEqual(buf[11], 0);
+  assertEqual(buf[24 + PushTarget::TargetHttpPost], 3);
+
+  Outbox::decode(&buf[0], read);
+  assertEqual(read.boot, item.boot);
+  assertEqual(read.seq, item.seq);
+  assertEqual(read.type, item.type);
+  assertEqual(read.idx, item.idx);
+  assertEqual(read.targets, item.targets);
+  assertNear(read.stableVol, item.stableVol, 0.001);
+  assertNear(read.pourVol, item.pourVol, 0.001);
+  assertNear(read.glasses, item.glasses, 0.001);
+  assertEqual(read.attempts[PushTarget::TargetHttpPost], 3);
+  assertTrue(read.persist);
+}
+
+test(outbox_append_full) {
+  Outbox outbox;
+  PushItem item;
+
+  resetOutbox(outbox);
+
+  for (int i = 0; i < OUTBOX_MAX_RECORDS + 2; i++)
+    assertTrue(outbox.append(makeOutboxItem(i, 0x01)));
+
+  // The two oldest updates are dropped to make room
+  assertEqual(outbox.size(), OUTBOX_MAX_RECORDS);
+  assertEqual(outbox.getDropped(), static_cast<uint32_t>(2));
+  assertTrue(outbox.peek(item));
+  assertEqual(item.seq, static_cast<uint32_t>(2));
+  assertTrue(outbox.get(OUTBOX_MAX_RECORDS - 1, item));
+  assertEqual(item.seq, static_cast<uint32_t>(OUTBOX_MAX_RECORDS + 1));
+
+  // A new instance reads the same records back from the file
+  Outbox reloaded;
+  assertEqual(reloaded.size(), OUTBOX_MAX_RECORDS);
+  assertTrue(reloaded.peek(item));
+  assertEqual(item.seq, static_cast<uint32_t>(2));
+  outbox.clear();
+}
+
+test(outbox_update_first) {
+  Outbox outbox;
+  PushItem item;
+
+  resetOutbox(outbox);
+  outbox.append(makeOutboxItem(1, 0x03));
+  outbox.append(makeOutboxItem(2, 0x02));
+
+  // A record stays while any target is left
+  assertTrue(outbox.peek(item));
+  item.targets = 0x02;
+  item.attempts[PushTarget::TargetHomeAssist] = 1;
+  assertTrue(outbox.updateFirst(item));
+  assertEqual(outbox.size(), 2);
+  assertFalse(outbox.hasTarget(PushTarget::TargetBrewspy));
+  assertTrue(outbox.peek(item));
+  assertEqual(item.attempts[PushTarget::TargetHomeAssist], 1);
+
+  // Done records at the head are removed
+  item.targets = 0;
+  assertTrue(outbox.updateFirst(item));
+  assertEqual(outbox.size(), 1);
+  assertTrue(outbox.peek(item));
+  assertEqual(item.seq, static_cast<uint32_t>(2));
+  outbox.clear();
+}
+
+test(outbox_pop) {
+  Outbox outbox;
+  PushItem item;
+
+  resetOutbox(outbox);
+  outbox.append(makeOutboxItem(1, 0x02));
+  outbox.append(makeOutboxItem(2, 0x01));
+  outbox.append(makeOutboxItem(3, 0x03));
+
+  // Each target finds its own oldest record
+  assertEqual(outbox.find(PushTarget::TargetBrewspy, item), 1);
+  assertEqual(item.seq, static_cast<uint32_t>(2));
+  assertEqual(outbox.find(PushTarget::TargetHttpGet, item), -1);
+
+  // Done records behind the head stay until the head reaches them
+  item.targets = 0;
+  assertTrue(outbox.update(1, item));
+  assertEqual(outbox.size(), 3);
+  assertEqual(outbox.find(PushTarget::TargetBrewspy, item), 2);
+
+  assertTrue(outbox.pop());
+  assertEqual(outbox.size(), 2);
+  assertEqual(outbox.find(PushTarget::TargetHomeAssist, item), 1);
+
+  // The head is kept in the file
+  Outbox reloaded;
+  assertEqual(reloaded.size(), 2);
+  assertTrue(reloaded.peek(item));
+  assertEqual(item.seq, static_cast<uint32_t>(2));
+
+  assertTrue(outbox.pop());
+  assertTrue(outbox.pop());
+  assertEqual(outbox.size(), 0);
+  assertFalse(outbox.pop());
+}
+
+// EOF
@@ -0,0 +1,99 @@
+/*
+MIT License
+
+Copyright (c) 2022 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <perfstats.hpp>
+
+test(perfstats_histogram) {
+  PerfStats perf;
+
+  perf.record("read", 50);
+  perf.record("read", 100);
+  perf.record("read", 101);
+  perf.record("read", 2000000);
+  perf.record("push", 7000);
+
+  assertEqual(perf.size(), 2);
+
+  const PerfMarker& m = perf.get(0);
+  assertEqual(m.name, "read");
+  assertEqual(m.count, static_cast<uint32_t>(4));
+  assertEqual(static_cast<uint32_t>(m.sum), static_cast<uint32_t>(2000251));
+  assertEqual(m.buckets[0], static_cast<uint32_t>(2));  // <= 100 us
+  assertEqual(m.buckets[1], static_cast<uint32_t>(1));  // <= 500 us
+  assertEqual(m.buckets[PERFSTATS_BUCKETS - 1], static_cast<uint32_t>(1));
+
+  assertEqual(perf.get(1).buckets[4], static_cast<uint32_t>(1));  // <= 10 ms
+
+  // Markers are kept but the values are reset
+  perf.clear();
+  assertEqual(perf.size(), 2);
+  assertEqual(perf.get(0).count, static_cast<uint32_t>(0));
+  assertEqual(perf.get(0).buckets[0], static_cast<uint32_t>(0));
+}
+
+test(perfstats_window) {
+  PerfStats perf;
+
+  assertEqual(perf.getSummary(0).samples, static_cast<uint32_t>(0));
+
+  for (uint32_t i = 1; i <= 100; i++) perf.record("loop", i * 10);
+
+  // Only the last samples are part of the window (690-1000 us with 32)
+  PerfSummary s = perf.getSummary(0);
+  assertEqual(s.samples, static_cast<uint32_t>(PERFSTATS_WINDOW));
+  assertEqual(s.min, static_cast<uint32_t>(1010 - PERFSTATS_WINDOW * 10));
+  assertEqual(s.max, static_cast<uint32_t>(1000));
+  assertEqual(s.mean, static_cast<uint32_t>(5 * (201 - PERFSTATS_WINDOW)));
+  assertEqual(s.p99, static_cast<uint32_t>(1000));
+
+  perf.record("loop", 5);
+  s = perf.getSummary(0);
+  assertEqual(s.min, static_cast<uint32_t>(5));
+  assertEqual(perf.get(0).count, static_cast<uint32_t>(101));
+}
+
+test(perfstats_ids) {
+  PerfStats perf;
+
+  int read = perf.find("read");
+  int push = perf.find("push");
+  assertEqual(read, 0);
+  assertEqual(push, 1);
+  assertEqual(perf.find("read"), read);
+
+  // Nested use of the same marker is measured as one sample
+  perf.begin(read);
+  perf.begin(read);
+  perf.end(read);
+  assertEqual(perf.get(read).count, static_cast<uint32_t>(0));
+  perf.end(read);
+  assertEqual(perf.get(read).count, static_cast<uint32_t>(1));
+
+  // End without begin and a full table are ignored
+  perf.end(push);
+  perf.end(-1);
+  assertEqual(perf.get(push).count, static_cast<uint32_t>(0));
+}
+
+// EOF
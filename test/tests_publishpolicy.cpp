@@ -0,0 +1,63 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <publishpolicy.hpp>
+
+test(publishpolicy_delta) {
+  PublishPolicy policy;
+  policy.setLimits(PolicyChannel::ChannelKeg1, {0.05, 0, 600000});
+
+  assertTrue(policy.offer(PolicyChannel::ChannelKeg1, 10.0, 1000));
+  assertFalse(policy.offer(PolicyChannel::ChannelKeg1, 10.02, 2000));
+  assertFalse(policy.offer(PolicyChannel::ChannelKeg1, 9.98, 3000));
+  assertTrue(policy.offer(PolicyChannel::ChannelKeg1, 9.6, 4000));
+  assertEqual(policy.getSuppressed(), static_cast<uint32_t>(2));
+
+  // Unchanged value is sent again after the heartbeat
+  assertFalse(policy.isDue(PolicyChannel::ChannelKeg1, 500000));
+  assertTrue(policy.isDue(PolicyChannel::ChannelKeg1, 604000));
+  assertTrue(policy.offer(PolicyChannel::ChannelKeg1, 9.6, 604000));
+}
+
+test(publishpolicy_coalesce) {
+  PublishPolicy policy;
+  policy.setLimits(PolicyChannel::ChannelTemp, {0.2, 60000, 0});
+
+  assertTrue(policy.offer(PolicyChannel::ChannelTemp, 4.0, 0));
+  assertFalse(policy.offer(PolicyChannel::ChannelTemp, 5.0, 10000));
+  assertFalse(policy.offer(PolicyChannel::ChannelTemp, 6.0, 20000));
+  assertTrue(policy.isPending(PolicyChannel::ChannelTemp));
+  assertEqual(policy.getCoalesced(), static_cast<uint32_t>(1));
+  assertFalse(policy.isDue(PolicyChannel::ChannelTemp, 50000));
+  assertTrue(policy.isDue(PolicyChannel::ChannelTemp, 60000));
+
+  // Going back to the published value cancels the waiting change
+  assertFalse(policy.offer(PolicyChannel::ChannelTemp, 4.1, 30000));
+  assertFalse(policy.isDue(PolicyChannel::ChannelTemp, 60000));
+
+  // No heartbeat configured
+  assertFalse(policy.isDue(PolicyChannel::ChannelTemp, 6000000));
+}
+
+// EOF
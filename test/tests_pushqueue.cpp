@@ -0,0 +1,149 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <pushqueue.hpp>
+
+static PushItem makePushItem(PushType type, UnitIndex idx, float vol) {
+  PushItem item = {};
+  item.type = type;
+  item.idx = idx;
+  item.targets = (1 << PushTarget::TargetBrewspy) |
+                 (1 << PushTarget::TargetHomeAssist);
+  item.pourVol = vol;
+  item.stableVol = vol;
+  return item;
+}
+
+test(pushqueue_coalesce) {
+  PushQueue queue;
+
+  // Pours are kept, newer keg levels replace the waiting one for the same tap
+  queue.add(makePushItem(PushType::PushPour, UnitIndex::U1, 0.3));
+  queue.add(makePushItem(PushType::PushPour, UnitIndex::U1, 0.4));
+  queue.add(makePushItem(PushType::PushKeg, UnitIndex::U1, 10));
+  queue.add(makePushItem(PushType::PushKeg, UnitIndex::U1, 9));
+  queue.add(makePushItem(PushType::PushKeg, UnitIndex::U2, 5));
+  assertEqual(queue.getDepth(), 4);
+
+  for (int i = 0; i < PUSHQUEUE_SIZE; i++)
+    queue.add(makePushItem(PushType::PushPour, UnitIndex::U2, 0.1));
+
+  assertEqual(queue.getDepth(), PUSHQUEUE_SIZE);
+  assertEqual(queue.getDropped(), static_cast<uint32_t>(4));
+}
+
+test(pushqueue_keg_after_pour) {
+  PushQueue queue;
+  PushType order[3];
+  int count = 0;
+
+  // The newer keg level includes the pour so it must be sent after it
+  queue.add(makePushItem(PushType::PushKeg, UnitIndex::U1, 10));
+  queue.add(makePushItem(PushType::PushPour, UnitIndex::U1, 0.4));
+  queue.add(makePushItem(PushType::PushKeg, UnitIndex::U1, 9.6));
+  assertEqual(queue.getDepth(), 2);
+
+  auto send = [&](PushTarget t, const PushItem& item) {
+    if (t == PushTarget::TargetBrewspy && count < 3) order[count++] = item.type;
+    return true;
+  };
+
+  queue.drain(0, send);
+  queue.drain(0, send);
+  assertEqual(count, 2);
+  assertEqual(order[0], PushType::PushPour);
+  assertEqual(order[1], PushType::PushKeg);
+  assertEqual(queue.getDepth(), 0);
+}
+
+test(pushqueue_backoff) {
+  PushQueue queue;
+  bool brewspyUp = false;
+  float sent = 0;
+
+  queue.setRateLimit(PushTarget::TargetHomeAssist, 1000);
+  queue.add(makePushItem(PushType::PushPour, UnitIndex::U1, 0.3));
+  queue.add(makePushItem(PushType::PushPour, UnitIndex::U1, 0.4));
+
+  auto send = [&](PushTarget t, const PushItem& item) {
+    if (t == PushTarget::TargetBrewspy) return brewspyUp;
+    sent = item.pourVol;
+    return true;
+  };
+
+  // Brewspy fails, mqtt gets the first pour
+  assertEqual(queue.drain(0, send), 2);
+  assertEqual(sent, 0.3f);
+  assertEqual(queue.getTarget(PushTarget::TargetBrewspy).failed,
+              static_cast<uint32_t>(1));
+
+  // Mqtt is rate limited and brewspy waits for the backoff
+  assertEqual(queue.drain(500, send), 0);
+  assertEqual(queue.drain(1000, send), 1);
+  assertEqual(sent, 0.4f);
+
+  // Second failure doubles the backoff
+  assertEqual(queue.drain(PUSHQUEUE_BACKOFF_MIN, send), 1);
+  assertEqual(queue.drain(PUSHQUEUE_BACKOFF_MIN * 3 - 1, send), 0);
+
+  brewspyUp = true;
+  assertEqual(queue.drain(PUSHQUEUE_BACKOFF_MIN * 3, send), 1);
+  assertEqual(queue.getDepth(), 1);
+  assertEqual(queue.drain(PUSHQUEUE_BACKOFF_MIN * 3, send), 1);
+  assertEqual(queue.getDepth(), 0);
+  assertEqual(queue.getTarget(PushTarget::TargetBrewspy).sent,
+              static_cast<uint32_t>(2));
+}
+
+test(pushqueue_rejected) {
+  PushQueue queue;
+  int given = 0;
+
+  queue.setRateLimit(PushTarget::TargetBrewspy, 1000);
+  queue.setRateLimit(PushTarget::TargetHomeAssist, 1000);
+  queue.add(makePushItem(PushType::PushPour, UnitIndex::U1, 0.3));
+  queue.add(makePushItem(PushType::PushPour, UnitIndex::U1, 0.4));
+
+  auto send = [&](PushTarget t, const PushItem&) {
+    return t == PushTarget::TargetBrewspy ? PushResult::PushRejected
+                                          : PushResult::PushSent;
+  };
+
+  // A rejected item is counted as failed but not retried or given up, the
+  // next one is sent after the rate limit instead of the backoff
+  assertEqual(queue.drain(0, send,
+                          [&](PushTarget, const PushItem&) { given++; }),
+              2);
+  assertEqual(queue.getDepth(), 1);
+  assertEqual(queue.drain(0, send), 0);
+  assertEqual(queue.drain(1000, send), 2);
+  assertEqual(queue.getDepth(), 0);
+  assertEqual(given, 0);
+  assertEqual(queue.getTarget(PushTarget::TargetBrewspy).failed,
+              static_cast<uint32_t>(2));
+  assertEqual(queue.getTarget(PushTarget::TargetBrewspy).dropped,
+              static_cast<uint32_t>(0));
+}
+
+// EOF
@@ -0,0 +1,82 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <scheduler.hpp>
+
+static int schedulerOrder[10];
+static int schedulerRuns = 0;
+
+static void schedulerTaskA() { schedulerOrder[schedulerRuns++] = 1; }
+static void schedulerTaskB() { schedulerOrder[schedulerRuns++] = 2; }
+
+test(scheduler_priority) {
+  Scheduler sched;
+  schedulerRuns = 0;
+
+  sched.add("b", schedulerTaskB, 1000, 1);
+  sched.add("a", schedulerTaskA, 1000, 0);
+  sched.start(0);
+
+  assertEqual(sched.getTimeToDue(0, 400), static_cast<int32_t>(600));
+  assertEqual(sched.getTimeToDue(0, 1100), static_cast<int32_t>(-100));
+  assertFalse(sched.run(999));
+
+  // Both are due, one task per run and the highest priority first
+  assertTrue(sched.run(1000));
+  assertTrue(sched.run(1001));
+  assertFalse(sched.run(1002));
+  assertEqual(schedulerRuns, 2);
+  assertEqual(schedulerOrder[0], 1);
+  assertEqual(schedulerOrder[1], 2);
+  assertEqual(sched.get(0).late, static_cast<uint32_t>(1));
+  assertEqual(sched.get(1).runs, static_cast<uint32_t>(1));
+}
+
+test(scheduler_deadline) {
+  Scheduler sched;
+  schedulerRuns = 0;
+
+  int i = sched.add("a", schedulerTaskA, 1000, 0, 100);
+  sched.start(0);
+
+  assertTrue(sched.run(1050));  // Within deadline
+  assertEqual(sched.get(i).misses, static_cast<uint32_t>(0));
+
+  assertTrue(sched.run(2200));  // Missed deadline
+  assertEqual(sched.get(i).misses, static_cast<uint32_t>(1));
+  assertEqual(sched.get(i).maxLate, static_cast<uint32_t>(200));
+
+  // Late by more than two periods, the missed periods are skipped and the
+  // task keeps its phase
+  assertTrue(sched.run(5500));
+  assertEqual(sched.get(i).skips, static_cast<uint32_t>(2));
+  assertFalse(sched.run(5999));
+  assertTrue(sched.run(6000));
+  assertEqual(sched.get(i).runs, static_cast<uint32_t>(4));
+
+  sched.clear();
+  assertEqual(sched.get(i).runs, static_cast<uint32_t>(0));
+}
+
+// EOF
@@ -0,0 +1,94 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <snapshot.hpp>
+
+#if !defined(ESP8266)
+#include <thread>
+#endif
+
+struct TestSnapshot {
+  uint32_t a;
+  float b;
+  uint8_t c;  // Not a multiple of 4 bytes
+  uint32_t d;
+};
+
+test(snapshot_read_write) {
+  Snapshot<TestSnapshot> snap;
+  TestSnapshot v = {1, 2.5, 3, 4};
+
+  assertFalse(snap.read(v));  // Nothing written yet
+  assertEqual(v.a, static_cast<uint32_t>(0));
+
+  v = {10, 1.5, 7, 20};
+  snap.write(v);
+  v = {};
+
+  assertTrue(snap.read(v));
+  assertEqual(v.a, static_cast<uint32_t>(10));
+  assertEqual(v.b, 1.5f);
+  assertEqual(v.c, static_cast<uint8_t>(7));
+  assertEqual(v.d, static_cast<uint32_t>(20));
+  assertEqual(snap.getVersion(), static_cast<uint32_t>(1));
+}
+
+#if !defined(ESP8266)
+// One writer and two readers, every value written has all fields derived from
+// the same counter so a torn read would show up as a mismatch.
+test(snapshot_threads) {
+  Snapshot<TestSnapshot> snap;
+  const uint32_t writes = 200000;
+  std::atomic<bool> torn(false);
+
+  auto reader = [&]() {
+    TestSnapshot v;
+    uint32_t last = 0;
+
+    while (last < writes) {
+      if (!snap.read(v)) continue;
+      if (v.d != v.a * 3 || v.c != static_cast<uint8_t>(v.a) ||
+          v.b != static_cast<float>(v.a & 0xffff) || v.a < last)
+        torn = true;
+      last = v.a;
+    }
+  };
+
+  std::thread r1(reader);
+  std::thread r2(reader);
+
+  for (uint32_t i = 1; i <= writes; i++) {
+    TestSnapshot v = {i, static_cast<float>(i & 0xffff),
+                      static_cast<uint8_t>(i), i * 3};
+    snap.write(v);
+  }
+
+  r1.join();
+  r2.join();
+  assertFalse(torn.load());
+  assertEqual(snap.getVersion(), writes);
+}
+#endif
+
+// EOF
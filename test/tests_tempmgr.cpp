@@ -0,0 +1,95 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <temp_mgr.hpp>
+
+// Sensor that is ready when the test says so
+class FakeTempSensor : public TempSensorBase {
+ public:
+  bool ready = false;
+  int requests = 0;
+  int reads = 0;
+
+  void setup() override {}
+  bool hasSensor() override { return true; }
+  void request() override { requests++; }
+  bool isReady() override { return ready; }
+  TempReading read() override {
+    reads++;
+    return {20.5, NAN, NAN};
+  }
+};
+
+test(tempmgr_request_ready) {
+  TempSensorManager mgr;
+  FakeTempSensor* sensor = new FakeTempSensor;
+
+  mgr.setSensor(sensor);
+
+  // The first call starts a measurement and does not wait for it
+  assertFalse(mgr.loop(1000));
+  assertEqual(sensor->requests, 1);
+  assertFalse(mgr.loop(1500));
+  assertEqual(sensor->reads, 0);
+  assertFalse(mgr.hasTemp());
+
+  sensor->ready = true;
+  assertTrue(mgr.loop(1600));
+  assertEqual(sensor->reads, 1);
+  assertNear(mgr.getLastTempC(), 20.5, 0.01);
+
+  // Next measurement after the interval
+  assertFalse(mgr.loop(1000 + TEMP_READ_INTERVAL - 1));
+  assertEqual(sensor->requests, 1);
+  assertTrue(mgr.loop(1000 + TEMP_READ_INTERVAL));
+  assertEqual(sensor->requests, 2);
+  assertEqual(sensor->reads, 2);
+}
+
+test(tempmgr_timeout) {
+  TempSensorManager mgr;
+  FakeTempSensor* sensor = new FakeTempSensor;
+
+  mgr.setSensor(sensor);
+  sensor->ready = true;
+  assertTrue(mgr.loop(0));
+  assertTrue(mgr.hasTemp());
+
+  // No result in time gives a failed reading
+  sensor->ready = false;
+  assertFalse(mgr.loop(TEMP_READ_INTERVAL));
+  assertFalse(mgr.loop(TEMP_READ_INTERVAL + TEMP_CONVERSION_TIMEOUT - 1));
+  assertTrue(mgr.loop(TEMP_READ_INTERVAL + TEMP_CONVERSION_TIMEOUT));
+  assertFalse(mgr.hasTemp());
+  assertEqual(mgr.getTimeouts(), static_cast<uint32_t>(1));
+  assertEqual(sensor->reads, 1);
+
+  // A new measurement is started after the interval
+  sensor->ready = true;
+  assertTrue(mgr.loop(TEMP_READ_INTERVAL * 2));
+  assertEqual(sensor->requests, 3);
+  assertTrue(mgr.hasTemp());
+}
+
+// EOF
@@ -0,0 +1,65 @@
+/*
+MIT License
+
+Copyright (c) 2022 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <varint.hpp>
+
+test(varint_zigzag) {
+  assertEqual(zigzagEncode(0), static_cast<uint32_t>(0));
+  assertEqual(zigzagEncode(-1), static_cast<uint32_t>(1));
+  assertEqual(zigzagEncode(1), static_cast<uint32_t>(2));
+  assertEqual(zigzagEncode(-2), static_cast<uint32_t>(3));
+  assertEqual(zigzagDecode(zigzagEncode(-8388608)),
+              static_cast<int32_t>(-8388608));
+  assertEqual(zigzagDecode(zigzagEncode(8388607)),
+              static_cast<int32_t>(8388607));
+}
+
+test(varint_stream) {
+  int32_t values[] = {0, 1, -1, 63, -64, 300, -70000, 8388607, -8388608};
+  uint8_t buf[sizeof(values) / sizeof(int32_t) * VARINT_MAX_BYTES];
+  size_t len = 0;
+
+  for (int32_t v : values) len += varintEncode(zigzagEncode(v), &buf[len]);
+
+  // Small values should only use one byte
+  assertEqual(varintEncode(zigzagEncode(-64), &buf[len]),
+              static_cast<size_t>(1));
+
+  VarintStream stream(&buf[0], len, false);
+  int32_t v;
+
+  for (int32_t expected : values) {
+    assertTrue(stream.readSigned(v));
+    assertEqual(v, expected);
+  }
+
+  assertTrue(stream.isEnd());
+  assertFalse(stream.readSigned(v));
+
+  stream.rewind();
+  assertTrue(stream.readSigned(v));
+  assertEqual(v, values[0]);
+}
+
+// EOF
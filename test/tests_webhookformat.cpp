@@ -0,0 +1,88 @@
+/*
+MIT License
+
+Copyright (c) 2021-23 Magnus
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+ */
+#include <AUnit.h>
+#include <webhookformat.hpp>
+
+static const TemplateVar webhookVars[] = {
+    {"${mdns}", "keg mon"}, {"${tap}", "1"}, {"${beer-name}", "Pale \"A&B\""}};
+
+test(webhookformat_render) {
+  char out[120];
+  const char* post = "{\"name\":\"${mdns}\",\"tap\":${tap},"
+                     "\"beer\":\"${beer-name}\",\"x\":\"${unknown}\"}";
+  const char* expected =
+      "{\"name\":\"keg mon\",\"tap\":1,"
+      "\"beer\":\"Pale \\\"A&B\\\"\",\"x\":\"${unknown}\"}";
+
+  int len = WebhookFormat::render(&out[0], sizeof(out), post, &webhookVars[0],
+                                  3, WebhookEncoding::WebhookJson);
+  assertEqual(&out[0], expected);
+  assertEqual(len, static_cast<int>(strlen(expected)));
+
+  len = WebhookFormat::render(&out[0], sizeof(out),
+                              "?name=${mdns}&tap=${tap}&beer=${beer-name}",
+                              &webhookVars[0], 3, WebhookEncoding::WebhookUrl);
+  assertEqual(&out[0], "?name=keg%20mon&tap=1&beer=Pale%20%22A%26B%22");
+
+  // Does not fit
+  assertEqual(WebhookFormat::render(&out[0], 10, post, &webhookVars[0], 3,
+                                    WebhookEncoding::WebhookJson),
+              -1);
+}
+
+test(webhookformat_header) {
+  char name[20], value[20];
+
+  assertTrue(WebhookFormat::parseHeader(" X-Token :  abc def ", &name[0],
+                                        sizeof(name), &value[0],
+                                        sizeof(value)));
+  assertEqual(&name[0], "X-Token");
+  assertEqual(&value[0], "abc def");
+
+  assertTrue(WebhookFormat::parseHeader("Authorization:Bearer a:b", &name[0],
+                                        sizeof(name), &value[0],
+                                        sizeof(value)));
+  assertEqual(&name[0], "Authorization");
+  assertEqual(&value[0], "Bearer a:b");
+
+  assertFalse(WebhookFormat::parseHeader("no separator", &name[0],
+                                         sizeof(name), &value[0],
+                                         sizeof(value)));
+  assertFalse(WebhookFormat::parseHeader("  : value", &name[0], sizeof(name),
+                                         &value[0], sizeof(value)));
+  assertFalse(WebhookFormat::parseHeader("Name: this value is too long",
+                                         &name[0], sizeof(name), &value[0],
+                                         sizeof(value)));
+}
+
+test(webhookformat_origin) {
+  assertEqual(WebhookFormat::originLength("http://host:8080/path?a=1"),
+              strlen("http://host:8080"));
+  assertEqual(WebhookFormat::originLength("https://host"),
+              strlen("https://host"));
+  assertEqual(WebhookFormat::originLength("http://host?a=b/c"),
+              strlen("http://host"));
+}
+
+// EOF